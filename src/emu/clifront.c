@@ -43,15 +43,18 @@
 #include "jedparse.h"
 #include "audit.h"
 #include "info.h"
+#include "infocache.h"
 #include "unzip.h"
 #include "un7z.h"
 #include "validity.h"
 #include "sound/samples.h"
 #include "clifront.h"
 #include "xmlfile.h"
+#include "png.h"
 
 #include <new>
 #include <ctype.h>
+#include <zlib.h>
 
 
 //**************************************************************************
@@ -89,6 +92,17 @@ const options_entry cli_options::s_option_entries[] =
 	{ CLICOMMAND_LISTMEDIA ";lm",       "0",       OPTION_COMMAND,    "list available media for the system" },
 	{ CLICOMMAND_LISTSOFTWARE ";lsoft", "0",       OPTION_COMMAND,    "list known software for the system" },
 	{ CLICOMMAND_GETSOFTLIST ";glist",  "0",       OPTION_COMMAND,    "retrieve software list by name" },
+
+	/* testing commands */
+	{ NULL,                            NULL,       OPTION_HEADER,     "TESTING COMMANDS" },
+	{ CLICOMMAND_REGRESS,               "0",       OPTION_COMMAND,    "run each matching system headless for -seconds_to_run in parallel processes and report the results" },
+
+	/* regression runner options */
+	{ NULL,                            NULL,       OPTION_HEADER,     "REGRESSION RUNNER OPTIONS" },
+	{ CLIOPTION_REGRESS_DIRECTORY,      "regress", OPTION_STRING,     "directory for the report, logs and final snapshots of -regress" },
+	{ CLIOPTION_REGRESS_JOBS,           "4",       OPTION_INTEGER,    "number of systems -regress runs at once" },
+	{ CLIOPTION_REGRESS_TIMEOUT,        "600",     OPTION_INTEGER,    "real seconds after which -regress kills a system that has not finished; 0 means never" },
+	{ CLIOPTION_REGRESS_ARGS,           NULL,      OPTION_STRING,     "extra space-separated options passed to every system run by -regress" },
 	{ NULL }
 };
 
@@ -233,9 +247,10 @@ int cli_frontend::execute(int argc, char **argv)
 		if (option_errors)
 			printf("Error in command line:\n%s\n", option_errors.trimspace().cstr());
 
-		// determine the base name of the EXE
+		// determine the base name of the EXE; keep the full path for spawning copies of ourself
 		astring exename;
 		core_filename_extract_base(exename, argv[0], true);
+		m_exepath.cpy(argv[0]);
 
 		// if we have a command, execute that
 		if (*(m_options.command()) != 0)
@@ -490,54 +505,78 @@ void cli_frontend::listroms(const char *gamename)
 	if (drivlist.count() == 0)
 		throw emu_fatalerror(MAMERR_NO_SUCH_GAME, "No matching games found for '%s'", gamename);
 
+	// open the cache and queue up the configs it doesn't cover
+	info_cache cache(drivlist, "roms");
+	cache.prefetch();
+
 	// iterate through matches
-	astring tempstr;
+	astring text;
 	bool first = true;
 	while (drivlist.next())
 	{
-		// print a header
+		// print a separator
 		if (!first)
 			mame_printf_info("\n");
 		first = false;
-		mame_printf_info("ROMs required for driver \"%s\".\n"
-				"Name                    Size Checksum\n", drivlist.driver().name);
 
-		// iterate through roms
-		device_iterator deviter(drivlist.config().root_device());
-		for (device_t *device = deviter.first(); device != NULL; device = deviter.next())
-			for (const rom_entry *region = rom_first_region(*device); region; region = rom_next_region(region))
-				for (const rom_entry *rom = rom_first_file(region); rom; rom = rom_next_file(rom))
-				{
-					// accumulate the total length of all chunks
-					int length = -1;
-					if (ROMREGION_ISROMDATA(region))
-						length = rom_file_size(rom);
-
-					// start with the name
-					const char *name = ROM_GETNAME(rom);
-					mame_printf_info("%-20s ", name);
-
-					// output the length next
-					if (length >= 0)
-						mame_printf_info("%7d", length);
-					else
-						mame_printf_info("       ");
-
-					// output the hash data
-					hash_collection hashes(ROM_GETHASHDATA(rom));
-					if (!hashes.flag(hash_collection::FLAG_NO_DUMP))
-					{
-						if (hashes.flag(hash_collection::FLAG_BAD_DUMP))
-							mame_printf_info(" BAD");
-						mame_printf_info(" %s", hashes.macro_string(tempstr));
-					}
-					else
-						mame_printf_info(" NO GOOD DUMP KNOWN");
+		// format the ROMs unless we have them already
+		if (!cache.find_driver(text))
+		{
+			format_roms(drivlist, text);
+			cache.add_driver(text);
+		}
+		mame_printf_info("%s", text.cstr());
+	}
+}
+
+
+//-------------------------------------------------
+//  format_roms - format the list of ROMs for the
+//  current driver
+//-------------------------------------------------
+
+void cli_frontend::format_roms(driver_enumerator &drivlist, astring &text)
+{
+	// print a header
+	text.printf("ROMs required for driver \"%s\".\n"
+			"Name                    Size Checksum\n", drivlist.driver().name);
+
+	// iterate through roms
+	astring tempstr;
+	device_iterator deviter(drivlist.config().root_device());
+	for (device_t *device = deviter.first(); device != NULL; device = deviter.next())
+		for (const rom_entry *region = rom_first_region(*device); region; region = rom_next_region(region))
+			for (const rom_entry *rom = rom_first_file(region); rom; rom = rom_next_file(rom))
+			{
+				// accumulate the total length of all chunks
+				int length = -1;
+				if (ROMREGION_ISROMDATA(region))
+					length = rom_file_size(rom);
+
+				// start with the name
+				const char *name = ROM_GETNAME(rom);
+				text.catprintf("%-20s ", name);
+
+				// output the length next
+				if (length >= 0)
+					text.catprintf("%7d", length);
+				else
+					text.cat("       ");
 
-					// end with a CR
-					mame_printf_info("\n");
+				// output the hash data
+				hash_collection hashes(ROM_GETHASHDATA(rom));
+				if (!hashes.flag(hash_collection::FLAG_NO_DUMP))
+				{
+					if (hashes.flag(hash_collection::FLAG_BAD_DUMP))
+						text.cat(" BAD");
+					text.catprintf(" %s", hashes.macro_string(tempstr));
 				}
-	}
+				else
+					text.cat(" NO GOOD DUMP KNOWN");
+
+				// end with a CR
+				text.cat("\n");
+			}
 }
 
 
@@ -591,34 +630,58 @@ void cli_frontend::listdevices(const char *gamename)
 	if (drivlist.count() == 0)
 		throw emu_fatalerror(MAMERR_NO_SUCH_GAME, "No matching games found for '%s'", gamename);
 
-	// iterate over drivers, looking for SAMPLES devices
+	// open the cache and queue up the configs it doesn't cover
+	info_cache cache(drivlist, "devices");
+	cache.prefetch();
+
+	// iterate over drivers
+	astring text;
 	bool first = true;
 	while (drivlist.next())
 	{
-		// print a header
+		// print a separator
 		if (!first)
 			printf("\n");
 		first = false;
-		printf("Driver %s (%s):\n", drivlist.driver().name, drivlist.driver().description);
 
-		// iterate through devices
-		device_iterator iter(drivlist.config().root_device());
-		for (const device_t *device = iter.first(); device != NULL; device = iter.next())
+		// format the devices unless we have them already
+		if (!cache.find_driver(text))
 		{
-			printf("   %s ('%s')", device->name(), device->tag());
-
-			UINT32 clock = device->clock();
-			if (clock >= 1000000000)
-				printf(" @ %d.%02d GHz\n", clock / 1000000000, (clock / 10000000) % 100);
-			else if (clock >= 1000000)
-				printf(" @ %d.%02d MHz\n", clock / 1000000, (clock / 10000) % 100);
-			else if (clock >= 1000)
-				printf(" @ %d.%02d kHz\n", clock / 1000, (clock / 10) % 100);
-			else if (clock > 0)
-				printf(" @ %d Hz\n", clock);
-			else
-				printf("\n");
+			format_devices(drivlist, text);
+			cache.add_driver(text);
 		}
+		fputs(text, stdout);
+	}
+}
+
+
+//-------------------------------------------------
+//  format_devices - format the list of devices
+//  for the current driver
+//-------------------------------------------------
+
+void cli_frontend::format_devices(driver_enumerator &drivlist, astring &text)
+{
+	// print a header
+	text.printf("Driver %s (%s):\n", drivlist.driver().name, drivlist.driver().description);
+
+	// iterate through devices
+	device_iterator iter(drivlist.config().root_device());
+	for (const device_t *device = iter.first(); device != NULL; device = iter.next())
+	{
+		text.catprintf("   %s ('%s')", device->name(), device->tag());
+
+		UINT32 clock = device->clock();
+		if (clock >= 1000000000)
+			text.catprintf(" @ %d.%02d GHz\n", clock / 1000000000, (clock / 10000000) % 100);
+		else if (clock >= 1000000)
+			text.catprintf(" @ %d.%02d MHz\n", clock / 1000000, (clock / 10000) % 100);
+		else if (clock >= 1000)
+			text.catprintf(" @ %d.%02d kHz\n", clock / 1000, (clock / 10) % 100);
+		else if (clock > 0)
+			text.catprintf(" @ %d Hz\n", clock);
+		else
+			text.cat("\n");
 	}
 }
 
@@ -635,47 +698,69 @@ void cli_frontend::listslots(const char *gamename)
 	if (drivlist.count() == 0)
 		throw emu_fatalerror(MAMERR_NO_SUCH_GAME, "No matching games found for '%s'", gamename);
 
+	// open the cache and queue up the configs it doesn't cover
+	info_cache cache(drivlist, "slots");
+	cache.prefetch();
+
 	// print header
 	printf(" SYSTEM      SLOT NAME    SLOT OPTIONS    SLOT DEVICE NAME     \n");
 	printf("----------  -----------  --------------  ----------------------\n");
 
 	// iterate over drivers
+	astring text;
 	while (drivlist.next())
 	{
-		// iterate
-		slot_interface_iterator iter(drivlist.config().root_device());
-		bool first = true;
-		for (const device_slot_interface *slot = iter.first(); slot != NULL; slot = iter.next())
+		if (!cache.find_driver(text))
 		{
-			if (slot->fixed()) continue;
-			// output the line, up to the list of extensions
-			printf("%-13s%-10s   ", first ? drivlist.driver().name : "", slot->device().tag()+1);
+			format_slots(drivlist, text);
+			cache.add_driver(text);
+		}
+		fputs(text, stdout);
+	}
+}
 
-			// get the options and print them
-			const slot_interface* intf = slot->get_slot_interfaces();
-			for (int i = 0; intf && intf[i].name != NULL; i++)
+
+//-------------------------------------------------
+//  format_slots - format the list of slots for
+//  the current driver
+//-------------------------------------------------
+
+void cli_frontend::format_slots(driver_enumerator &drivlist, astring &text)
+{
+	// iterate
+	text.reset();
+	slot_interface_iterator iter(drivlist.config().root_device());
+	bool first = true;
+	for (const device_slot_interface *slot = iter.first(); slot != NULL; slot = iter.next())
+	{
+		if (slot->fixed()) continue;
+		// output the line, up to the list of extensions
+		text.catprintf("%-13s%-10s   ", first ? drivlist.driver().name : "", slot->device().tag()+1);
+
+		// get the options and print them
+		const slot_interface* intf = slot->get_slot_interfaces();
+		for (int i = 0; intf && intf[i].name != NULL; i++)
+		{
+			if (!intf[i].internal)
 			{
-				if (!intf[i].internal)
-				{
-					device_t *dev = (*intf[i].devtype)(drivlist.config(), "dummy", &drivlist.config().root_device(), 0);
-					dev->config_complete();
-					if (i==0) {
-						printf("%-15s %s\n", intf[i].name,dev->name());
-					} else {
-						printf("%-23s   %-15s %s\n", "",intf[i].name,dev->name());
-					}
-					global_free(dev);
+				device_t *dev = (*intf[i].devtype)(drivlist.config(), "dummy", &drivlist.config().root_device(), 0);
+				dev->config_complete();
+				if (i==0) {
+					text.catprintf("%-15s %s\n", intf[i].name,dev->name());
+				} else {
+					text.catprintf("%-23s   %-15s %s\n", "",intf[i].name,dev->name());
 				}
+				global_free(dev);
 			}
-			// end the line
-			printf("\n");
-			first = false;
 		}
-
-		// if we didn't get any at all, just print a none line
-		if (first)
-			printf("%-13s(none)\n", drivlist.driver().name);
+		// end the line
+		text.cat("\n");
+		first = false;
 	}
+
+	// if we didn't get any at all, just print a none line
+	if (first)
+		text.catprintf("%-13s(none)\n", drivlist.driver().name);
 }
 
 
@@ -691,44 +776,66 @@ void cli_frontend::listmedia(const char *gamename)
 	if (drivlist.count() == 0)
 		throw emu_fatalerror(MAMERR_NO_SUCH_GAME, "No matching games found for '%s'", gamename);
 
+	// open the cache and queue up the configs it doesn't cover
+	info_cache cache(drivlist, "media");
+	cache.prefetch();
+
 	// print header
 	printf(" SYSTEM      MEDIA NAME (brief)   IMAGE FILE EXTENSIONS SUPPORTED     \n");
 	printf("----------  --------------------  ------------------------------------\n");
 
 	// iterate over drivers
+	astring text;
 	while (drivlist.next())
 	{
-		// iterate
-		image_interface_iterator iter(drivlist.config().root_device());
-		bool first = true;
-		for (const device_image_interface *imagedev = iter.first(); imagedev != NULL; imagedev = iter.next())
+		if (!cache.find_driver(text))
 		{
-			// extract the shortname with parentheses
-			astring paren_shortname;
-			paren_shortname.format("(%s)", imagedev->brief_instance_name());
+			format_media(drivlist, text);
+			cache.add_driver(text);
+		}
+		fputs(text, stdout);
+	}
+}
 
-			// output the line, up to the list of extensions
-			printf("%-13s%-12s%-8s   ", first ? drivlist.driver().name : "", imagedev->instance_name(), paren_shortname.cstr());
 
-			// get the extensions and print them
-			astring extensions(imagedev->file_extensions());
-			for (int start = 0, end = extensions.chr(0, ','); ; start = end + 1, end = extensions.chr(start, ','))
-			{
-				astring curext(extensions, start, (end == -1) ? extensions.len() - start : end - start);
-				printf(".%-5s", curext.cstr());
-				if (end == -1)
-					break;
-			}
+//-------------------------------------------------
+//  format_media - format the list of image
+//  devices for the current driver
+//-------------------------------------------------
 
-			// end the line
-			printf("\n");
-			first = false;
+void cli_frontend::format_media(driver_enumerator &drivlist, astring &text)
+{
+	// iterate
+	text.reset();
+	image_interface_iterator iter(drivlist.config().root_device());
+	bool first = true;
+	for (const device_image_interface *imagedev = iter.first(); imagedev != NULL; imagedev = iter.next())
+	{
+		// extract the shortname with parentheses
+		astring paren_shortname;
+		paren_shortname.format("(%s)", imagedev->brief_instance_name());
+
+		// output the line, up to the list of extensions
+		text.catprintf("%-13s%-12s%-8s   ", first ? drivlist.driver().name : "", imagedev->instance_name(), paren_shortname.cstr());
+
+		// get the extensions and print them
+		astring extensions(imagedev->file_extensions());
+		for (int start = 0, end = extensions.chr(0, ','); ; start = end + 1, end = extensions.chr(start, ','))
+		{
+			astring curext(extensions, start, (end == -1) ? extensions.len() - start : end - start);
+			text.catprintf(".%-5s", curext.cstr());
+			if (end == -1)
+				break;
 		}
 
-		// if we didn't get any at all, just print a none line
-		if (first)
-			printf("%-13s(none)\n", drivlist.driver().name);
+		// end the line
+		text.cat("\n");
+		first = false;
 	}
+
+	// if we didn't get any at all, just print a none line
+	if (first)
+		text.catprintf("%-13s(none)\n", drivlist.driver().name);
 }
 
 
@@ -1336,6 +1443,22 @@ void cli_frontend::romident(const char *filename)
 }
 
 
+//-------------------------------------------------
+//  regress - run the matching systems headless
+//  in parallel and write a report
+//-------------------------------------------------
+
+void cli_frontend::regress(const char *gamename)
+{
+	regression_runner runner(m_options, m_exepath);
+
+	// return a failure code if anything failed, so scripts can tell
+	int failures = runner.run(gamename);
+	if (failures != 0)
+		throw emu_fatalerror(MAMERR_FATALERROR, "%d system%s failed; see %s" PATH_SEPARATOR "report.txt", failures, (failures == 1) ? "" : "s", m_options.regress_directory());
+}
+
+
 //-------------------------------------------------
 //  execute_commands - execute various frontend
 //  commands
@@ -1419,6 +1542,7 @@ void cli_frontend::execute_commands(const char *exename)
 		{ CLICOMMAND_LISTSOFTWARE,  &cli_frontend::listsoftware },
 		{ CLICOMMAND_ROMIDENT,		&cli_frontend::romident },
 		{ CLICOMMAND_GETSOFTLIST,   &cli_frontend::getsoftlist },
+		{ CLICOMMAND_REGRESS,		&cli_frontend::regress },
 	};
 
 	// find the command
@@ -1768,3 +1892,304 @@ int media_identifier::find_by_hash(const hash_collection &hashes, int length)
 
 	return found;
 }
+
+
+
+//**************************************************************************
+//  REGRESSION RUNNER
+//**************************************************************************
+
+//-------------------------------------------------
+//  regression_runner - constructor
+//-------------------------------------------------
+
+regression_runner::regression_runner(cli_options &options, const char *exepath)
+	: m_options(options),
+	  m_exepath(exepath),
+	  m_drivlist(options),
+	  m_report(options.regress_directory(), OPEN_FLAG_READ | OPEN_FLAG_WRITE),
+	  m_failures(0)
+{
+}
+
+
+//-------------------------------------------------
+//  ~regression_runner - destructor
+//-------------------------------------------------
+
+regression_runner::~regression_runner()
+{
+}
+
+
+//-------------------------------------------------
+//  run - run every matching system and return
+//  the number that failed
+//-------------------------------------------------
+
+int regression_runner::run(const char *gamename)
+{
+	// every system runs for a fixed emulated time, which also makes it save a final snapshot
+	if (m_options.seconds_to_run() == 0)
+		throw emu_fatalerror(MAMERR_INVALID_CONFIG, "-%s requires -%s", CLICOMMAND_REGRESS, OPTION_SECONDS_TO_RUN);
+
+	// determine which systems to run; skip the ones that cannot run on their own
+	m_drivlist.filter(gamename);
+	if (m_drivlist.count() == 0)
+		throw emu_fatalerror(MAMERR_NO_SUCH_GAME, "No matching systems found for '%s'", gamename);
+	for (int index = 0; index < driver_list::total(); index++)
+		if (m_drivlist.included(index) && ((driver_list::driver(index).flags & (GAME_IS_BIOS_ROOT | GAME_NO_STANDALONE)) != 0 || strcmp(driver_list::driver(index).name, "___empty") == 0))
+			m_drivlist.exclude(index);
+
+	// anything already in the report is left over from an interrupted run, so skip it
+	int total = m_drivlist.count();
+	load_report();
+	if (m_drivlist.count() < total)
+		mame_printf_info("Resuming: %d of %d systems already in the report\n", total - m_drivlist.count(), total);
+
+	// one slot per process we run at once
+	int jobs = MAX(m_options.regress_jobs(), 1);
+	dynamic_array<job> slots(jobs);
+	for (int slotnum = 0; slotnum < jobs; slotnum++)
+		slots[slotnum].m_process = NULL;
+
+	osd_ticks_t timeout = osd_ticks_per_second() * m_options.regress_timeout();
+	bool more = true;
+	int running = 0;
+	while (more || running > 0)
+	{
+		// fill the free slots with the next systems
+		for (int slotnum = 0; slotnum < jobs && more; slotnum++)
+			if (slots[slotnum].m_process == NULL)
+			{
+				more = m_drivlist.next();
+				if (more && start(slots[slotnum], m_drivlist.current()))
+					running++;
+			}
+
+		// then see who has finished; only the first wait actually sleeps
+		bool waited = false;
+		for (int slotnum = 0; slotnum < jobs; slotnum++)
+		{
+			job &slot = slots[slotnum];
+			if (slot.m_process == NULL)
+				continue;
+
+			int result;
+			int state = osd_process_wait(slot.m_process, waited ? 0 : osd_ticks_per_second() / 50, &result);
+			waited = true;
+
+			// kill anything that has hung
+			if (state == OSD_PROCESS_RUNNING && timeout != 0 && osd_ticks() - slot.m_start > timeout)
+			{
+				osd_process_kill(slot.m_process);
+				state = -1;
+			}
+			if (state != OSD_PROCESS_RUNNING)
+			{
+				finish(slot, state, result);
+				running--;
+			}
+		}
+	}
+
+	mame_printf_info("%d systems run, %d failed; see %s" PATH_SEPARATOR "report.txt\n", m_drivlist.count(), m_failures, m_options.regress_directory());
+	return m_failures;
+}
+
+
+//-------------------------------------------------
+//  load_report - open the report, excluding all
+//  systems already listed in it
+//-------------------------------------------------
+
+void regression_runner::load_report()
+{
+	// an existing report means we are resuming
+	if (m_report.open("report.txt") == FILERR_NONE)
+	{
+		// read it all, minus any partial last line an interrupted run left behind
+		dynamic_buffer buffer(m_report.size());
+		int length = m_report.read(buffer, buffer.count());
+		while (length > 0 && buffer[length - 1] != '\n')
+			length--;
+		astring report((const char *)(const UINT8 *)buffer, length);
+
+		for (int start = 0, end; start < report.len(); start = end + 1)
+		{
+			// the system name is everything up to the first tab
+			end = report.chr(start, '\n');
+			int tab = report.chr(start, '\t');
+			if (report[start] == '#' || tab == -1 || tab > end)
+				continue;
+
+			int index = driver_list::find(astring(report, start, tab - start));
+			if (index != -1)
+				m_drivlist.exclude(index);
+		}
+
+		// if there was a partial line, rewrite the report without it so
+		// the new lines start on a line of their own
+		if (length == buffer.count())
+		{
+			m_report.seek(0, SEEK_END);
+			return;
+		}
+		m_report.close();
+		m_report.set_openflags(OPEN_FLAG_WRITE | OPEN_FLAG_CREATE);
+		if (m_report.open("report.txt") != FILERR_NONE || m_report.write(report, length) != length)
+			throw emu_fatalerror(MAMERR_FATALERROR, "Unable to rewrite %s" PATH_SEPARATOR "report.txt", m_options.regress_directory());
+		return;
+	}
+
+	// otherwise start a new one
+	m_report.set_openflags(OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	if (m_report.open("report.txt") != FILERR_NONE)
+		throw emu_fatalerror(MAMERR_FATALERROR, "Unable to create %s" PATH_SEPARATOR "report.txt", m_options.regress_directory());
+	m_report.printf("# system\tresult\texit code\tspeed\tfinal frame\tdetails\n");
+}
+
+
+//-------------------------------------------------
+//  start - start a child process running the
+//  given system
+//-------------------------------------------------
+
+bool regression_runner::start(job &slot, int index)
+{
+	const char *name = driver_list::driver(index).name;
+	slot.m_index = index;
+	slot.m_start = osd_ticks();
+
+	// remove the snapshot from any earlier run so we never report a stale one
+	{
+		emu_file stale(m_options.regress_directory(), OPEN_FLAG_READ);
+		if (stale.open(name, PATH_SEPARATOR "final.png") == FILERR_NONE)
+			stale.remove_on_close();
+	}
+
+	// create the log here so the directory exists; the child rewrites it
+	astring logpath;
+	{
+		emu_file log(m_options.regress_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+		if (log.open(name, PATH_SEPARATOR "regress.log") == FILERR_NONE)
+			logpath.cpy(log.fullpath());
+	}
+
+	// headless, unthrottled and silent; snapshots go to our directory
+	astring seconds, extra(m_options.regress_args());
+	seconds.printf("%d", m_options.seconds_to_run());
+	dynamic_array<const char *> argv;
+	argv.append(m_exepath);
+	argv.append(name);
+	argv.append("-" OPTION_SECONDS_TO_RUN);
+	argv.append(seconds);
+	argv.append("-no" OPTION_THROTTLE);
+	argv.append("-no" OPTION_SOUND);
+	argv.append("-" OPTION_SKIP_GAMEINFO);
+	argv.append("-" OPTION_MEDIAPATH);
+	argv.append(m_options.media_path());
+	argv.append("-" OPTION_SNAPSHOT_DIRECTORY);
+	argv.append(m_options.regress_directory());
+	if (m_options.exists("video"))
+	{
+		argv.append("-video");
+		argv.append("none");
+	}
+
+	// then any extra options, split at spaces
+	char *arg = const_cast<char *>(extra.cstr());
+	while (*arg != 0)
+	{
+		while (*arg == ' ')
+			*arg++ = 0;
+		if (*arg != 0)
+			argv.append(arg);
+		while (*arg != 0 && *arg != ' ')
+			arg++;
+	}
+	argv.append(NULL);
+
+	slot.m_process = osd_process_create(argv, (logpath.len() != 0) ? logpath.cstr() : NULL);
+	if (slot.m_process == NULL)
+	{
+		m_report.printf("%s\tfailed\t-\t-\t-\tunable to start %s\n", name, m_exepath.cstr());
+		mame_printf_info("%-16s failed to start\n", name);
+		m_failures++;
+		return false;
+	}
+	return true;
+}
+
+
+//-------------------------------------------------
+//  finish - collect the results of a finished
+//  (or killed) process and add them to the
+//  report
+//-------------------------------------------------
+
+void regression_runner::finish(job &slot, int state, int result)
+{
+	const char *name = driver_list::driver(slot.m_index).name;
+	osd_process_free(slot.m_process);
+	slot.m_process = NULL;
+
+	// scan the log for the speed and the last thing printed
+	astring speed("-"), lastline;
+	{
+		emu_file log(m_options.regress_directory(), OPEN_FLAG_READ);
+		if (log.open(name, PATH_SEPARATOR "regress.log") == FILERR_NONE)
+		{
+			char line[1024];
+			while (log.gets(line, ARRAY_LENGTH(line)) != NULL)
+			{
+				float percent;
+				if (sscanf(line, "Average speed: %f%%", &percent) == 1)
+					speed.printf("%.2f%%", percent);
+				astring trimmed(line);
+				if (trimmed.trimspace().len() != 0)
+					lastline.cpy(trimmed);
+			}
+		}
+	}
+
+	// hash the pixels of the final frame rather than the PNG file, which carries a version string
+	astring frame("-");
+	{
+		emu_file snap(m_options.regress_directory(), OPEN_FLAG_READ);
+		bitmap_argb32 bitmap;
+		if (snap.open(name, PATH_SEPARATOR "final.png") == FILERR_NONE && png_read_bitmap(snap, bitmap) == PNGERR_NONE)
+		{
+			UINT32 crc = 0;
+			for (int y = 0; y < bitmap.height(); y++)
+				crc = crc32(crc, reinterpret_cast<const UINT8 *>(&bitmap.pix32(y)), bitmap.width() * sizeof(UINT32));
+			frame.printf("%dx%d:%08x", bitmap.width(), bitmap.height(), crc);
+		}
+	}
+
+	// classify the outcome
+	astring status, code;
+	if (state == OSD_PROCESS_EXITED && result == MAMERR_NONE)
+		status.cpy("ok");
+	else if (state == OSD_PROCESS_EXITED && result == MAMERR_MISSING_FILES)
+		status.cpy("missing");
+	else if (state == OSD_PROCESS_EXITED)
+		status.cpy("error");
+	else if (state == OSD_PROCESS_CRASHED)
+		status.cpy("crash");
+	else
+		status.cpy("timeout");
+	if (state == OSD_PROCESS_EXITED || state == OSD_PROCESS_CRASHED)
+		code.printf("%d", result);
+	else
+		code.cpy("-");
+
+	// missing ROMs are not a regression, everything else that didn't finish is
+	bool failed = (status != "ok" && status != "missing");
+	if (failed)
+		m_failures++;
+
+	// one line per system, flushed as we go so an interrupted run can resume
+	m_report.printf("%s\t%s\t%s\t%s\t%s\t%s\n", name, status.cstr(), code.cstr(), speed.cstr(), frame.cstr(), failed ? lastline.cstr() : "");
+	mame_printf_info("%-16s %-8s %-10s %s\n", name, status.cstr(), speed.cstr(), frame.cstr());
+}
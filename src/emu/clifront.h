@@ -77,6 +77,15 @@
 #define CLICOMMAND_LISTSOFTWARE			"listsoftware"
 #define CLICOMMAND_GETSOFTLIST			"getsoftlist"
 
+// testing commands
+#define CLICOMMAND_REGRESS				"regress"
+
+// regression runner options
+#define CLIOPTION_REGRESS_DIRECTORY		"regress_directory"
+#define CLIOPTION_REGRESS_JOBS			"regress_jobs"
+#define CLIOPTION_REGRESS_TIMEOUT		"regress_timeout"
+#define CLIOPTION_REGRESS_ARGS			"regress_args"
+
 
 
 //**************************************************************************
@@ -90,6 +99,12 @@ public:
 	// construction/destruction
 	cli_options();
 
+	// regression runner options
+	const char *regress_directory() const { return value(CLIOPTION_REGRESS_DIRECTORY); }
+	int regress_jobs() const { return int_value(CLIOPTION_REGRESS_JOBS); }
+	int regress_timeout() const { return int_value(CLIOPTION_REGRESS_TIMEOUT); }
+	const char *regress_args() const { return value(CLIOPTION_REGRESS_ARGS); }
+
 private:
 	static const options_entry s_option_entries[];
 };
@@ -124,6 +139,7 @@ public:
 	void verifysamples(const char *gamename = "*");
 	void romident(const char *filename);
 	void getsoftlist(const char *gamename = "*");
+	void regress(const char *gamename = "*");
 
 private:
 	// internal helpers
@@ -131,11 +147,16 @@ private:
 	void display_help();
 	void display_suggestions(const char *gamename);
 	void output_single_softlist(FILE *out,software_list *list, const char *listname);
+	void format_roms(driver_enumerator &drivlist, astring &text);
+	void format_devices(driver_enumerator &drivlist, astring &text);
+	void format_slots(driver_enumerator &drivlist, astring &text);
+	void format_media(driver_enumerator &drivlist, astring &text);
 
 	// internal state
 	cli_options &		m_options;
 	osd_interface &		m_osd;
 	int					m_result;
+	astring				m_exepath;
 };
 
 
@@ -168,5 +189,40 @@ private:
 };
 
 
+// regression_runner runs a set of systems headless in parallel child
+// processes and collects the results into a resumable report
+class regression_runner
+{
+public:
+	// construction/destruction
+	regression_runner(cli_options &options, const char *exepath);
+	~regression_runner();
+
+	// operations
+	int run(const char *gamename);
+
+private:
+	// a single child process
+	struct job
+	{
+		int					m_index;		// driver index
+		osd_process *		m_process;		// running process, or NULL if the slot is free
+		osd_ticks_t			m_start;		// time the process was started
+	};
+
+	// internal helpers
+	void load_report();
+	bool start(job &slot, int index);
+	void finish(job &slot, int state, int result);
+
+	// internal state
+	cli_options &		m_options;
+	astring				m_exepath;
+	driver_enumerator	m_drivlist;
+	emu_file			m_report;
+	int					m_failures;
+};
+
+
 
 #endif	/* __CLIFRONT_H__ */
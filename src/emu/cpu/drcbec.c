@@ -157,6 +157,18 @@ enum
 	OP_FFRI8,
 	OP_FFRFS,
 	OP_FFRFD,
+	OP_VADD1,
+	OP_VADD2,
+	OP_VADD4,
+	OP_VADD8,
+	OP_VSUB1,
+	OP_VSUB2,
+	OP_VSUB4,
+	OP_VSUB8,
+	OP_VADDS1,
+	OP_VADDS2,
+	OP_VSUBS1,
+	OP_VSUBS2,
 };
 
 
@@ -210,6 +222,15 @@ enum
 #define FDPARAM2					(*inst[2].pdouble)
 #define FDPARAM3					(*inst[3].pdouble)
 
+// vector lane loops; every UML vector is 16 bytes of packed lanes
+#define VECTOR_LOOP(type, expr) \
+	do { type *vdst = (type *)inst[0].v; const type *vsrc1 = (const type *)inst[1].v; const type *vsrc2 = (const type *)inst[2].v; \
+		 for (int lane = 0; lane < (int)(16 / sizeof(type)); lane++) vdst[lane] = (expr); } while (0)
+
+// signed saturation for vector lanes
+#define SATURATE8(v)				(((v) > 127) ? 127 : ((v) < -128) ? -128 : (v))
+#define SATURATE16(v)				(((v) > 32767) ? 32767 : ((v) < -32768) ? -32768 : (v))
+
 // compute C and V flags for 32-bit add/subtract
 #define FLAGS32_C_ADD(a,b)			((UINT32)~(a) < (UINT32)(b))
 #define FLAGS32_C_SUB(a,b)			((UINT32)(b) > (UINT32)(a))
@@ -428,6 +449,8 @@ void drcbe_c::generate(drcuml_block &block, const instruction *instlist, UINT32
 					psize[0] = 1 << inst.param(2).size();
 				if (opcode == OP_FFRINT || opcode == OP_FFRFLT)
 					psize[1] = 1 << inst.param(2).size();
+				if (opcode == OP_VSHUF)
+					psize[2] = 4;
 
 				// pre-expand opcodes that encode size/scale in them
 				if (opcode == OP_LOAD)
@@ -452,6 +475,14 @@ void drcbe_c::generate(drcuml_block &block, const instruction *instlist, UINT32
 					opcode = (opcode_t)(OP_FFRI4 + (inst.param(2).size() - 2));
 				if (opcode == OP_FFRFLT)
 					opcode = (opcode_t)(OP_FFRFS + (inst.param(2).size() - 2));
+				if (opcode == OP_VADD)
+					opcode = (opcode_t)(OP_VADD1 + inst.param(3).size());
+				if (opcode == OP_VSUB)
+					opcode = (opcode_t)(OP_VSUB1 + inst.param(3).size());
+				if (opcode == OP_VADDS)
+					opcode = (opcode_t)(OP_VADDS1 + inst.param(3).size());
+				if (opcode == OP_VSUBS)
+					opcode = (opcode_t)(OP_VSUBS1 + inst.param(3).size());
 
 				// count how many bytes of immediates we need
 				int immedbytes = 0;
@@ -511,6 +542,7 @@ void drcbe_c::get_info(drcbe_info &info)
 {
 	info.direct_iregs = 0;
 	info.direct_fregs = 0;
+	info.vector_ops = true;
 }
 
 
@@ -2088,6 +2120,83 @@ int drcbe_c::execute(code_handle &entry)
 				FDPARAM0 = 1.0 / sqrt(FDPARAM1);
 				break;
 
+
+			// ----------------------- 128-bit Vector Operations -----------------------
+
+			case MAKE_OPCODE_SHORT(OP_VAND, 16, 0):		// VAND    dst,src1,src2
+				VECTOR_LOOP(UINT32, vsrc1[lane] & vsrc2[lane]);
+				break;
+
+			case MAKE_OPCODE_SHORT(OP_VOR, 16, 0):		// VOR     dst,src1,src2
+				VECTOR_LOOP(UINT32, vsrc1[lane] | vsrc2[lane]);
+				break;
+
+			case MAKE_OPCODE_SHORT(OP_VXOR, 16, 0):		// VXOR    dst,src1,src2
+				VECTOR_LOOP(UINT32, vsrc1[lane] ^ vsrc2[lane]);
+				break;
+
+			case MAKE_OPCODE_SHORT(OP_VNOT, 16, 0):		// VNOT    dst,src
+				for (int lane = 0; lane < 4; lane++)
+					inst[0].puint32[lane] = ~inst[1].puint32[lane];
+				break;
+
+			case MAKE_OPCODE_SHORT(OP_VADD1, 16, 0):	// VADD    dst,src1,src2,byte
+				VECTOR_LOOP(UINT8, vsrc1[lane] + vsrc2[lane]);
+				break;
+
+			case MAKE_OPCODE_SHORT(OP_VADD2, 16, 0):	// VADD    dst,src1,src2,word
+				VECTOR_LOOP(UINT16, vsrc1[lane] + vsrc2[lane]);
+				break;
+
+			case MAKE_OPCODE_SHORT(OP_VADD4, 16, 0):	// VADD    dst,src1,src2,dword
+				VECTOR_LOOP(UINT32, vsrc1[lane] + vsrc2[lane]);
+				break;
+
+			case MAKE_OPCODE_SHORT(OP_VADD8, 16, 0):	// VADD    dst,src1,src2,qword
+				VECTOR_LOOP(UINT64, vsrc1[lane] + vsrc2[lane]);
+				break;
+
+			case MAKE_OPCODE_SHORT(OP_VSUB1, 16, 0):	// VSUB    dst,src1,src2,byte
+				VECTOR_LOOP(UINT8, vsrc1[lane] - vsrc2[lane]);
+				break;
+
+			case MAKE_OPCODE_SHORT(OP_VSUB2, 16, 0):	// VSUB    dst,src1,src2,word
+				VECTOR_LOOP(UINT16, vsrc1[lane] - vsrc2[lane]);
+				break;
+
+			case MAKE_OPCODE_SHORT(OP_VSUB4, 16, 0):	// VSUB    dst,src1,src2,dword
+				VECTOR_LOOP(UINT32, vsrc1[lane] - vsrc2[lane]);
+				break;
+
+			case MAKE_OPCODE_SHORT(OP_VSUB8, 16, 0):	// VSUB    dst,src1,src2,qword
+				VECTOR_LOOP(UINT64, vsrc1[lane] - vsrc2[lane]);
+				break;
+
+			case MAKE_OPCODE_SHORT(OP_VADDS1, 16, 0):	// VADDS   dst,src1,src2,byte
+				VECTOR_LOOP(INT8, SATURATE8((INT32)vsrc1[lane] + (INT32)vsrc2[lane]));
+				break;
+
+			case MAKE_OPCODE_SHORT(OP_VADDS2, 16, 0):	// VADDS   dst,src1,src2,word
+				VECTOR_LOOP(INT16, SATURATE16((INT32)vsrc1[lane] + (INT32)vsrc2[lane]));
+				break;
+
+			case MAKE_OPCODE_SHORT(OP_VSUBS1, 16, 0):	// VSUBS   dst,src1,src2,byte
+				VECTOR_LOOP(INT8, SATURATE8((INT32)vsrc1[lane] - (INT32)vsrc2[lane]));
+				break;
+
+			case MAKE_OPCODE_SHORT(OP_VSUBS2, 16, 0):	// VSUBS   dst,src1,src2,word
+				VECTOR_LOOP(INT16, SATURATE16((INT32)vsrc1[lane] - (INT32)vsrc2[lane]));
+				break;
+
+			case MAKE_OPCODE_SHORT(OP_VSHUF, 16, 0):	// VSHUF   dst,src,selectors
+			{
+				UINT16 vtemp[8];
+				memcpy(vtemp, inst[1].v, 16);
+				for (int lane = 0; lane < 8; lane++)
+					inst[0].puint16[lane] = vtemp[(PARAM2 >> (3 * lane)) & 7];
+				break;
+			}
+
 			default:
 				fatalerror("Unexpected opcode!");
 				break;
@@ -236,6 +236,16 @@ private:
 	void op_frecip(x86code *&dst, const uml::instruction &inst);
 	void op_frsqrt(x86code *&dst, const uml::instruction &inst);
 
+	void op_vand(x86code *&dst, const uml::instruction &inst);
+	void op_vor(x86code *&dst, const uml::instruction &inst);
+	void op_vxor(x86code *&dst, const uml::instruction &inst);
+	void op_vnot(x86code *&dst, const uml::instruction &inst);
+	void op_vadd(x86code *&dst, const uml::instruction &inst);
+	void op_vsub(x86code *&dst, const uml::instruction &inst);
+	void op_vadds(x86code *&dst, const uml::instruction &inst);
+	void op_vsubs(x86code *&dst, const uml::instruction &inst);
+	void op_vshuf(x86code *&dst, const uml::instruction &inst);
+
 	// 32-bit code emission helpers
 	void emit_mov_r32_p32(x86code *&dst, UINT8 reg, const be_parameter &param);
 	void emit_movsx_r64_p32(x86code *&dst, UINT8 reg, const be_parameter &param);
@@ -318,6 +328,10 @@ private:
 	void emit_movsd_r128_p64(x86code *&dst, UINT8 reg, const be_parameter &param);
 	void emit_movsd_p64_r128(x86code *&dst, const be_parameter &param, UINT8 reg);
 
+	// vector code emission helpers
+	typedef void (*sse_binary_func)(x86code *&emitptr, UINT8 dreg, UINT8 sreg);
+	void emit_vector_binary(x86code *&dst, const uml::instruction &inst, sse_binary_func func);
+
 	// internal state
 	drc_hash_table			m_hash;					// hash table state
 	drc_map_variables		m_map;					// code map
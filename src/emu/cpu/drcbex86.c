@@ -298,7 +298,18 @@ const drcbe_x86::opcode_table_entry drcbe_x86::s_opcode_table_source[] =
 	{ uml::OP_FABS,    &drcbe_x86::op_fabs },		// FABS    dst,src1
 	{ uml::OP_FSQRT,   &drcbe_x86::op_fsqrt },		// FSQRT   dst,src1
 	{ uml::OP_FRECIP,  &drcbe_x86::op_frecip },		// FRECIP  dst,src1
-	{ uml::OP_FRSQRT,  &drcbe_x86::op_frsqrt }		// FRSQRT  dst,src1
+	{ uml::OP_FRSQRT,  &drcbe_x86::op_frsqrt },		// FRSQRT  dst,src1
+
+	// 128-bit Vector Operations
+	{ uml::OP_VAND,    &drcbe_x86::op_vand },		// VAND    dst,src1,src2
+	{ uml::OP_VOR,     &drcbe_x86::op_vor },		// VOR     dst,src1,src2
+	{ uml::OP_VXOR,    &drcbe_x86::op_vxor },		// VXOR    dst,src1,src2
+	{ uml::OP_VNOT,    &drcbe_x86::op_vnot },		// VNOT    dst,src
+	{ uml::OP_VADD,    &drcbe_x86::op_vadd },		// VADD    dst,src1,src2,lanesize
+	{ uml::OP_VSUB,    &drcbe_x86::op_vsub },		// VSUB    dst,src1,src2,lanesize
+	{ uml::OP_VADDS,   &drcbe_x86::op_vadds },		// VADDS   dst,src1,src2,lanesize
+	{ uml::OP_VSUBS,   &drcbe_x86::op_vsubs },		// VSUBS   dst,src1,src2,lanesize
+	{ uml::OP_VSHUF,   &drcbe_x86::op_vshuf }		// VSHUF   dst,src,selectors
 };
 
 
@@ -539,6 +550,7 @@ drcbe_x86::drcbe_x86(drcuml_state &drcuml, device_t &device, drc_cache &cache, U
 	  m_log(NULL),
 	  m_logged_common(false),
 	  m_sse3(false),
+	  m_sse2(false),
 	  m_entry(NULL),
 	  m_exit(NULL),
 	  m_nocode(NULL),
@@ -641,6 +653,18 @@ void drcbe_x86::reset()
 	// call it to determine if we have SSE3 support
 	m_sse3 = (((*cpuid_ecx_stub)() & 1) != 0);
 
+	// generate a second stub for the EDX feature bits
+	UINT32 (*cpuid_edx_stub)(void) = (UINT32 (*)(void))dst;
+	emit_push_r32(dst, REG_EBX);														// push  ebx
+	emit_mov_r32_imm(dst, REG_EAX, 1);													// mov   eax,1
+	emit_cpuid(dst);																	// cpuid
+	emit_mov_r32_r32(dst, REG_EAX, REG_EDX);											// mov   eax,edx
+	emit_pop_r32(dst, REG_EBX);															// pop   ebx
+	emit_ret(dst);																		// ret
+
+	// call it to determine if we have SSE2 support, needed for vector opcodes
+	m_sse2 = (((*cpuid_edx_stub)() & 0x4000000) != 0);
+
 	// generate an entry point
 	m_entry = (x86_entry_point_func)dst;
 	emit_mov_r32_m32(dst, REG_EAX, MBD(REG_ESP, 4));									// mov   eax,[esp+4]
@@ -803,6 +827,10 @@ void drcbe_x86::generate(drcuml_block &block, const instruction *instlist, UINT3
 		const instruction &inst = instlist[inum];
 		assert(inst.opcode() < ARRAY_LENGTH(s_opcode_table));
 
+		// vector opcodes are emitted as SSE2 and have no x87 fallback; front-ends check get_info first
+		if (inst.opcode() >= OP_VAND && !m_sse2)
+			fatalerror("UML vector opcodes require a CPU with SSE2 support");
+
 		// add a comment
 		if (m_log != NULL)
 		{
@@ -861,6 +889,7 @@ void drcbe_x86::get_info(drcbe_info &info)
 		if (int_register_map[info.direct_iregs] == 0)
 			break;
 	info.direct_fregs = 0;
+	info.vector_ops = m_sse2;
 }
 
 
@@ -6477,6 +6506,238 @@ void drcbe_x86::op_frsqrt(x86code *&dst, const instruction &inst)
 
 
 
+//**************************************************************************
+//  VECTOR OPERATIONS
+//**************************************************************************
+
+//-------------------------------------------------
+//  emit_vector_binary - emit a lane-wise 128-bit
+//  operation through xmm0/xmm1; unaligned moves
+//  are used since UML vectors carry no alignment
+//  guarantee
+//-------------------------------------------------
+
+void drcbe_x86::emit_vector_binary(x86code *&dst, const instruction &inst, sse_binary_func func)
+{
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_M);
+	be_parameter src1p(*this, inst.param(1), PTYPE_M);
+	be_parameter src2p(*this, inst.param(2), PTYPE_M);
+
+	emit_movdqu_r128_m128(dst, REG_XMM0, MABS(src1p.memory()));							// movdqu xmm0,[src1p]
+	emit_movdqu_r128_m128(dst, REG_XMM1, MABS(src2p.memory()));							// movdqu xmm1,[src2p]
+	(*func)(dst, REG_XMM0, REG_XMM1);													// op     xmm0,xmm1
+	emit_movdqu_m128_r128(dst, MABS(dstp.memory()), REG_XMM0);							// movdqu [dstp],xmm0
+}
+
+
+//-------------------------------------------------
+//  op_vand - process a VAND opcode
+//-------------------------------------------------
+
+void drcbe_x86::op_vand(x86code *&dst, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 16);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	emit_vector_binary(dst, inst, emit_pand_r128_r128);
+}
+
+
+//-------------------------------------------------
+//  op_vor - process a VOR opcode
+//-------------------------------------------------
+
+void drcbe_x86::op_vor(x86code *&dst, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 16);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	emit_vector_binary(dst, inst, emit_por_r128_r128);
+}
+
+
+//-------------------------------------------------
+//  op_vxor - process a VXOR opcode
+//-------------------------------------------------
+
+void drcbe_x86::op_vxor(x86code *&dst, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 16);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	emit_vector_binary(dst, inst, emit_pxor_r128_r128);
+}
+
+
+//-------------------------------------------------
+//  op_vnot - process a VNOT opcode
+//-------------------------------------------------
+
+void drcbe_x86::op_vnot(x86code *&dst, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 16);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_M);
+	be_parameter srcp(*this, inst.param(1), PTYPE_M);
+
+	emit_movdqu_r128_m128(dst, REG_XMM0, MABS(srcp.memory()));							// movdqu  xmm0,[srcp]
+	emit_pcmpeqd_r128_r128(dst, REG_XMM1, REG_XMM1);									// pcmpeqd xmm1,xmm1
+	emit_pxor_r128_r128(dst, REG_XMM0, REG_XMM1);										// pxor    xmm0,xmm1
+	emit_movdqu_m128_r128(dst, MABS(dstp.memory()), REG_XMM0);							// movdqu  [dstp],xmm0
+}
+
+
+//-------------------------------------------------
+//  op_vadd - process a VADD opcode
+//-------------------------------------------------
+
+void drcbe_x86::op_vadd(x86code *&dst, const instruction &inst)
+{
+	static const sse_binary_func add_by_size[] = { emit_paddb_r128_r128, emit_paddw_r128_r128, emit_paddd_r128_r128, emit_paddq_r128_r128 };
+
+	// validate instruction
+	assert(inst.size() == 16);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+	assert(inst.param(3).size() <= SIZE_QWORD);
+
+	emit_vector_binary(dst, inst, add_by_size[inst.param(3).size()]);
+}
+
+
+//-------------------------------------------------
+//  op_vsub - process a VSUB opcode
+//-------------------------------------------------
+
+void drcbe_x86::op_vsub(x86code *&dst, const instruction &inst)
+{
+	static const sse_binary_func sub_by_size[] = { emit_psubb_r128_r128, emit_psubw_r128_r128, emit_psubd_r128_r128, emit_psubq_r128_r128 };
+
+	// validate instruction
+	assert(inst.size() == 16);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+	assert(inst.param(3).size() <= SIZE_QWORD);
+
+	emit_vector_binary(dst, inst, sub_by_size[inst.param(3).size()]);
+}
+
+
+//-------------------------------------------------
+//  op_vadds - process a VADDS opcode
+//-------------------------------------------------
+
+void drcbe_x86::op_vadds(x86code *&dst, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 16);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+	assert(inst.param(3).size() <= SIZE_WORD);
+
+	emit_vector_binary(dst, inst, (inst.param(3).size() == SIZE_BYTE) ? emit_paddsb_r128_r128 : emit_paddsw_r128_r128);
+}
+
+
+//-------------------------------------------------
+//  op_vsubs - process a VSUBS opcode
+//-------------------------------------------------
+
+void drcbe_x86::op_vsubs(x86code *&dst, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 16);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+	assert(inst.param(3).size() <= SIZE_WORD);
+
+	emit_vector_binary(dst, inst, (inst.param(3).size() == SIZE_BYTE) ? emit_psubsb_r128_r128 : emit_psubsw_r128_r128);
+}
+
+
+//-------------------------------------------------
+//  op_vshuf - process a VSHUF opcode
+//-------------------------------------------------
+
+void drcbe_x86::op_vshuf(x86code *&dst, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 16);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_M);
+	be_parameter srcp(*this, inst.param(1), PTYPE_M);
+	UINT32 selectors = inst.param(2).immediate();
+
+	// unpack the selectors and classify the pattern
+	UINT8 sel[8];
+	bool inhalves = true, broadcast = true;
+	for (int lane = 0; lane < 8; lane++)
+	{
+		sel[lane] = (selectors >> (3 * lane)) & 7;
+		if ((sel[lane] ^ lane) & 4)
+			inhalves = false;
+		if (sel[lane] != sel[0])
+			broadcast = false;
+	}
+
+	emit_movdqu_r128_m128(dst, REG_XMM0, MABS(srcp.memory()));							// movdqu  xmm0,[srcp]
+
+	// every lane picks the same word: spread it across its half, then across the dwords
+	if (broadcast)
+	{
+		if (sel[0] < 4)
+		{
+			emit_pshuflw_r128_r128_imm(dst, REG_XMM0, REG_XMM0, sel[0] * 0x55);			// pshuflw xmm0,xmm0,sel*0x55
+			emit_pshufd_r128_r128_imm(dst, REG_XMM0, REG_XMM0, 0x00);					// pshufd  xmm0,xmm0,0x00
+		}
+		else
+		{
+			emit_pshufhw_r128_r128_imm(dst, REG_XMM0, REG_XMM0, (sel[0] - 4) * 0x55);	// pshufhw xmm0,xmm0,sel*0x55
+			emit_pshufd_r128_r128_imm(dst, REG_XMM0, REG_XMM0, 0xaa);					// pshufd  xmm0,xmm0,0xaa
+		}
+		emit_movdqu_m128_r128(dst, MABS(dstp.memory()), REG_XMM0);						// movdqu  [dstp],xmm0
+	}
+
+	// each half only picks from itself: one shuffle per half
+	else if (inhalves)
+	{
+		UINT8 lo = sel[0] | (sel[1] << 2) | (sel[2] << 4) | (sel[3] << 6);
+		UINT8 hi = (sel[4] & 3) | ((sel[5] & 3) << 2) | ((sel[6] & 3) << 4) | ((sel[7] & 3) << 6);
+		if (lo != 0xe4)
+			emit_pshuflw_r128_r128_imm(dst, REG_XMM0, REG_XMM0, lo);						// pshuflw xmm0,xmm0,lo
+		if (hi != 0xe4)
+			emit_pshufhw_r128_r128_imm(dst, REG_XMM0, REG_XMM0, hi);						// pshufhw xmm0,xmm0,hi
+		emit_movdqu_m128_r128(dst, MABS(dstp.memory()), REG_XMM0);						// movdqu  [dstp],xmm0
+	}
+
+	// general case: move each word individually
+	else
+	{
+		for (int lane = 0; lane < 8; lane++)
+		{
+			emit_pextrw_r32_r128_imm(dst, REG_EAX, REG_XMM0, sel[lane]);				// pextrw  eax,xmm0,sel
+			emit_pinsrw_r128_r32_imm(dst, REG_XMM1, REG_EAX, lane);						// pinsrw  xmm1,eax,lane
+		}
+		emit_movdqu_m128_r128(dst, MABS(dstp.memory()), REG_XMM1);						// movdqu  [dstp],xmm1
+	}
+}
+
+
+
 //**************************************************************************
 //  MISCELLAENOUS FUNCTIONS
 //**************************************************************************
@@ -238,6 +238,16 @@ private:
 	void op_frecip(x86code *&dst, const uml::instruction &inst);
 	void op_frsqrt(x86code *&dst, const uml::instruction &inst);
 
+	void op_vand(x86code *&dst, const uml::instruction &inst);
+	void op_vor(x86code *&dst, const uml::instruction &inst);
+	void op_vxor(x86code *&dst, const uml::instruction &inst);
+	void op_vnot(x86code *&dst, const uml::instruction &inst);
+	void op_vadd(x86code *&dst, const uml::instruction &inst);
+	void op_vsub(x86code *&dst, const uml::instruction &inst);
+	void op_vadds(x86code *&dst, const uml::instruction &inst);
+	void op_vsubs(x86code *&dst, const uml::instruction &inst);
+	void op_vshuf(x86code *&dst, const uml::instruction &inst);
+
 	// 32-bit code emission helpers
 	void emit_mov_r32_p32(x86code *&dst, UINT8 reg, const be_parameter &param);
 	void emit_mov_r32_p32_keepflags(x86code *&dst, UINT8 reg, const be_parameter &param);
@@ -324,6 +334,10 @@ private:
 	static int ddivu(UINT64 &dstlo, UINT64 &dsthi, UINT64 src1, UINT64 src2);
 	static int ddivs(UINT64 &dstlo, UINT64 &dsthi, INT64 src1, INT64 src2);
 
+	// vector code emission helpers
+	typedef void (*sse_binary_func)(x86code *&emitptr, UINT8 dreg, UINT8 sreg);
+	void emit_vector_binary(x86code *&dst, const uml::instruction &inst, sse_binary_func func);
+
 	// internal state
 	drc_hash_table			m_hash;					// hash table state
 	drc_map_variables		m_map;					// code map
@@ -331,6 +345,7 @@ private:
 	x86log_context *		m_log;					// logging
 	bool					m_logged_common;		// logged common code already?
 	bool					m_sse3;					// do we have SSE3 support?
+	bool					m_sse2;					// do we have SSE2 support?
 
 	x86_entry_point_func	m_entry;				// entry point
 	x86code *				m_exit;					// exit point
@@ -78,6 +78,7 @@ using namespace uml;
 //**************************************************************************
 
 #define VALIDATE_BACKEND		(0)
+#define VALIDATE_VECTOR_OPS		(0)
 #define LOG_SIMPLIFICATIONS		(0)
 
 
@@ -97,6 +98,25 @@ struct bevalidate_test
 };
 
 
+// structure describing one vector opcode compared against the C back-end
+struct vecvalidate_test
+{
+	opcode_t				opcode;
+	const char *			name;				// opcode name, for reporting
+	operand_size			lanesize;			// lane size, for opcodes that take one
+	int						alias;				// 0 = distinct operands, 1 = dst is src1, 2 = dst is src2, 3 = src1 is src2
+	UINT8					selectors[8];		// VSHUF lane selectors
+};
+
+
+
+//**************************************************************************
+//  FUNCTION PROTOTYPES
+//**************************************************************************
+
+static void validate_vector_ops(drcuml_state &drcuml);
+
+
 
 //**************************************************************************
 //  DRC BACKEND INTERFACE
@@ -198,6 +218,17 @@ void drcuml_state::reset()
 		// call the backend to reset
 		m_beintf.reset();
 
+		// do a one-time comparison of the vector opcodes against the C back-end if requested
+		if (VALIDATE_VECTOR_OPS)
+		{
+			static bool validated = false;
+			if (!validated)
+			{
+				validated = true;
+				validate_vector_ops(*this);
+			}
+		}
+
 		// do a one-time validation if requested
 /*      if (VALIDATE_BACKEND)
         {
@@ -1167,3 +1198,193 @@ static int bevalidate_verify_state(drcuml_state *drcuml, const drcuml_machine_st
 }
 
 #endif
+
+
+
+/***************************************************************************
+    VECTOR OPCODE VALIDATION
+***************************************************************************/
+
+//-------------------------------------------------
+//  vecvalidate_add - add a vector test to the
+//  list
+//-------------------------------------------------
+
+static void vecvalidate_add(vecvalidate_test *tests, int &count, opcode_t opcode, const char *name, operand_size lanesize, int alias, const UINT8 *selectors = NULL)
+{
+	vecvalidate_test &test = tests[count++];
+	test.opcode = opcode;
+	test.name = name;
+	test.lanesize = lanesize;
+	test.alias = alias;
+	for (int lane = 0; lane < 8; lane++)
+		test.selectors[lane] = (selectors != NULL) ? selectors[lane] : lane;
+}
+
+
+//-------------------------------------------------
+//  vecvalidate_generate - generate a block that
+//  runs every test; vec[0] and vec[1] are the
+//  sources and vec[2 + n] is the result of test n
+//-------------------------------------------------
+
+static void vecvalidate_generate(drcuml_state &drcuml, code_handle &entry, const vecvalidate_test *tests, int count, UINT8 (*vec)[16])
+{
+	drcuml_block *block = drcuml.begin_block(count + 4);
+	block->append().handle(entry);
+
+	for (int tnum = 0; tnum < count; tnum++)
+	{
+		const vecvalidate_test &test = tests[tnum];
+		parameter dst = parameter::make_memory(vec[2 + tnum]);
+		parameter src1 = parameter::make_memory((test.alias == 1) ? vec[2 + tnum] : vec[0]);
+		parameter src2 = parameter::make_memory((test.alias == 2) ? vec[2 + tnum] : (test.alias == 3) ? vec[0] : vec[1]);
+
+		switch (test.opcode)
+		{
+			case OP_VAND:	block->append().vand(dst, src1, src2);						break;
+			case OP_VOR:	block->append().vor(dst, src1, src2);						break;
+			case OP_VXOR:	block->append().vxor(dst, src1, src2);						break;
+			case OP_VNOT:	block->append().vnot(dst, src1);							break;
+			case OP_VADD:	block->append().vadd(dst, src1, src2, test.lanesize);		break;
+			case OP_VSUB:	block->append().vsub(dst, src1, src2, test.lanesize);		break;
+			case OP_VADDS:	block->append().vadds(dst, src1, src2, test.lanesize);		break;
+			case OP_VSUBS:	block->append().vsubs(dst, src1, src2, test.lanesize);		break;
+			case OP_VSHUF:	block->append().vshuf(dst, src1, test.selectors);			break;
+			default:		fatalerror("vecvalidate_generate: unexpected opcode %d", test.opcode);
+		}
+	}
+
+	block->append().exit(0);
+	block->end();
+}
+
+
+//-------------------------------------------------
+//  vecvalidate_prepare - reset the results of the
+//  tests whose destination is also a source
+//-------------------------------------------------
+
+static void vecvalidate_prepare(const vecvalidate_test *tests, int count, UINT8 (*vec)[16])
+{
+	for (int tnum = 0; tnum < count; tnum++)
+		if (tests[tnum].alias == 1 || tests[tnum].alias == 2)
+			memcpy(vec[2 + tnum], vec[tests[tnum].alias - 1], 16);
+}
+
+
+//-------------------------------------------------
+//  validate_vector_ops - run every vector opcode
+//  on random data through this back-end and the
+//  C back-end, and stop on the first difference
+//-------------------------------------------------
+
+static void validate_vector_ops(drcuml_state &drcuml)
+{
+	static const UINT8 shuffles[][8] =
+	{
+		{ 0,1,2,3,4,5,6,7 },			// identity
+		{ 7,6,5,4,3,2,1,0 },			// reverse
+		{ 0,0,2,2,4,4,6,6 },			// pairs, as used by the RSP
+		{ 1,1,3,3,5,5,7,7 },
+		{ 0,0,0,0,4,4,4,4 },			// quads
+		{ 3,3,3,3,7,7,7,7 },
+		{ 5,5,5,5,5,5,5,5 },			// broadcast
+		{ 4,0,6,1,3,7,2,5 }				// arbitrary, crossing halves
+	};
+	static const UINT16 edges[] = { 0x0000, 0x0001, 0x7fff, 0x8000, 0x8001, 0xffff, 0x7f80, 0x807f };
+	const int passes = 1000;
+
+	// skip back-ends that cannot generate vector opcodes
+	drcbe_info info;
+	drcuml.get_backend_info(info);
+	if (!info.vector_ops)
+		return;
+
+	// build the list of tests
+	vecvalidate_test tests[128];
+	int count = 0;
+	for (int alias = 0; alias < 4; alias++)
+	{
+		vecvalidate_add(tests, count, OP_VAND, "vand", SIZE_QWORD, alias);
+		vecvalidate_add(tests, count, OP_VOR, "vor", SIZE_QWORD, alias);
+		vecvalidate_add(tests, count, OP_VXOR, "vxor", SIZE_QWORD, alias);
+		for (operand_size lanesize = SIZE_BYTE; lanesize <= SIZE_QWORD; lanesize = operand_size(lanesize + 1))
+		{
+			vecvalidate_add(tests, count, OP_VADD, "vadd", lanesize, alias);
+			vecvalidate_add(tests, count, OP_VSUB, "vsub", lanesize, alias);
+		}
+		for (operand_size lanesize = SIZE_BYTE; lanesize <= SIZE_WORD; lanesize = operand_size(lanesize + 1))
+		{
+			vecvalidate_add(tests, count, OP_VADDS, "vadds", lanesize, alias);
+			vecvalidate_add(tests, count, OP_VSUBS, "vsubs", lanesize, alias);
+		}
+	}
+	for (int alias = 0; alias < 2; alias++)
+	{
+		vecvalidate_add(tests, count, OP_VNOT, "vnot", SIZE_QWORD, alias);
+		for (int shuffle = 0; shuffle < ARRAY_LENGTH(shuffles); shuffle++)
+			vecvalidate_add(tests, count, OP_VSHUF, "vshuf", SIZE_WORD, alias, shuffles[shuffle]);
+	}
+	assert(count <= ARRAY_LENGTH(tests));
+
+	// operands must be within reach of the native code, so allocate them from its cache
+	size_t vecbytes = (2 + count) * 16;
+	UINT8 (*vec)[16] = reinterpret_cast<UINT8 (*)[16]>(drcuml.cache().alloc(vecbytes));
+	if (vec == NULL)
+		fatalerror("validate_vector_ops: out of cache space");
+	dynamic_array<UINT8> native(count * 16);
+
+	// set up a C back-end with its own cache and generate the same block for both
+	drc_cache ccache(1024 * 1024);
+	drcuml_state cdrcuml(drcuml.device(), ccache, DRCUML_OPTION_USE_C, 1, 32, 0);
+	cdrcuml.reset();
+	code_handle *entry = drcuml.handle_alloc("vector_validate");
+	code_handle *centry = cdrcuml.handle_alloc("vector_validate");
+	vecvalidate_generate(drcuml, *entry, tests, count, vec);
+	vecvalidate_generate(cdrcuml, *centry, tests, count, vec);
+
+	printf("Vector opcode validation....\n");
+	UINT32 seed = 0x12345678;
+	for (int pass = 0; pass < passes; pass++)
+	{
+		// random sources, with some lanes at the saturation and sign edges
+		for (int index = 0; index < 16; index += 2)
+		{
+			for (int src = 0; src < 2; src++)
+			{
+				seed = seed * 1103515245 + 12345;
+				UINT16 value = ((seed >> 28) < 4) ? edges[(seed >> 16) & 7] : (seed >> 8);
+				memcpy(&vec[src][index], &value, 2);
+			}
+		}
+
+		// run the native code and keep its results
+		vecvalidate_prepare(tests, count, vec);
+		drcuml.execute(*entry);
+		memcpy(native, vec[2], count * 16);
+
+		// run the C code over the same sources and compare
+		vecvalidate_prepare(tests, count, vec);
+		cdrcuml.execute(*centry);
+		for (int tnum = 0; tnum < count; tnum++)
+			if (memcmp(&native[tnum * 16], vec[2 + tnum], 16) != 0)
+			{
+				const vecvalidate_test &test = tests[tnum];
+				astring src1, src2, nresult, cresult;
+				for (int index = 15; index >= 0; index--)
+				{
+					src1.catprintf("%02X", vec[0][index]);
+					src2.catprintf("%02X", vec[1][index]);
+					nresult.catprintf("%02X", native[tnum * 16 + index]);
+					cresult.catprintf("%02X", vec[2 + tnum][index]);
+				}
+				fatalerror("Vector validation failed: %s lanesize=%d alias=%d\nsrc1=%s src2=%s\nnative=%s C=%s",
+						test.name, 1 << test.lanesize, test.alias,
+						src1.cstr(), src2.cstr(), nresult.cstr(), cresult.cstr());
+			}
+	}
+	printf("%d vector tests passed %d times\n", count, passes);
+
+	drcuml.cache().dealloc(vec, vecbytes);
+}
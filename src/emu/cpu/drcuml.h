@@ -115,6 +115,7 @@ struct drcbe_info
 {
 	UINT8				direct_iregs;		// number of direct-mapped integer registers
 	UINT8				direct_fregs;		// number of direct-mapped floating point registers
+	bool				vector_ops;			// true if the vector opcodes can be generated
 };
 
 
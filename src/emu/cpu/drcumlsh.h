@@ -183,4 +183,16 @@
 #define UML_FDRSQRT(block, dst, src1)						do { block->append().fdrsqrt(dst, src1); } while (0)
 
 
+/* ----- 128-bit Vector Operations ----- */
+#define UML_VAND(block, dst, src1, src2)					do { block->append().vand(dst, src1, src2); } while (0)
+#define UML_VOR(block, dst, src1, src2)						do { block->append().vor(dst, src1, src2); } while (0)
+#define UML_VXOR(block, dst, src1, src2)					do { block->append().vxor(dst, src1, src2); } while (0)
+#define UML_VNOT(block, dst, src1)							do { block->append().vnot(dst, src1); } while (0)
+#define UML_VADD(block, dst, src1, src2, lanesize)			do { block->append().vadd(dst, src1, src2, lanesize); } while (0)
+#define UML_VSUB(block, dst, src1, src2, lanesize)			do { block->append().vsub(dst, src1, src2, lanesize); } while (0)
+#define UML_VADDS(block, dst, src1, src2, lanesize)			do { block->append().vadds(dst, src1, src2, lanesize); } while (0)
+#define UML_VSUBS(block, dst, src1, src2, lanesize)			do { block->append().vsubs(dst, src1, src2, lanesize); } while (0)
+#define UML_VSHUF(block, dst, src1, selectors)				do { block->append().vshuf(dst, src1, selectors); } while (0)
+
+
 #endif /* __DRCUMLSH_H__ */
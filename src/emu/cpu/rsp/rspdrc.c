@@ -112,6 +112,7 @@ struct _rspimp_state
 
 	/* internal stuff */
 	UINT8				cache_dirty;				/* true if we need to flush the cache */
+	UINT8				vector_ops;					/* true if the back-end can generate vector opcodes */
 	UINT32				jmpdest;					/* destination jump target */
 
 	/* parameters for subroutines */
@@ -122,6 +123,8 @@ struct _rspimp_state
 	UINT32				arg2;						/* print_debug argument 3 */
 	UINT32				arg3;						/* print_debug argument 4 */
 	UINT32				vres[8];					/* used for temporary vector results */
+	VECTOR_REG			vsel;						/* element-selected VS2 for inline vector ops */
+	VECTOR_REG			vaccum;						/* accumulator low words for inline vector ops */
 
 	/* register mappings */
 	parameter	regmap[34];					/* parameter to register mappings for all 32 integer registers */
@@ -198,6 +201,10 @@ static int generate_special(rsp_state *rsp, drcuml_block *block, compiler_state
 static int generate_regimm(rsp_state *rsp, drcuml_block *block, compiler_state *compiler, const opcode_desc *desc);
 static int generate_cop0(rsp_state *rsp, drcuml_block *block, compiler_state *compiler, const opcode_desc *desc);
 static int generate_cop2(rsp_state *rsp, drcuml_block *block, compiler_state *compiler, const opcode_desc *desc);
+static VECTOR_REG *generate_vector_select(rsp_state *rsp, drcuml_block *block, UINT32 op);
+static void generate_vector_accum_low(rsp_state *rsp, drcuml_block *block, VECTOR_REG *src);
+static void generate_vector_logic(rsp_state *rsp, drcuml_block *block, UINT32 op, opcode_t logicop, int invert, void (*fallback)(void *));
+static void generate_vector_add_sub(rsp_state *rsp, drcuml_block *block, compiler_state *compiler, UINT32 op, int subtract, void (*fallback)(void *));
 
 static void log_add_disasm_comment(rsp_state *rsp, drcuml_block *block, UINT32 pc, UINT32 op);
 
@@ -658,6 +665,11 @@ static CPU_INIT( rsp )
 	}
 	rsp->impstate->drcuml = auto_alloc(device->machine(), drcuml_state(*device, *cache, flags, 8, 32, 2));
 
+	/* inline vector code needs back-end support; otherwise every vector op calls its C handler */
+	drcbe_info beinfo;
+	rsp->impstate->drcuml->get_backend_info(beinfo);
+	rsp->impstate->vector_ops = beinfo.vector_ops;
+
 	/* add symbols for our stuff */
 	rsp->impstate->drcuml->symbol_add(&rsp->pc, sizeof(rsp->pc), "pc");
 	rsp->impstate->drcuml->symbol_add(&rsp->icount, sizeof(rsp->icount), "icount");
@@ -3938,6 +3950,127 @@ static void generate_delay_slot_and_branch(rsp_state *rsp, drcuml_block *block,
 }
 
 
+/*-------------------------------------------------
+    generate_vector_select - generate code to
+    apply the element selector to VS2; returns
+    the vector holding the selected elements
+-------------------------------------------------*/
+
+static VECTOR_REG *generate_vector_select(rsp_state *rsp, drcuml_block *block, UINT32 op)
+{
+	UINT8 selectors[8];
+	int i;
+
+	/* element types 0 and 1 select the whole vector unchanged */
+	if (EL < 2)
+		return &rsp->v[VS2REG];
+
+	for (i = 0; i < 8; i++)
+		selectors[i] = VEC_EL_2(EL, i);
+	UML_VSHUF(block, mem(&rsp->impstate->vsel), mem(&rsp->v[VS2REG]), selectors);	// vshuf   [vsel],[v[VS2REG]],EL
+	return &rsp->impstate->vsel;
+}
+
+
+/*-------------------------------------------------
+    generate_vector_accum_low - generate code to
+    copy the lanes of a vector into the low
+    words of the accumulators
+-------------------------------------------------*/
+
+static void generate_vector_accum_low(rsp_state *rsp, drcuml_block *block, VECTOR_REG *src)
+{
+	int i;
+
+	for (i = 0; i < 8; i++)
+	{
+		UML_LOAD(block, I0, &src->s[0], i, SIZE_WORD, SCALE_x2);						// load    i0,src,i,word
+		UML_STORE(block, &ACCUM_L(i), 0, I0, SIZE_WORD, SCALE_x2);						// store   ACCUM_L(i),i0,word
+	}
+}
+
+
+/*-------------------------------------------------
+    generate_vector_logic - generate inline code
+    for VAND/VNAND/VOR/VNOR/VXOR/VNXOR, or a call
+    to the C implementation if the back-end has
+    no vector opcodes
+-------------------------------------------------*/
+
+static void generate_vector_logic(rsp_state *rsp, drcuml_block *block, UINT32 op, opcode_t logicop, int invert, void (*fallback)(void *))
+{
+	VECTOR_REG *src2;
+
+	if (!rsp->impstate->vector_ops)
+	{
+		UML_MOV(block, mem(&rsp->impstate->arg0), op);									// mov     [arg0],op
+		UML_CALLC(block, fallback, rsp);												// callc   fallback,rsp
+		return;
+	}
+
+	src2 = generate_vector_select(rsp, block, op);
+	switch (logicop)
+	{
+		case OP_VAND:	UML_VAND(block, mem(&rsp->v[VDREG]), mem(&rsp->v[VS1REG]), mem(src2));	break;	// vand    [v[VDREG]],[v[VS1REG]],[src2]
+		case OP_VOR:	UML_VOR(block, mem(&rsp->v[VDREG]), mem(&rsp->v[VS1REG]), mem(src2));	break;	// vor     [v[VDREG]],[v[VS1REG]],[src2]
+		case OP_VXOR:	UML_VXOR(block, mem(&rsp->v[VDREG]), mem(&rsp->v[VS1REG]), mem(src2));	break;	// vxor    [v[VDREG]],[v[VS1REG]],[src2]
+		default:			fatalerror("generate_vector_logic: unexpected opcode %d", logicop);
+	}
+	if (invert)
+		UML_VNOT(block, mem(&rsp->v[VDREG]), mem(&rsp->v[VDREG]));					// vnot    [v[VDREG]],[v[VDREG]]
+	generate_vector_accum_low(rsp, block, &rsp->v[VDREG]);
+}
+
+
+/*-------------------------------------------------
+    generate_vector_add_sub - generate code for
+    VADD/VSUB; the inline path handles the common
+    case of clear carry flags and falls back to
+    the C implementation otherwise, or always if
+    the back-end has no vector opcodes
+-------------------------------------------------*/
+
+static void generate_vector_add_sub(rsp_state *rsp, drcuml_block *block, compiler_state *compiler, UINT32 op, int subtract, void (*fallback)(void *))
+{
+	code_label slow, done;
+	VECTOR_REG *src2;
+
+	if (!rsp->impstate->vector_ops)
+	{
+		UML_MOV(block, mem(&rsp->impstate->arg0), op);									// mov     [arg0],op
+		UML_CALLC(block, fallback, rsp);												// callc   fallback,rsp
+		return;
+	}
+
+	slow = compiler->labelnum++;
+	done = compiler->labelnum++;
+	UML_LOAD(block, I0, &rsp->flag[0], 0, SIZE_WORD, SCALE_x2);						// load    i0,flag[0],word
+	UML_TEST(block, I0, 0xff);															// test    i0,0xff
+	UML_JMPc(block, COND_NZ, slow);														// jmp     slow,NZ
+
+	/* the accumulator gets the wrapped sum, VD the saturated one */
+	src2 = generate_vector_select(rsp, block, op);
+	if (!subtract)
+	{
+		UML_VADD(block, mem(&rsp->impstate->vaccum), mem(&rsp->v[VS1REG]), mem(src2), SIZE_WORD);	// vadd    [vaccum],[v[VS1REG]],[src2],word
+		UML_VADDS(block, mem(&rsp->v[VDREG]), mem(&rsp->v[VS1REG]), mem(src2), SIZE_WORD);			// vadds   [v[VDREG]],[v[VS1REG]],[src2],word
+	}
+	else
+	{
+		UML_VSUB(block, mem(&rsp->impstate->vaccum), mem(&rsp->v[VS1REG]), mem(src2), SIZE_WORD);	// vsub    [vaccum],[v[VS1REG]],[src2],word
+		UML_VSUBS(block, mem(&rsp->v[VDREG]), mem(&rsp->v[VS1REG]), mem(src2), SIZE_WORD);			// vsubs   [v[VDREG]],[v[VS1REG]],[src2],word
+	}
+	generate_vector_accum_low(rsp, block, &rsp->impstate->vaccum);
+	UML_STORE(block, &rsp->flag[0], 0, 0, SIZE_WORD, SCALE_x2);						// store   flag[0],0,word
+	UML_JMP(block, done);																// jmp     done
+
+	UML_LABEL(block, slow);															// slow:
+	UML_MOV(block, mem(&rsp->impstate->arg0), op);										// mov     [arg0],op
+	UML_CALLC(block, fallback, rsp);													// callc   fallback,rsp
+	UML_LABEL(block, done);															// done:
+}
+
+
 /*-------------------------------------------------
     generate_opcode - generate code for a specific
     opcode
@@ -4015,13 +4148,11 @@ static int generate_vector_opcode(rsp_state *rsp, drcuml_block *block, compiler_
 			return TRUE;
 
 		case 0x10:		/* VADD */
-			UML_MOV(block, mem(&rsp->impstate->arg0), desc->opptr.l[0]);		// mov     [arg0],desc->opptr.l
-			UML_CALLC(block, cfunc_rsp_vadd, rsp);
+			generate_vector_add_sub(rsp, block, compiler, op, FALSE, cfunc_rsp_vadd);
 			return TRUE;
 
 		case 0x11:		/* VSUB */
-			UML_MOV(block, mem(&rsp->impstate->arg0), desc->opptr.l[0]);		// mov     [arg0],desc->opptr.l
-			UML_CALLC(block, cfunc_rsp_vsub, rsp);
+			generate_vector_add_sub(rsp, block, compiler, op, TRUE, cfunc_rsp_vsub);
 			return TRUE;
 
 		case 0x13:		/* VABS */
@@ -4085,33 +4216,27 @@ static int generate_vector_opcode(rsp_state *rsp, drcuml_block *block, compiler_
 			return TRUE;
 
 		case 0x28:		/* VAND */
-			UML_MOV(block, mem(&rsp->impstate->arg0), desc->opptr.l[0]);		// mov     [arg0],desc->opptr.l
-			UML_CALLC(block, cfunc_rsp_vand, rsp);
+			generate_vector_logic(rsp, block, op, OP_VAND, FALSE, cfunc_rsp_vand);
 			return TRUE;
 
 		case 0x29:		/* VNAND */
-			UML_MOV(block, mem(&rsp->impstate->arg0), desc->opptr.l[0]);		// mov     [arg0],desc->opptr.l
-			UML_CALLC(block, cfunc_rsp_vnand, rsp);
+			generate_vector_logic(rsp, block, op, OP_VAND, TRUE, cfunc_rsp_vnand);
 			return TRUE;
 
 		case 0x2a:		/* VOR */
-			UML_MOV(block, mem(&rsp->impstate->arg0), desc->opptr.l[0]);		// mov     [arg0],desc->opptr.l
-			UML_CALLC(block, cfunc_rsp_vor, rsp);
+			generate_vector_logic(rsp, block, op, OP_VOR, FALSE, cfunc_rsp_vor);
 			return TRUE;
 
 		case 0x2b:		/* VNOR */
-			UML_MOV(block, mem(&rsp->impstate->arg0), desc->opptr.l[0]);		// mov     [arg0],desc->opptr.l
-			UML_CALLC(block, cfunc_rsp_vnor, rsp);
+			generate_vector_logic(rsp, block, op, OP_VOR, TRUE, cfunc_rsp_vnor);
 			return TRUE;
 
 		case 0x2c:		/* VXOR */
-			UML_MOV(block, mem(&rsp->impstate->arg0), desc->opptr.l[0]);		// mov     [arg0],desc->opptr.l
-			UML_CALLC(block, cfunc_rsp_vxor, rsp);
+			generate_vector_logic(rsp, block, op, OP_VXOR, FALSE, cfunc_rsp_vxor);
 			return TRUE;
 
 		case 0x2d:		/* VNXOR */
-			UML_MOV(block, mem(&rsp->impstate->arg0), desc->opptr.l[0]);		// mov     [arg0],desc->opptr.l
-			UML_CALLC(block, cfunc_rsp_vnxor, rsp);
+			generate_vector_logic(rsp, block, op, OP_VXOR, TRUE, cfunc_rsp_vnxor);
 			return TRUE;
 
 		case 0x30:		/* VRCP */
@@ -140,6 +140,7 @@ using namespace uml;
 #define PTYPES_IMV		(PTYPES_IMM | PTYPES_MVAR)
 #define PTYPES_IANY		(PTYPES_IRM | PTYPES_IMV)
 #define PTYPES_FANY		(PTYPES_FRM)
+#define PTYPES_VANY		(PTYPES_MEM)
 
 
 
@@ -244,6 +245,17 @@ const opcode_info instruction::s_opcode_info_table[OP_MAX] =
 	OPINFO2(FSQRT,   "f#sqrt",   4|8, false, NONE, NONE, ALL,  PINFO(OUT, OP, FRM), PINFO(IN, OP, FANY))
 	OPINFO2(FRECIP,  "f#recip",  4|8, false, NONE, NONE, ALL,  PINFO(OUT, OP, FRM), PINFO(IN, OP, FANY))
 	OPINFO2(FRSQRT,  "f#rsqrt",  4|8, false, NONE, NONE, ALL,  PINFO(OUT, OP, FRM), PINFO(IN, OP, FANY))
+
+	// 128-bit Vector Operations
+	OPINFO3(VAND,    "vand",     16,  false, NONE, NONE, NONE, PINFO(OUT, OP, VANY), PINFO(IN, OP, VANY), PINFO(IN, OP, VANY))
+	OPINFO3(VOR,     "vor",      16,  false, NONE, NONE, NONE, PINFO(OUT, OP, VANY), PINFO(IN, OP, VANY), PINFO(IN, OP, VANY))
+	OPINFO3(VXOR,    "vxor",     16,  false, NONE, NONE, NONE, PINFO(OUT, OP, VANY), PINFO(IN, OP, VANY), PINFO(IN, OP, VANY))
+	OPINFO2(VNOT,    "vnot",     16,  false, NONE, NONE, NONE, PINFO(OUT, OP, VANY), PINFO(IN, OP, VANY))
+	OPINFO4(VADD,    "vadd",     16,  false, NONE, NONE, NONE, PINFO(OUT, OP, VANY), PINFO(IN, OP, VANY), PINFO(IN, OP, VANY), PINFO(IN, OP, SIZE))
+	OPINFO4(VSUB,    "vsub",     16,  false, NONE, NONE, NONE, PINFO(OUT, OP, VANY), PINFO(IN, OP, VANY), PINFO(IN, OP, VANY), PINFO(IN, OP, SIZE))
+	OPINFO4(VADDS,   "vadds",    16,  false, NONE, NONE, NONE, PINFO(OUT, OP, VANY), PINFO(IN, OP, VANY), PINFO(IN, OP, VANY), PINFO(IN, OP, SIZE))
+	OPINFO4(VSUBS,   "vsubs",    16,  false, NONE, NONE, NONE, PINFO(OUT, OP, VANY), PINFO(IN, OP, VANY), PINFO(IN, OP, VANY), PINFO(IN, OP, SIZE))
+	OPINFO3(VSHUF,   "vshuf",    16,  false, NONE, NONE, NONE, PINFO(OUT, OP, VANY), PINFO(IN, OP, VANY), PINFO(IN, 4, IMM))
 };
 
 
@@ -794,7 +806,7 @@ void uml::instruction::validate()
 
 	// validate raw information
 	assert(m_opcode != OP_INVALID && m_opcode < OP_MAX);
-	assert(m_size == 1 || m_size == 2 || m_size == 4 || m_size == 8);
+	assert(m_size == 1 || m_size == 2 || m_size == 4 || m_size == 8 || m_size == 16);
 
 	// validate against opcode limits
 	assert((opinfo.sizes & m_size) != 0);
@@ -248,6 +248,17 @@ namespace uml
 		OP_FRECIP,					// FRECIP  dst,src1
 		OP_FRSQRT,					// FRSQRT  dst,src1
 
+		// 128-bit vector operations
+		OP_VAND,					// VAND    dst,src1,src2
+		OP_VOR,						// VOR     dst,src1,src2
+		OP_VXOR,					// VXOR    dst,src1,src2
+		OP_VNOT,					// VNOT    dst,src
+		OP_VADD,					// VADD    dst,src1,src2,lanesize
+		OP_VSUB,					// VSUB    dst,src1,src2,lanesize
+		OP_VADDS,					// VADDS   dst,src1,src2,lanesize
+		OP_VSUBS,					// VSUBS   dst,src1,src2,lanesize
+		OP_VSHUF,					// VSHUF   dst,src,selectors
+
 		OP_MAX
 	};
 
@@ -596,6 +607,22 @@ namespace uml
 		void fdrecip(parameter dst, parameter src1) { configure(OP_FRECIP, 8, dst, src1); }
 		void fdrsqrt(parameter dst, parameter src1) { configure(OP_FRSQRT, 8, dst, src1); }
 
+		// 128-bit vector operations; operands are 16-byte memory blocks holding packed
+		// lanes in host order. VADDS/VSUBS saturate signed lanes, and VSHUF picks each
+		// 16-bit lane from selectors[lane]
+		void vand(parameter dst, parameter src1, parameter src2) { configure(OP_VAND, 16, dst, src1, src2); }
+		void vor(parameter dst, parameter src1, parameter src2) { configure(OP_VOR, 16, dst, src1, src2); }
+		void vxor(parameter dst, parameter src1, parameter src2) { configure(OP_VXOR, 16, dst, src1, src2); }
+		void vnot(parameter dst, parameter src1) { configure(OP_VNOT, 16, dst, src1); }
+		void vadd(parameter dst, parameter src1, parameter src2, operand_size lanesize) { configure(OP_VADD, 16, dst, src1, src2, parameter::make_size(lanesize)); }
+		void vsub(parameter dst, parameter src1, parameter src2, operand_size lanesize) { configure(OP_VSUB, 16, dst, src1, src2, parameter::make_size(lanesize)); }
+		void vadds(parameter dst, parameter src1, parameter src2, operand_size lanesize) { assert(lanesize <= SIZE_WORD); configure(OP_VADDS, 16, dst, src1, src2, parameter::make_size(lanesize)); }
+		void vsubs(parameter dst, parameter src1, parameter src2, operand_size lanesize) { assert(lanesize <= SIZE_WORD); configure(OP_VSUBS, 16, dst, src1, src2, parameter::make_size(lanesize)); }
+		void vshuf(parameter dst, parameter src1, const UINT8 *selectors) { configure(OP_VSHUF, 16, dst, src1, vshuf_selectors(selectors)); }
+
+		// helper to pack 8 word lane selectors into a VSHUF immediate
+		static UINT32 vshuf_selectors(const UINT8 *selectors) { UINT32 result = 0; for (int lane = 0; lane < 8; lane++) result |= (selectors[lane] & 7) << (3 * lane); return result; }
+
 		// constants
 		static const int MAX_PARAMS = 4;
 
@@ -1303,6 +1303,13 @@ inline void emit_op(x86code *&emitptr, UINT32 op, UINT8 opsize, UINT8 reg, UINT8
 	if (opsize == OP_16BIT)
 		emit_byte(emitptr, PREFIX_OPSIZE);
 
+	// mandatory SSE prefixes must come ahead of any REX prefix
+	if ((op & 0xff0000) != 0 && ((op >> 16) & 0xff) != 0x0f)
+	{
+		emit_byte(emitptr, op >> 16);
+		op &= ~0xff0000;
+	}
+
 #if (X86EMIT_SIZE == 64)
 {
 	UINT8 rex;
@@ -3211,6 +3218,99 @@ inline void emit_cvttpd2dq_r128_m128(x86code *&emitptr, UINT8 dreg, x86_memref m
 inline void emit_roundpd_r128_r128_imm(x86code *&emitptr, UINT8 dreg, UINT8 sreg, UINT8 imm)		{ emit_op_modrm_reg(emitptr, OP_ROUNDPD_Vdq_Wdq_Ib, OP_32BIT, dreg, sreg); emit_byte(emitptr, imm); }
 inline void emit_roundpd_r128_m128_imm(x86code *&emitptr, UINT8 dreg, x86_memref memref, UINT8 imm) { emit_op_modrm_mem(emitptr, OP_ROUNDPD_Vdq_Wdq_Ib, OP_32BIT, dreg, memref); emit_byte(emitptr, imm); }
 
+
+//**************************************************************************
+//  SSE PACKED INTEGER EMITTERS
+//**************************************************************************
+
+inline void emit_movdqa_r128_r128(x86code *&emitptr, UINT8 dreg, UINT8 sreg)				{ emit_op_modrm_reg(emitptr, OP_MOVDQA_Vdq_Wdq, OP_32BIT, dreg, sreg); }
+inline void emit_movdqu_r128_m128(x86code *&emitptr, UINT8 dreg, x86_memref memref)			{ emit_op_modrm_mem(emitptr, OP_MOVDQU_Vdq_Wdq, OP_32BIT, dreg, memref); }
+inline void emit_movdqu_m128_r128(x86code *&emitptr, x86_memref memref, UINT8 sreg)			{ emit_op_modrm_mem(emitptr, OP_MOVDQU_Wdq_Vdq, OP_32BIT, sreg, memref); }
+
+inline void emit_paddb_r128_r128(x86code *&emitptr, UINT8 dreg, UINT8 sreg)					{ emit_op_modrm_reg(emitptr, OP_PADDB_Vdq_Wdq, OP_32BIT, dreg, sreg); }
+inline void emit_paddb_r128_m128(x86code *&emitptr, UINT8 dreg, x86_memref memref)			{ emit_op_modrm_mem(emitptr, OP_PADDB_Vdq_Wdq, OP_32BIT, dreg, memref); }
+
+inline void emit_paddw_r128_r128(x86code *&emitptr, UINT8 dreg, UINT8 sreg)					{ emit_op_modrm_reg(emitptr, OP_PADDW_Vdq_Wdq, OP_32BIT, dreg, sreg); }
+inline void emit_paddw_r128_m128(x86code *&emitptr, UINT8 dreg, x86_memref memref)			{ emit_op_modrm_mem(emitptr, OP_PADDW_Vdq_Wdq, OP_32BIT, dreg, memref); }
+
+inline void emit_paddd_r128_r128(x86code *&emitptr, UINT8 dreg, UINT8 sreg)					{ emit_op_modrm_reg(emitptr, OP_PADDD_Vdq_Wdq, OP_32BIT, dreg, sreg); }
+inline void emit_paddd_r128_m128(x86code *&emitptr, UINT8 dreg, x86_memref memref)			{ emit_op_modrm_mem(emitptr, OP_PADDD_Vdq_Wdq, OP_32BIT, dreg, memref); }
+
+inline void emit_paddq_r128_r128(x86code *&emitptr, UINT8 dreg, UINT8 sreg)					{ emit_op_modrm_reg(emitptr, OP_PADDQ_Vdq_Wdq, OP_32BIT, dreg, sreg); }
+inline void emit_paddq_r128_m128(x86code *&emitptr, UINT8 dreg, x86_memref memref)			{ emit_op_modrm_mem(emitptr, OP_PADDQ_Vdq_Wdq, OP_32BIT, dreg, memref); }
+
+inline void emit_psubb_r128_r128(x86code *&emitptr, UINT8 dreg, UINT8 sreg)					{ emit_op_modrm_reg(emitptr, OP_PSUBB_Vdq_Wdq, OP_32BIT, dreg, sreg); }
+inline void emit_psubb_r128_m128(x86code *&emitptr, UINT8 dreg, x86_memref memref)			{ emit_op_modrm_mem(emitptr, OP_PSUBB_Vdq_Wdq, OP_32BIT, dreg, memref); }
+
+inline void emit_psubw_r128_r128(x86code *&emitptr, UINT8 dreg, UINT8 sreg)					{ emit_op_modrm_reg(emitptr, OP_PSUBW_Vdq_Wdq, OP_32BIT, dreg, sreg); }
+inline void emit_psubw_r128_m128(x86code *&emitptr, UINT8 dreg, x86_memref memref)			{ emit_op_modrm_mem(emitptr, OP_PSUBW_Vdq_Wdq, OP_32BIT, dreg, memref); }
+
+inline void emit_psubd_r128_r128(x86code *&emitptr, UINT8 dreg, UINT8 sreg)					{ emit_op_modrm_reg(emitptr, OP_PSUBD_Vdq_Wdq, OP_32BIT, dreg, sreg); }
+inline void emit_psubd_r128_m128(x86code *&emitptr, UINT8 dreg, x86_memref memref)			{ emit_op_modrm_mem(emitptr, OP_PSUBD_Vdq_Wdq, OP_32BIT, dreg, memref); }
+
+inline void emit_psubq_r128_r128(x86code *&emitptr, UINT8 dreg, UINT8 sreg)					{ emit_op_modrm_reg(emitptr, OP_PSUBQ_Vdq_Wdq, OP_32BIT, dreg, sreg); }
+inline void emit_psubq_r128_m128(x86code *&emitptr, UINT8 dreg, x86_memref memref)			{ emit_op_modrm_mem(emitptr, OP_PSUBQ_Vdq_Wdq, OP_32BIT, dreg, memref); }
+
+inline void emit_paddsb_r128_r128(x86code *&emitptr, UINT8 dreg, UINT8 sreg)				{ emit_op_modrm_reg(emitptr, OP_PADDSB_Vdq_Wdq, OP_32BIT, dreg, sreg); }
+inline void emit_paddsb_r128_m128(x86code *&emitptr, UINT8 dreg, x86_memref memref)			{ emit_op_modrm_mem(emitptr, OP_PADDSB_Vdq_Wdq, OP_32BIT, dreg, memref); }
+
+inline void emit_paddsw_r128_r128(x86code *&emitptr, UINT8 dreg, UINT8 sreg)				{ emit_op_modrm_reg(emitptr, OP_PADDSW_Vdq_Wdq, OP_32BIT, dreg, sreg); }
+inline void emit_paddsw_r128_m128(x86code *&emitptr, UINT8 dreg, x86_memref memref)			{ emit_op_modrm_mem(emitptr, OP_PADDSW_Vdq_Wdq, OP_32BIT, dreg, memref); }
+
+inline void emit_psubsb_r128_r128(x86code *&emitptr, UINT8 dreg, UINT8 sreg)				{ emit_op_modrm_reg(emitptr, OP_PSUBSB_Vdq_Wdq, OP_32BIT, dreg, sreg); }
+inline void emit_psubsb_r128_m128(x86code *&emitptr, UINT8 dreg, x86_memref memref)			{ emit_op_modrm_mem(emitptr, OP_PSUBSB_Vdq_Wdq, OP_32BIT, dreg, memref); }
+
+inline void emit_psubsw_r128_r128(x86code *&emitptr, UINT8 dreg, UINT8 sreg)				{ emit_op_modrm_reg(emitptr, OP_PSUBSW_Vdq_Wdq, OP_32BIT, dreg, sreg); }
+inline void emit_psubsw_r128_m128(x86code *&emitptr, UINT8 dreg, x86_memref memref)			{ emit_op_modrm_mem(emitptr, OP_PSUBSW_Vdq_Wdq, OP_32BIT, dreg, memref); }
+
+inline void emit_pmullw_r128_r128(x86code *&emitptr, UINT8 dreg, UINT8 sreg)				{ emit_op_modrm_reg(emitptr, OP_PMULLW_Vdq_Wdq, OP_32BIT, dreg, sreg); }
+inline void emit_pmullw_r128_m128(x86code *&emitptr, UINT8 dreg, x86_memref memref)			{ emit_op_modrm_mem(emitptr, OP_PMULLW_Vdq_Wdq, OP_32BIT, dreg, memref); }
+
+inline void emit_pmulhw_r128_r128(x86code *&emitptr, UINT8 dreg, UINT8 sreg)				{ emit_op_modrm_reg(emitptr, OP_PMULHW_Vdq_Wdq, OP_32BIT, dreg, sreg); }
+inline void emit_pmulhw_r128_m128(x86code *&emitptr, UINT8 dreg, x86_memref memref)			{ emit_op_modrm_mem(emitptr, OP_PMULHW_Vdq_Wdq, OP_32BIT, dreg, memref); }
+
+inline void emit_pand_r128_r128(x86code *&emitptr, UINT8 dreg, UINT8 sreg)					{ emit_op_modrm_reg(emitptr, OP_PAND_Vdq_Wdq, OP_32BIT, dreg, sreg); }
+inline void emit_pand_r128_m128(x86code *&emitptr, UINT8 dreg, x86_memref memref)			{ emit_op_modrm_mem(emitptr, OP_PAND_Vdq_Wdq, OP_32BIT, dreg, memref); }
+
+inline void emit_pandn_r128_r128(x86code *&emitptr, UINT8 dreg, UINT8 sreg)					{ emit_op_modrm_reg(emitptr, OP_PANDN_Vdq_Wdq, OP_32BIT, dreg, sreg); }
+inline void emit_pandn_r128_m128(x86code *&emitptr, UINT8 dreg, x86_memref memref)			{ emit_op_modrm_mem(emitptr, OP_PANDN_Vdq_Wdq, OP_32BIT, dreg, memref); }
+
+inline void emit_por_r128_r128(x86code *&emitptr, UINT8 dreg, UINT8 sreg)					{ emit_op_modrm_reg(emitptr, OP_POR_Vdq_Wdq, OP_32BIT, dreg, sreg); }
+inline void emit_por_r128_m128(x86code *&emitptr, UINT8 dreg, x86_memref memref)			{ emit_op_modrm_mem(emitptr, OP_POR_Vdq_Wdq, OP_32BIT, dreg, memref); }
+
+inline void emit_pxor_r128_r128(x86code *&emitptr, UINT8 dreg, UINT8 sreg)					{ emit_op_modrm_reg(emitptr, OP_PXOR_Vdq_Wdq, OP_32BIT, dreg, sreg); }
+inline void emit_pxor_r128_m128(x86code *&emitptr, UINT8 dreg, x86_memref memref)			{ emit_op_modrm_mem(emitptr, OP_PXOR_Vdq_Wdq, OP_32BIT, dreg, memref); }
+
+inline void emit_pcmpeqb_r128_r128(x86code *&emitptr, UINT8 dreg, UINT8 sreg)				{ emit_op_modrm_reg(emitptr, OP_PCMPEQB_Vdq_Wdq, OP_32BIT, dreg, sreg); }
+inline void emit_pcmpeqb_r128_m128(x86code *&emitptr, UINT8 dreg, x86_memref memref)		{ emit_op_modrm_mem(emitptr, OP_PCMPEQB_Vdq_Wdq, OP_32BIT, dreg, memref); }
+
+inline void emit_pcmpeqw_r128_r128(x86code *&emitptr, UINT8 dreg, UINT8 sreg)				{ emit_op_modrm_reg(emitptr, OP_PCMPEQW_Vdq_Wdq, OP_32BIT, dreg, sreg); }
+inline void emit_pcmpeqw_r128_m128(x86code *&emitptr, UINT8 dreg, x86_memref memref)		{ emit_op_modrm_mem(emitptr, OP_PCMPEQW_Vdq_Wdq, OP_32BIT, dreg, memref); }
+
+inline void emit_pcmpeqd_r128_r128(x86code *&emitptr, UINT8 dreg, UINT8 sreg)				{ emit_op_modrm_reg(emitptr, OP_PCMPEQD_Vdq_Wdq, OP_32BIT, dreg, sreg); }
+inline void emit_pcmpeqd_r128_m128(x86code *&emitptr, UINT8 dreg, x86_memref memref)		{ emit_op_modrm_mem(emitptr, OP_PCMPEQD_Vdq_Wdq, OP_32BIT, dreg, memref); }
+
+inline void emit_pcmpgtb_r128_r128(x86code *&emitptr, UINT8 dreg, UINT8 sreg)				{ emit_op_modrm_reg(emitptr, OP_PCMPGTB_Vdq_Wdq, OP_32BIT, dreg, sreg); }
+inline void emit_pcmpgtb_r128_m128(x86code *&emitptr, UINT8 dreg, x86_memref memref)		{ emit_op_modrm_mem(emitptr, OP_PCMPGTB_Vdq_Wdq, OP_32BIT, dreg, memref); }
+
+inline void emit_pcmpgtw_r128_r128(x86code *&emitptr, UINT8 dreg, UINT8 sreg)				{ emit_op_modrm_reg(emitptr, OP_PCMPGTW_Vdq_Wdq, OP_32BIT, dreg, sreg); }
+inline void emit_pcmpgtw_r128_m128(x86code *&emitptr, UINT8 dreg, x86_memref memref)		{ emit_op_modrm_mem(emitptr, OP_PCMPGTW_Vdq_Wdq, OP_32BIT, dreg, memref); }
+
+inline void emit_pcmpgtd_r128_r128(x86code *&emitptr, UINT8 dreg, UINT8 sreg)				{ emit_op_modrm_reg(emitptr, OP_PCMPGTD_Vdq_Wdq, OP_32BIT, dreg, sreg); }
+inline void emit_pcmpgtd_r128_m128(x86code *&emitptr, UINT8 dreg, x86_memref memref)		{ emit_op_modrm_mem(emitptr, OP_PCMPGTD_Vdq_Wdq, OP_32BIT, dreg, memref); }
+
+inline void emit_pshufd_r128_r128_imm(x86code *&emitptr, UINT8 dreg, UINT8 sreg, UINT8 imm)		{ emit_op_modrm_reg(emitptr, OP_PSHUFD_Vdq_Wdq_Ib, OP_32BIT, dreg, sreg); emit_byte(emitptr, imm); }
+inline void emit_pshufd_r128_m128_imm(x86code *&emitptr, UINT8 dreg, x86_memref memref, UINT8 imm)	{ emit_op_modrm_mem(emitptr, OP_PSHUFD_Vdq_Wdq_Ib, OP_32BIT, dreg, memref); emit_byte(emitptr, imm); }
+
+inline void emit_pshuflw_r128_r128_imm(x86code *&emitptr, UINT8 dreg, UINT8 sreg, UINT8 imm)		{ emit_op_modrm_reg(emitptr, OP_PSHUFLW_Vdq_Wdq_Ib, OP_32BIT, dreg, sreg); emit_byte(emitptr, imm); }
+inline void emit_pshuflw_r128_m128_imm(x86code *&emitptr, UINT8 dreg, x86_memref memref, UINT8 imm)	{ emit_op_modrm_mem(emitptr, OP_PSHUFLW_Vdq_Wdq_Ib, OP_32BIT, dreg, memref); emit_byte(emitptr, imm); }
+
+inline void emit_pshufhw_r128_r128_imm(x86code *&emitptr, UINT8 dreg, UINT8 sreg, UINT8 imm)		{ emit_op_modrm_reg(emitptr, OP_PSHUFHW_Vdq_Wdq_Ib, OP_32BIT, dreg, sreg); emit_byte(emitptr, imm); }
+inline void emit_pshufhw_r128_m128_imm(x86code *&emitptr, UINT8 dreg, x86_memref memref, UINT8 imm)	{ emit_op_modrm_mem(emitptr, OP_PSHUFHW_Vdq_Wdq_Ib, OP_32BIT, dreg, memref); emit_byte(emitptr, imm); }
+
+inline void emit_pextrw_r32_r128_imm(x86code *&emitptr, UINT8 dreg, UINT8 sreg, UINT8 imm)		{ emit_op_modrm_reg(emitptr, OP_PEXTRW_Gw_Vw_Ib, OP_32BIT, dreg, sreg); emit_byte(emitptr, imm); }
+inline void emit_pinsrw_r128_r32_imm(x86code *&emitptr, UINT8 dreg, UINT8 sreg, UINT8 imm)		{ emit_op_modrm_reg(emitptr, OP_PINSRW_Vw_Ew_Ib, OP_32BIT, dreg, sreg); emit_byte(emitptr, imm); }
+
 };
 
 #undef X86EMIT_SIZE
@@ -146,9 +146,12 @@ static void execute_snap(running_machine &machine, int ref, int params, const ch
 static void execute_source(running_machine &machine, int ref, int params, const char **param);
 static void execute_map(running_machine &machine, int ref, int params, const char **param);
 static void execute_memdump(running_machine &machine, int ref, int params, const char **param);
+static void execute_membench(running_machine &machine, int ref, int params, const char **param);
+static void execute_memstats(running_machine &machine, int ref, int params, const char **param);
 static void execute_symlist(running_machine &machine, int ref, int params, const char **param);
 static void execute_softreset(running_machine &machine, int ref, int params, const char **param);
 static void execute_hardreset(running_machine &machine, int ref, int params, const char **param);
+static void execute_fastboot(running_machine &machine, int ref, int params, const char **param);
 static void execute_images(running_machine &machine, int ref, int params, const char **param);
 static void execute_mount(running_machine &machine, int ref, int params, const char **param);
 static void execute_unmount(running_machine &machine, int ref, int params, const char **param);
@@ -365,11 +368,16 @@ void debug_command_init(running_machine &machine)
 	debug_console_register_command(machine, "mapd",		CMDFLAG_NONE, AS_DATA, 1, 1, execute_map);
 	debug_console_register_command(machine, "mapi",		CMDFLAG_NONE, AS_IO, 1, 1, execute_map);
 	debug_console_register_command(machine, "memdump",	CMDFLAG_NONE, 0, 0, 1, execute_memdump);
+	debug_console_register_command(machine, "membench",	CMDFLAG_NONE, AS_PROGRAM, 1, 2, execute_membench);
+	debug_console_register_command(machine, "membenchd",CMDFLAG_NONE, AS_DATA, 1, 2, execute_membench);
+	debug_console_register_command(machine, "membenchi",CMDFLAG_NONE, AS_IO, 1, 2, execute_membench);
+	debug_console_register_command(machine, "memstats",	CMDFLAG_NONE, 0, 0, 1, execute_memstats);
 
 	debug_console_register_command(machine, "symlist",	CMDFLAG_NONE, 0, 0, 1, execute_symlist);
 
 	debug_console_register_command(machine, "softreset",	CMDFLAG_NONE, 0, 0, 1, execute_softreset);
 	debug_console_register_command(machine, "hardreset",	CMDFLAG_NONE, 0, 0, 1, execute_hardreset);
+	debug_console_register_command(machine, "fastboot",	CMDFLAG_NONE, 0, 0, 0, execute_fastboot);
 
 	debug_console_register_command(machine, "images",	CMDFLAG_NONE, 0, 0, 0, execute_images);
 	debug_console_register_command(machine, "mount",	CMDFLAG_NONE, 0, 2, 2, execute_mount);
@@ -2580,6 +2588,130 @@ static void execute_map(running_machine &machine, int ref, int params, const cha
 }
 
 
+/*-------------------------------------------------
+    membench_run - time a loop of bus-width reads
+    over one 1k window through the given accessor
+-------------------------------------------------*/
+
+template<typename _Type, _Type (address_space::*_Read)(offs_t)>
+static UINT64 membench_run(address_space &space, offs_t base, UINT64 count, osd_ticks_t &elapsed)
+{
+	UINT64 sum = 0;
+	osd_ticks_t start = osd_ticks();
+	for (UINT64 index = 0; index < count; index++)
+		sum += (space.*_Read)((base + ((index * sizeof(_Type)) & 0x3ff)) & space.bytemask());
+	elapsed = osd_ticks() - start;
+	return sum;
+}
+
+
+/*-------------------------------------------------
+    execute_membench - execute the membench
+    command
+-------------------------------------------------*/
+
+static void execute_membench(running_machine &machine, int ref, int params, const char **param)
+{
+	UINT64 address, count = 10000000;
+	address_space *space;
+	osd_ticks_t direct_ticks = 0, cached_ticks = 0;
+	UINT64 direct_sum = 0, cached_sum = 0;
+
+	/* validate parameters */
+	if (!debug_command_parameter_number(machine, param[0], &address))
+		return;
+	if (params > 1 && !debug_command_parameter_number(machine, param[1], &count))
+		return;
+	if (!debug_command_parameter_cpu_space(machine, NULL, ref, &space))
+		return;
+	if (count == 0)
+		return;
+
+	/* run the regular dispatch and the page cache over the same addresses */
+	offs_t base = space->address_to_byte(address) & space->bytemask();
+	switch (space->data_width())
+	{
+		case 8:
+			direct_sum = membench_run<UINT8, &address_space::read_byte>(*space, base, count, direct_ticks);
+			cached_sum = membench_run<UINT8, &address_space::read_byte_cached>(*space, base, count, cached_ticks);
+			break;
+
+		case 16:
+			direct_sum = membench_run<UINT16, &address_space::read_word>(*space, base, count, direct_ticks);
+			cached_sum = membench_run<UINT16, &address_space::read_word_cached>(*space, base, count, cached_ticks);
+			break;
+
+		case 32:
+			direct_sum = membench_run<UINT32, &address_space::read_dword>(*space, base, count, direct_ticks);
+			cached_sum = membench_run<UINT32, &address_space::read_dword_cached>(*space, base, count, cached_ticks);
+			break;
+
+		case 64:
+			direct_sum = membench_run<UINT64, &address_space::read_qword>(*space, base, count, direct_ticks);
+			cached_sum = membench_run<UINT64, &address_space::read_qword_cached>(*space, base, count, cached_ticks);
+			break;
+	}
+
+	/* report the time per access */
+	double direct_ns = (double)direct_ticks * 1e9 / ((double)osd_ticks_per_second() * (double)count);
+	double cached_ns = (double)cached_ticks * 1e9 / ((double)osd_ticks_per_second() * (double)count);
+	debug_console_printf(machine, "%s: %d reads of %d bits at %s\n", space->name(), (int)count, space->data_width(), core_i64_hex_format(address, space->logaddrchars()));
+	debug_console_printf(machine, "  dispatch:   %.2f ns/read\n", direct_ns);
+	debug_console_printf(machine, "  page cache: %.2f ns/read (%.2fx)\n", cached_ns, (cached_ns > 0) ? direct_ns / cached_ns : 0.0);
+	if (direct_sum != cached_sum)
+		debug_console_printf(machine, "  warning: results differ between the two paths\n");
+}
+
+
+/*-------------------------------------------------
+    execute_memstats - execute the memstats
+    command
+-------------------------------------------------*/
+
+static void execute_memstats(running_machine &machine, int ref, int params, const char **param)
+{
+	/* turn counting on or off, or clear the counters */
+	if (params > 0)
+	{
+		if (!core_stricmp(param[0], "on"))
+		{
+			machine.memory().enable_access_stats(true);
+			debug_console_printf(machine, "Memory access counting enabled\n");
+		}
+		else if (!core_stricmp(param[0], "off"))
+		{
+			machine.memory().enable_access_stats(false);
+			debug_console_printf(machine, "Memory access counting disabled\n");
+		}
+		else if (!core_stricmp(param[0], "clear"))
+		{
+			machine.memory().reset_access_stats();
+			debug_console_printf(machine, "Memory access counters cleared\n");
+		}
+		else
+			debug_console_printf(machine, "Invalid parameter '%s'\n", param[0]);
+		return;
+	}
+
+	/* otherwise, print the report a line at a time */
+	astring report;
+	machine.memory().access_stats_report(report, 16);
+	if (report.len() == 0)
+	{
+		debug_console_printf(machine, "No memory accesses have been counted; use 'memstats on' to start\n");
+		return;
+	}
+	for (int start = 0, end; start < report.len(); start = end + 1)
+	{
+		end = report.chr(start, '\n');
+		if (end == -1)
+			end = report.len();
+		astring line(report, start, end - start);
+		debug_console_printf(machine, "%s\n", line.cstr());
+	}
+}
+
+
 /*-------------------------------------------------
     execute_memdump - execute the memdump command
 -------------------------------------------------*/
@@ -2686,6 +2818,19 @@ static void execute_hardreset(running_machine &machine, int ref, int params, con
 	machine.schedule_hard_reset();
 }
 
+
+/*-------------------------------------------------
+    execute_fastboot - execute the fastboot command
+-------------------------------------------------*/
+
+static void execute_fastboot(running_machine &machine, int ref, int params, const char **param)
+{
+	if (machine.schedule_fastboot_save())
+		debug_console_printf(machine, "Fast boot snapshot scheduled\n");
+	else
+		debug_console_printf(machine, "Fast boot is not active; start with -fastboot to use it\n");
+}
+
 /*-------------------------------------------------
     execute_images - lists all image devices with
     mounted files
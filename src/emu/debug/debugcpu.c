@@ -2755,10 +2755,14 @@ void device_debug::compute_debug_flags()
 	running_machine &machine = m_device.machine();
 	debugcpu_private *global = machine.debugcpu_data;
 
-	// clear out global flags by default, keep DEBUG_FLAG_OSD_ENABLED
-	machine.debug_flags &= DEBUG_FLAG_OSD_ENABLED;
+	// clear out global flags by default, keep DEBUG_FLAG_OSD_ENABLED and DEBUG_FLAG_PROFILE_CALLS
+	machine.debug_flags &= DEBUG_FLAG_OSD_ENABLED | DEBUG_FLAG_PROFILE_CALLS;
 	machine.debug_flags |= DEBUG_FLAG_ENABLED;
 
+	// the guest profiler needs the hook whatever the debugger is doing
+	if ((machine.debug_flags & DEBUG_FLAG_PROFILE_CALLS) != 0)
+		machine.debug_flags |= DEBUG_FLAG_CALL_HOOK;
+
 	// if we are ignoring this CPU, or if events are pending, we're done
 	if ((m_flags & DEBUG_FLAG_OBSERVING) == 0 || machine.scheduled_event_pending() || machine.save_or_load_pending())
 		return;
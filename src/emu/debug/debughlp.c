@@ -83,6 +83,7 @@ static const help_item static_help_list[] =
 		"  symlist [<cpu>] -- lists registered symbols\n"
 		"  softreset -- executes a soft reset\n"
 		"  hardreset -- executes a hard reset\n"
+		"  fastboot -- takes the fast boot snapshot now\n"
 		"  print <item>[,...] -- prints one or more <item>s to the console\n"
 		"  printf <format>[,<item>[,...]] -- prints one or more <item>s to the console using <format>\n"
 		"  logerror <format>[,<item>[,...]] -- outputs one or more <item>s to the error.log\n"
@@ -114,6 +115,8 @@ static const help_item static_help_list[] =
 		"  mapd <address> -- map logical data address to physical address and bank\n"
 		"  mapi <address> -- map logical I/O address to physical address and bank\n"
 		"  memdump [<filename>] -- dump the current memory map to <filename>\n"
+		"  membench[{d|i}] <address>[,<count>] -- time reads through the page cache against the full dispatch\n"
+		"  memstats [on|off|clear] -- count memory accesses per handler and page, or show the counts\n"
 	},
 	{
 		"execution",
@@ -285,6 +288,20 @@ static const help_item static_help_list[] =
 		"hardreset\n"
 		"  Executes a hard reset.\n"
 	},
+	{
+		"fastboot",
+		"\n"
+		"  fastboot\n"
+		"\n"
+		"Takes the fast boot snapshot at the current point, replacing any existing one for this "
+		"configuration. Later starts with -fastboot resume from here instead of running the boot "
+		"sequence. Only available when the emulator was started with -fastboot.\n"
+		"\n"
+		"Examples:\n"
+		"\n"
+		"fastboot\n"
+		"  Takes the fast boot snapshot now.\n"
+	},
 	{
 		"print",
 		"\n"
@@ -1036,6 +1053,47 @@ static const help_item static_help_list[] =
 		"memdump\n"
 		"  Dumps memory to memdump.log.\n"
 	},
+	{
+		"membench",
+		"\n"
+		"  membench[{d|i}] <address>[,<count>]\n"
+		"\n"
+		"The membench/membenchd/membenchi commands time <count> bus-width reads (default 10000000) over "
+		"the 1k window starting at <address>, once through the regular handler dispatch and once through "
+		"the page cache, and print the cost per read of each. Reads only hit the page cache when the whole "
+		"window is RAM or ROM; for I/O windows both paths end up in the same handlers. Note that the reads "
+		"are real, so avoid addresses with read side effects.\n"
+		"\n"
+		"Examples:\n"
+		"\n"
+		"membench 0\n"
+		"  Times reads from the first 1k of program memory.\n"
+		"\n"
+		"membenchd c000,1000000\n"
+		"  Times 1000000 reads from data memory starting at c000.\n"
+	},
+	{
+		"memstats",
+		"\n"
+		"  memstats [on|off|clear]\n"
+		"\n"
+		"The memstats command controls counting of memory accesses. 'on' starts counting every read and "
+		"write made through each address space, both per handler and per address page; 'off' stops "
+		"counting but keeps the counts; 'clear' resets them. With no parameter, memstats lists the busiest "
+		"handlers and pages of each counted space, with the split between RAM/ROM and handler accesses. "
+		"Opcode fetches and other direct reads count as RAM/ROM reads; recompiling CPU cores only count "
+		"code when they translate it. Counting disables the page cache and slows emulation down. The "
+		"-memstats option turns counting on from the start and writes the full report to memstats.log on "
+		"exit.\n"
+		"\n"
+		"Examples:\n"
+		"\n"
+		"memstats on\n"
+		"  Starts counting memory accesses.\n"
+		"\n"
+		"memstats\n"
+		"  Shows the busiest handlers and pages counted so far.\n"
+	},
 	{
 		"comadd",
 		"\n"
@@ -46,7 +46,12 @@ void debugger_flush_all_traces_on_abnormal_exit(void);
 INLINE void debugger_instruction_hook(device_t *device, offs_t curpc)
 {
 	if ((device->machine().debug_flags & DEBUG_FLAG_CALL_HOOK) != 0)
-		device->debug()->instruction_hook(curpc);
+	{
+		if ((device->machine().debug_flags & DEBUG_FLAG_PROFILE_CALLS) != 0)
+			device->machine().guestprof().instruction_hook(*device, curpc);
+		if ((device->machine().debug_flags & DEBUG_FLAG_ENABLED) != 0)
+			device->debug()->instruction_hook(curpc);
+	}
 }
 
 
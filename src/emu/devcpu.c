@@ -109,9 +109,10 @@ legacy_cpu_device::legacy_cpu_device(const machine_config &mconfig, device_type
 		m_space_config[spacenum].m_default_map = reinterpret_cast<address_map_constructor>(get_legacy_fct(DEVINFO_PTR_DEFAULT_MEMORY_MAP + spacenum));
 	}
 
-	// set the real name
-	m_name = get_legacy_string(DEVINFO_STR_NAME);
-	m_shortname = get_legacy_string(DEVINFO_STR_SHORTNAME);
+	// set the real name; use our own buffer, since configs can be built on several threads at once
+	char buffer[LEGACY_STRING_LENGTH];
+	m_name = get_legacy_string(DEVINFO_STR_NAME, buffer);
+	m_shortname = get_legacy_string(DEVINFO_STR_SHORTNAME, buffer);
 	m_searchpath = m_shortname;
 
 	int tokenbytes = get_legacy_int(CPUINFO_INT_CONTEXT_SIZE);
@@ -411,13 +412,16 @@ genf *legacy_cpu_device::get_legacy_fct(UINT32 state) const
 
 //-------------------------------------------------
 //  get_legacy_string - return a legacy
-//  string value
+//  string value; if no buffer of
+//  LEGACY_STRING_LENGTH is given, the result lives
+//  in the temporary string pool
 //-------------------------------------------------
 
-const char *legacy_cpu_device::get_legacy_string(UINT32 state) const
+const char *legacy_cpu_device::get_legacy_string(UINT32 state, char *buffer) const
 {
 	cpuinfo info;
-	info.s = get_temp_string_buffer();
+	info.s = (buffer != NULL) ? buffer : get_temp_string_buffer();
+	info.s[0] = 0;
 	(*m_get_info)(const_cast<legacy_cpu_device *>(this), state, &info);
 	return info.s;
 }
@@ -407,7 +407,7 @@ protected:
 	INT64 get_legacy_int(UINT32 state) const;
 	void *get_legacy_ptr(UINT32 state) const;
 	genf *get_legacy_fct(UINT32 state) const;
-	const char *get_legacy_string(UINT32 state) const;
+	const char *get_legacy_string(UINT32 state, char *buffer = NULL) const;
 	void set_legacy_int(UINT32 state, INT64 value);
 
 protected:
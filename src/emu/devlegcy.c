@@ -60,9 +60,10 @@ legacy_device_base::legacy_device_base(const machine_config &mconfig, device_typ
 	if (configlen != 0)
 		m_inline_config = global_alloc_array_clear(UINT8, configlen);
 
-	// set the proper name
-	m_name = get_legacy_string(DEVINFO_STR_NAME);
-	m_shortname = get_legacy_string(DEVINFO_STR_SHORTNAME);
+	// set the proper name; use our own buffer, since configs can be built on several threads at once
+	char buffer[LEGACY_STRING_LENGTH];
+	m_name = get_legacy_string(DEVINFO_STR_NAME, buffer);
+	m_shortname = get_legacy_string(DEVINFO_STR_SHORTNAME, buffer);
 	m_searchpath = m_shortname;
 
 	// create the token
@@ -124,13 +125,16 @@ genf *legacy_device_base::get_legacy_fct(UINT32 state) const
 
 //-------------------------------------------------
 //  get_legacy_string - return a legacy
-//  configuration parameter as a string pointer
+//  configuration parameter as a string pointer;
+//  if no buffer of LEGACY_STRING_LENGTH is given,
+//  the result lives in the temporary string pool
 //-------------------------------------------------
 
-const char *legacy_device_base::get_legacy_string(UINT32 state) const
+const char *legacy_device_base::get_legacy_string(UINT32 state, char *buffer) const
 {
 	deviceinfo info;
-	info.s = get_temp_string_buffer();
+	info.s = (buffer != NULL) ? buffer : get_temp_string_buffer();
+	info.s[0] = 0;
 	(*m_get_config_func)(this, state, &info);
 	return info.s;
 }
@@ -263,6 +263,9 @@ union deviceinfo;
 class machine_config;
 class device_t;
 
+// size of a buffer passed to get_legacy_string
+const int LEGACY_STRING_LENGTH = 256;
+
 char *get_temp_string_buffer(void);
 resource_pool &machine_get_pool(running_machine &machine);
 
@@ -340,7 +343,7 @@ protected:
 	INT64 get_legacy_int(UINT32 state) const;
 	void *get_legacy_ptr(UINT32 state) const;
 	genf *get_legacy_fct(UINT32 state) const;
-	const char *get_legacy_string(UINT32 state) const;
+	const char *get_legacy_string(UINT32 state, char *buffer = NULL) const;
 
 	// configuration state
 	device_get_config_func		m_get_config_func;
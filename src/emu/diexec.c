@@ -72,8 +72,11 @@ const int TRIGGER_SUSPENDTIME	= -4000;
 
 device_execute_interface::device_execute_interface(const machine_config &mconfig, device_t &device)
 	: device_interface(device),
-//    m_cothread(cothread_entry_delegate(FUNC(device_execute_interface::run_thread_wrapper), this)),
+	  m_cothread(NULL),
+	  m_cothread_caller(NULL),
+	  m_cothread_error(NULL),
 	  m_disabled(false),
+	  m_catchup(false),
 	  m_vblank_interrupt_legacy(NULL),
 	  m_vblank_interrupt_screen(NULL),
 	  m_timed_interrupt_legacy(NULL),
@@ -111,6 +114,7 @@ device_execute_interface::device_execute_interface(const machine_config &mconfig
 
 device_execute_interface::~device_execute_interface()
 {
+	global_free(m_cothread);
 }
 
 
@@ -128,6 +132,25 @@ void device_execute_interface::static_set_disable(device_t &device)
 }
 
 
+//-------------------------------------------------
+//  static_set_catchup - configuration helper to
+//  run a device on its own cothread; other
+//  catch-up devices are then only brought up to
+//  its time when it calls device_scheduler::
+//  catch_up before touching a shared resource,
+//  instead of being interleaved with a perfect
+//  quantum
+//-------------------------------------------------
+
+void device_execute_interface::static_set_catchup(device_t &device)
+{
+	device_execute_interface *exec;
+	if (!device.interface(exec))
+		throw emu_fatalerror("MCFG_DEVICE_CATCHUP called on device '%s' with no execute interface", device.tag());
+	exec->m_catchup = true;
+}
+
+
 //-------------------------------------------------
 //  static_set_vblank_int - configuration helper
 //  to set up VBLANK interrupts on the device
@@ -387,24 +410,63 @@ UINT64 device_execute_interface::total_cycles() const
 }
 
 
+//-------------------------------------------------
+//  run - execute for the number of cycles set up
+//  by the scheduler, on our own cothread if we
+//  are using catch-up scheduling
+//-------------------------------------------------
+
+void device_execute_interface::run()
+{
+	// if we don't have a cothread, just run directly
+	if (m_cothread == NULL)
+	{
+		execute_run();
+		return;
+	}
+
+	// otherwise, switch to it; it switches back when done
+	m_cothread_caller = co_active();
+	m_cothread->make_active();
+	m_cothread_caller = NULL;
+
+	// exceptions can't unwind across cothreads, so rethrow here
+	if (m_cothread_error != NULL)
+	{
+		emu_fatalerror error(*m_cothread_error);
+		global_free(m_cothread_error);
+		m_cothread_error = NULL;
+		throw error;
+	}
+}
+
+
 //-------------------------------------------------
 //  run_thread_wrapper - wrapper for our cothread
-//  which just calls run and then returns to the
-//  scheduler thread, over and over
+//  which just calls execute_run and then returns
+//  to the thread that resumed us, over and over
 //-------------------------------------------------
-/*
+
 void device_execute_interface::run_thread_wrapper()
 {
-    // loop infinitely
-    device_scheduler &scheduler = device().machine().scheduler();
-    while (1)
-    {
-        // call the classic run function, then swap back to the scheduler's thread
-        execute_run();
-        scheduler.make_active();
-    }
+	// loop infinitely
+	while (1)
+	{
+		try
+		{
+			execute_run();
+		}
+		catch (emu_fatalerror &fatal)
+		{
+			m_cothread_error = global_alloc(emu_fatalerror(fatal));
+		}
+		catch (...)
+		{
+			m_cothread_error = global_alloc(emu_fatalerror("Unhandled exception while executing device '%s'", device().tag()));
+		}
+		co_switch(m_cothread_caller);
+	}
 }
-*/
 
 //-------------------------------------------------
 //  execute_clocks_to_cycles - convert the number
@@ -549,6 +611,10 @@ void device_execute_interface::interface_pre_start()
 	if (m_timed_interrupt_period != attotime::zero)
 		m_timedint_timer = device().machine().scheduler().timer_alloc(FUNC(static_trigger_periodic_interrupt), (void *)this);
 
+	// catch-up devices execute on their own cothread
+	if (m_catchup)
+		m_cothread = global_alloc(cothread(cothread_entry_delegate(FUNC(device_execute_interface::run_thread_wrapper), this)));
+
 	// register for save states
 	device().save_item(NAME(m_suspend));
 	device().save_item(NAME(m_nextsuspend));
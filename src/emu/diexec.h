@@ -47,10 +47,6 @@
 #define __DIEXEC_H__
 
 
-// set to 1 to execute on cothread instead of directly
-//#define USE_COTHREADS 1
-
-
 //**************************************************************************
 //  CONSTANTS
 //**************************************************************************
@@ -119,6 +115,9 @@ enum
 #define MCFG_DEVICE_DISABLE() \
 	device_execute_interface::static_set_disable(*device); \
 
+#define MCFG_DEVICE_CATCHUP() \
+	device_execute_interface::static_set_catchup(*device); \
+
 #define MCFG_DEVICE_VBLANK_INT(_tag, _func) \
 	device_execute_interface::static_set_vblank_int(*device, _func, _tag); \
 
@@ -171,6 +170,7 @@ public:
 
 	// configuration access
 	bool disabled() const { return m_disabled; }
+	bool catchup() const { return m_catchup; }
 	UINT64 clocks_to_cycles(UINT64 clocks) const { return execute_clocks_to_cycles(clocks); }
 	UINT64 cycles_to_clocks(UINT64 cycles) const { return execute_cycles_to_clocks(cycles); }
 	UINT32 min_cycles() const { return execute_min_cycles(); }
@@ -183,6 +183,7 @@ public:
 
 	// static inline configuration helpers
 	static void static_set_disable(device_t &device);
+	static void static_set_catchup(device_t &device);
 	static void static_set_vblank_int(device_t &device, device_interrupt_func function, const char *tag, int rate = 0);
 	static void static_set_vblank_int(device_t &device, device_interrupt_delegate function, const char *tag, int rate = 0);
 	static void static_set_periodic_int(device_t &device, device_interrupt_func function, attotime rate);
@@ -222,11 +223,7 @@ public:
 	UINT64 total_cycles() const;
 
 	// required operation overrides
-//#if USE_COTHREADS
-//  void run() { m_cothread.make_active(); }
-//#else
-	void run() { execute_run(); }
-//#endif
+	void run();
 
 protected:
 	// internal helpers
@@ -289,11 +286,14 @@ protected:
 		void empty_event_queue();
 	};
 
-	// internal state
-//  cothread                m_cothread;                 // thread used for execution
+	// catch-up execution
+	cothread *				m_cothread;					// thread used for execution in catch-up mode
+	cothread_t				m_cothread_caller;			// thread to return to, while running on our own
+	emu_fatalerror *		m_cothread_error;			// error thrown on our thread, to rethrow on the caller's
 
 	// configuration
 	bool					m_disabled;					// disabled from executing?
+	bool					m_catchup;					// run on a cothread with catch-up scheduling?
 	device_interrupt_delegate m_vblank_interrupt;		// for interrupts tied to VBLANK
 	device_interrupt_func	m_vblank_interrupt_legacy;	// for interrupts tied to VBLANK
 	const char *			m_vblank_interrupt_screen;	// the screen that causes the VBLANK interrupt
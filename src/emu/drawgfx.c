@@ -10,6 +10,7 @@
 *********************************************************************/
 
 #include "emu.h"
+#include "emuopts.h"
 #include "drawgfxm.h"
 
 
@@ -29,6 +30,44 @@ bitmap_ind8 drawgfx_dummy_priority_bitmap;
 ***************************************************************************/
 
 static void decodechar(const gfx_element *gfx, UINT32 code, const UINT8 *src);
+static void *decode_range_callback(void *param, int threadid);
+
+
+
+/***************************************************************************
+    TYPE DEFINITIONS
+***************************************************************************/
+
+/* a range of codes within a gfx_element to be decoded by a worker thread */
+struct gfx_decode_range
+{
+	const gfx_element *	gfx;				/* element being decoded */
+	UINT32				start;				/* first code to decode */
+	UINT32				count;				/* number of codes to decode */
+};
+
+
+/* header of a persisted decoded-graphics cache file */
+struct gfx_cache_header
+{
+	UINT8				magic[8];			/* 'MAMEGFXC' */
+	UINT8				key[20];			/* SHA1 of the source data and layout */
+	UINT32				total;				/* total_elements, little-endian */
+	UINT32				char_modulo;		/* char_modulo, little-endian */
+	UINT8				has_pen_usage;		/* non-zero if pen usage follows the pixel data */
+	UINT8				reserved[3];
+};
+
+
+
+/***************************************************************************
+    CONSTANTS
+***************************************************************************/
+
+static const UINT8 GFX_CACHE_MAGIC[8] = { 'M','A','M','E','G','F','X','C' };
+
+/* number of codes each work item decodes during precaching */
+#define GFX_DECODE_CHUNK		256
 
 
 
@@ -214,6 +253,190 @@ void gfx_init(running_machine &machine)
 
 
 
+/*-------------------------------------------------
+    gfx_cache_key - compute a key identifying the
+    source data and layout of an element; srcbytes
+    is the size of the source data from srcdata
+    to the end of its region
+-------------------------------------------------*/
+
+static sha1_t gfx_cache_key(const gfx_element *gfx, UINT32 srcbytes)
+{
+	const gfx_layout *gl = &gfx->layout;
+	const UINT32 *xoffset = gl->extxoffs ? gl->extxoffs : gl->xoffset;
+	const UINT32 *yoffset = gl->extyoffs ? gl->extyoffs : gl->yoffset;
+	UINT32 maxbit = 0, maxx = 0, maxy = 0;
+	sha1_creator creator;
+	int index;
+
+	// find the furthest bit referenced by the layout
+	for (index = 0; index < gl->planes; index++)
+		maxbit = MAX(maxbit, gl->planeoffset[index]);
+	for (index = 0; index < gfx->origwidth; index++)
+		maxx = MAX(maxx, xoffset[index]);
+	for (index = 0; index < gfx->origheight; index++)
+		maxy = MAX(maxy, yoffset[index]);
+	maxbit += maxx + maxy + (gfx->total_elements - 1) * gl->charincrement;
+
+	// hash the layout, then every source byte the layout touches
+	creator.append(&gl->planes, sizeof(gl->planes));
+	creator.append(&gl->charincrement, sizeof(gl->charincrement));
+	creator.append(&gfx->total_elements, sizeof(gfx->total_elements));
+	creator.append(&gfx->origwidth, sizeof(gfx->origwidth));
+	creator.append(&gfx->origheight, sizeof(gfx->origheight));
+	creator.append(gl->planeoffset, gl->planes * sizeof(gl->planeoffset[0]));
+	creator.append(xoffset, gfx->origwidth * sizeof(xoffset[0]));
+	creator.append(yoffset, gfx->origheight * sizeof(yoffset[0]));
+	creator.append(gfx->srcdata, MIN(maxbit / 8 + 1, srcbytes));
+	return creator.finish();
+}
+
+
+/*-------------------------------------------------
+    gfx_cache_load - attempt to load the decoded
+    data for an element from the cache
+-------------------------------------------------*/
+
+static bool gfx_cache_load(gfx_element *gfx, int index, const sha1_t &key)
+{
+	running_machine &machine = gfx->machine();
+	emu_file file(machine.options().gfxcache_directory(), OPEN_FLAG_READ);
+	astring name;
+	name.printf("gfx%d", index);
+	if (file.open(machine.basename(), PATH_SEPARATOR, name, ".dat") != FILERR_NONE)
+		return false;
+
+	// validate the header against what we expect
+	gfx_cache_header header;
+	if (file.read(&header, sizeof(header)) != sizeof(header) ||
+		memcmp(header.magic, GFX_CACHE_MAGIC, sizeof(header.magic)) != 0 ||
+		memcmp(header.key, key.m_raw, sizeof(header.key)) != 0 ||
+		LITTLE_ENDIANIZE_INT32(header.total) != gfx->total_elements ||
+		LITTLE_ENDIANIZE_INT32(header.char_modulo) != gfx->char_modulo ||
+		(header.has_pen_usage != 0) != (gfx->pen_usage != NULL))
+		return false;
+
+	// read the pixel data directly into the element
+	UINT32 bytes = gfx->total_elements * gfx->char_modulo;
+	if (file.read(gfx->gfxdata, bytes) != bytes)
+		return false;
+
+	// followed by the pen usage, if present
+	if (gfx->pen_usage != NULL)
+	{
+		if (file.read(gfx->pen_usage, gfx->total_elements * sizeof(gfx->pen_usage[0])) != gfx->total_elements * sizeof(gfx->pen_usage[0]))
+			return false;
+		for (UINT32 code = 0; code < gfx->total_elements; code++)
+			gfx->pen_usage[code] = LITTLE_ENDIANIZE_INT32(gfx->pen_usage[code]);
+	}
+
+	// everything is now clean
+	memset(gfx->dirty, 0, gfx->total_elements * sizeof(*gfx->dirty));
+	return true;
+}
+
+
+/*-------------------------------------------------
+    gfx_cache_save - write the decoded data for an
+    element to the cache
+-------------------------------------------------*/
+
+static void gfx_cache_save(const gfx_element *gfx, int index, const sha1_t &key)
+{
+	running_machine &machine = gfx->machine();
+	emu_file file(machine.options().gfxcache_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	astring name;
+	name.printf("gfx%d", index);
+	if (file.open(machine.basename(), PATH_SEPARATOR, name, ".dat") != FILERR_NONE)
+		return;
+
+	// build and write the header
+	gfx_cache_header header;
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, GFX_CACHE_MAGIC, sizeof(header.magic));
+	memcpy(header.key, key.m_raw, sizeof(header.key));
+	header.total = LITTLE_ENDIANIZE_INT32(gfx->total_elements);
+	header.char_modulo = LITTLE_ENDIANIZE_INT32(gfx->char_modulo);
+	header.has_pen_usage = (gfx->pen_usage != NULL);
+	file.write(&header, sizeof(header));
+
+	// write the pixel data and pen usage
+	file.write(gfx->gfxdata, gfx->total_elements * gfx->char_modulo);
+	if (gfx->pen_usage != NULL)
+		for (UINT32 code = 0; code < gfx->total_elements; code++)
+		{
+			UINT32 usage = LITTLE_ENDIANIZE_INT32(gfx->pen_usage[code]);
+			file.write(&usage, sizeof(usage));
+		}
+}
+
+
+/*-------------------------------------------------
+    gfx_precache - decode all ROM-based graphics
+    elements up front, in parallel, optionally
+    loading from and saving to the decoded
+    graphics cache
+-------------------------------------------------*/
+
+void gfx_precache(running_machine &machine)
+{
+	const gfx_decode_entry *gfxdecodeinfo = machine.config().m_gfxdecodeinfo;
+	bool usecache = machine.options().gfx_cache();
+
+	// skip if nothing to do
+	if (gfxdecodeinfo == NULL || (!usecache && !machine.options().gfx_precache()))
+		return;
+
+	osd_work_queue *queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+	for (int curgfx = 0; curgfx < MAX_GFX_ELEMENTS && gfxdecodeinfo[curgfx].gfxlayout != NULL; curgfx++)
+	{
+		gfx_element *gfx = machine.gfx[curgfx];
+
+		// only ROM-based, non-raw elements are candidates
+		if (gfx == NULL || gfxdecodeinfo[curgfx].memory_region == NULL || gfx->srcdata == NULL || gfx->total_elements == 0 ||
+			gfx->layout.planeoffset[0] == GFX_RAW)
+			continue;
+
+		// try the cache first; the key covers the source data up to the end of the region
+		sha1_t key;
+		if (usecache)
+		{
+			memory_region *region = machine.root_device().memregion(gfxdecodeinfo[curgfx].memory_region);
+			UINT32 start = gfxdecodeinfo[curgfx].start;
+			key = gfx_cache_key(gfx, (region != NULL && region->bytes() > start) ? region->bytes() - start : 0);
+			if (gfx_cache_load(gfx, curgfx, key))
+				continue;
+		}
+
+		// split the element into chunks and decode them in parallel
+		UINT32 numranges = (gfx->total_elements + GFX_DECODE_CHUNK - 1) / GFX_DECODE_CHUNK;
+		gfx_decode_range *ranges = auto_alloc_array(machine, gfx_decode_range, numranges);
+		for (UINT32 rangenum = 0; rangenum < numranges; rangenum++)
+		{
+			ranges[rangenum].gfx = gfx;
+			ranges[rangenum].start = rangenum * GFX_DECODE_CHUNK;
+			ranges[rangenum].count = MIN(GFX_DECODE_CHUNK, gfx->total_elements - ranges[rangenum].start);
+		}
+		if (queue != NULL)
+		{
+			osd_work_item_queue_multiple(queue, decode_range_callback, numranges, ranges, sizeof(ranges[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+			osd_work_queue_wait(queue, 100 * osd_ticks_per_second());
+		}
+		else
+			for (UINT32 rangenum = 0; rangenum < numranges; rangenum++)
+				decode_range_callback(&ranges[rangenum], 0);
+		auto_free(machine, ranges);
+
+		// write back to the cache
+		if (usecache)
+			gfx_cache_save(gfx, curgfx, key);
+	}
+
+	if (queue != NULL)
+		osd_work_queue_free(queue);
+}
+
+
 /*-------------------------------------------------
     gfx_element_alloc - allocate a gfx_element structure
     based on a given layout
@@ -455,6 +678,21 @@ static void decodechar(const gfx_element *gfx, UINT32 code, const UINT8 *src)
 }
 
 
+/*-------------------------------------------------
+    decode_range_callback - work item callback
+    that decodes a range of codes
+-------------------------------------------------*/
+
+static void *decode_range_callback(void *param, int threadid)
+{
+	const gfx_decode_range *range = reinterpret_cast<const gfx_decode_range *>(param);
+
+	for (UINT32 code = range->start; code < range->start + range->count; code++)
+		decodechar(range->gfx, code, range->gfx->srcdata);
+	return NULL;
+}
+
+
 /***************************************************************************
     DRAWGFX IMPLEMENTATIONS
 ***************************************************************************/
@@ -177,6 +177,9 @@ struct gfx_decode_entry
 /* allocate memory for the graphics elements referenced by a machine */
 void gfx_init(running_machine &machine);
 
+/* decode all ROM-based graphics up front, using the decoded graphics cache if enabled */
+void gfx_precache(running_machine &machine);
+
 /* allocate a gfx_element structure based on a given layout */
 gfx_element *gfx_element_alloc(running_machine &machine, const gfx_layout *gl, const UINT8 *srcdata, UINT32 total_colors, UINT32 color_base);
 
@@ -161,7 +161,9 @@ driver_enumerator::driver_enumerator(emu_options &options)
 	  m_filtered_count(0),
 	  m_options(options),
 	  m_included(global_alloc_array(UINT8, s_driver_count)),
-	  m_config(global_alloc_array_clear(machine_config *, s_driver_count))
+	  m_config(global_alloc_array_clear(machine_config *, s_driver_count)),
+	  m_prefetch(global_alloc_array_clear(UINT8, s_driver_count)),
+	  m_prefetch_queue(NULL)
 {
 	include_all();
 }
@@ -172,7 +174,9 @@ driver_enumerator::driver_enumerator(emu_options &options, const char *string)
 	  m_filtered_count(0),
 	  m_options(options),
 	  m_included(global_alloc_array(UINT8, s_driver_count)),
-	  m_config(global_alloc_array_clear(machine_config *, s_driver_count))
+	  m_config(global_alloc_array_clear(machine_config *, s_driver_count)),
+	  m_prefetch(global_alloc_array_clear(UINT8, s_driver_count)),
+	  m_prefetch_queue(NULL)
 {
 	filter(string);
 }
@@ -183,7 +187,9 @@ driver_enumerator::driver_enumerator(emu_options &options, const game_driver &dr
 	  m_filtered_count(0),
 	  m_options(options),
 	  m_included(global_alloc_array(UINT8, s_driver_count)),
-	  m_config(global_alloc_array_clear(machine_config *, s_driver_count))
+	  m_config(global_alloc_array_clear(machine_config *, s_driver_count)),
+	  m_prefetch(global_alloc_array_clear(UINT8, s_driver_count)),
+	  m_prefetch_queue(NULL)
 {
 	filter(driver);
 }
@@ -202,6 +208,11 @@ driver_enumerator::~driver_enumerator()
 	// free the arrays
 	global_free(m_included);
 	global_free(m_config);
+	global_free(m_prefetch);
+
+	// free the work queue
+	if (m_prefetch_queue != NULL)
+		osd_work_queue_free(m_prefetch_queue);
 }
 
 
@@ -217,19 +228,104 @@ machine_config &driver_enumerator::config(int index, emu_options &options) const
 	// if we don't have it cached, add it
 	if (m_config[index] == NULL)
 	{
-		// if our cache is full, release the head entry
-		if (m_config_cache.count() == CONFIG_CACHE_COUNT)
+		// if the caller told us it wants this one, build a batch of them up front
+		if (m_prefetch[index] && &options == &m_options)
+			prefetch_configs(index);
+
+		// allocate the config if the batch didn't produce it
+		if (m_config[index] == NULL)
+			cache_config(index, global_alloc(machine_config(*s_drivers_sorted[index], options)));
+	}
+	return *m_config[index];
+}
+
+
+//-------------------------------------------------
+//  cache_config - add a config to the end of the
+//  cache, releasing the oldest if it is full
+//-------------------------------------------------
+
+void driver_enumerator::cache_config(int index, machine_config *config) const
+{
+	// if our cache is full, release the head entry
+	if (m_config_cache.count() == CONFIG_CACHE_COUNT)
+	{
+		config_entry *first = m_config_cache.first();
+		m_config[first->index()] = NULL;
+		m_config_cache.remove(*first);
+	}
+
+	// add the config to the end of the list
+	m_config[index] = config;
+	m_config_cache.append(*global_alloc(config_entry(*config, index)));
+}
+
+
+//-------------------------------------------------
+//  prefetch_configs - construct the configs for
+//  the given driver and the next few drivers
+//  marked for prefetch in parallel
+//-------------------------------------------------
+
+struct config_prefetch_item
+{
+	const game_driver *	driver;
+	emu_options *		options;
+	machine_config *	config;
+};
+
+void driver_enumerator::prefetch_configs(int index) const
+{
+	// gather the batch; it must fit in the cache without evicting itself
+	config_prefetch_item items[CONFIG_PREFETCH_COUNT];
+	int indexes[CONFIG_PREFETCH_COUNT];
+	int count = 0;
+	for (int curindex = index; curindex < s_driver_count && count < CONFIG_PREFETCH_COUNT; curindex++)
+		if (m_prefetch[curindex] && m_config[curindex] == NULL)
 		{
-			config_entry *first = m_config_cache.first();
-			m_config[first->index()] = NULL;
-			m_config_cache.remove(*first);
+			m_prefetch[curindex] = false;
+			items[count].driver = s_drivers_sorted[curindex];
+			items[count].options = &m_options;
+			items[count].config = NULL;
+			indexes[count++] = curindex;
 		}
 
-		// allocate the config and add it to the end of the list
-		machine_config *config = m_config[index] = global_alloc(machine_config(*s_drivers_sorted[index], options));
-		m_config_cache.append(*global_alloc(config_entry(*config, index)));
+	// construct them all in parallel
+	if (m_prefetch_queue == NULL)
+		m_prefetch_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+	if (m_prefetch_queue != NULL && count > 1)
+	{
+		osd_work_item_queue_multiple(m_prefetch_queue, prefetch_callback, count, items, sizeof(items[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+		while (!osd_work_queue_wait(m_prefetch_queue, osd_ticks_per_second())) ;
 	}
-	return *m_config[index];
+	else
+		for (int itemnum = 0; itemnum < count; itemnum++)
+			prefetch_callback(&items[itemnum], 0);
+
+	// add the results to the cache in order; failures are rebuilt (and reported) on demand
+	for (int itemnum = 0; itemnum < count; itemnum++)
+		if (items[itemnum].config != NULL)
+			cache_config(indexes[itemnum], items[itemnum].config);
+}
+
+
+//-------------------------------------------------
+//  prefetch_callback - work callback to construct
+//  one machine_config
+//-------------------------------------------------
+
+void *driver_enumerator::prefetch_callback(void *param, int threadid)
+{
+	config_prefetch_item &item = *reinterpret_cast<config_prefetch_item *>(param);
+	try
+	{
+		item.config = global_alloc(machine_config(*item.driver, *item.options));
+	}
+	catch (...)
+	{
+		item.config = NULL;
+	}
+	return NULL;
 }
 
 
@@ -124,6 +124,7 @@ public:
 	bool excluded(int index) const { assert(index >= 0 && index < s_driver_count); return !m_included[index]; }
 	machine_config &config(int index) const { return config(index,m_options); }
 	machine_config &config(int index, emu_options &options) const;
+	void prefetch_config(int index) { assert(index >= 0 && index < s_driver_count); m_prefetch[index] = true; }
 	void include(int index) { assert(index >= 0 && index < s_driver_count); if (!m_included[index]) { m_included[index] = true; m_filtered_count++; }  }
 	void exclude(int index) { assert(index >= 0 && index < s_driver_count); if (m_included[index]) { m_included[index] = false; m_filtered_count--; } }
 	using driver_list::driver;
@@ -167,7 +168,13 @@ private:
 		int					m_index;
 	};
 
+	// internal helpers
+	void cache_config(int index, machine_config *config) const;
+	void prefetch_configs(int index) const;
+	static void *prefetch_callback(void *param, int threadid);
+
 	static const int CONFIG_CACHE_COUNT = 100;
+	static const int CONFIG_PREFETCH_COUNT = 32;
 
 	// internal state
 	int					m_current;
@@ -175,6 +182,8 @@ private:
 	emu_options &		m_options;
 	UINT8 *				m_included;
 	machine_config **	m_config;
+	UINT8 *				m_prefetch;
+	mutable osd_work_queue *m_prefetch_queue;
 	mutable simple_list<config_entry> m_config_cache;
 };
 
@@ -67,6 +67,7 @@
 #include "hash.h"
 #include "fileio.h" // remove me once NVRAM is implemented as device
 #include "delegate.h"
+#include "cothread.h"
 
 // memory and address spaces
 #include "memory.h"
@@ -151,6 +152,7 @@ private:
 
 // the running machine
 #include "machine.h"
+#include "guestprof.h"
 #include "driver.h"
 #include "mame.h"
 
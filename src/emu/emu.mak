@@ -51,6 +51,7 @@ EMUOBJS = \
 	$(EMUOBJ)/cheat.o \
 	$(EMUOBJ)/clifront.o \
 	$(EMUOBJ)/config.o \
+	$(EMUOBJ)/cothread.o \
 	$(EMUOBJ)/crsshair.o \
 	$(EMUOBJ)/debugger.o \
 	$(EMUOBJ)/delegate.o \
@@ -77,9 +78,11 @@ EMUOBJS = \
 	$(EMUOBJ)/emuopts.o \
 	$(EMUOBJ)/emupal.o \
 	$(EMUOBJ)/fileio.o \
+	$(EMUOBJ)/guestprof.o \
 	$(EMUOBJ)/hash.o \
 	$(EMUOBJ)/image.o \
 	$(EMUOBJ)/info.o \
+	$(EMUOBJ)/infocache.o \
 	$(EMUOBJ)/input.o \
 	$(EMUOBJ)/ioport.o \
 	$(EMUOBJ)/mame.o \
@@ -279,6 +282,7 @@ EMUVIDEOOBJS = \
 	$(EMUVIDEO)/crt9007.o		\
 	$(EMUVIDEO)/crt9021.o		\
 	$(EMUVIDEO)/crt9212.o		\
+	$(EMUVIDEO)/deferred.o		\
 	$(EMUVIDEO)/dm9368.o		\
 	$(EMUVIDEO)/generic.o		\
 	$(EMUVIDEO)/h63484.o		\
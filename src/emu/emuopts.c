@@ -82,6 +82,9 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_SNAPSHOT_DIRECTORY,                         "snap",      OPTION_STRING,     "directory to save screenshots" },
 	{ OPTION_DIFF_DIRECTORY,                             "diff",      OPTION_STRING,     "directory to save hard drive image difference files" },
 	{ OPTION_COMMENT_DIRECTORY,                          "comments",  OPTION_STRING,     "directory to save debugger comments" },
+	{ OPTION_GFXCACHE_DIRECTORY,                         "gfxcache",  OPTION_STRING,     "directory to save decoded graphics caches" },
+	{ OPTION_FASTBOOT_DIRECTORY,                         "fastboot",  OPTION_STRING,     "directory to save fast boot snapshots" },
+	{ OPTION_INFOCACHE_DIRECTORY,                        "",          OPTION_STRING,     "directory to save cached -list* information; empty means no caching" },
 
 	// state/playback options
 	{ NULL,                                              NULL,        OPTION_HEADER,     "CORE STATE/PLAYBACK OPTIONS" },
@@ -89,6 +92,10 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_AUTOSAVE,                                   "0",         OPTION_BOOLEAN,    "enable automatic restore at startup, and automatic save at exit time" },
 	{ OPTION_PLAYBACK ";pb",                             NULL,        OPTION_STRING,     "playback an input file" },
 	{ OPTION_RECORD ";rec",                              NULL,        OPTION_STRING,     "record an input file" },
+	{ OPTION_RECORD_HASH "(0-65535)",                    "60",        OPTION_INTEGER,    "number of frames between save state hashes stored in a recorded input file; 0 stores none" },
+	{ OPTION_HASH_FILTER,                                NULL,        OPTION_STRING,     "only hash save state entries whose names contain this string when recording; stored in the input file" },
+	{ OPTION_FASTBOOT,                                   "0",         OPTION_BOOLEAN,    "skip the boot sequence by restoring a snapshot of the machine taken after an earlier boot" },
+	{ OPTION_FASTBOOT_TIME,                              "0",         OPTION_FLOAT,      "emulated seconds after startup at which to take the fast boot snapshot; 0 means only on request from the debugger" },
 	{ OPTION_MNGWRITE,                                   NULL,        OPTION_STRING,     "optional filename to write a MNG movie of the current session" },
 	{ OPTION_AVIWRITE,                                   NULL,        OPTION_STRING,     "optional filename to write an AVI movie of the current session" },
 	{ OPTION_WAVWRITE,                                   NULL,        OPTION_STRING,     "optional filename to write a WAV file of the current session" },
@@ -106,6 +113,9 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_SLEEP,                                      "1",         OPTION_BOOLEAN,    "enable sleeping, which gives time back to other applications when idle" },
 	{ OPTION_SPEED "(0.01-100)",                         "1.0",       OPTION_FLOAT,      "controls the speed of gameplay, relative to realtime; smaller numbers are slower" },
 	{ OPTION_REFRESHSPEED ";rs",                         "0",         OPTION_BOOLEAN,    "automatically adjusts the speed of gameplay to keep the refresh rate lower than the screen" },
+	{ OPTION_GFX_PRECACHE,                               "0",         OPTION_BOOLEAN,    "decode all ROM-based graphics at startup instead of on first use" },
+	{ OPTION_GFX_CACHE,                                  "0",         OPTION_BOOLEAN,    "load and save decoded ROM-based graphics in the gfxcache directory (implies gfx_precache)" },
+	{ OPTION_DEFERRED_SCANLINES,                         "0",         OPTION_BOOLEAN,    "capture scanline state during emulation and render the lines on worker threads in drivers that support it" },
 
 	// rotation options
 	{ NULL,                                              NULL,        OPTION_HEADER,     "CORE ROTATION OPTIONS" },
@@ -184,6 +194,9 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_DEBUG ";d",                                 "0",         OPTION_BOOLEAN,    "enable/disable debugger" },
 	{ OPTION_DEBUGSCRIPT,                                NULL,        OPTION_STRING,     "script for debugger" },
 	{ OPTION_DEBUG_INTERNAL ";di",                       "0",         OPTION_BOOLEAN,    "use the internal debugger for debugging" },
+	{ OPTION_MEMSTATS,                                   "0",         OPTION_BOOLEAN,    "count memory accesses per handler and page, and write them to memstats.log on exit" },
+	{ OPTION_GUEST_PROFILE,                              "0",         OPTION_INTEGER,    "sample the PC of every CPU this many times per emulated second, and write profiles on exit; 0 means off" },
+	{ OPTION_GUEST_PROFILE_CALLS,                        "0",         OPTION_BOOLEAN,    "follow calls and returns so guest profiles include call stacks" },
 
 	// misc options
 	{ NULL,                                              NULL,        OPTION_HEADER,     "CORE MISC OPTIONS" },
@@ -95,12 +95,19 @@ enum
 #define OPTION_SNAPSHOT_DIRECTORY	"snapshot_directory"
 #define OPTION_DIFF_DIRECTORY		"diff_directory"
 #define OPTION_COMMENT_DIRECTORY	"comment_directory"
+#define OPTION_GFXCACHE_DIRECTORY	"gfxcache_directory"
+#define OPTION_FASTBOOT_DIRECTORY	"fastboot_directory"
+#define OPTION_INFOCACHE_DIRECTORY	"infocache_directory"
 
 // core state/playback options
 #define OPTION_STATE				"state"
 #define OPTION_AUTOSAVE				"autosave"
 #define OPTION_PLAYBACK				"playback"
 #define OPTION_RECORD				"record"
+#define OPTION_RECORD_HASH			"record_hash"
+#define OPTION_HASH_FILTER			"hash_filter"
+#define OPTION_FASTBOOT				"fastboot"
+#define OPTION_FASTBOOT_TIME		"fastboot_time"
 #define OPTION_MNGWRITE				"mngwrite"
 #define OPTION_AVIWRITE				"aviwrite"
 #define OPTION_WAVWRITE				"wavwrite"
@@ -117,6 +124,9 @@ enum
 #define OPTION_SLEEP				"sleep"
 #define OPTION_SPEED				"speed"
 #define OPTION_REFRESHSPEED			"refreshspeed"
+#define OPTION_GFX_PRECACHE			"gfx_precache"
+#define OPTION_GFX_CACHE			"gfx_cache"
+#define OPTION_DEFERRED_SCANLINES	"deferred_scanlines"
 
 // core rotation options
 #define OPTION_ROTATE				"rotate"
@@ -187,6 +197,9 @@ enum
 #define OPTION_DEBUG				"debug"
 #define OPTION_DEBUG_INTERNAL		"debug_internal"
 #define OPTION_DEBUGSCRIPT			"debugscript"
+#define OPTION_MEMSTATS				"memstats"
+#define OPTION_GUEST_PROFILE		"guest_profile"
+#define OPTION_GUEST_PROFILE_CALLS	"guest_profile_calls"
 
 // core misc options
 #define OPTION_BIOS					"bios"
@@ -250,12 +263,19 @@ public:
 	const char *snapshot_directory() const { return value(OPTION_SNAPSHOT_DIRECTORY); }
 	const char *diff_directory() const { return value(OPTION_DIFF_DIRECTORY); }
 	const char *comment_directory() const { return value(OPTION_COMMENT_DIRECTORY); }
+	const char *gfxcache_directory() const { return value(OPTION_GFXCACHE_DIRECTORY); }
+	const char *fastboot_directory() const { return value(OPTION_FASTBOOT_DIRECTORY); }
+	const char *infocache_directory() const { return value(OPTION_INFOCACHE_DIRECTORY); }
 
 	// core state/playback options
 	const char *state() const { return value(OPTION_STATE); }
 	bool autosave() const { return bool_value(OPTION_AUTOSAVE); }
 	const char *playback() const { return value(OPTION_PLAYBACK); }
 	const char *record() const { return value(OPTION_RECORD); }
+	int record_hash() const { return int_value(OPTION_RECORD_HASH); }
+	const char *hash_filter() const { return value(OPTION_HASH_FILTER); }
+	bool fastboot() const { return bool_value(OPTION_FASTBOOT); }
+	float fastboot_time() const { return float_value(OPTION_FASTBOOT_TIME); }
 	const char *mng_write() const { return value(OPTION_MNGWRITE); }
 	const char *avi_write() const { return value(OPTION_AVIWRITE); }
 	const char *wav_write() const { return value(OPTION_WAVWRITE); }
@@ -272,6 +292,9 @@ public:
 	bool sleep() const { return bool_value(OPTION_SLEEP); }
 	float speed() const { return float_value(OPTION_SPEED); }
 	bool refresh_speed() const { return bool_value(OPTION_REFRESHSPEED); }
+	bool gfx_precache() const { return bool_value(OPTION_GFX_PRECACHE); }
+	bool gfx_cache() const { return bool_value(OPTION_GFX_CACHE); }
+	bool deferred_scanlines() const { return bool_value(OPTION_DEFERRED_SCANLINES); }
 
 	// core rotation options
 	bool rotate() const { return bool_value(OPTION_ROTATE); }
@@ -337,6 +360,9 @@ public:
 	bool verbose() const { return bool_value(OPTION_VERBOSE); }
 	bool log() const { return bool_value(OPTION_LOG); }
 	bool debug() const { return bool_value(OPTION_DEBUG); }
+	bool memstats() const { return bool_value(OPTION_MEMSTATS); }
+	int guest_profile() const { return int_value(OPTION_GUEST_PROFILE); }
+	bool guest_profile_calls() const { return bool_value(OPTION_GUEST_PROFILE_CALLS); }
 	bool debug_internal() const { return bool_value(OPTION_DEBUG_INTERNAL); }
 	const char *debug_script() const { return value(OPTION_DEBUGSCRIPT); }
 	bool update_in_pause() const { return bool_value(OPTION_UPDATEINPAUSE); }
@@ -178,6 +178,7 @@ emu_file::emu_file(UINT32 openflags)
 	  m_zipfile(NULL),
 	  m_zipdata(NULL),
 	  m_ziplength(0),
+	  m_zippos(0),
 	  m__7zfile(NULL),
 	  m__7zdata(NULL),
 	  m__7zlength(0),
@@ -196,6 +197,7 @@ emu_file::emu_file(const char *searchpath, UINT32 openflags)
 	  m_zipfile(NULL),
 	  m_zipdata(NULL),
 	  m_ziplength(0),
+	  m_zippos(0),
 	  m__7zfile(NULL),
 	  m__7zdata(NULL),
 	  m__7zlength(0),
@@ -438,6 +440,7 @@ void emu_file::close()
 	if (m_zipfile != NULL)
 		zip_file_close(m_zipfile);
 	m_zipfile = NULL;
+	m_zippos = 0;
 
 	if (m_file != NULL)
 		core_fclose(m_file);
@@ -496,6 +499,16 @@ bool emu_file::compressed_file_ready(void)
 
 int emu_file::seek(INT64 offset, int whence)
 {
+	// unloaded ZIP members just track the position
+	if (zipped_in_place())
+	{
+		INT64 base = (whence == SEEK_CUR) ? m_zippos : (whence == SEEK_END) ? m_ziplength : 0;
+		if (base + offset < 0)
+			return 1;
+		m_zippos = base + offset;
+		return 0;
+	}
+
 	// load the ZIP file now if we haven't yet
 	if (compressed_file_ready())
 		return 1;
@@ -514,6 +527,9 @@ int emu_file::seek(INT64 offset, int whence)
 
 UINT64 emu_file::tell()
 {
+	if (zipped_in_place())
+		return m_zippos;
+
 	// load the ZIP file now if we haven't yet
 	if (compressed_file_ready())
 		return 0;
@@ -532,6 +548,9 @@ UINT64 emu_file::tell()
 
 bool emu_file::eof()
 {
+	if (zipped_in_place())
+		return (m_zippos >= m_ziplength);
+
 	// load the ZIP file now if we haven't yet
 	if (compressed_file_ready())
 		return 0;
@@ -571,6 +590,10 @@ UINT64 emu_file::size()
 
 UINT32 emu_file::read(void *buffer, UINT32 length)
 {
+	// read unloaded ZIP members in place rather than decompressing them whole
+	if (zipped_in_place())
+		return read_zipped(buffer, length);
+
 	// load the ZIP file now if we haven't yet
 	if (compressed_file_ready())
 		return 0;
@@ -751,6 +774,7 @@ file_error emu_file::attempt_zipped()
 		{
 			m_zipfile = zip;
 			m_ziplength = header->uncompressed_length;
+			m_zippos = 0;
 
 			// build a hash with just the CRC
 			m_hashes.reset();
@@ -795,6 +819,9 @@ file_error emu_file::load_zipped_file()
 		return FILERR_FAILURE;
 	}
 
+	// pick up where any in-place reads left off
+	core_fseek(m_file, m_zippos, SEEK_SET);
+
 	// close out the ZIP file
 	zip_file_close(m_zipfile);
 	m_zipfile = NULL;
@@ -802,6 +829,26 @@ file_error emu_file::load_zipped_file()
 }
 
 
+//-------------------------------------------------
+//  read_zipped - read from a ZIPped file without
+//  loading it; sequential reads carry on from
+//  where the previous one stopped
+//-------------------------------------------------
+
+UINT32 emu_file::read_zipped(void *buffer, UINT32 length)
+{
+	// clamp to the end of the member
+	if (m_zippos >= m_ziplength)
+		return 0;
+	length = MIN(length, m_ziplength - m_zippos);
+
+	if (zip_file_decompress_range(m_zipfile, m_zippos, buffer, length) != ZIPERR_NONE)
+		return 0;
+	m_zippos += length;
+	return length;
+}
+
+
 //-------------------------------------------------
 //  zip_filename_match - compare zip filename
 //  to expected filename, ignoring any directory
@@ -165,10 +165,12 @@ public:
 
 private:
 	bool compressed_file_ready(void);
+	bool zipped_in_place() const { return (m_zipfile != NULL && m_file == NULL); }
 
 	// internal helpers
 	file_error attempt_zipped();
 	file_error load_zipped_file();
+	UINT32 read_zipped(void *buffer, UINT32 length);
 	bool zip_filename_match(const zip_file_header &header, const astring &filename);
 	bool zip_header_is_path(const zip_file_header &header);
 
@@ -187,6 +189,7 @@ private:
 	zip_file *		m_zipfile;						// ZIP file pointer
 	UINT8 *			m_zipdata;						// ZIP file data
 	UINT64			m_ziplength;					// ZIP file length
+	UINT64			m_zippos;						// position within an unloaded ZIP file
 
 	_7z_file *		m__7zfile;						// 7Z file pointer
 	UINT8 *			m__7zdata;						// 7Z file data
@@ -0,0 +1,580 @@
+/***************************************************************************
+
+    guestprof.c
+
+    Sampling profiler for emulated CPUs.
+
+****************************************************************************
+
+    Copyright Aaron Giles
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are
+    met:
+
+        * Redistributions of source code must retain the above copyright
+          notice, this list of conditions and the following disclaimer.
+        * Redistributions in binary form must reproduce the above copyright
+          notice, this list of conditions and the following disclaimer in
+          the documentation and/or other materials provided with the
+          distribution.
+        * Neither the name 'MAME' nor the names of its contributors may be
+          used to endorse or promote products derived from this software
+          without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY AARON GILES ''AS IS'' AND ANY EXPRESS OR
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL AARON GILES BE LIABLE FOR ANY DIRECT,
+    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+    HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+    STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+    IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+    POSSIBILITY OF SUCH DAMAGE.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "emuopts.h"
+#include "debugger.h"
+
+
+
+//**************************************************************************
+//  TYPE DEFINITIONS
+//**************************************************************************
+
+// an address and the samples attributed to it
+struct profile_count
+{
+	offs_t		address;
+	UINT32		self;
+	UINT32		total;
+};
+
+
+
+//**************************************************************************
+//  INLINE FUNCTIONS
+//**************************************************************************
+
+//-------------------------------------------------
+//  compare_address - qsort callback to order
+//  counts by address
+//-------------------------------------------------
+
+static int compare_address(const void *item1, const void *item2)
+{
+	offs_t address1 = reinterpret_cast<const profile_count *>(item1)->address;
+	offs_t address2 = reinterpret_cast<const profile_count *>(item2)->address;
+	return (address1 < address2) ? -1 : (address1 > address2) ? 1 : 0;
+}
+
+
+//-------------------------------------------------
+//  compare_total - qsort callback to order
+//  counts from busiest to quietest
+//-------------------------------------------------
+
+static int compare_total(const void *item1, const void *item2)
+{
+	const profile_count *count1 = reinterpret_cast<const profile_count *>(item1);
+	const profile_count *count2 = reinterpret_cast<const profile_count *>(item2);
+	if (count1->total != count2->total)
+		return (count1->total > count2->total) ? -1 : 1;
+	if (count1->self != count2->self)
+		return (count1->self > count2->self) ? -1 : 1;
+	return compare_address(item1, item2);
+}
+
+
+//-------------------------------------------------
+//  merge_counts - sort counts by address and
+//  fold together entries for the same address
+//-------------------------------------------------
+
+static void merge_counts(dynamic_array<profile_count> &counts)
+{
+	if (counts.count() == 0)
+		return;
+
+	qsort(&counts[0], counts.count(), sizeof(counts[0]), compare_address);
+	int dest = 0;
+	for (int index = 1; index < counts.count(); index++)
+		if (counts[index].address == counts[dest].address)
+		{
+			counts[dest].self += counts[index].self;
+			counts[dest].total += counts[index].total;
+		}
+		else
+			counts[++dest] = counts[index];
+	counts.resize(dest + 1, true);
+	qsort(&counts[0], counts.count(), sizeof(counts[0]), compare_total);
+}
+
+
+
+//**************************************************************************
+//  GUEST PROFILER
+//**************************************************************************
+
+//-------------------------------------------------
+//  guest_profiler - constructor
+//-------------------------------------------------
+
+guest_profiler::guest_profiler(running_machine &machine, emu_timer &timer)
+	: m_machine(machine),
+	  m_cpulist(machine.respool()),
+	  m_lastcpu(NULL),
+	  m_timer(&timer)
+{
+	// profile every executing device that can tell us its PC
+	execute_interface_iterator iter(machine.root_device());
+	for (device_execute_interface *exec = iter.first(); exec != NULL; exec = iter.next())
+	{
+		device_state_interface *state;
+		if (exec->device().interface(state))
+			m_cpulist.append(*auto_alloc(machine, cpu_profile(exec->device())));
+	}
+
+	// if we're following calls, CPU cores need to call the instruction hook
+	if (machine.options().guest_profile_calls())
+		machine.debug_flags |= DEBUG_FLAG_PROFILE_CALLS | DEBUG_FLAG_CALL_HOOK;
+
+	// sample at a fixed emulated rate, so that the same run always profiles the same way
+	m_period = attotime::from_hz(machine.options().guest_profile());
+	m_timer->adjust(m_period, 0, m_period);
+
+	// a state saved without the profiler loads with the timer stopped
+	machine.save().register_postload(save_prepost_delegate(FUNC(guest_profiler::postload), this));
+
+	// write the results on the way out
+	machine.add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(FUNC(guest_profiler::exit), this));
+}
+
+
+//-------------------------------------------------
+//  instruction_hook - called by CPU cores before
+//  each instruction while calls are followed
+//-------------------------------------------------
+
+void guest_profiler::instruction_hook(device_t &device, offs_t curpc)
+{
+	// the same device is usually running many instructions in a row
+	cpu_profile *cpu = m_lastcpu;
+	if (cpu == NULL || &cpu->device() != &device)
+	{
+		for (cpu = m_cpulist.first(); cpu != NULL; cpu = cpu->next())
+			if (&cpu->device() == &device)
+				break;
+		if (cpu == NULL)
+			return;
+		m_lastcpu = cpu;
+	}
+	cpu->instruction_hook(curpc);
+}
+
+
+//-------------------------------------------------
+//  sample - take a sample from every profiled
+//  device; called by the machine's sampling timer
+//-------------------------------------------------
+
+void guest_profiler::sample()
+{
+	for (cpu_profile *cpu = m_cpulist.first(); cpu != NULL; cpu = cpu->next())
+		cpu->sample();
+}
+
+
+//-------------------------------------------------
+//  postload - restart sampling at our own rate,
+//  whatever the loaded state left the timer doing
+//-------------------------------------------------
+
+void guest_profiler::postload()
+{
+	m_timer->adjust(m_period, 0, m_period);
+}
+
+
+//-------------------------------------------------
+//  exit - stop following calls and write out the
+//  profile of each device
+//-------------------------------------------------
+
+void guest_profiler::exit()
+{
+	if ((machine().debug_flags & DEBUG_FLAG_ENABLED) == 0)
+		machine().debug_flags &= ~DEBUG_FLAG_CALL_HOOK;
+	machine().debug_flags &= ~DEBUG_FLAG_PROFILE_CALLS;
+
+	for (cpu_profile *cpu = m_cpulist.first(); cpu != NULL; cpu = cpu->next())
+		cpu->write(machine().basename());
+}
+
+
+
+//**************************************************************************
+//  PER-DEVICE PROFILE
+//**************************************************************************
+
+//-------------------------------------------------
+//  cpu_profile - constructor
+//-------------------------------------------------
+
+guest_profiler::cpu_profile::cpu_profile(device_t &device)
+	: m_next(NULL),
+	  m_device(device),
+	  m_state(NULL),
+	  m_execute(NULL),
+	  m_disasm(NULL),
+	  m_memory(NULL),
+	  m_space(NULL),
+	  m_calls(device.machine().options().guest_profile_calls()),
+	  m_depth(0),
+	  m_pending(PENDING_NONE),
+	  m_delay(0),
+	  m_pendingret(0),
+	  m_total(0),
+	  m_idle(0),
+	  m_dropped(0)
+{
+	device.interface(m_state);
+	device.interface(m_execute);
+	device.interface(m_disasm);
+	if (device.interface(m_memory))
+		m_space = m_memory->space(AS_PROGRAM);
+
+	// without a disassembler and a program space there are no calls to follow
+	if (m_disasm == NULL || m_space == NULL)
+	{
+		m_disasm = NULL;
+		m_calls = false;
+	}
+
+	for (int index = 0; index < DASM_CACHE_SIZE; index++)
+	{
+		m_dasmcache[index].pc = ~0;
+		m_dasmcache[index].flags = 0;
+	}
+	for (int index = 0; index < STACK_HASH_SIZE; index++)
+		m_buckets[index] = -1;
+}
+
+
+//-------------------------------------------------
+//  instruction_hook - follow calls and returns
+//  on the return address stack
+//-------------------------------------------------
+
+void guest_profiler::cpu_profile::instruction_hook(offs_t curpc)
+{
+	// a call or return from the previous instruction takes effect once its delay slots have run
+	if (m_pending != PENDING_NONE)
+	{
+		if (m_delay > 0)
+		{
+			m_delay--;
+			return;
+		}
+
+		// only a taken call gets a frame; a branch that keeps looping back to the same place doesn't stack up
+		if (m_pending == PENDING_CALL)
+		{
+			if (curpc != m_pendingret && (m_depth == 0 || m_stack[m_depth - 1].entry != curpc || m_stack[m_depth - 1].retaddr != m_pendingret))
+			{
+				if (m_depth == MAX_DEPTH)
+				{
+					memmove(&m_stack[0], &m_stack[1], sizeof(m_stack[0]) * (MAX_DEPTH - 1));
+					m_depth--;
+					m_dropped++;
+				}
+				m_stack[m_depth].entry = curpc;
+				m_stack[m_depth].retaddr = m_pendingret;
+				m_depth++;
+			}
+		}
+
+		// a return unwinds to the innermost frame that returns here; returns from interrupts match nothing
+		else
+		{
+			for (int depth = m_depth - 1; depth >= 0; depth--)
+				if (m_stack[depth].retaddr == curpc)
+				{
+					m_depth = depth;
+					break;
+				}
+		}
+		m_pending = PENDING_NONE;
+	}
+
+	// reaching the return address by any other route also leaves the frame
+	else if (m_depth > 0 && m_stack[m_depth - 1].retaddr == curpc)
+		m_depth--;
+
+	// note calls and returns for the next instruction
+	offs_t flags = dasm_flags(curpc);
+	if ((flags & (DASMFLAG_STEP_OVER | DASMFLAG_STEP_OUT)) != 0)
+	{
+		m_pending = ((flags & DASMFLAG_STEP_OVER) != 0) ? PENDING_CALL : PENDING_RETURN;
+		m_delay = (flags & DASMFLAG_OVERINSTMASK) >> DASMFLAG_OVERINSTSHIFT;
+		m_pendingret = (curpc + (m_delay + 1) * (flags & DASMFLAG_LENGTHMASK)) & m_space->logaddrmask();
+	}
+}
+
+
+//-------------------------------------------------
+//  sample - record the current PC, under the
+//  current call stack if we are following calls
+//-------------------------------------------------
+
+void guest_profiler::cpu_profile::sample()
+{
+	m_total++;
+	if (m_execute->suspended())
+	{
+		m_idle++;
+		return;
+	}
+
+	offs_t frames[MAX_DEPTH + 1];
+	int depth = 0;
+	if (m_calls)
+		for ( ; depth < m_depth; depth++)
+			frames[depth] = m_stack[depth].entry;
+	frames[depth++] = m_state->pcbase();
+	add_sample(frames, depth);
+}
+
+
+//-------------------------------------------------
+//  add_sample - count a sample against a stack,
+//  adding the stack if it is new
+//-------------------------------------------------
+
+void guest_profiler::cpu_profile::add_sample(const offs_t *frames, int depth)
+{
+	UINT32 hash = depth;
+	for (int index = 0; index < depth; index++)
+		hash = (hash * 31) ^ frames[index];
+
+	// look for an existing stack
+	int *bucket = &m_buckets[hash % STACK_HASH_SIZE];
+	for (int index = *bucket; index != -1; index = m_samples[index].next)
+	{
+		stack_sample &sample = m_samples[index];
+		if (sample.hash == hash && sample.depth == depth && memcmp(&m_frames[sample.start], frames, depth * sizeof(*frames)) == 0)
+		{
+			sample.count++;
+			return;
+		}
+	}
+
+	// add a new one
+	stack_sample sample;
+	sample.hash = hash;
+	sample.next = *bucket;
+	sample.start = m_frames.count();
+	sample.depth = depth;
+	sample.count = 1;
+	*bucket = m_samples.count();
+	m_samples.append(sample);
+	for (int index = 0; index < depth; index++)
+		m_frames.append(frames[index]);
+}
+
+
+//-------------------------------------------------
+//  dasm_flags - return the disassembler flags for
+//  an instruction, from the cache if possible
+//-------------------------------------------------
+
+offs_t guest_profiler::cpu_profile::dasm_flags(offs_t pc)
+{
+	if (m_disasm == NULL)
+		return 0;
+
+	dasm_entry &entry = m_dasmcache[(pc ^ (pc >> 12)) % DASM_CACHE_SIZE];
+	if (entry.pc != pc)
+	{
+		astring buffer;
+		offs_t result = disassemble(buffer, pc);
+		entry.pc = pc;
+		entry.flags = ((result & DASMFLAG_SUPPORTED) != 0) ? result : 0;
+	}
+	return entry.flags;
+}
+
+
+//-------------------------------------------------
+//  disassemble - disassemble an instruction
+//  without going through the debugger
+//-------------------------------------------------
+
+offs_t guest_profiler::cpu_profile::disassemble(astring &buffer, offs_t pc)
+{
+	buffer.reset();
+	if (m_disasm == NULL)
+		return 0;
+
+	// translate the PC to a physical byte address
+	offs_t pcbyte = m_space->address_to_byte(pc) & m_space->logbytemask();
+	if (!m_memory->translate(AS_PROGRAM, TRANSLATE_FETCH_DEBUG, pcbyte))
+	{
+		buffer.cpy("<unmapped>");
+		return 0;
+	}
+	pcbyte &= m_space->bytemask();
+
+	// opcode bytes come from the bus in its own byte order
+	offs_t addrxor = 0;
+	bool little = (m_space->endianness() == ENDIANNESS_LITTLE);
+	switch (m_space->data_width())
+	{
+		case 16:	addrxor = little ? BYTE_XOR_LE(0) : BYTE_XOR_BE(0);		break;
+		case 32:	addrxor = little ? BYTE4_XOR_LE(0) : BYTE4_XOR_BE(0);	break;
+		case 64:	addrxor = little ? BYTE8_XOR_LE(0) : BYTE8_XOR_BE(0);	break;
+	}
+
+	// fetch the bytes, telling handlers that this is not a real access
+	UINT8 opbuf[64], argbuf[64];
+	int numbytes = MIN(m_disasm->max_opcode_bytes(), ARRAY_LENGTH(opbuf));
+	m_space->set_debugger_access(true);
+	for (int index = 0; index < numbytes; index++)
+	{
+		opbuf[index] = m_space->direct().read_decrypted_byte(pcbyte + index, addrxor);
+		argbuf[index] = m_space->direct().read_raw_byte(pcbyte + index, addrxor);
+	}
+	m_space->set_debugger_access(false);
+
+	char text[256];
+	text[0] = 0;
+	offs_t result = m_disasm->disassemble(text, pc & m_space->logaddrmask(), opbuf, argbuf);
+	buffer.cpy(text);
+	return result;
+}
+
+
+//-------------------------------------------------
+//  write - write the collapsed stacks and flat
+//  profile for this device
+//-------------------------------------------------
+
+void guest_profiler::cpu_profile::write(const char *basename)
+{
+	if (m_total == 0)
+		return;
+
+	// one pair of files per device, named after its tag
+	astring name(m_device.tag());
+	name.replacechr(':', '_');
+	astring filename;
+	filename.printf("profile" PATH_SEPARATOR "%s" PATH_SEPARATOR "%s", basename, name.cstr());
+
+	emu_file file(OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	if (file.open(filename, ".folded") == FILERR_NONE)
+	{
+		write_folded(file);
+		file.close();
+	}
+	if (file.open(filename, ".txt") == FILERR_NONE)
+	{
+		write_flat(file);
+		file.close();
+	}
+	mame_printf_verbose("Wrote guest profile for '%s' to %s.txt/.folded\n", m_device.tag(), filename.cstr());
+}
+
+
+//-------------------------------------------------
+//  write_folded - write each unique stack with
+//  its sample count, one per line, outermost
+//  frame first
+//-------------------------------------------------
+
+void guest_profiler::cpu_profile::write_folded(emu_file &file)
+{
+	int chars = (m_space != NULL) ? m_space->logaddrchars() : 8;
+
+	for (int index = 0; index < m_samples.count(); index++)
+	{
+		const stack_sample &sample = m_samples[index];
+		astring line(m_device.tag());
+		for (int frame = 0; frame < sample.depth; frame++)
+			line.catprintf(";%0*X", chars, m_frames[sample.start + frame]);
+		line.catprintf(" %d\n", sample.count);
+		file.puts(line);
+	}
+}
+
+
+//-------------------------------------------------
+//  write_flat - write the busiest addresses and,
+//  if calls were followed, the busiest routines
+//-------------------------------------------------
+
+void guest_profiler::cpu_profile::write_flat(emu_file &file)
+{
+	int chars = (m_space != NULL) ? m_space->logaddrchars() : 8;
+	UINT32 busy = m_total - m_idle;
+
+	file.printf("Guest profile for '%s' (%s)\n", m_device.tag(), m_device.name());
+	file.printf("%d samples, %d while suspended (%.2f%%)\n", m_total, m_idle, 100.0 * m_idle / m_total);
+	if (m_calls && m_dropped != 0)
+		file.printf("%d frames dropped from the bottom of the call stack\n", m_dropped);
+	if (busy == 0)
+		return;
+
+	// sum the samples at each PC
+	dynamic_array<profile_count> counts;
+	for (int index = 0; index < m_samples.count(); index++)
+	{
+		const stack_sample &sample = m_samples[index];
+		profile_count count;
+		count.address = m_frames[sample.start + sample.depth - 1];
+		count.self = count.total = sample.count;
+		counts.append(count);
+	}
+	merge_counts(counts);
+
+	file.printf("\nSamples    %%      PC%*s  Disassembly\n", MAX(chars - 2, 0), "");
+	astring buffer;
+	for (int index = 0; index < counts.count(); index++)
+	{
+		disassemble(buffer, counts[index].address);
+		file.printf("%8d %6.2f%%  %0*X  %s\n", counts[index].total, 100.0 * counts[index].total / busy, chars, counts[index].address, buffer.cstr());
+	}
+	if (!m_calls)
+		return;
+
+	// sum the samples in each routine, itself and including everything it called
+	counts.reset();
+	for (int index = 0; index < m_samples.count(); index++)
+	{
+		const stack_sample &sample = m_samples[index];
+		const offs_t *frames = &m_frames[sample.start];
+		for (int frame = 0; frame < sample.depth - 1; frame++)
+		{
+			// recursion only counts once toward the total
+			int prev;
+			for (prev = 0; prev < frame; prev++)
+				if (frames[prev] == frames[frame])
+					break;
+
+			profile_count count;
+			count.address = frames[frame];
+			count.self = (frame == sample.depth - 2) ? sample.count : 0;
+			count.total = (prev == frame) ? sample.count : 0;
+			counts.append(count);
+		}
+	}
+	merge_counts(counts);
+
+	file.printf("\n    Self    %%    Total    %%      Routine\n");
+	for (int index = 0; index < counts.count(); index++)
+		file.printf("%8d %6.2f%% %8d %6.2f%%  %0*X\n", counts[index].self, 100.0 * counts[index].self / busy, counts[index].total, 100.0 * counts[index].total / busy, chars, counts[index].address);
+}
@@ -0,0 +1,174 @@
+/***************************************************************************
+
+    guestprof.h
+
+    Sampling profiler for emulated CPUs.
+
+****************************************************************************
+
+    Copyright Aaron Giles
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are
+    met:
+
+        * Redistributions of source code must retain the above copyright
+          notice, this list of conditions and the following disclaimer.
+        * Redistributions in binary form must reproduce the above copyright
+          notice, this list of conditions and the following disclaimer in
+          the documentation and/or other materials provided with the
+          distribution.
+        * Neither the name 'MAME' nor the names of its contributors may be
+          used to endorse or promote products derived from this software
+          without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY AARON GILES ''AS IS'' AND ANY EXPRESS OR
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL AARON GILES BE LIABLE FOR ANY DIRECT,
+    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+    HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+    STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+    IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+    POSSIBILITY OF SUCH DAMAGE.
+
+***************************************************************************/
+
+#pragma once
+
+#ifndef __EMU_H__
+#error Dont include this file directly; include emu.h instead.
+#endif
+
+#ifndef __GUESTPROF_H__
+#define __GUESTPROF_H__
+
+
+//**************************************************************************
+//  TYPE DEFINITIONS
+//**************************************************************************
+
+// ======================> guest_profiler
+
+// samples the PC of every executing device at a fixed emulated rate, and
+// optionally follows calls and returns to attribute samples to call stacks
+class guest_profiler
+{
+	DISABLE_COPYING(guest_profiler);
+
+public:
+	// construction/destruction
+	guest_profiler(running_machine &machine, emu_timer &timer);
+
+	// getters
+	running_machine &machine() const { return m_machine; }
+
+	// hooks
+	void instruction_hook(device_t &device, offs_t curpc);
+	void sample();
+
+private:
+	// a single frame on a return address stack
+	struct stack_frame
+	{
+		offs_t				entry;					// address the call went to
+		offs_t				retaddr;				// address the call will return to
+	};
+
+	// a unique stack and the number of samples taken in it
+	struct stack_sample
+	{
+		UINT32				hash;					// hash of the frames
+		int					next;					// next entry in the hash chain
+		int					start;					// index of the first frame in the frame pool
+		int					depth;					// number of frames, including the sampled PC
+		UINT32				count;					// number of samples
+	};
+
+	// a cached disassembly result
+	struct dasm_entry
+	{
+		offs_t				pc;						// address disassembled
+		offs_t				flags;					// flags and length returned by the disassembler
+	};
+
+	// per-device profile
+	class cpu_profile
+	{
+		friend class simple_list<cpu_profile>;
+
+	public:
+		// construction/destruction
+		cpu_profile(device_t &device);
+
+		// getters
+		cpu_profile *next() const { return m_next; }
+		device_t &device() const { return m_device; }
+
+		// operations
+		void instruction_hook(offs_t curpc);
+		void sample();
+		void write(const char *basename);
+
+	private:
+		// internal helpers
+		offs_t dasm_flags(offs_t pc);
+		offs_t disassemble(astring &buffer, offs_t pc);
+		void add_sample(const offs_t *frames, int depth);
+		void write_folded(emu_file &file);
+		void write_flat(emu_file &file);
+
+		static const int MAX_DEPTH = 64;
+		static const int DASM_CACHE_SIZE = 4096;
+		static const int STACK_HASH_SIZE = 4096;
+
+		// pending control flow from the previous instruction
+		enum
+		{
+			PENDING_NONE = 0,
+			PENDING_CALL,
+			PENDING_RETURN
+		};
+
+		// internal state
+		cpu_profile *				m_next;						// next profile in the list
+		device_t &					m_device;					// device being profiled
+		device_state_interface *	m_state;					// state interface, for the PC
+		device_execute_interface *	m_execute;					// execute interface, for suspension
+		device_disasm_interface *	m_disasm;					// disassembler, if any
+		device_memory_interface *	m_memory;					// memory interface, for translation
+		address_space *				m_space;					// program space
+		bool						m_calls;					// are calls being tracked?
+
+		int							m_depth;					// current return stack depth
+		stack_frame					m_stack[MAX_DEPTH];			// return address stack
+		int							m_pending;					// PENDING_* from the last instruction
+		int							m_delay;					// delay slots left before m_pending applies
+		offs_t						m_pendingret;				// return address of a pending call
+		dasm_entry					m_dasmcache[DASM_CACHE_SIZE];	// direct-mapped disassembly flags
+
+		UINT32						m_total;					// total samples taken
+		UINT32						m_idle;						// samples taken while suspended
+		UINT32						m_dropped;					// frames dropped off the bottom of the stack
+		int							m_buckets[STACK_HASH_SIZE];	// hash of unique stacks
+		dynamic_array<stack_sample>	m_samples;					// unique stacks
+		dynamic_array<offs_t>		m_frames;					// frames for all unique stacks
+	};
+
+	// internal helpers
+	void postload();
+	void exit();
+
+	// internal state
+	running_machine &			m_machine;					// reference to our machine
+	simple_list<cpu_profile>	m_cpulist;					// list of profiled devices
+	cpu_profile *				m_lastcpu;					// most recent device seen by the hook
+	emu_timer *					m_timer;					// sampling timer, owned by the machine
+	attotime					m_period;					// sampling period
+};
+
+
+#endif	/* __GUESTPROF_H__ */
@@ -107,6 +107,28 @@ void harddisk_image_device::device_start()
 	m_hard_disk_handle = NULL;
 }
 
+//-------------------------------------------------
+//  device_stop - write back any cached changes
+//  before exiting
+//-------------------------------------------------
+
+void harddisk_image_device::device_stop()
+{
+	if (m_hard_disk_handle != NULL && !hard_disk_flush(m_hard_disk_handle))
+		mame_printf_error("%s: failed to write back cached changes to the hard disk image\n", tag());
+}
+
+//-------------------------------------------------
+//  device_pre_save - write back any cached
+//  changes so the disk matches the saved state
+//-------------------------------------------------
+
+void harddisk_image_device::device_pre_save()
+{
+	if (m_hard_disk_handle != NULL && !hard_disk_flush(m_hard_disk_handle))
+		mame_printf_error("%s: failed to write back cached changes to the hard disk image\n", tag());
+}
+
 bool harddisk_image_device::call_load()
 {
 	int our_result;
@@ -166,6 +188,7 @@ void harddisk_image_device::call_unload()
 		m_device_image_unload(*this);
 	}
 
+	/* closing writes back any cached changes */
 	if (m_hard_disk_handle != NULL)
 	{
 		hard_disk_close(m_hard_disk_handle);
@@ -213,6 +236,9 @@ int harddisk_image_device::internal_load_hd()
 	if (!m_hard_disk_handle)
 		goto done;
 
+	/* keep written hunks in memory and write them back in the background */
+	hard_disk_enable_write_cache(m_hard_disk_handle, HARDDISK_WRITE_CACHE_HUNKS);
+
 done:
 	if (err)
 	{
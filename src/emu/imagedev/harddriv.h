@@ -12,6 +12,9 @@
 #include "image.h"
 #include "harddisk.h"
 
+/* number of hunks held by the write-back cache of each hard disk */
+#define HARDDISK_WRITE_CACHE_HUNKS	256
+
 /***************************************************************************
     TYPE DEFINITIONS
 ***************************************************************************/
@@ -63,6 +66,8 @@ protected:
 	// device-level overrides
     virtual void device_config_complete();
 	virtual void device_start();
+	virtual void device_stop();
+	virtual void device_pre_save();
 
 	int internal_load_hd();
 
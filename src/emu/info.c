@@ -42,6 +42,7 @@
 #include "machine/ram.h"
 #include "sound/samples.h"
 #include "info.h"
+#include "infocache.h"
 #include "xmlfile.h"
 #include "config.h"
 
@@ -200,8 +201,7 @@ const char info_xml_creator::s_dtd_string[] =
 //-------------------------------------------------
 
 info_xml_creator::info_xml_creator(driver_enumerator &drivlist)
-	: m_output(NULL),
-	  m_drivlist(drivlist),
+	: m_drivlist(drivlist),
 	  m_lookup_options(m_drivlist.options())
 {
 	m_lookup_options.remove_device_options();
@@ -215,18 +215,16 @@ info_xml_creator::info_xml_creator(driver_enumerator &drivlist)
 
 void info_xml_creator::output(FILE *out)
 {
-	m_output = out;
-
 	// output the DTD
-	fprintf(m_output, "<?xml version=\"1.0\"?>\n");
+	fprintf(out, "<?xml version=\"1.0\"?>\n");
 	astring dtd(s_dtd_string);
 	dtd.replace(0,"__XML_ROOT__", emulator_info::get_xml_root());
 	dtd.replace(0,"__XML_TOP__", emulator_info::get_xml_top());
 
-	fprintf(m_output, "%s\n\n", dtd.cstr());
+	fprintf(out, "%s\n\n", dtd.cstr());
 
 	// top-level tag
-	fprintf(m_output, "<%s build=\"%s\" debug=\""
+	fprintf(out, "<%s build=\"%s\" debug=\""
 #ifdef MAME_DEBUG
 		"yes"
 #else
@@ -238,15 +236,40 @@ void info_xml_creator::output(FILE *out)
 		CONFIG_VERSION
 	);
 
-	// iterate through the drivers, outputting one at a time
-	while (m_drivlist.next())
-		output_one();
+	// open the cache and queue up the configs it doesn't cover
+	info_cache cache(m_drivlist, "xml");
+	cache.prefetch();
 
-	// output devices (both devices with roms and slot devices)
-	output_devices();
+	// iterate through the drivers, outputting one at a time and gathering their
+	// devices (both devices with roms and slot devices) to output afterwards
+	m_devices.reset();
+	m_shortnames.reset();
+	astring devkey, devlist, fragment;
+	while (m_drivlist.next())
+	{
+		// format the driver and its devices unless we have them already
+		devkey.cpy(m_drivlist.driver().name).cat("/devices");
+		if (!cache.find_driver(m_output) || !cache.find(devkey, devlist))
+		{
+			m_output.reset();
+			output_one();
+			fragment.cpy(m_output);
+			output_devices(cache, devlist);
+			if (cache.cacheable())
+			{
+				cache.add(devkey, devlist);
+				cache.add_driver(fragment);
+			}
+			m_output.cpy(fragment);
+		}
+		else
+			gather_devices(cache, devlist);
+		fputs(m_output, out);
+	}
+	fputs(m_devices, out);
 
 	// close the top level tag
-	fprintf(m_output, "</%s>\n",emulator_info::get_xml_root());
+	fprintf(out, "</%s>\n",emulator_info::get_xml_root());
 }
 
 
@@ -271,8 +294,8 @@ void info_xml_creator::output_one()
 		portlist.append(*device, errors);
 
 	// print the header and the game name
-	fprintf(m_output, "\t<%s",emulator_info::get_xml_top());
-	fprintf(m_output, " name=\"%s\"", xml_normalize_string(driver.name));
+	m_output.catprintf("\t<%s",emulator_info::get_xml_top());
+	m_output.catprintf(" name=\"%s\"", xml_normalize_string(driver.name));
 
 	// strip away any path information from the source_file and output it
 	const char *start = strrchr(driver.source_file, '/');
@@ -280,38 +303,38 @@ void info_xml_creator::output_one()
 		start = strrchr(driver.source_file, '\\');
 	if (start == NULL)
 		start = driver.source_file - 1;
-	fprintf(m_output, " sourcefile=\"%s\"", xml_normalize_string(start + 1));
+	m_output.catprintf(" sourcefile=\"%s\"", xml_normalize_string(start + 1));
 
 	// append bios and runnable flags
 	if (driver.flags & GAME_IS_BIOS_ROOT)
-		fprintf(m_output, " isbios=\"yes\"");
+		m_output.catprintf(" isbios=\"yes\"");
 	if (driver.flags & GAME_NO_STANDALONE)
-		fprintf(m_output, " runnable=\"no\"");
+		m_output.catprintf(" runnable=\"no\"");
 	if (driver.flags & GAME_MECHANICAL)
-		fprintf(m_output, " ismechanical=\"yes\"");
+		m_output.catprintf(" ismechanical=\"yes\"");
 
 	// display clone information
 	int clone_of = m_drivlist.find(driver.parent);
 	if (clone_of != -1 && !(m_drivlist.driver(clone_of).flags & GAME_IS_BIOS_ROOT))
-		fprintf(m_output, " cloneof=\"%s\"", xml_normalize_string(m_drivlist.driver(clone_of).name));
+		m_output.catprintf(" cloneof=\"%s\"", xml_normalize_string(m_drivlist.driver(clone_of).name));
 	if (clone_of != -1)
-		fprintf(m_output, " romof=\"%s\"", xml_normalize_string(m_drivlist.driver(clone_of).name));
+		m_output.catprintf(" romof=\"%s\"", xml_normalize_string(m_drivlist.driver(clone_of).name));
 
 	// display sample information and close the game tag
 	output_sampleof();
-	fprintf(m_output, ">\n");
+	m_output.catprintf(">\n");
 
 	// output game description
 	if (driver.description != NULL)
-		fprintf(m_output, "\t\t<description>%s</description>\n", xml_normalize_string(driver.description));
+		m_output.catprintf("\t\t<description>%s</description>\n", xml_normalize_string(driver.description));
 
 	// print the year only if is a number or another allowed character (? or +)
 	if (driver.year != NULL && strspn(driver.year, "0123456789?+") == strlen(driver.year))
-		fprintf(m_output, "\t\t<year>%s</year>\n", xml_normalize_string(driver.year));
+		m_output.catprintf("\t\t<year>%s</year>\n", xml_normalize_string(driver.year));
 
 	// print the manufacturer information
 	if (driver.manufacturer != NULL)
-		fprintf(m_output, "\t\t<manufacturer>%s</manufacturer>\n", xml_normalize_string(driver.manufacturer));
+		m_output.catprintf("\t\t<manufacturer>%s</manufacturer>\n", xml_normalize_string(driver.manufacturer));
 
 	// now print various additional information
 	output_bios();
@@ -332,7 +355,7 @@ void info_xml_creator::output_one()
 	output_ramoptions();
 
 	// close the topmost tag
-	fprintf(m_output, "\t</%s>\n",emulator_info::get_xml_top());
+	m_output.catprintf("\t</%s>\n",emulator_info::get_xml_top());
 }
 
 
@@ -364,12 +387,12 @@ void info_xml_creator::output_one_device(device_t &device, const char *devtag)
 			}
 
 	// start to output info
-	fprintf(m_output, "\t<%s", emulator_info::get_xml_top());
-	fprintf(m_output, " name=\"%s\"", xml_normalize_string(device.shortname()));
-	fprintf(m_output, " isdevice=\"yes\"");
-	fprintf(m_output, " runnable=\"no\"");
-	fprintf(m_output, ">\n");
-	fprintf(m_output, "\t\t<description>%s</description>\n", xml_normalize_string(device.name()));
+	m_output.catprintf("\t<%s", emulator_info::get_xml_top());
+	m_output.catprintf(" name=\"%s\"", xml_normalize_string(device.shortname()));
+	m_output.catprintf(" isdevice=\"yes\"");
+	m_output.catprintf(" runnable=\"no\"");
+	m_output.catprintf(">\n");
+	m_output.catprintf("\t\t<description>%s</description>\n", xml_normalize_string(device.name()));
 
 	output_rom(device);
 	output_chips(device, devtag);
@@ -383,7 +406,7 @@ void info_xml_creator::output_one_device(device_t &device, const char *devtag)
 	output_adjusters(portlist);
 	output_images(device, devtag);
 	output_slots(device, devtag);
-	fprintf(m_output, "\t</%s>\n", emulator_info::get_xml_top());
+	m_output.catprintf("\t</%s>\n", emulator_info::get_xml_top());
 }
 
 
@@ -393,49 +416,98 @@ void info_xml_creator::output_one_device(device_t &device, const char *devtag)
 //  in slots
 //-------------------------------------------------
 
-typedef tagmap_t<FPTR> slot_map;
-
-void info_xml_creator::output_devices()
+void info_xml_creator::output_devices(info_cache &cache, astring &devlist)
 {
-	m_drivlist.reset();
-	slot_map shortnames;
+	// when caching, every device is formatted so the list is complete for later
+	// runs; each line of the list names a device and the cache entry holding it
+	bool cacheable = cache.cacheable();
+	devlist.reset();
 
-	while (m_drivlist.next())
+	// first, run through devices with roms which belongs to the default configuration
+	device_iterator deviter(m_drivlist.config().root_device());
+	for (device_t *device = deviter.first(); device != NULL; device = deviter.next())
 	{
-		// first, run through devices with roms which belongs to the default configuration
-		device_iterator deviter(m_drivlist.config().root_device());
-		for (device_t *device = deviter.first(); device != NULL; device = deviter.next())
+		if (device->owner() != NULL && device->rom_region() != NULL && device->shortname()!= NULL)
 		{
-			if (device->owner() != NULL && device->rom_region() != NULL && device->shortname()!= NULL)
+			if (cacheable || m_shortnames.find(device->shortname()) == 0)
 			{
-				if (shortnames.add(device->shortname(), 0, FALSE) != TMERR_DUPLICATE)
-					output_one_device(*device, device->tag());
+				m_output.reset();
+				output_one_device(*device, device->tag());
+				add_device(cache, devlist, device->shortname());
 			}
 		}
+	}
 
-		// then, run through slot devices
-		slot_interface_iterator iter(m_drivlist.config().root_device());
-		for (const device_slot_interface *slot = iter.first(); slot != NULL; slot = iter.next())
+	// then, run through slot devices
+	slot_interface_iterator iter(m_drivlist.config().root_device());
+	for (const device_slot_interface *slot = iter.first(); slot != NULL; slot = iter.next())
+	{
+		const slot_interface* intf = slot->get_slot_interfaces();
+		for (int i = 0; intf && intf[i].name != NULL; i++)
 		{
-			const slot_interface* intf = slot->get_slot_interfaces();
-			for (int i = 0; intf && intf[i].name != NULL; i++)
+			astring temptag("_");
+			temptag.cat(intf[i].name);
+			device_t *dev = const_cast<machine_config &>(m_drivlist.config()).device_add(&m_drivlist.config().root_device(), temptag.cstr(), intf[i].devtype, 0);
+
+			// notify this device and all its subdevices that they are now configured
+			device_iterator subiter(*dev);
+			for (device_t *device = subiter.first(); device != NULL; device = subiter.next())
+				if (!device->configured())
+					device->config_complete();
+
+			if (cacheable || m_shortnames.find(dev->shortname()) == 0)
 			{
-				astring temptag("_");
-				temptag.cat(intf[i].name);
-				device_t *dev = const_cast<machine_config &>(m_drivlist.config()).device_add(&m_drivlist.config().root_device(), temptag.cstr(), intf[i].devtype, 0);
+				m_output.reset();
+				output_one_device(*dev, temptag.cstr());
+				add_device(cache, devlist, dev->shortname());
+			}
 
-				// notify this device and all its subdevices that they are now configured
-				device_iterator subiter(*dev);
-				for (device_t *device = subiter.first(); device != NULL; device = subiter.next())
-					if (!device->configured())
-						device->config_complete();
+			const_cast<machine_config &>(m_drivlist.config()).device_remove(&m_drivlist.config().root_device(), temptag.cstr());
+			global_free(dev);
+		}
+	}
+}
 
-				if (shortnames.add(dev->shortname(), 0, FALSE) != TMERR_DUPLICATE)
-					output_one_device(*dev, temptag.cstr());
 
-				const_cast<machine_config &>(m_drivlist.config()).device_remove(&m_drivlist.config().root_device(), temptag.cstr());
-				global_free(dev);
-			}
+//-------------------------------------------------
+//  add_device - take the device just formatted
+//  into m_output, queueing it for output if it
+//  is new and adding it to the cache
+//-------------------------------------------------
+
+void info_xml_creator::add_device(info_cache &cache, astring &devlist, const char *shortname)
+{
+	if (m_shortnames.add(shortname, 1, FALSE) != TMERR_DUPLICATE)
+		m_devices.cat(m_output);
+
+	// identical devices share one entry, keyed by their contents
+	if (cache.cacheable())
+	{
+		astring key;
+		key.printf("@%s/%08x/%d", shortname, crc32_creator::simple(m_output, m_output.len()).m_raw, m_output.len());
+		cache.add(key, m_output);
+		devlist.cat(shortname).cat("\t").cat(key).cat("\n");
+	}
+}
+
+
+//-------------------------------------------------
+//  gather_devices - queue up the new devices
+//  from a cached device list for output
+//-------------------------------------------------
+
+void info_xml_creator::gather_devices(info_cache &cache, const astring &devlist)
+{
+	astring shortname, key, fragment;
+	for (int start = 0, end = devlist.chr(0, '\n'); end != -1; start = end + 1, end = devlist.chr(start, '\n'))
+	{
+		int tab = devlist.chr(start, '\t');
+		shortname.cpysubstr(devlist, start, tab - start);
+		key.cpysubstr(devlist, tab + 1, end - tab - 1);
+		if (m_shortnames.find(shortname) == 0 && cache.find(key, fragment))
+		{
+			m_shortnames.add(shortname, 1, FALSE);
+			m_devices.cat(fragment);
 		}
 	}
 }
@@ -451,7 +523,7 @@ void info_xml_creator::output_device_roms()
 	device_iterator deviter(m_drivlist.config().root_device());
 	for (device_t *device = deviter.first(); device != NULL; device = deviter.next())
 		if (device->owner() != NULL && device->rom_region() != NULL && device->shortname()!= NULL)
-			fprintf(m_output, "\t\t<device_ref name=\"%s\"/>\n", xml_normalize_string(device->shortname()));
+			m_output.catprintf("\t\t<device_ref name=\"%s\"/>\n", xml_normalize_string(device->shortname()));
 }
 
 
@@ -469,7 +541,7 @@ void info_xml_creator::output_sampleof()
 		samples_iterator sampiter(*device);
 		if (sampiter.altbasename() != NULL)
 		{
-			fprintf(m_output, " sampleof=\"%s\"", xml_normalize_string(sampiter.altbasename()));
+			m_output.catprintf(" sampleof=\"%s\"", xml_normalize_string(sampiter.altbasename()));
 
 			// must stop here, as there can only be one attribute of the same name
 			return;
@@ -494,12 +566,12 @@ void info_xml_creator::output_bios()
 		if (ROMENTRY_ISSYSTEM_BIOS(rom))
 		{
 			// output extracted name and descriptions
-			fprintf(m_output, "\t\t<biosset");
-			fprintf(m_output, " name=\"%s\"", xml_normalize_string(ROM_GETNAME(rom)));
-			fprintf(m_output, " description=\"%s\"", xml_normalize_string(ROM_GETHASHDATA(rom)));
+			m_output.catprintf("\t\t<biosset");
+			m_output.catprintf(" name=\"%s\"", xml_normalize_string(ROM_GETNAME(rom)));
+			m_output.catprintf(" description=\"%s\"", xml_normalize_string(ROM_GETHASHDATA(rom)));
 			if (ROM_GETBIOSFLAGS(rom) == 1)
-				fprintf(m_output, " default=\"yes\"");
-			fprintf(m_output, "/>\n");
+				m_output.catprintf(" default=\"yes\"");
+			m_output.catprintf("/>\n");
 		}
 }
 
@@ -555,49 +627,49 @@ void info_xml_creator::output_rom(device_t &device)
 
 				// opening tag
 				if (!is_disk)
-					fprintf(m_output, "\t\t<rom");
+					m_output.catprintf("\t\t<rom");
 				else
-					fprintf(m_output, "\t\t<disk");
+					m_output.catprintf("\t\t<disk");
 
 				// add name, merge, bios, and size tags */
 				if (name != NULL && name[0] != 0)
-					fprintf(m_output, " name=\"%s\"", xml_normalize_string(name));
+					m_output.catprintf(" name=\"%s\"", xml_normalize_string(name));
 				if (merge_name != NULL)
-					fprintf(m_output, " merge=\"%s\"", xml_normalize_string(merge_name));
+					m_output.catprintf(" merge=\"%s\"", xml_normalize_string(merge_name));
 				if (bios_name[0] != 0)
-					fprintf(m_output, " bios=\"%s\"", xml_normalize_string(bios_name));
+					m_output.catprintf(" bios=\"%s\"", xml_normalize_string(bios_name));
 				if (!is_disk)
-					fprintf(m_output, " size=\"%d\"", rom_file_size(rom));
+					m_output.catprintf(" size=\"%d\"", rom_file_size(rom));
 
 				// dump checksum information only if there is a known dump
 				if (!hashes.flag(hash_collection::FLAG_NO_DUMP))
 				{
 					// iterate over hash function types and print m_output their values
 					astring tempstr;
-					fprintf(m_output, " %s", hashes.attribute_string(tempstr));
+					m_output.catprintf(" %s", hashes.attribute_string(tempstr));
 				}
 				else
-					fprintf(m_output, " status=\"nodump\"");
+					m_output.catprintf(" status=\"nodump\"");
 
 				// append a region name
-				fprintf(m_output, " region=\"%s\"", ROMREGION_GETTAG(region));
+				m_output.catprintf(" region=\"%s\"", ROMREGION_GETTAG(region));
 
 				// for non-disk entries, print offset
 				if (!is_disk)
-					fprintf(m_output, " offset=\"%x\"", offset);
+					m_output.catprintf(" offset=\"%x\"", offset);
 
 				// for disk entries, add the disk index
 				else
 				{
-					fprintf(m_output, " index=\"%x\"", DISK_GETINDEX(rom));
-					fprintf(m_output, " writable=\"%s\"", DISK_ISREADONLY(rom) ? "no" : "yes");
+					m_output.catprintf(" index=\"%x\"", DISK_GETINDEX(rom));
+					m_output.catprintf(" writable=\"%s\"", DISK_ISREADONLY(rom) ? "no" : "yes");
 				}
 
 				// add optional flag
 				if ((!is_disk && ROM_ISOPTIONAL(rom)) || (is_disk && DISK_ISOPTIONAL(rom)))
-					fprintf(m_output, " optional=\"yes\"");
+					m_output.catprintf(" optional=\"yes\"");
 
-				fprintf(m_output, "/>\n");
+				m_output.catprintf("/>\n");
 			}
 		}
 }
@@ -623,7 +695,7 @@ void info_xml_creator::output_sample()
 				continue;
 
 			// output the sample name
-			fprintf(m_output, "\t\t<sample name=\"%s\"/>\n", xml_normalize_string(samplename));
+			m_output.catprintf("\t\t<sample name=\"%s\"/>\n", xml_normalize_string(samplename));
 		}
 	}
 }
@@ -645,12 +717,12 @@ void info_xml_creator::output_chips(device_t &device, const char *root_tag)
 			astring newtag(exec->device().tag()), oldtag(":");
 			newtag.substr(newtag.find(oldtag.cat(root_tag)) + oldtag.len());
 
-			fprintf(m_output, "\t\t<chip");
-			fprintf(m_output, " type=\"cpu\"");
-			fprintf(m_output, " tag=\"%s\"", xml_normalize_string(newtag));
-			fprintf(m_output, " name=\"%s\"", xml_normalize_string(exec->device().name()));
-			fprintf(m_output, " clock=\"%d\"", exec->device().clock());
-			fprintf(m_output, "/>\n");
+			m_output.catprintf("\t\t<chip");
+			m_output.catprintf(" type=\"cpu\"");
+			m_output.catprintf(" tag=\"%s\"", xml_normalize_string(newtag));
+			m_output.catprintf(" name=\"%s\"", xml_normalize_string(exec->device().name()));
+			m_output.catprintf(" clock=\"%d\"", exec->device().clock());
+			m_output.catprintf("/>\n");
 		}
 	}
 
@@ -663,13 +735,13 @@ void info_xml_creator::output_chips(device_t &device, const char *root_tag)
 			astring newtag(sound->device().tag()), oldtag(":");
 			newtag.substr(newtag.find(oldtag.cat(root_tag)) + oldtag.len());
 
-			fprintf(m_output, "\t\t<chip");
-			fprintf(m_output, " type=\"audio\"");
-			fprintf(m_output, " tag=\"%s\"", xml_normalize_string(newtag));
-			fprintf(m_output, " name=\"%s\"", xml_normalize_string(sound->device().name()));
+			m_output.catprintf("\t\t<chip");
+			m_output.catprintf(" type=\"audio\"");
+			m_output.catprintf(" tag=\"%s\"", xml_normalize_string(newtag));
+			m_output.catprintf(" name=\"%s\"", xml_normalize_string(sound->device().name()));
 			if (sound->device().clock() != 0)
-				fprintf(m_output, " clock=\"%d\"", sound->device().clock());
-			fprintf(m_output, "/>\n");
+				m_output.catprintf(" clock=\"%d\"", sound->device().clock());
+			m_output.catprintf("/>\n");
 		}
 	}
 }
@@ -691,43 +763,43 @@ void info_xml_creator::output_display(device_t &device, const char *root_tag)
 			astring newtag(screendev->tag()), oldtag(":");
 			newtag.substr(newtag.find(oldtag.cat(root_tag)) + oldtag.len());
 
-			fprintf(m_output, "\t\t<display");
-			fprintf(m_output, " tag=\"%s\"", xml_normalize_string(newtag));
+			m_output.catprintf("\t\t<display");
+			m_output.catprintf(" tag=\"%s\"", xml_normalize_string(newtag));
 
 			switch (screendev->screen_type())
 			{
-				case SCREEN_TYPE_RASTER:	fprintf(m_output, " type=\"raster\"");	break;
-				case SCREEN_TYPE_VECTOR:	fprintf(m_output, " type=\"vector\"");	break;
-				case SCREEN_TYPE_LCD:		fprintf(m_output, " type=\"lcd\"");		break;
-				default:					fprintf(m_output, " type=\"unknown\"");	break;
+				case SCREEN_TYPE_RASTER:	m_output.catprintf(" type=\"raster\"");	break;
+				case SCREEN_TYPE_VECTOR:	m_output.catprintf(" type=\"vector\"");	break;
+				case SCREEN_TYPE_LCD:		m_output.catprintf(" type=\"lcd\"");		break;
+				default:					m_output.catprintf(" type=\"unknown\"");	break;
 			}
 
 			// output the orientation as a string
 			switch (m_drivlist.driver().flags & ORIENTATION_MASK)
 			{
 				case ORIENTATION_FLIP_X:
-					fprintf(m_output, " rotate=\"0\" flipx=\"yes\"");
+					m_output.catprintf(" rotate=\"0\" flipx=\"yes\"");
 					break;
 				case ORIENTATION_FLIP_Y:
-					fprintf(m_output, " rotate=\"180\" flipx=\"yes\"");
+					m_output.catprintf(" rotate=\"180\" flipx=\"yes\"");
 					break;
 				case ORIENTATION_FLIP_X|ORIENTATION_FLIP_Y:
-					fprintf(m_output, " rotate=\"180\"");
+					m_output.catprintf(" rotate=\"180\"");
 					break;
 				case ORIENTATION_SWAP_XY:
-					fprintf(m_output, " rotate=\"90\" flipx=\"yes\"");
+					m_output.catprintf(" rotate=\"90\" flipx=\"yes\"");
 					break;
 				case ORIENTATION_SWAP_XY|ORIENTATION_FLIP_X:
-					fprintf(m_output, " rotate=\"90\"");
+					m_output.catprintf(" rotate=\"90\"");
 					break;
 				case ORIENTATION_SWAP_XY|ORIENTATION_FLIP_Y:
-					fprintf(m_output, " rotate=\"270\"");
+					m_output.catprintf(" rotate=\"270\"");
 					break;
 				case ORIENTATION_SWAP_XY|ORIENTATION_FLIP_X|ORIENTATION_FLIP_Y:
-					fprintf(m_output, " rotate=\"270\" flipx=\"yes\"");
+					m_output.catprintf(" rotate=\"270\" flipx=\"yes\"");
 					break;
 				default:
-					fprintf(m_output, " rotate=\"0\"");
+					m_output.catprintf(" rotate=\"0\"");
 					break;
 			}
 
@@ -735,12 +807,12 @@ void info_xml_creator::output_display(device_t &device, const char *root_tag)
 			if (screendev->screen_type() != SCREEN_TYPE_VECTOR)
 			{
 				const rectangle &visarea = screendev->visible_area();
-				fprintf(m_output, " width=\"%d\"", visarea.width());
-				fprintf(m_output, " height=\"%d\"", visarea.height());
+				m_output.catprintf(" width=\"%d\"", visarea.width());
+				m_output.catprintf(" height=\"%d\"", visarea.height());
 			}
 
 			// output refresh rate
-			fprintf(m_output, " refresh=\"%f\"", ATTOSECONDS_TO_HZ(screendev->refresh_attoseconds()));
+			m_output.catprintf(" refresh=\"%f\"", ATTOSECONDS_TO_HZ(screendev->refresh_attoseconds()));
 
 			// output raw video parameters only for games that are not vector
 			// and had raw parameters specified
@@ -748,15 +820,15 @@ void info_xml_creator::output_display(device_t &device, const char *root_tag)
 			{
 				int pixclock = screendev->width() * screendev->height() * ATTOSECONDS_TO_HZ(screendev->refresh_attoseconds());
 
-				fprintf(m_output, " pixclock=\"%d\"", pixclock);
-				fprintf(m_output, " htotal=\"%d\"", screendev->width());
-				fprintf(m_output, " hbend=\"%d\"", screendev->visible_area().min_x);
-				fprintf(m_output, " hbstart=\"%d\"", screendev->visible_area().max_x+1);
-				fprintf(m_output, " vtotal=\"%d\"", screendev->height());
-				fprintf(m_output, " vbend=\"%d\"", screendev->visible_area().min_y);
-				fprintf(m_output, " vbstart=\"%d\"", screendev->visible_area().max_y+1);
+				m_output.catprintf(" pixclock=\"%d\"", pixclock);
+				m_output.catprintf(" htotal=\"%d\"", screendev->width());
+				m_output.catprintf(" hbend=\"%d\"", screendev->visible_area().min_x);
+				m_output.catprintf(" hbstart=\"%d\"", screendev->visible_area().max_x+1);
+				m_output.catprintf(" vtotal=\"%d\"", screendev->height());
+				m_output.catprintf(" vbend=\"%d\"", screendev->visible_area().min_y);
+				m_output.catprintf(" vbstart=\"%d\"", screendev->visible_area().max_y+1);
 			}
-			fprintf(m_output, " />\n");
+			m_output.catprintf(" />\n");
 		}
 	}
 }
@@ -777,7 +849,7 @@ void info_xml_creator::output_sound(device_t &device)
 	if (snditer.first() == NULL)
 		speakers = 0;
 
-	fprintf(m_output, "\t\t<sound channels=\"%d\"/>\n", speakers);
+	m_output.catprintf("\t\t<sound channels=\"%d\"/>\n", speakers);
 }
 
 
@@ -986,17 +1058,17 @@ void info_xml_creator::output_input(const ioport_list &portlist)
 		}
 
 	// output the basic info
-	fprintf(m_output, "\t\t<input");
-	fprintf(m_output, " players=\"%d\"", nplayer);
+	m_output.catprintf("\t\t<input");
+	m_output.catprintf(" players=\"%d\"", nplayer);
 	if (nbutton != 0)
-		fprintf(m_output, " buttons=\"%d\"", nbutton);
+		m_output.catprintf(" buttons=\"%d\"", nbutton);
 	if (ncoin != 0)
-		fprintf(m_output, " coins=\"%d\"", ncoin);
+		m_output.catprintf(" coins=\"%d\"", ncoin);
 	if (service)
-		fprintf(m_output, " service=\"yes\"");
+		m_output.catprintf(" service=\"yes\"");
 	if (tilt)
-		fprintf(m_output, " tilt=\"yes\"");
-	fprintf(m_output, ">\n");
+		m_output.catprintf(" tilt=\"yes\"");
+	m_output.catprintf(">\n");
 
 	// output the joystick types
 	if (joytype[1]==0 && joytype[2]!=0) { joytype[1] = joytype[2]; joytype[2] = 0; }
@@ -1005,7 +1077,7 @@ void info_xml_creator::output_input(const ioport_list &portlist)
 	if (joytype[0] != 0)
 	{
 		const char *joys = (joytype[2]!=0) ? "triple" : (joytype[1]!=0) ? "double" : "";
-		fprintf(m_output, "\t\t\t<control type=\"%sjoy\"", joys);
+		m_output.catprintf("\t\t\t<control type=\"%sjoy\"", joys);
 		for (int lp=0; lp<3 && joytype[lp]!=0; lp++)
 		{
 			const char *plural = (lp==2) ? "3" : (lp==1) ? "2" : "";
@@ -1037,46 +1109,46 @@ void info_xml_creator::output_input(const ioport_list &portlist)
 					ways = "strange2";
 					break;
 			}
-			fprintf(m_output, " ways%s=\"%s\"", plural,ways);
+			m_output.catprintf(" ways%s=\"%s\"", plural,ways);
 		}
-		fprintf(m_output, "/>\n");
+		m_output.catprintf("/>\n");
 	}
 
 	// output analog types
 	for (int type = 0; type < ANALOG_TYPE_COUNT; type++)
 		if (control_info[type].type != NULL)
 		{
-			fprintf(m_output, "\t\t\t<control type=\"%s\"", xml_normalize_string(control_info[type].type));
+			m_output.catprintf("\t\t\t<control type=\"%s\"", xml_normalize_string(control_info[type].type));
 			if (control_info[type].min != 0 || control_info[type].max != 0)
 			{
-				fprintf(m_output, " minimum=\"%d\"", control_info[type].min);
-				fprintf(m_output, " maximum=\"%d\"", control_info[type].max);
+				m_output.catprintf(" minimum=\"%d\"", control_info[type].min);
+				m_output.catprintf(" maximum=\"%d\"", control_info[type].max);
 			}
 			if (control_info[type].sensitivity != 0)
-				fprintf(m_output, " sensitivity=\"%d\"", control_info[type].sensitivity);
+				m_output.catprintf(" sensitivity=\"%d\"", control_info[type].sensitivity);
 			if (control_info[type].keydelta != 0)
-				fprintf(m_output, " keydelta=\"%d\"", control_info[type].keydelta);
+				m_output.catprintf(" keydelta=\"%d\"", control_info[type].keydelta);
 			if (control_info[type].reverse)
-				fprintf(m_output, " reverse=\"yes\"");
+				m_output.catprintf(" reverse=\"yes\"");
 
-			fprintf(m_output, "/>\n");
+			m_output.catprintf("/>\n");
 		}
 
 	// output keypad and keyboard
 	if (keypad)
-		fprintf(m_output, "\t\t\t<control type=\"keypad\"/>\n");
+		m_output.catprintf("\t\t\t<control type=\"keypad\"/>\n");
 	if (keyboard)
-		fprintf(m_output, "\t\t\t<control type=\"keyboard\"/>\n");
+		m_output.catprintf("\t\t\t<control type=\"keyboard\"/>\n");
 
 	// misc
 	if (mahjong)
-		fprintf(m_output, "\t\t\t<control type=\"mahjong\"/>\n");
+		m_output.catprintf("\t\t\t<control type=\"mahjong\"/>\n");
 	if (hanafuda)
-		fprintf(m_output, "\t\t\t<control type=\"hanafuda\"/>\n");
+		m_output.catprintf("\t\t\t<control type=\"hanafuda\"/>\n");
 	if (gambling)
-		fprintf(m_output, "\t\t\t<control type=\"gambling\"/>\n");
+		m_output.catprintf("\t\t\t<control type=\"gambling\"/>\n");
 
-	fprintf(m_output, "\t\t</input>\n");
+	m_output.catprintf("\t\t</input>\n");
 }
 
 
@@ -1096,23 +1168,23 @@ void info_xml_creator::output_switches(const ioport_list &portlist, const char *
 				newtag.substr(newtag.find(oldtag.cat(root_tag)) + oldtag.len());
 
 				// output the switch name information
-				fprintf(m_output, "\t\t<%s name=\"%s\"", outertag, xml_normalize_string(field->name()));
-				fprintf(m_output, " tag=\"%s\"", xml_normalize_string(newtag));
-				fprintf(m_output, " mask=\"%u\"", field->mask());
-				fprintf(m_output, ">\n");
+				m_output.catprintf("\t\t<%s name=\"%s\"", outertag, xml_normalize_string(field->name()));
+				m_output.catprintf(" tag=\"%s\"", xml_normalize_string(newtag));
+				m_output.catprintf(" mask=\"%u\"", field->mask());
+				m_output.catprintf(">\n");
 
 				// loop over settings
 				for (ioport_setting *setting = field->first_setting(); setting != NULL; setting = setting->next())
 				{
-					fprintf(m_output, "\t\t\t<%s name=\"%s\"", innertag, xml_normalize_string(setting->name()));
-					fprintf(m_output, " value=\"%u\"", setting->value());
+					m_output.catprintf("\t\t\t<%s name=\"%s\"", innertag, xml_normalize_string(setting->name()));
+					m_output.catprintf(" value=\"%u\"", setting->value());
 					if (setting->value() == field->defvalue())
-						fprintf(m_output, " default=\"yes\"");
-					fprintf(m_output, "/>\n");
+						m_output.catprintf(" default=\"yes\"");
+					m_output.catprintf("/>\n");
 				}
 
 				// terminate the switch entry
-				fprintf(m_output, "\t\t</%s>\n", outertag);
+				m_output.catprintf("\t\t</%s>\n", outertag);
 			}
 }
 
@@ -1128,7 +1200,7 @@ void info_xml_creator::output_adjusters(const ioport_list &portlist)
 	for (ioport_port *port = portlist.first(); port != NULL; port = port->next())
 		for (ioport_field *field = port->first_field(); field != NULL; field = field->next())
 			if (field->type() == IPT_ADJUSTER)
-				fprintf(m_output, "\t\t<adjuster name=\"%s\" default=\"%d\"/>\n", xml_normalize_string(field->name()), field->defvalue());
+				m_output.catprintf("\t\t<adjuster name=\"%s\" default=\"%d\"/>\n", xml_normalize_string(field->name()), field->defvalue());
 }
 
 
@@ -1138,7 +1210,7 @@ void info_xml_creator::output_adjusters(const ioport_list &portlist)
 
 void info_xml_creator::output_driver()
 {
-	fprintf(m_output, "\t\t<driver");
+	m_output.catprintf("\t\t<driver");
 
 	/* The status entry is an hint for frontend authors */
 	/* to select working and not working games without */
@@ -1149,50 +1221,50 @@ void info_xml_creator::output_driver()
 	/* don't work or have major emulation problems. */
 
 	if (m_drivlist.driver().flags & (GAME_NOT_WORKING | GAME_UNEMULATED_PROTECTION | GAME_NO_SOUND | GAME_WRONG_COLORS | GAME_MECHANICAL))
-		fprintf(m_output, " status=\"preliminary\"");
+		m_output.catprintf(" status=\"preliminary\"");
 	else if (m_drivlist.driver().flags & (GAME_IMPERFECT_COLORS | GAME_IMPERFECT_SOUND | GAME_IMPERFECT_GRAPHICS))
-		fprintf(m_output, " status=\"imperfect\"");
+		m_output.catprintf(" status=\"imperfect\"");
 	else
-		fprintf(m_output, " status=\"good\"");
+		m_output.catprintf(" status=\"good\"");
 
 	if (m_drivlist.driver().flags & GAME_NOT_WORKING)
-		fprintf(m_output, " emulation=\"preliminary\"");
+		m_output.catprintf(" emulation=\"preliminary\"");
 	else
-		fprintf(m_output, " emulation=\"good\"");
+		m_output.catprintf(" emulation=\"good\"");
 
 	if (m_drivlist.driver().flags & GAME_WRONG_COLORS)
-		fprintf(m_output, " color=\"preliminary\"");
+		m_output.catprintf(" color=\"preliminary\"");
 	else if (m_drivlist.driver().flags & GAME_IMPERFECT_COLORS)
-		fprintf(m_output, " color=\"imperfect\"");
+		m_output.catprintf(" color=\"imperfect\"");
 	else
-		fprintf(m_output, " color=\"good\"");
+		m_output.catprintf(" color=\"good\"");
 
 	if (m_drivlist.driver().flags & GAME_NO_SOUND)
-		fprintf(m_output, " sound=\"preliminary\"");
+		m_output.catprintf(" sound=\"preliminary\"");
 	else if (m_drivlist.driver().flags & GAME_IMPERFECT_SOUND)
-		fprintf(m_output, " sound=\"imperfect\"");
+		m_output.catprintf(" sound=\"imperfect\"");
 	else
-		fprintf(m_output, " sound=\"good\"");
+		m_output.catprintf(" sound=\"good\"");
 
 	if (m_drivlist.driver().flags & GAME_IMPERFECT_GRAPHICS)
-		fprintf(m_output, " graphic=\"imperfect\"");
+		m_output.catprintf(" graphic=\"imperfect\"");
 	else
-		fprintf(m_output, " graphic=\"good\"");
+		m_output.catprintf(" graphic=\"good\"");
 
 	if (m_drivlist.driver().flags & GAME_NO_COCKTAIL)
-		fprintf(m_output, " cocktail=\"preliminary\"");
+		m_output.catprintf(" cocktail=\"preliminary\"");
 
 	if (m_drivlist.driver().flags & GAME_UNEMULATED_PROTECTION)
-		fprintf(m_output, " protection=\"preliminary\"");
+		m_output.catprintf(" protection=\"preliminary\"");
 
 	if (m_drivlist.driver().flags & GAME_SUPPORTS_SAVE)
-		fprintf(m_output, " savestate=\"supported\"");
+		m_output.catprintf(" savestate=\"supported\"");
 	else
-		fprintf(m_output, " savestate=\"unsupported\"");
+		m_output.catprintf(" savestate=\"unsupported\"");
 
-	fprintf(m_output, " palettesize=\"%d\"", m_drivlist.config().m_total_colors);
+	m_output.catprintf(" palettesize=\"%d\"", m_drivlist.config().m_total_colors);
 
-	fprintf(m_output, "/>\n");
+	m_output.catprintf("/>\n");
 }
 
 
@@ -1212,42 +1284,42 @@ void info_xml_creator::output_images(device_t &device, const char *root_tag)
 			newtag.substr(newtag.find(oldtag.cat(root_tag)) + oldtag.len());
 
 			// print m_output device type
-			fprintf(m_output, "\t\t<device type=\"%s\"", xml_normalize_string(imagedev->image_type_name()));
+			m_output.catprintf("\t\t<device type=\"%s\"", xml_normalize_string(imagedev->image_type_name()));
 
 			// does this device have a tag?
 			if (imagedev->device().tag())
-				fprintf(m_output, " tag=\"%s\"", xml_normalize_string(newtag));
+				m_output.catprintf(" tag=\"%s\"", xml_normalize_string(newtag));
 
 			// is this device mandatory?
 			if (imagedev->must_be_loaded())
-				fprintf(m_output, " mandatory=\"1\"");
+				m_output.catprintf(" mandatory=\"1\"");
 
 			if (imagedev->image_interface() && imagedev->image_interface()[0])
-				fprintf(m_output, " interface=\"%s\"", xml_normalize_string(imagedev->image_interface()));
+				m_output.catprintf(" interface=\"%s\"", xml_normalize_string(imagedev->image_interface()));
 
 			// close the XML tag
-			fprintf(m_output, ">\n");
+			m_output.catprintf(">\n");
 
 			const char *name = imagedev->instance_name();
 			const char *shortname = imagedev->brief_instance_name();
 
-			fprintf(m_output, "\t\t\t<instance");
-			fprintf(m_output, " name=\"%s\"", xml_normalize_string(name));
-			fprintf(m_output, " briefname=\"%s\"", xml_normalize_string(shortname));
-			fprintf(m_output, "/>\n");
+			m_output.catprintf("\t\t\t<instance");
+			m_output.catprintf(" name=\"%s\"", xml_normalize_string(name));
+			m_output.catprintf(" briefname=\"%s\"", xml_normalize_string(shortname));
+			m_output.catprintf("/>\n");
 
 			astring extensions(imagedev->file_extensions());
 
 			char *ext = strtok((char *)extensions.cstr(), ",");
 			while (ext != NULL)
 			{
-				fprintf(m_output, "\t\t\t<extension");
-				fprintf(m_output, " name=\"%s\"", xml_normalize_string(ext));
-				fprintf(m_output, "/>\n");
+				m_output.catprintf("\t\t\t<extension");
+				m_output.catprintf(" name=\"%s\"", xml_normalize_string(ext));
+				m_output.catprintf("/>\n");
 				ext = strtok(NULL, ",");
 			}
 
-			fprintf(m_output, "\t\t</device>\n");
+			m_output.catprintf("\t\t</device>\n");
 		}
 	}
 }
@@ -1268,11 +1340,11 @@ void info_xml_creator::output_slots(device_t &device, const char *root_tag)
 			newtag.substr(newtag.find(oldtag.cat(root_tag)) + oldtag.len());
 
 			// print m_output device type
-			fprintf(m_output, "\t\t<slot name=\"%s\">\n", xml_normalize_string(newtag));
+			m_output.catprintf("\t\t<slot name=\"%s\">\n", xml_normalize_string(newtag));
 
 			/*
              if (slot->slot_interface()[0])
-             fprintf(m_output, " interface=\"%s\"", xml_normalize_string(slot->slot_interface()));
+             m_output.catprintf(" interface=\"%s\"", xml_normalize_string(slot->slot_interface()));
              */
 
 			const slot_interface* intf = slot->get_slot_interfaces();
@@ -1282,19 +1354,19 @@ void info_xml_creator::output_slots(device_t &device, const char *root_tag)
 				if (!dev->configured())
 					dev->config_complete();
 
-				fprintf(m_output, "\t\t\t<slotoption");
-				fprintf(m_output, " name=\"%s\"", xml_normalize_string(intf[i].name));
-				fprintf(m_output, " devname=\"%s\"", xml_normalize_string(dev->shortname()));
+				m_output.catprintf("\t\t\t<slotoption");
+				m_output.catprintf(" name=\"%s\"", xml_normalize_string(intf[i].name));
+				m_output.catprintf(" devname=\"%s\"", xml_normalize_string(dev->shortname()));
 				if (slot->get_default_card())
 				{
 					if (strcmp(slot->get_default_card(),intf[i].name)==0)
-						fprintf(m_output, " default=\"yes\"");
+						m_output.catprintf(" default=\"yes\"");
 				}
-				fprintf(m_output, "/>\n");
+				m_output.catprintf("/>\n");
 				const_cast<machine_config &>(m_drivlist.config()).device_remove(&m_drivlist.config().root_device(), "dummy");
 			}
 
-			fprintf(m_output, "\t\t</slot>\n");
+			m_output.catprintf("\t\t</slot>\n");
 		}
 	}
 }
@@ -1310,12 +1382,12 @@ void info_xml_creator::output_software_list()
 	software_list_device_iterator iter(m_drivlist.config().root_device());
 	for (const software_list_device *swlist = iter.first(); swlist != NULL; swlist = iter.next())
 	{
-		fprintf(m_output, "\t\t<softwarelist name=\"%s\" ", swlist->list_name());
-		fprintf(m_output, "status=\"%s\" ", (swlist->list_type() == SOFTWARE_LIST_ORIGINAL_SYSTEM) ? "original" : "compatible");
+		m_output.catprintf("\t\t<softwarelist name=\"%s\" ", swlist->list_name());
+		m_output.catprintf("status=\"%s\" ", (swlist->list_type() == SOFTWARE_LIST_ORIGINAL_SYSTEM) ? "original" : "compatible");
 		if (swlist->filter()) {
-			fprintf(m_output, "filter=\"%s\" ", swlist->filter());
+			m_output.catprintf("filter=\"%s\" ", swlist->filter());
 		}
-		fprintf(m_output, "/>\n");
+		m_output.catprintf("/>\n");
 	}
 }
 
@@ -1331,7 +1403,7 @@ void info_xml_creator::output_ramoptions()
 	ram_device_iterator iter(m_drivlist.config().root_device());
 	for (const ram_device *ram = iter.first(); ram != NULL; ram = iter.next())
 	{
-		fprintf(m_output, "\t\t<ramoption default=\"1\">%u</ramoption>\n", ram->default_size());
+		m_output.catprintf("\t\t<ramoption default=\"1\">%u</ramoption>\n", ram->default_size());
 
 		if (ram->extra_options() != NULL)
 		{
@@ -1340,7 +1412,7 @@ void info_xml_creator::output_ramoptions()
 			{
 				astring option;
 				option.cpysubstr(options, start, (end == -1) ? -1 : end - start);
-				fprintf(m_output, "\t\t<ramoption>%u</ramoption>\n", ram_device::parse_string(option));
+				m_output.catprintf("\t\t<ramoption>%u</ramoption>\n", ram_device::parse_string(option));
 				if (end == -1)
 					break;
 			}
@@ -45,6 +45,13 @@
 #include "drivenum.h"
 
 
+//**************************************************************************
+//  TYPE DEFINITIONS
+//**************************************************************************
+
+class info_cache;
+
+
 //**************************************************************************
 //  FUNCTION PROTOTYPES
 //**************************************************************************
@@ -80,14 +87,18 @@ private:
 	void output_ramoptions();
 
 	void output_one_device(device_t &device, const char *devtag);
-	void output_devices();
+	void output_devices(info_cache &cache, astring &devlist);
+	void add_device(info_cache &cache, astring &devlist, const char *shortname);
+	void gather_devices(info_cache &cache, const astring &devlist);
 
 	const char *get_merge_name(const hash_collection &romhashes);
 
 	// internal state
-	FILE *					m_output;
+	astring					m_output;
 	driver_enumerator &		m_drivlist;
 	emu_options 			m_lookup_options;
+	astring					m_devices;
+	tagmap_t<FPTR>			m_shortnames;
 
 	static const char s_dtd_string[];
 };
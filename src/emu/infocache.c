@@ -0,0 +1,324 @@
+/***************************************************************************
+
+    infocache.c
+
+    Persistent cache of per-driver information for the -list* commands.
+
+****************************************************************************
+
+    Copyright Aaron Giles
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are
+    met:
+
+        * Redistributions of source code must retain the above copyright
+          notice, this list of conditions and the following disclaimer.
+        * Redistributions in binary form must reproduce the above copyright
+          notice, this list of conditions and the following disclaimer in
+          the documentation and/or other materials provided with the
+          distribution.
+        * Neither the name 'MAME' nor the names of its contributors may be
+          used to endorse or promote products derived from this software
+          without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY AARON GILES ''AS IS'' AND ANY EXPRESS OR
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL AARON GILES BE LIABLE FOR ANY DIRECT,
+    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+    HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+    STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+    IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+    POSSIBILITY OF SUCH DAMAGE.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "emuopts.h"
+#include "infocache.h"
+
+
+
+//**************************************************************************
+//  CONSTANTS
+//**************************************************************************
+
+// bump this whenever the file layout changes
+const UINT32 INFO_CACHE_VERSION = 1;
+
+static const UINT8 INFO_CACHE_MAGIC[8] = { 'M','A','M','E','I','N','F','C' };
+
+
+
+//**************************************************************************
+//  TYPE DEFINITIONS
+//**************************************************************************
+
+// header at the start of each cache file; it is followed by a sequence of
+// entries, each a key length, data length, key and data
+struct info_cache_header
+{
+	UINT8				magic[8];			/* 'MAMEINFC' */
+	UINT32				version;			/* INFO_CACHE_VERSION */
+	UINT32				drivers;			/* number of drivers in the build */
+	char				build[112];			/* version and build ID of the writer */
+};
+
+struct info_cache_entry_header
+{
+	UINT32				keylength;			/* length of the key */
+	UINT32				length;				/* length of the data */
+};
+
+
+
+//**************************************************************************
+//  INLINE FUNCTIONS
+//**************************************************************************
+
+//-------------------------------------------------
+//  build_header - build the header we expect to
+//  find in a cache written by this build
+//-------------------------------------------------
+
+inline void build_header(info_cache_header &header)
+{
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, INFO_CACHE_MAGIC, sizeof(header.magic));
+	header.version = LITTLE_ENDIANIZE_INT32(INFO_CACHE_VERSION);
+	header.drivers = LITTLE_ENDIANIZE_INT32(driver_list::total());
+	astring build(build_version, " ", build_id);
+	strncpy(header.build, build, sizeof(header.build) - 1);
+}
+
+
+
+//**************************************************************************
+//  INFO CACHE
+//**************************************************************************
+
+//-------------------------------------------------
+//  info_cache - constructor; reads the index of
+//  the cache for the given kind of information,
+//  unless it was written by a different build
+//-------------------------------------------------
+
+info_cache::info_cache(driver_enumerator &drivlist, const char *kind)
+	: m_drivlist(drivlist),
+	  m_name(emulator_info::get_configname(), "_", kind, ".dat"),
+	  m_enabled(drivlist.options().infocache_directory()[0] != 0),
+	  m_file(drivlist.options().infocache_directory(), OPEN_FLAG_READ),
+	  m_end(0),
+	  m_addedlength(0)
+{
+	// an empty directory disables the cache; a file we can't use is simply replaced on the way out
+	if (m_enabled && m_file.open(m_name) == FILERR_NONE && !load())
+	{
+		m_file.close();
+		m_entries.reset();
+		m_index.reset();
+		m_end = 0;
+	}
+}
+
+
+//-------------------------------------------------
+//  ~info_cache - destructor; writes out anything
+//  added during this run
+//-------------------------------------------------
+
+info_cache::~info_cache()
+{
+	if (m_enabled && m_addedlength != 0)
+		save();
+}
+
+
+//-------------------------------------------------
+//  cacheable - return true if the current driver
+//  can use the cache; the selected system is
+//  always built directly, since its slot options
+//  apply to it
+//-------------------------------------------------
+
+bool info_cache::cacheable() const
+{
+	return enabled() && strcmp(m_drivlist.driver().name, m_drivlist.options().system_name()) != 0;
+}
+
+
+//-------------------------------------------------
+//  prefetch - mark all the included drivers that
+//  aren't in the cache so their configs can be
+//  built in parallel
+//-------------------------------------------------
+
+void info_cache::prefetch()
+{
+	int current = m_drivlist.current();
+	for (m_drivlist.reset(); m_drivlist.next(); )
+		if (!cacheable() || m_index.find(m_drivlist.driver().name) == 0)
+			m_drivlist.prefetch_config(m_drivlist.current());
+	m_drivlist.set_current(current);
+}
+
+
+//-------------------------------------------------
+//  find - look up an entry, returning true and
+//  filling in the data if present
+//-------------------------------------------------
+
+bool info_cache::find(const char *key, astring &data)
+{
+	FPTR entrynum = m_index.find(key);
+	if (entrynum == 0)
+		return false;
+
+	// entries from this run are still in memory
+	const entry &ent = m_entries[entrynum - 1];
+	if (ent.added)
+	{
+		data.cpy(reinterpret_cast<const char *>(&m_added[ent.offset]), ent.length);
+		return true;
+	}
+
+	// others come from the file
+	char *buffer = global_alloc_array(char, ent.length + 1);
+	m_file.seek(ent.offset, SEEK_SET);
+	bool success = (m_file.read(buffer, ent.length) == ent.length);
+	buffer[ent.length] = 0;
+	if (success)
+		data.cpy(buffer, ent.length);
+	global_free(buffer);
+	return success;
+}
+
+
+//-------------------------------------------------
+//  add - add an entry to the cache; it is written
+//  out when the cache is destroyed
+//-------------------------------------------------
+
+void info_cache::add(const char *key, const char *data)
+{
+	// nothing to do if disabled or already present
+	if (!enabled() || m_index.find(key) != 0)
+		return;
+
+	// grow the buffer geometrically, since there may be thousands of entries
+	info_cache_entry_header header;
+	UINT32 keylength = strlen(key);
+	UINT32 length = strlen(data);
+	UINT32 needed = m_addedlength + sizeof(header) + keylength + length;
+	if (needed > m_added.count())
+		m_added.resize(MAX(needed, m_added.count() * 2), true);
+
+	// append the entry in file format
+	header.keylength = LITTLE_ENDIANIZE_INT32(keylength);
+	header.length = LITTLE_ENDIANIZE_INT32(length);
+	memcpy(&m_added[m_addedlength], &header, sizeof(header));
+	memcpy(&m_added[m_addedlength + sizeof(header)], key, keylength);
+	memcpy(&m_added[m_addedlength + sizeof(header) + keylength], data, length);
+
+	// add it to the index
+	entry ent;
+	ent.offset = m_addedlength + sizeof(header) + keylength;
+	ent.length = length;
+	ent.added = true;
+	m_entries.append(ent);
+	m_index.add(key, m_entries.count());
+	m_addedlength = needed;
+}
+
+
+//-------------------------------------------------
+//  load - validate the header of an existing file
+//  and read its index
+//-------------------------------------------------
+
+bool info_cache::load()
+{
+	// the header must match our build exactly
+	info_cache_header header, expected;
+	build_header(expected);
+	if (m_file.read(&header, sizeof(header)) != sizeof(header) || memcmp(&header, &expected, sizeof(header)) != 0)
+		return false;
+
+	// walk the entries, indexing each
+	UINT64 size = m_file.size();
+	m_end = sizeof(header);
+	astring key;
+	while (m_end < size)
+	{
+		// a truncated entry means the file is damaged; start it over
+		info_cache_entry_header entheader;
+		if (m_file.read(&entheader, sizeof(entheader)) != sizeof(entheader))
+			return false;
+		UINT32 keylength = LITTLE_ENDIANIZE_INT32(entheader.keylength);
+		entry ent;
+		ent.offset = m_end + sizeof(entheader) + keylength;
+		ent.length = LITTLE_ENDIANIZE_INT32(entheader.length);
+		ent.added = false;
+		if (ent.offset + ent.length > size)
+			return false;
+
+		// read the key and skip the data
+		char *buffer = key.stringbuffer(keylength + 1);
+		if (m_file.read(buffer, keylength) != keylength)
+			return false;
+		buffer[keylength] = 0;
+		m_entries.append(ent);
+		m_index.add(buffer, m_entries.count());
+		m_end = ent.offset + ent.length;
+		m_file.seek(m_end, SEEK_SET);
+	}
+	return true;
+}
+
+
+//-------------------------------------------------
+//  save - write the existing and added entries
+//  to a new file, then rename it over the old
+//  one, so that other processes using the cache
+//  only ever see a complete file
+//-------------------------------------------------
+
+void info_cache::save()
+{
+	// write to a name no other process will pick
+	astring tempname;
+	tempname.printf("%s.%08X", m_name.cstr(), (UINT32)osd_ticks());
+	emu_file temp(m_drivlist.options().infocache_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	if (temp.open(tempname) != FILERR_NONE)
+		return;
+
+	// header, then the valid part of the old file, then our additions
+	info_cache_header header;
+	build_header(header);
+	bool success = (temp.write(&header, sizeof(header)) == sizeof(header));
+	if (m_file.is_open())
+	{
+		UINT8 buffer[65536];
+		m_file.seek(sizeof(header), SEEK_SET);
+		for (UINT64 remaining = m_end - sizeof(header); success && remaining > 0; )
+		{
+			UINT32 chunk = MIN(remaining, sizeof(buffer));
+			success = (m_file.read(buffer, chunk) == chunk && temp.write(buffer, chunk) == chunk);
+			remaining -= chunk;
+		}
+		m_file.close();
+	}
+	if (success)
+		success = (temp.write(&m_added[0], m_addedlength) == m_addedlength);
+
+	// replace the old file only if the new one is complete
+	astring temppath(temp.fullpath());
+	temp.close();
+	astring finalpath(temppath, 0, temppath.len() - (tempname.len() - m_name.len()));
+	if (!success || osd_rename(temppath, finalpath) != FILERR_NONE)
+		osd_rmfile(temppath);
+}
@@ -0,0 +1,103 @@
+/***************************************************************************
+
+    infocache.h
+
+    Persistent cache of per-driver information for the -list* commands.
+
+****************************************************************************
+
+    Copyright Aaron Giles
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are
+    met:
+
+        * Redistributions of source code must retain the above copyright
+          notice, this list of conditions and the following disclaimer.
+        * Redistributions in binary form must reproduce the above copyright
+          notice, this list of conditions and the following disclaimer in
+          the documentation and/or other materials provided with the
+          distribution.
+        * Neither the name 'MAME' nor the names of its contributors may be
+          used to endorse or promote products derived from this software
+          without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY AARON GILES ''AS IS'' AND ANY EXPRESS OR
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL AARON GILES BE LIABLE FOR ANY DIRECT,
+    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+    HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+    STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+    IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+    POSSIBILITY OF SUCH DAMAGE.
+
+***************************************************************************/
+
+#pragma once
+
+#ifndef __INFOCACHE_H__
+#define __INFOCACHE_H__
+
+#include "drivenum.h"
+
+
+//**************************************************************************
+//  TYPE DEFINITIONS
+//**************************************************************************
+
+// ======================> info_cache
+
+// a file of text blobs by key, valid only for the build that wrote it
+class info_cache
+{
+	DISABLE_COPYING(info_cache);
+
+public:
+	// construction/destruction
+	info_cache(driver_enumerator &drivlist, const char *kind);
+	~info_cache();
+
+	// getters
+	bool enabled() const { return m_enabled; }
+	bool cacheable() const;
+
+	// entries for the current driver
+	bool find_driver(astring &data) { return cacheable() && find(m_drivlist.driver().name, data); }
+	void add_driver(const char *data) { if (cacheable()) add(m_drivlist.driver().name, data); }
+	void prefetch();
+
+	// entries by arbitrary key
+	bool find(const char *key, astring &data);
+	void add(const char *key, const char *data);
+
+private:
+	// internal helpers
+	bool load();
+	void save();
+
+	// an entry in the index
+	struct entry
+	{
+		UINT64				offset;					// offset of the data in the file, or in m_added
+		UINT32				length;					// length of the data
+		bool				added;					// true if added by this run
+	};
+
+	// internal state
+	driver_enumerator &		m_drivlist;				// drivers we are caching for
+	astring					m_name;					// base name of the cache file
+	bool					m_enabled;				// is the cache in use?
+	emu_file				m_file;					// existing cache file, opened for reading
+	UINT64					m_end;					// end of the last valid entry in m_file
+	dynamic_buffer			m_added;				// entries added by this run, in file format
+	UINT32					m_addedlength;			// bytes used in m_added
+	dynamic_array<entry>	m_entries;				// index of entries
+	tagmap_t<FPTR, 6151>	m_index;				// key to entry number + 1
+};
+
+
+#endif	/* __INFOCACHE_H__ */
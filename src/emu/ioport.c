@@ -2616,7 +2616,10 @@ ioport_manager::ioport_manager(running_machine &machine)
 	  m_record_file(machine.options().input_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS),
 	  m_playback_file(machine.options().input_directory(), OPEN_FLAG_READ),
 	  m_playback_accumulated_speed(0),
-	  m_playback_accumulated_frames(0)
+	  m_playback_accumulated_frames(0),
+	  m_playback_hash_frames(0),
+	  m_record_frames(0),
+	  m_record_hash_frames(0)
 {
 	memset(m_type_to_entry, 0, sizeof(m_type_to_entry));
 }
@@ -3513,6 +3516,8 @@ time_t ioport_manager::playback_init()
 		fatalerror("Input file invalid or in an older, unsupported format");
 	if (header[0x10] != INP_HEADER_MAJVERSION)
 		fatalerror("Input file format version mismatch");
+	if (header[0x11] > INP_HEADER_MINVERSION)
+		fatalerror("Input file is version %d.%d, newer than the supported %d.%d", header[0x10], header[0x11], INP_HEADER_MAJVERSION, INP_HEADER_MINVERSION);
 
 	// output info to console
 	mame_printf_info("Input file: %s\n", filename);
@@ -3522,6 +3527,25 @@ time_t ioport_manager::playback_init()
 	mame_printf_info("Created %s", ctime(&basetime));
 	mame_printf_info("Recorded using %s\n", header + 0x20);
 
+	// 3.1 and later files may carry periodic hashes of the save state,
+	// and the header is followed by the filter they were made with
+	m_playback_hash_frames = header[0x12] | (header[0x13] << 8);
+	m_playback_hash_filter.reset();
+	if (header[0x11] >= 1)
+	{
+		char filter[INP_HASH_FILTER_MAX];
+		UINT8 length;
+		if (m_playback_file.read(&length, 1) != 1 || m_playback_file.read(filter, length) != length)
+			fatalerror("Input file is corrupt or invalid (missing hash filter)");
+		m_playback_hash_filter.cpy(filter, length);
+	}
+	if (m_playback_hash_frames != 0)
+	{
+		mame_printf_info("State hashed every %d frames\n", m_playback_hash_frames);
+		if (m_playback_hash_filter.len() != 0)
+			mame_printf_info("State hash limited to entries containing '%s'\n", m_playback_hash_filter.cstr());
+	}
+
 	// verify the header against the current game
 	if (memcmp(machine().system().name, header + 0x14, strlen(machine().system().name) + 1) != 0)
 		mame_printf_info("Input file is for %s '%s', not for current %s '%s'\n", emulator_info::get_gamenoun(), header + 0x14, emulator_info::get_gamenoun(), machine().system().name);
@@ -3576,6 +3600,21 @@ void ioport_manager::playback_frame(attotime curtime)
 		// then the speed
 		UINT32 curspeed;
 		m_playback_accumulated_speed += playback_read(curspeed);
+
+		// then the state hash, if this frame has one; stop at the first
+		// frame that no longer matches the recording
+		if (m_playback_hash_frames != 0 && m_playback_accumulated_frames % m_playback_hash_frames == 0)
+		{
+			UINT32 readhash;
+			playback_read(readhash);
+			UINT32 curhash = machine().save().state_hash(m_playback_hash_filter.cstr());
+			if (m_playback_file.is_open() && readhash != curhash)
+			{
+				mame_printf_error("Playback diverged at frame %d (time %s): state hash %08X, expected %08X\n",
+						m_playback_accumulated_frames, curtime.as_string(), curhash, readhash);
+				playback_end("State diverged");
+			}
+		}
 		m_playback_accumulated_frames++;
 	}
 }
@@ -3668,8 +3707,21 @@ void ioport_manager::record_init()
 	strcpy((char *)header + 0x14, machine().system().name);
 	sprintf((char *)header + 0x20, "%s %s", emulator_info::get_appname(), build_version);
 
+	// note how often we store a hash of the save state
+	m_record_hash_frames = machine().options().record_hash();
+	header[0x12] = m_record_hash_frames >> 0;
+	header[0x13] = m_record_hash_frames >> 8;
+
+	// the filter the hashes are made with goes right after the header
+	const char *filter = machine().options().hash_filter();
+	if (strlen(filter) > INP_HASH_FILTER_MAX)
+		fatalerror("Hash filter is longer than %d characters", INP_HASH_FILTER_MAX);
+	UINT8 length = strlen(filter);
+
 	// write it
 	m_record_file.write(header, sizeof(header));
+	m_record_file.write(&length, 1);
+	m_record_file.write(filter, length);
 
 	// enable compression
 	m_record_file.compress(FCOMPRESS_MEDIUM);
@@ -3711,6 +3763,12 @@ void ioport_manager::record_frame(attotime curtime)
 
 		// then the current speed
 		record_write(UINT32(machine().video().speed_percent() * double(1 << 20)));
+
+		// then periodically a hash of the state, so playback can find the
+		// first frame where it no longer matches
+		if (m_record_hash_frames != 0 && m_record_frames % m_record_hash_frames == 0)
+			record_write(machine().save().state_hash(machine().options().hash_filter()));
+		m_record_frames++;
 	}
 }
 
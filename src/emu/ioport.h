@@ -66,7 +66,8 @@ const int MAX_PLAYERS = 8;
 // INP file parameters
 const UINT32 INP_HEADER_SIZE = 64;
 const UINT32 INP_HEADER_MAJVERSION = 3;
-const UINT32 INP_HEADER_MINVERSION = 0;
+const UINT32 INP_HEADER_MINVERSION = 1;
+const UINT32 INP_HASH_FILTER_MAX = 255;
 
 // unicode constants
 const unicode_char UCHAR_PRIVATE = 0x100000;
@@ -711,11 +712,14 @@ struct inp_header
 	UINT64						basetime;		// +08: base time of recording
 	UINT8						majversion;		// +10: major INP version
 	UINT8						minversion;		// +11: minor INP version
-	UINT8						reserved[2];	// +12: must be zero
+	UINT8						hashframes[2];	// +12: frames between state hashes, little-endian (0 = none; always 0 before 3.1)
 	char						gamename[12];	// +14: game name string, NULL-terminated
 	char						version[32];	// +20: system version string, NULL-terminated
 };
 
+// from 3.1 on the header is followed by the state hash filter: a length
+// byte and that many characters, with no terminator (length 0 = no filter)
+
 
 // ======================> input_device_default
 
@@ -1322,6 +1326,10 @@ private:
 	emu_file				m_playback_file;		// playback file (NULL if not recording)
 	UINT64					m_playback_accumulated_speed; // accumulated speed during playback
 	UINT32					m_playback_accumulated_frames; // accumulated frames during playback
+	UINT32					m_playback_hash_frames;	// frames between state hashes in the playback file (0 = none)
+	astring					m_playback_hash_filter;	// state hash filter stored in the playback file
+	UINT32					m_record_frames;		// frames recorded so far
+	UINT32					m_record_hash_frames;	// frames between state hashes in the record file (0 = none)
 };
 
 
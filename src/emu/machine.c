@@ -109,12 +109,22 @@
 #include "crsshair.h"
 #include "validity.h"
 #include "unzip.h"
+#include "imagedev/harddriv.h"
 #include "debug/debugcon.h"
 
 #include <time.h>
 
 
 
+//**************************************************************************
+//  CONSTANTS
+//**************************************************************************
+
+// writable media other than CHDs are not hashed for fast boot if larger than this
+const UINT64 FASTBOOT_MAX_MEDIA_BYTES = 64 * 1024 * 1024;
+
+
+
 //**************************************************************************
 //  GLOBAL VARIABLES
 //**************************************************************************
@@ -156,6 +166,7 @@ running_machine::running_machine(const machine_config &_config, osd_interface &o
 	  m_video(NULL),
 	  m_tilemap(NULL),
 	  m_debug_view(NULL),
+	  m_guestprof(NULL),
 	  m_current_phase(MACHINE_PHASE_PREINIT),
 	  m_paused(false),
 	  m_hard_reset_pending(false),
@@ -163,6 +174,7 @@ running_machine::running_machine(const machine_config &_config, osd_interface &o
 	  m_exit_to_game_select(exit_to_game_select),
 	  m_new_driver_pending(NULL),
 	  m_soft_reset_timer(NULL),
+	  m_guestprof_timer(NULL),
 	  m_rand_seed(0x9d14abd7),
       m_ui_active(false),
 	  m_basename(_config.gamedrv().name),
@@ -171,6 +183,7 @@ running_machine::running_machine(const machine_config &_config, osd_interface &o
 	  m_saveload_schedule(SLS_NONE),
 	  m_saveload_schedule_time(attotime::zero),
 	  m_saveload_searchpath(NULL),
+	  m_fastboot_timer(NULL),
 	  m_logerror_list(m_respool),
 
 	  m_save(*this),
@@ -306,6 +319,15 @@ void running_machine::start()
 	save().register_postload(save_prepost_delegate(FUNC(running_machine::postload_all_devices), this));
 	start_all_devices();
 
+	// now that ROMs are decrypted and devices started, decode graphics up front if requested
+	gfx_precache(*this);
+
+	// start profiling the guest CPUs if requested; the sampling timer is part of
+	// the saved state, so allocate it whether we need it or not
+	m_guestprof_timer = m_scheduler.timer_alloc(timer_expired_delegate(FUNC(running_machine::guestprof_sample), this));
+	if (options().guest_profile() > 0)
+		m_guestprof = auto_alloc(*this, guest_profiler(*this, *m_guestprof_timer));
+
 	// if we're coming in with a savegame request, process it now
 	const char *savegame = options().state();
 	if (savegame[0] != 0)
@@ -315,6 +337,10 @@ void running_machine::start()
 	else if (options().autosave() && (m_system.flags & GAME_SUPPORTS_SAVE) != 0)
 		schedule_load("auto");
 
+	// otherwise, skip past the boot sequence if we can
+	else if (options().fastboot())
+		fastboot_init();
+
 	// set up the cheat engine
 	m_cheat = auto_alloc(*this, cheat_manager(*this));
 
@@ -570,6 +596,48 @@ void running_machine::schedule_load(const char *filename)
 }
 
 
+//-------------------------------------------------
+//  schedule_fastboot_save - schedule the fast
+//  boot snapshot to be taken as soon as possible;
+//  returns false if fast boot is not active
+//-------------------------------------------------
+
+bool running_machine::schedule_fastboot_save()
+{
+	if (!m_fastboot_file)
+		return false;
+
+	// if writable media changed since startup, the snapshot would not match its contents hash
+	astring contents;
+	if (!fastboot_contents(contents) || contents != m_fastboot_contents)
+	{
+		mame_printf_warning("Fast boot snapshot not taken: writable media changed since startup\n");
+		return false;
+	}
+
+	// record what the snapshot is taken against; any earlier snapshot was removed at startup
+	emu_file hashfile(options().fastboot_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	if (hashfile.open(m_fastboot_file, ".fbh") != FILERR_NONE || hashfile.puts(m_fastboot_contents) != m_fastboot_contents.len())
+	{
+		mame_printf_warning("Fast boot snapshot not taken: unable to write %s.fbh\n", m_fastboot_file.cstr());
+		hashfile.remove_on_close();
+		return false;
+	}
+
+	// snapshots live in their own directory, so bypass set_saveload_filename
+	m_saveload_searchpath = options().fastboot_directory();
+	m_saveload_pending_file.cpy(m_fastboot_file).cat(".fbs");
+
+	// note the start time and set a timer for the next timeslice to actually schedule it
+	m_saveload_schedule = SLS_SAVE;
+	m_saveload_schedule_time = this->time();
+
+	// we can't be paused since we need to clear out anonymous timers
+	resume();
+	return true;
+}
+
+
 //-------------------------------------------------
 //  pause - pause the system
 //-------------------------------------------------
@@ -911,6 +979,194 @@ void running_machine::watchdog_vblank(screen_device &screen, bool vblank_state)
 }
 
 
+//-------------------------------------------------
+//  fastboot_init - restore a snapshot of an
+//  earlier boot with the same driver, ROMs and
+//  media, or arrange to take one
+//-------------------------------------------------
+
+void running_machine::fastboot_init()
+{
+	// input recordings must start from power-on
+	if (options().playback()[0] != 0 || options().record()[0] != 0)
+		return;
+
+	// the timer is part of the saved state, so allocate it whether we need it or not
+	m_fastboot_timer = m_scheduler.timer_alloc(timer_expired_delegate(FUNC(running_machine::fastboot_capture), this));
+
+	// key on everything loaded from outside; give up if that can't be done cheaply
+	if (!fastboot_contents(m_fastboot_contents))
+		return;
+	fastboot_key(m_fastboot_file);
+
+	// the snapshot is only good if NVRAM and writable media still hold what they did when it was taken
+	astring contents;
+	emu_file hashfile(options().fastboot_directory(), OPEN_FLAG_READ);
+	if (hashfile.open(m_fastboot_file, ".fbh") == FILERR_NONE)
+	{
+		char buffer[64];
+		if (hashfile.gets(buffer, ARRAY_LENGTH(buffer)) != NULL)
+			contents.cpy(buffer);
+		hashfile.close();
+	}
+
+	// if we have a snapshot, load it right away just like -state
+	emu_file file(options().fastboot_directory(), OPEN_FLAG_READ);
+	if (file.open(m_fastboot_file, ".fbs") == FILERR_NONE)
+	{
+		if (contents == m_fastboot_contents)
+		{
+			m_saveload_searchpath = options().fastboot_directory();
+			m_saveload_pending_file.cpy(m_fastboot_file).cat(".fbs");
+			m_saveload_schedule = SLS_LOAD;
+			m_saveload_schedule_time = this->time();
+			return;
+		}
+
+		// otherwise it is stale; drop it so that the next snapshot replaces it
+		mame_printf_verbose("Fast boot snapshot %s.fbs is out of date\n", m_fastboot_file.cstr());
+		file.remove_on_close();
+	}
+
+	// take a new one once the boot has had time to finish
+	float seconds = options().fastboot_time();
+	if (seconds > 0)
+		m_fastboot_timer->adjust(attotime::from_double(seconds));
+}
+
+
+//-------------------------------------------------
+//  fastboot_key - build the name of the fast
+//  boot snapshot, less its extension, from the
+//  save state layout plus the identity of
+//  everything that is loaded from outside
+//-------------------------------------------------
+
+void running_machine::fastboot_key(astring &name)
+{
+	sha1_creator key;
+	key.append(m_system.name, strlen(m_system.name));
+	UINT32 signature = m_save.signature();
+	key.append(&signature, sizeof(signature));
+
+	// expected ROM hashes for every device
+	device_iterator deviter(root_device());
+	for (device_t *device = deviter.first(); device != NULL; device = deviter.next())
+		for (const rom_entry *region = rom_first_region(*device); region != NULL; region = rom_next_region(region))
+			for (const rom_entry *rom = rom_first_file(region); rom != NULL; rom = rom_next_file(rom))
+			{
+				key.append(ROM_GETNAME(rom), strlen(ROM_GETNAME(rom)) + 1);
+				key.append(ROM_GETHASHDATA(rom), strlen(ROM_GETHASHDATA(rom)) + 1);
+			}
+
+	// mounted media, by name, size and whatever hashes are known
+	image_interface_iterator imgiter(root_device());
+	for (device_image_interface *image = imgiter.first(); image != NULL; image = imgiter.next())
+	{
+		key.append(image->device().tag(), strlen(image->device().tag()) + 1);
+		if (!image->exists())
+			continue;
+		key.append(image->filename(), strlen(image->filename()) + 1);
+		if (image->image_core_file() != NULL)
+		{
+			UINT64 length = image->length();
+			key.append(&length, sizeof(length));
+		}
+		astring hashes;
+		image->hash().internal_string(hashes);
+		key.append(hashes.cstr(), hashes.len());
+
+		// hard disks are too large to hash, so use the SHA1s in the CHD header instead
+		harddisk_image_device *harddisk = dynamic_cast<harddisk_image_device *>(image);
+		chd_file *chd = (harddisk != NULL) ? harddisk->get_chd_file() : NULL;
+		if (chd != NULL)
+		{
+			sha1_t sha1 = chd->sha1();
+			key.append(sha1.m_raw, sizeof(sha1.m_raw));
+			sha1 = chd->parent_sha1();
+			key.append(sha1.m_raw, sizeof(sha1.m_raw));
+		}
+	}
+
+	astring keystring;
+	name.cpy(basename()).cat(PATH_SEPARATOR).cat(key.finish().as_string(keystring));
+}
+
+
+//-------------------------------------------------
+//  fastboot_contents - hash the NVRAM files and
+//  the contents of writable media, which change
+//  from run to run and so are checked against
+//  the snapshot rather than being part of its
+//  name; returns false if writable media are too
+//  large to include
+//-------------------------------------------------
+
+bool running_machine::fastboot_contents(astring &contents)
+{
+	sha1_creator hash;
+
+	// the emulated system may have changed writable media since the snapshot, so include their contents
+	image_interface_iterator imgiter(root_device());
+	for (device_image_interface *image = imgiter.first(); image != NULL; image = imgiter.next())
+	{
+		if (!image->exists() || !image->is_writeable() || image->is_readonly())
+			continue;
+
+		// CHD hard disks are covered by the key
+		harddisk_image_device *harddisk = dynamic_cast<harddisk_image_device *>(image);
+		if (harddisk != NULL && harddisk->get_chd_file() != NULL)
+			continue;
+
+		core_file *file = image->image_core_file();
+		if (file == NULL || image->length() > FASTBOOT_MAX_MEDIA_BYTES)
+		{
+			mame_printf_verbose("Fast boot disabled: writable image '%s' is too large to check\n", image->filename());
+			return false;
+		}
+
+		UINT8 buffer[16384];
+		UINT64 position = core_ftell(file);
+		core_fseek(file, 0, SEEK_SET);
+		for (UINT32 actual; (actual = core_fread(file, buffer, sizeof(buffer))) != 0; )
+			hash.append(buffer, actual);
+		core_fseek(file, position, SEEK_SET);
+	}
+
+	// NVRAM is restored from the snapshot too, so the files it was loaded from must match
+	nvram_hash(*this, hash);
+
+	hash.finish().as_string(contents);
+	return true;
+}
+
+
+//-------------------------------------------------
+//  fastboot_capture - timer callback to take the
+//  fast boot snapshot
+//-------------------------------------------------
+
+void running_machine::fastboot_capture(void *ptr, INT32 param)
+{
+	schedule_fastboot_save();
+}
+
+
+//-------------------------------------------------
+//  guestprof_sample - sample the guest CPUs for
+//  the profiler; a state saved while profiling
+//  can leave the timer running without one
+//-------------------------------------------------
+
+void running_machine::guestprof_sample(void *ptr, INT32 param)
+{
+	if (m_guestprof != NULL)
+		m_guestprof->sample();
+	else
+		m_guestprof_timer->enable(false);
+}
+
+
 //-------------------------------------------------
 //  logfile_callback - callback for logging to
 //  logfile
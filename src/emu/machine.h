@@ -103,6 +103,7 @@ const int DEBUG_FLAG_WPW_PROGRAM	= 0x00000100;		// watchpoints are enabled for P
 const int DEBUG_FLAG_WPW_DATA		= 0x00000200;		// watchpoints are enabled for DATA memory writes
 const int DEBUG_FLAG_WPW_IO			= 0x00000400;		// watchpoints are enabled for IO memory writes
 const int DEBUG_FLAG_OSD_ENABLED	= 0x00001000;		// The OSD debugger is enabled
+const int DEBUG_FLAG_PROFILE_CALLS	= 0x00002000;		// the guest profiler is following calls
 
 
 
@@ -150,6 +151,7 @@ class sound_manager;
 class video_manager;
 class tilemap_manager;
 class debug_view_manager;
+class guest_profiler;
 class osd_interface;
 
 typedef struct _palette_private palette_private;
@@ -229,6 +231,7 @@ public:
 	video_manager &video() const { assert(m_video != NULL); return *m_video; }
 	tilemap_manager &tilemap() const { assert(m_tilemap != NULL); return *m_tilemap; }
 	debug_view_manager &debug_view() const { assert(m_debug_view != NULL); return *m_debug_view; }
+	guest_profiler &guestprof() const { assert(m_guestprof != NULL); return *m_guestprof; }
 	driver_device *driver_data() const { return &downcast<driver_device &>(root_device()); }
 	template<class _DriverClass> _DriverClass *driver_data() const { return &downcast<_DriverClass &>(root_device()); }
 	machine_phase phase() const { return m_current_phase; }
@@ -271,6 +274,7 @@ public:
 	void schedule_new_driver(const game_driver &driver);
 	void schedule_save(const char *filename);
 	void schedule_load(const char *filename);
+	bool schedule_fastboot_save();
 
 	// date & time
 	void base_datetime(system_time &systime);
@@ -319,6 +323,11 @@ private:
 	void soft_reset(void *ptr = NULL, INT32 param = 0);
 	void watchdog_fired(void *ptr = NULL, INT32 param = 0);
 	void watchdog_vblank(screen_device &screen, bool vblank_state);
+	void fastboot_init();
+	void fastboot_key(astring &name);
+	bool fastboot_contents(astring &contents);
+	void fastboot_capture(void *ptr = NULL, INT32 param = 0);
+	void guestprof_sample(void *ptr = NULL, INT32 param = 0);
 
 	// internal callbacks
 	static void logfile_callback(running_machine &machine, const char *buffer);
@@ -343,6 +352,7 @@ private:
 	video_manager *			m_video;				// internal data from video.c
 	tilemap_manager *		m_tilemap;				// internal data from tilemap.c
 	debug_view_manager *	m_debug_view;			// internal data from debugvw.c
+	guest_profiler *		m_guestprof;			// internal data from guestprof.c
 
 	// system state
 	machine_phase			m_current_phase;		// current execution phase
@@ -352,6 +362,7 @@ private:
 	bool					m_exit_to_game_select;	// when we exit, go we go back to the game select?
 	const game_driver *		m_new_driver_pending;	// pointer to the next pending driver
 	emu_timer *				m_soft_reset_timer;		// timer used to schedule a soft reset
+	emu_timer *				m_guestprof_timer;		// timer used to sample for the guest profiler
 
 	// watchdog state
 	bool					m_watchdog_enabled;		// is the watchdog enabled?
@@ -379,6 +390,11 @@ private:
 	astring					m_saveload_pending_file;
 	const char *			m_saveload_searchpath;
 
+	// fast boot snapshots
+	emu_timer *				m_fastboot_timer;		// timer to capture the snapshot
+	astring					m_fastboot_file;		// snapshot filename less extension, or empty if disabled
+	astring					m_fastboot_contents;	// hash of NVRAM and writable media at startup
+
 	// notifier callbacks
 	struct notifier_callback_item
 	{
@@ -336,6 +336,45 @@ void nvram_load(running_machine &machine)
 }
 
 
+/*-------------------------------------------------
+    nvram_hash - add the name and contents of
+    each NVRAM file that nvram_load would read
+    to a hash
+-------------------------------------------------*/
+
+static void nvram_hash_file(sha1_creator &creator, emu_file &file, const char *name)
+{
+	creator.append(name, strlen(name) + 1);
+	if (!file.is_open())
+		return;
+
+	UINT8 buffer[16384];
+	for (UINT32 actual; (actual = file.read(buffer, sizeof(buffer))) != 0; )
+		creator.append(buffer, actual);
+	file.close();
+}
+
+void nvram_hash(running_machine &machine, sha1_creator &creator)
+{
+	if (machine.config().m_nvram_handler != NULL)
+	{
+		astring filename;
+		emu_file file(machine.options().nvram_directory(), OPEN_FLAG_READ);
+		file.open(nvram_filename(filename, machine.root_device()), ".nv");
+		nvram_hash_file(creator, file, filename);
+	}
+
+	nvram_interface_iterator iter(machine.root_device());
+	for (device_nvram_interface *nvram = iter.first(); nvram != NULL; nvram = iter.next())
+	{
+		astring filename;
+		emu_file file(machine.options().nvram_directory(), OPEN_FLAG_READ);
+		file.open(nvram_filename(filename, nvram->device()));
+		nvram_hash_file(creator, file, filename);
+	}
+}
+
+
 /*-------------------------------------------------
     nvram_save - save a system's NVRAM
 -------------------------------------------------*/
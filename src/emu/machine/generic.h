@@ -79,6 +79,9 @@ void nvram_load(running_machine &machine);
 /* save NVRAM to a file */
 void nvram_save(running_machine &machine);
 
+/* add the contents of a system's NVRAM files to a hash */
+void nvram_hash(running_machine &machine, sha1_creator &creator);
+
 
 
 /* ----- memory card management ----- */
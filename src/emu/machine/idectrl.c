@@ -2053,6 +2053,8 @@ ide_hdd_device::ide_hdd_device(const machine_config &mconfig, device_type type,
 
 void ide_hdd_device::device_start()
 {
+	m_handle = NULL;
+	m_disk = NULL;
 }
 
 //-------------------------------------------------
@@ -2061,8 +2063,14 @@ void ide_hdd_device::device_start()
 
 void ide_hdd_device::device_reset()
 {
-	m_handle = get_disk_handle(machine(), owner()->tag());
-	m_disk = hard_disk_open(m_handle);
+	// open the disk once and keep it, along with its write cache
+	if (m_disk == NULL)
+	{
+		m_handle = get_disk_handle(machine(), owner()->tag());
+		m_disk = hard_disk_open(m_handle);
+		if (m_disk != NULL)
+			hard_disk_enable_write_cache(m_disk, HARDDISK_WRITE_CACHE_HUNKS);
+	}
 
 	if (m_disk != NULL)
 	{
@@ -2077,11 +2085,34 @@ void ide_hdd_device::device_reset()
 		}
 		// build the features page
 		UINT32 metalength;
-		if (m_handle->read_metadata (HARD_DISK_IDENT_METADATA_TAG, 0, m_features, IDE_DISK_SECTOR_SIZE, metalength) != CHDERR_NONE)
+		if (hard_disk_read_metadata(m_disk, HARD_DISK_IDENT_METADATA_TAG, 0, m_features, IDE_DISK_SECTOR_SIZE, metalength) != CHDERR_NONE)
 			ide_build_features();
 	}
 }
 
+//-------------------------------------------------
+//  device_stop - write back any cached changes
+//  and close the disk
+//-------------------------------------------------
+
+void ide_hdd_device::device_stop()
+{
+	if (m_disk != NULL)
+		hard_disk_close(m_disk);
+	m_disk = NULL;
+}
+
+//-------------------------------------------------
+//  device_pre_save - write back any cached
+//  changes so the disk matches the saved state
+//-------------------------------------------------
+
+void ide_hdd_device::device_pre_save()
+{
+	if (m_disk != NULL && !hard_disk_flush(m_disk))
+		mame_printf_error("%s: failed to write back cached changes to the hard disk\n", tag());
+}
+
 //-------------------------------------------------
 //  read device key
 //-------------------------------------------------
@@ -2089,7 +2120,7 @@ void ide_hdd_device::device_reset()
 void ide_hdd_device::read_key(UINT8 key[])
 {
 	UINT32 metalength;
-	m_handle->read_metadata(HARD_DISK_KEY_METADATA_TAG, 0, key, 5, metalength);
+	hard_disk_read_metadata(m_disk, HARD_DISK_KEY_METADATA_TAG, 0, key, 5, metalength);
 }
 
 //**************************************************************************
@@ -2114,6 +2145,8 @@ ide_hdd_image_device::ide_hdd_image_device(const machine_config &mconfig, const
 
 void ide_hdd_image_device::device_start()
 {
+	m_handle = NULL;
+	m_disk = NULL;
 }
 
 //-------------------------------------------------
@@ -2122,35 +2155,43 @@ void ide_hdd_image_device::device_start()
 
 void ide_hdd_image_device::device_reset()
 {
-	m_handle = subdevice<harddisk_image_device>("harddisk")->get_chd_file();
+	// the image owns the disk and its write cache; only use it through the
+	// hard disk interface, so the cache keeps writing in the background
+	m_disk = subdevice<harddisk_image_device>("harddisk")->get_hard_disk_file();
 
-	if (m_handle)
+	if (m_disk != NULL)
 	{
-		m_disk = subdevice<harddisk_image_device>("harddisk")->get_hard_disk_file();
+		const hard_disk_info *hdinfo;
 
-		if (m_disk != NULL)
+		hdinfo = hard_disk_get_info(m_disk);
+		if (hdinfo->sectorbytes == IDE_DISK_SECTOR_SIZE)
 		{
-			const hard_disk_info *hdinfo;
-
-			hdinfo = hard_disk_get_info(m_disk);
-			if (hdinfo->sectorbytes == IDE_DISK_SECTOR_SIZE)
-			{
-				m_num_cylinders = hdinfo->cylinders;
-				m_num_sectors = hdinfo->sectors;
-				m_num_heads = hdinfo->heads;
-				if (PRINTF_IDE_COMMANDS) printf("CHS: %d %d %d\n", m_num_cylinders, m_num_heads, m_num_sectors);
-			}
-			// build the features page
-			UINT32 metalength;
-			if (m_handle->read_metadata (HARD_DISK_IDENT_METADATA_TAG, 0, m_features, IDE_DISK_SECTOR_SIZE, metalength) != CHDERR_NONE)
-				ide_build_features();
+			m_num_cylinders = hdinfo->cylinders;
+			m_num_sectors = hdinfo->sectors;
+			m_num_heads = hdinfo->heads;
+			if (PRINTF_IDE_COMMANDS) printf("CHS: %d %d %d\n", m_num_cylinders, m_num_heads, m_num_sectors);
 		}
+		// build the features page
+		UINT32 metalength;
+		if (hard_disk_read_metadata(m_disk, HARD_DISK_IDENT_METADATA_TAG, 0, m_features, IDE_DISK_SECTOR_SIZE, metalength) != CHDERR_NONE)
+			ide_build_features();
 	}
-	else
-		m_disk = NULL;
 
 }
 
+//-------------------------------------------------
+//  device_stop/device_pre_save - nothing to do;
+//  the image flushes and closes its own disk
+//-------------------------------------------------
+
+void ide_hdd_image_device::device_stop()
+{
+}
+
+void ide_hdd_image_device::device_pre_save()
+{
+}
+
 //-------------------------------------------------
 //  machine_config_additions - device-specific
 //  machine configurations
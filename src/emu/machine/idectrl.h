@@ -97,6 +97,8 @@ protected:
     // device-level overrides
     virtual void device_start();
 	virtual void device_reset();
+	virtual void device_stop();
+	virtual void device_pre_save();
 	virtual void device_config_complete() { m_shortname = "hdd"; }
 
 	void ide_build_features();
@@ -119,6 +121,8 @@ protected:
     // device-level overrides
     virtual void device_start();
 	virtual void device_reset();
+	virtual void device_stop();
+	virtual void device_pre_save();
 	virtual void device_config_complete() { m_shortname = "hdd_image"; }
 	// optional information overrides
 	virtual machine_config_constructor device_mconfig_additions() const;
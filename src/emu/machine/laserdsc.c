@@ -100,7 +100,11 @@ laserdisc_device::laserdisc_device(const machine_config &mconfig, device_type ty
 	  m_samplerate(0),
 	  m_readresult(CHDERR_NONE),
 	  m_chdtracks(0),
-	  m_work_queue(osd_work_queue_alloc(WORK_QUEUE_FLAG_IO)),
+	  m_work_queue(NULL),
+	  m_disc_lock(NULL),
+	  m_prefetch_clock(0),
+	  m_prefetch_lasttrack(0),
+	  m_prefetch_steady(false),
 	  m_audiosquelch(0),
 	  m_videosquelch(0),
 	  m_fieldnum(0),
@@ -126,6 +130,21 @@ laserdisc_device::laserdisc_device(const machine_config &mconfig, device_type ty
 	m_orig_config.m_overposx = m_orig_config.m_overposy = 0.0f;
 	m_orig_config.m_overscalex = m_orig_config.m_overscaley = 1.0f;
 	*static_cast<laserdisc_overlay_config *>(this) = m_orig_config;
+
+	// start with empty prefetch slots, expecting normal forward play
+	for (int slotnum = 0; slotnum < PREFETCH_SLOTS; slotnum++)
+	{
+		prefetch_slot &slot = m_prefetch[slotnum];
+		slot.m_device = this;
+		slot.m_hunknum = ~0;
+		slot.m_lastuse = 0;
+		slot.m_osd = NULL;
+		slot.m_result = CHDERR_NONE;
+		slot.m_audio[0] = slot.m_audio[1] = NULL;
+		slot.m_actsamples = 0;
+	}
+	m_prefetch_delta[0] = 1;
+	m_prefetch_delta[1] = 0;
 }
 
 
@@ -135,7 +154,6 @@ laserdisc_device::laserdisc_device(const machine_config &mconfig, device_type ty
 
 laserdisc_device::~laserdisc_device()
 {
-	osd_work_queue_free(m_work_queue);
 }
 
 
@@ -346,6 +364,10 @@ void laserdisc_device::device_start()
 	if (!m_screen->started())
 		throw device_missing_dependencies();
 
+	// allocate the threads that read and decode the disc
+	m_work_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+	m_disc_lock = osd_lock_alloc();
+
 	// initialize the various pieces
 	init_disc();
 	init_video();
@@ -365,6 +387,22 @@ void laserdisc_device::device_stop()
 	// make sure all async operations have completed
 	if (m_disc != NULL)
 		osd_work_queue_wait(m_work_queue, osd_ticks_per_second() * 10);
+	for (int slotnum = 0; slotnum < PREFETCH_SLOTS; slotnum++)
+		if (m_prefetch[slotnum].m_osd != NULL)
+		{
+			osd_work_item_release(m_prefetch[slotnum].m_osd);
+			m_prefetch[slotnum].m_osd = NULL;
+		}
+	if (m_work_queue != NULL)
+	{
+		osd_work_queue_free(m_work_queue);
+		m_work_queue = NULL;
+	}
+	if (m_disc_lock != NULL)
+	{
+		osd_lock_free(m_disc_lock);
+		m_disc_lock = NULL;
+	}
 
 	// free any textures and palettes
 	if (m_videotex != NULL)
@@ -798,6 +836,10 @@ void laserdisc_device::init_disc()
 		err = m_disc->read_metadata(AV_LD_METADATA_TAG, 0, m_vbidata);
 		if (err != CHDERR_NONE || m_vbidata.count() != totalhunks * VBI_PACKED_BYTES)
 			throw emu_fatalerror("Precomputed VBI metadata missing or incorrect size");
+
+		// fields decoded ahead are decoded whole so their CRCs can be checked
+		for (int slotnum = 0; slotnum < PREFETCH_SLOTS; slotnum++)
+			m_prefetch[slotnum].m_raw.resize(m_disc->hunk_bytes());
 	}
 	m_maxtrack = MAX(m_maxtrack, VIRTUAL_LEAD_IN_TRACKS + VIRTUAL_LEAD_OUT_TRACKS + m_chdtracks);
 }
@@ -837,6 +879,10 @@ void laserdisc_device::init_video()
 		frame.m_visbitmap.set_palette(m_videopalette);
 	}
 
+	// allocate bitmaps for fields decoded ahead
+	for (int slotnum = 0; slotnum < PREFETCH_SLOTS; slotnum++)
+		m_prefetch[slotnum].m_bitmap.allocate(m_width, m_height);
+
 	// allocate an empty frame of the same size
 	m_emptyframe.allocate(m_width, m_height * 2);
 	m_emptyframe.set_palette(m_videopalette);
@@ -891,6 +937,14 @@ void laserdisc_device::init_audio()
 	m_audiobufsize = m_audiomaxsamples * 4;
 	m_audiobuffer[0] = auto_alloc_array(machine(), INT16, m_audiobufsize);
 	m_audiobuffer[1] = auto_alloc_array(machine(), INT16, m_audiobufsize);
+
+	// allocate audio for fields decoded ahead
+	for (int slotnum = 0; slotnum < PREFETCH_SLOTS; slotnum++)
+	{
+		prefetch_slot &slot = m_prefetch[slotnum];
+		slot.m_audio[0] = auto_alloc_array(machine(), INT16, m_audiomaxsamples);
+		slot.m_audio[1] = auto_alloc_array(machine(), INT16, m_audiomaxsamples);
+	}
 }
 
 
@@ -1075,18 +1129,92 @@ void laserdisc_device::read_track_data()
 		m_metadata[m_fieldnum].line17 = m_metadata[m_fieldnum].line18 = m_metadata[m_fieldnum].line1718 = VBI_CODE_LEADIN;
 	}
 
-	// configure the codec and then read
+	// start decoding this field and the ones we expect to follow
 	m_readresult = CHDERR_FILE_NOT_FOUND;
 	if (m_disc != NULL && !m_videosquelch)
 	{
-		m_readresult = m_disc->codec_configure(CHD_CODEC_AVHUFF, AVHUFF_CODEC_DECOMPRESS_CONFIG, &m_avhuff_config);
-		if (m_readresult == CHDERR_NONE)
+		m_queued_hunknum = readhunk;
+		m_readresult = CHDERR_OPERATION_PENDING;
+		prefetch_fields(chdtrack);
+	}
+}
+
+
+//-------------------------------------------------
+//  prefetch_fields - queue decoding of the field
+//  about to be read, plus the fields expected to
+//  follow if the player keeps moving in the same
+//  direction at the same speed
+//-------------------------------------------------
+
+void laserdisc_device::prefetch_fields(UINT32 chdtrack)
+{
+	// learn how far the player moved before this field; scanning and
+	// multi-speed play repeat the same movement for each field parity
+	INT32 delta = chdtrack - m_prefetch_lasttrack;
+	m_prefetch_steady = (delta == m_prefetch_delta[m_fieldnum]);
+	m_prefetch_delta[m_fieldnum] = delta;
+	m_prefetch_lasttrack = chdtrack;
+	m_prefetch_clock++;
+
+	// the field we need now comes first; if every slot is busy, wait for them
+	if (prefetch_hunk(m_queued_hunknum) == NULL)
+	{
+		osd_work_queue_wait(m_work_queue, osd_ticks_per_second() * 10);
+		prefetch_hunk(m_queued_hunknum);
+	}
+
+	// after a seek or speed change, only look a couple of fields ahead until the movement repeats
+	int fields = m_prefetch_steady ? PREFETCH_FIELDS : 2;
+	INT32 track = chdtrack;
+	UINT8 fieldnum = m_fieldnum;
+	for (int fieldcount = 0; fieldcount < fields; fieldcount++)
+	{
+		fieldnum ^= 1;
+		track += m_prefetch_delta[fieldnum];
+		if (track < 0 || track >= m_chdtracks || prefetch_hunk(track * 2 + fieldnum) == NULL)
+			break;
+	}
+}
+
+
+//-------------------------------------------------
+//  prefetch_hunk - return the slot holding a
+//  hunk, queueing it for decoding if needed;
+//  returns NULL if no slot is free
+//-------------------------------------------------
+
+laserdisc_device::prefetch_slot *laserdisc_device::prefetch_hunk(UINT32 hunknum)
+{
+	// look for the hunk, or else the least recently used finished slot not wanted this field
+	prefetch_slot *victim = NULL;
+	for (int slotnum = 0; slotnum < PREFETCH_SLOTS; slotnum++)
+	{
+		prefetch_slot &slot = m_prefetch[slotnum];
+		if (slot.m_hunknum == hunknum)
 		{
-			m_queued_hunknum = readhunk;
-			m_readresult = CHDERR_OPERATION_PENDING;
-			osd_work_item_queue(m_work_queue, read_async_static, this, WORK_ITEM_FLAG_AUTO_RELEASE);
+			slot.m_lastuse = m_prefetch_clock;
+			return &slot;
 		}
+		if (slot.m_lastuse != m_prefetch_clock && slot.m_result != CHDERR_OPERATION_PENDING && (victim == NULL || slot.m_lastuse < victim->m_lastuse))
+			victim = &slot;
+	}
+	if (victim == NULL)
+		return NULL;
+
+	// release the previous work item and queue a new one
+	if (victim->m_osd != NULL)
+	{
+		osd_work_item_wait(victim->m_osd, osd_ticks_per_second() * 10);
+		osd_work_item_release(victim->m_osd);
 	}
+	victim->m_hunknum = hunknum;
+	victim->m_lastuse = m_prefetch_clock;
+	victim->m_result = CHDERR_OPERATION_PENDING;
+	victim->m_osd = osd_work_item_queue(m_work_queue, read_async_static, victim, 0);
+	if (victim->m_osd == NULL)
+		read_async_static(victim, 0);
+	return victim;
 }
 
 
@@ -1097,12 +1225,89 @@ void laserdisc_device::read_track_data()
 
 void *laserdisc_device::read_async_static(void *param, int threadid)
 {
-	laserdisc_device &ld = *reinterpret_cast<laserdisc_device *>(param);
-	ld.m_readresult = ld.m_disc->read_hunk(ld.m_queued_hunknum, NULL);
+	prefetch_slot &slot = *reinterpret_cast<prefetch_slot *>(param);
+	laserdisc_device &ld = *slot.m_device;
+
+	// fetch the compressed data; the disc itself is shared by all work items
+	chd_codec_type codec = CHD_CODEC_NONE;
+	UINT32 crc = 0;
+	UINT8 crcbits = 0;
+	osd_lock_acquire(ld.m_disc_lock);
+	chd_error result = ld.m_disc->read_compressed_hunk(slot.m_hunknum, slot.m_compressed, codec, crc, crcbits);
+
+	// anything but A/V Huffman data is left to the CHD to decode and check
+	if (result == CHDERR_NONE && codec != CHD_CODEC_AVHUFF)
+	{
+		result = ld.m_disc->read_hunk(slot.m_hunknum, slot.m_raw);
+		osd_lock_release(ld.m_disc_lock);
+	}
+
+	// otherwise, decode and check with this slot's own decoder outside of the lock
+	else
+	{
+		osd_lock_release(ld.m_disc_lock);
+		if (result == CHDERR_NONE)
+		{
+			if (slot.m_decoder.decode_data(slot.m_compressed, slot.m_compressed.count(), slot.m_raw) != AVHERR_NONE)
+				result = CHDERR_DECOMPRESSION_ERROR;
+			else
+			{
+				// pad short fields with 0 the way the CHD codec does
+				UINT32 size = avhuff_encoder::raw_data_size(slot.m_raw);
+				if (size < slot.m_raw.count())
+					memset(&slot.m_raw[size], 0, slot.m_raw.count() - size);
+				result = ld.m_disc->verify_hunk(slot.m_raw, crc, crcbits);
+			}
+		}
+	}
+
+	// unpack the big-endian audio and video into the slot
+	if (result == CHDERR_NONE && !ld.unpack_field(slot))
+		result = CHDERR_DECOMPRESSION_ERROR;
+	slot.m_result = result;
 	return NULL;
 }
 
 
+//-------------------------------------------------
+//  unpack_field - copy the audio and video of a
+//  raw decoded field into its slot's buffers;
+//  returns false if it does not fit
+//-------------------------------------------------
+
+bool laserdisc_device::unpack_field(prefetch_slot &slot)
+{
+	// parse the header
+	const UINT8 *raw = slot.m_raw;
+	if (slot.m_raw.count() < 12 || raw[0] != 'c' || raw[1] != 'h' || raw[2] != 'a' || raw[3] != 'v' || avhuff_encoder::raw_data_size(raw) > slot.m_raw.count())
+		return false;
+	int metasize = raw[4];
+	int channels = raw[5];
+	int samples = (raw[6] << 8) + raw[7];
+	int width = (raw[8] << 8) + raw[9];
+	int height = ((raw[10] << 8) + raw[11]) & 0x7fff;
+	if (samples > m_audiomaxsamples || width > slot.m_bitmap.width() || height > slot.m_bitmap.height())
+		return false;
+	raw += 12 + metasize;
+
+	// audio follows the metadata, one channel after the other
+	for (int chnum = 0; chnum < channels; chnum++, raw += 2 * samples)
+		if (chnum < ARRAY_LENGTH(slot.m_audio))
+			for (int sampnum = 0; sampnum < samples; sampnum++)
+				slot.m_audio[chnum][sampnum] = (raw[2 * sampnum] << 8) | raw[2 * sampnum + 1];
+	slot.m_actsamples = samples;
+
+	// then the video, one row after the other
+	for (int y = 0; y < height; y++, raw += 2 * width)
+	{
+		UINT16 *dest = &slot.m_bitmap.pix16(y);
+		for (int x = 0; x < width; x++)
+			dest[x] = (raw[2 * x] << 8) | raw[2 * x + 1];
+	}
+	return true;
+}
+
+
 //-------------------------------------------------
 //  process_track_data - process data from a
 //  track after it has been read
@@ -1110,9 +1315,35 @@ void *laserdisc_device::read_async_static(void *param, int threadid)
 
 void laserdisc_device::process_track_data()
 {
-	// wait for the async operation to complete
+	// wait for the field to be decoded and copy it into place
 	if (m_readresult == CHDERR_OPERATION_PENDING)
-		osd_work_queue_wait(m_work_queue, osd_ticks_per_second() * 10);
+	{
+		m_readresult = CHDERR_READ_ERROR;
+		for (int slotnum = 0; slotnum < PREFETCH_SLOTS; slotnum++)
+		{
+			prefetch_slot &slot = m_prefetch[slotnum];
+			if (slot.m_hunknum != m_queued_hunknum)
+				continue;
+			if (slot.m_osd != NULL && osd_work_item_wait(slot.m_osd, osd_ticks_per_second() * 10))
+			{
+				osd_work_item_release(slot.m_osd);
+				slot.m_osd = NULL;
+			}
+			if (slot.m_result == CHDERR_OPERATION_PENDING)
+				break;
+			m_readresult = slot.m_result;
+			if (m_readresult == CHDERR_NONE)
+			{
+				bitmap_yuy16 &video = m_avhuff_config.video;
+				for (int y = 0; y < video.height() && y < slot.m_bitmap.height(); y++)
+					memcpy(&video.pix16(y), &slot.m_bitmap.pix16(y), MIN(video.width(), slot.m_bitmap.width()) * 2);
+				m_audiocursamples = slot.m_actsamples;
+				memcpy(m_avhuff_config.audio[0], slot.m_audio[0], m_audiocursamples * 2);
+				memcpy(m_avhuff_config.audio[1], slot.m_audio[1], m_audiocursamples * 2);
+			}
+			break;
+		}
+	}
 	assert(m_readresult != CHDERR_OPERATION_PENDING);
 
 	// remove the video if we had an error
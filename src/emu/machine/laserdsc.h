@@ -306,6 +306,26 @@ private:
 		INT32				m_lastfield;			// last absolute field number
 	};
 
+	// number of fields that can be held decoded, and how many of them are read ahead
+	static const int PREFETCH_SLOTS = 12;
+	static const int PREFETCH_FIELDS = 8;
+
+	// a field decoded ahead of time
+	struct prefetch_slot
+	{
+		laserdisc_device *	m_device;				// owning device
+		UINT32				m_hunknum;				// hunk held, or ~0 if none
+		UINT32				m_lastuse;				// field counter at last use
+		osd_work_item *		m_osd;					// work item decoding this field
+		volatile int		m_result;				// result of the read
+		bitmap_yuy16		m_bitmap;				// decoded video
+		INT16 *				m_audio[2];				// decoded audio
+		UINT32				m_actsamples;			// number of audio samples decoded
+		avhuff_decoder		m_decoder;				// decoder private to this field
+		dynamic_buffer		m_compressed;			// compressed data
+		dynamic_buffer		m_raw;					// whole decoded hunk, for the CRC check
+	};
+
 	// internal helpers
 	void init_disc();
 	void init_video();
@@ -316,7 +336,10 @@ private:
 	void vblank_state_changed(screen_device &screen, bool vblank_state);
 	frame_data &current_frame();
 	void read_track_data();
+	void prefetch_fields(UINT32 chdtrack);
+	prefetch_slot *prefetch_hunk(UINT32 hunknum);
 	static void *read_async_static(void *param, int threadid);
+	bool unpack_field(prefetch_slot &slot);
 	void process_track_data();
 	void config_load(int config_type, xml_data_node *parentnode);
 	void config_save(int config_type, xml_data_node *parentnode);
@@ -345,7 +368,13 @@ private:
 
 	// async operations
 	osd_work_queue *	m_work_queue;			// work queue
+	osd_lock *			m_disc_lock;			// lock for accessing the disc from work items
 	UINT32				m_queued_hunknum;		// queued hunk
+	prefetch_slot		m_prefetch[PREFETCH_SLOTS];	// fields decoded ahead
+	UINT32				m_prefetch_clock;		// counter for replacing prefetched fields
+	INT32				m_prefetch_lasttrack;	// CHD track read for the previous field
+	INT32				m_prefetch_delta[2];	// track movement observed before each field
+	bool				m_prefetch_steady;		// did the movement repeat the last one?
 
 	// core states
 	UINT8				m_audiosquelch;			// audio squelch state: bit 0 = audio 1, bit 1 = audio 2
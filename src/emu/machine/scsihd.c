@@ -20,6 +20,8 @@ scsihd_device::scsihd_device(const machine_config &mconfig, const char *tag, dev
 
 void scsihd_device::device_start()
 {
+	region_disk = NULL;
+
 	save_item( NAME( lba ) );
 	save_item( NAME( blocks ) );
 }
@@ -32,12 +34,22 @@ void scsihd_device::device_reset()
 	disk = subdevice<harddisk_image_device>("image")->get_hard_disk_file();
 	if( !disk )
 	{
-		// try to locate the CHD from a DISK_REGION
-		chd_file *handle = get_disk_handle(machine(), tag());
-		if (handle != NULL)
+		// try to locate the CHD from a DISK_REGION; it is opened once and kept,
+		// along with its write cache, until the device stops
+		if( !region_disk )
+		{
+			chd_file *handle = get_disk_handle(machine(), tag());
+			if (handle != NULL)
+			{
+				region_disk = hard_disk_open(handle);
+				if (region_disk != NULL)
+					hard_disk_enable_write_cache(region_disk, HARDDISK_WRITE_CACHE_HUNKS);
+			}
+		}
+		if( region_disk )
 		{
 			is_image_device = false;
-			disk = hard_disk_open(handle);
+			disk = region_disk;
 		}
 	}
 
@@ -59,15 +71,20 @@ void scsihd_device::device_reset()
 
 void scsihd_device::device_stop()
 {
-	if (!is_image_device)
+	if( region_disk )
 	{
-		if( disk )
-		{
-			hard_disk_close( disk );
-		}
+		hard_disk_close( region_disk );
+		region_disk = NULL;
 	}
 }
 
+void scsihd_device::device_pre_save()
+{
+	// write back cached changes so the disk matches the saved state
+	if( region_disk && !hard_disk_flush( region_disk ) )
+		mame_printf_error("%s: failed to write back cached changes to the hard disk\n", tag());
+}
+
 static MACHINE_CONFIG_FRAGMENT(scsi_harddisk)
 	MCFG_HARDDISK_ADD("image")
 MACHINE_CONFIG_END
@@ -28,12 +28,14 @@ protected:
 	virtual void device_start();
 	virtual void device_reset();
 	virtual void device_stop();
+	virtual void device_pre_save();
 
 private:
 	UINT32 lba;
 	UINT32 blocks;
 	int sectorbytes;
 	hard_disk_file *disk;
+	hard_disk_file *region_disk;
 	bool is_image_device;
 };
 
@@ -83,6 +83,7 @@ public:
 //**************************************************************************
 
 extern const char build_version[];
+extern const char build_id[];
 
 
 
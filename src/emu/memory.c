@@ -184,6 +184,7 @@
 #include <map>
 
 #include "emu.h"
+#include "emuopts.h"
 #include "debug/debugcpu.h"
 
 
@@ -850,6 +851,49 @@ private:
 };
 
 
+// ======================> memory_access_stats
+
+// per-space access counters, kept by handler table entry and by address page
+class memory_access_stats
+{
+public:
+	// construction
+	memory_access_stats(running_machine &machine, offs_t bytemask)
+		: m_page_shift(8),
+		  m_pages(0)
+	{
+		// keep the page tables to at most 64k entries
+		while (m_page_shift < 32 && (bytemask >> m_page_shift) >= 0x10000)
+			m_page_shift++;
+		m_pages = (bytemask >> m_page_shift) + 1;
+		m_page[0] = auto_alloc_array_clear(machine, UINT64, m_pages);
+		m_page[1] = auto_alloc_array_clear(machine, UINT64, m_pages);
+		reset();
+	}
+
+	// count a single access
+	void count(int rw, UINT32 entry, offs_t byteaddress)
+	{
+		m_handler[rw][entry]++;
+		m_page[rw][byteaddress >> m_page_shift]++;
+	}
+
+	// clear all counters
+	void reset()
+	{
+		memset(m_handler, 0, sizeof(m_handler));
+		memset(m_page[0], 0, m_pages * sizeof(UINT64));
+		memset(m_page[1], 0, m_pages * sizeof(UINT64));
+	}
+
+	// internal state
+	UINT64				m_handler[2][256];		// read/write counts per handler table entry
+	UINT64 *			m_page[2];				// read/write counts per page
+	UINT8				m_page_shift;			// log2 of the page size in bytes
+	UINT32				m_pages;				// number of pages
+};
+
+
 // ======================> address_space_specific
 
 // this is a derived class of address_space with specific width, endianness, and table size
@@ -1016,8 +1060,8 @@ public:
 	virtual address_table_write &write() { return m_write; }
 
 	// watchpoint control
-	virtual void enable_read_watchpoints(bool enable = true) { m_read.enable_watchpoints(enable); }
-	virtual void enable_write_watchpoints(bool enable = true) { m_write.enable_watchpoints(enable); }
+	virtual void enable_read_watchpoints(bool enable = true) { m_read.enable_watchpoints(enable); invalidate_page_cache(ROW_READ); }
+	virtual void enable_write_watchpoints(bool enable = true) { m_write.enable_watchpoints(enable); invalidate_page_cache(ROW_WRITE); }
 
 	// generate accessor table
 	virtual void accessors(data_accessors &accessors) const
@@ -1077,6 +1121,8 @@ public:
 		offs_t byteaddress = offset & m_bytemask;
 		UINT32 entry = read_lookup(byteaddress);
 		const handler_entry_read &handler = m_read.handler_read(entry);
+		if (UNEXPECTED(m_access_stats != NULL))
+			m_access_stats->count(0, entry, byteaddress);
 
 		// either read directly from RAM, or call the delegate
 		offset = handler.byteoffset(byteaddress);
@@ -1102,6 +1148,8 @@ public:
 		offs_t byteaddress = offset & m_bytemask;
 		UINT32 entry = read_lookup(byteaddress);
 		const handler_entry_read &handler = m_read.handler_read(entry);
+		if (UNEXPECTED(m_access_stats != NULL))
+			m_access_stats->count(0, entry, byteaddress);
 
 		// either read directly from RAM, or call the delegate
 		offset = handler.byteoffset(byteaddress);
@@ -1125,6 +1173,8 @@ public:
 		offs_t byteaddress = offset & m_bytemask;
 		UINT32 entry = write_lookup(byteaddress);
 		const handler_entry_write &handler = m_write.handler_write(entry);
+		if (UNEXPECTED(m_access_stats != NULL))
+			m_access_stats->count(1, entry, byteaddress);
 
 		// either write directly to RAM, or call the delegate
 		offset = handler.byteoffset(byteaddress);
@@ -1150,6 +1200,8 @@ public:
 		offs_t byteaddress = offset & m_bytemask;
 		UINT32 entry = write_lookup(byteaddress);
 		const handler_entry_write &handler = m_write.handler_write(entry);
+		if (UNEXPECTED(m_access_stats != NULL))
+			m_access_stats->count(1, entry, byteaddress);
 
 		// either write directly to RAM, or call the delegate
 		offset = handler.byteoffset(byteaddress);
@@ -1555,6 +1607,13 @@ void memory_manager::initialize()
 	// dump the final memory configuration
 	generate_memdump(machine());
 
+	// count accesses if requested, and report them on the way out
+	if (machine().options().memstats())
+	{
+		enable_access_stats();
+		machine().add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(FUNC(memory_manager::write_access_stats), this));
+	}
+
 	// we are now initialized
 	m_initialized = true;
 }
@@ -1589,6 +1648,61 @@ void memory_manager::dump(FILE *file)
 }
 
 
+//-------------------------------------------------
+//  enable_access_stats - turn access counting
+//  on or off for all address spaces
+//-------------------------------------------------
+
+void memory_manager::enable_access_stats(bool enable)
+{
+	for (address_space *space = m_spacelist.first(); space != NULL; space = space->next())
+		space->enable_access_stats(enable);
+}
+
+
+//-------------------------------------------------
+//  reset_access_stats - clear the access counts
+//  of all address spaces
+//-------------------------------------------------
+
+void memory_manager::reset_access_stats()
+{
+	for (address_space *space = m_spacelist.first(); space != NULL; space = space->next())
+		space->reset_access_stats();
+}
+
+
+//-------------------------------------------------
+//  access_stats_report - append a report of the
+//  busiest handlers and pages of every address
+//  space that has counted accesses, including
+//  ones where counting has since been turned off
+//-------------------------------------------------
+
+void memory_manager::access_stats_report(astring &buffer, int maxentries)
+{
+	for (address_space *space = m_spacelist.first(); space != NULL; space = space->next())
+		space->access_stats_report(buffer, maxentries);
+}
+
+
+//-------------------------------------------------
+//  write_access_stats - write the access report
+//  to memstats.log at exit
+//-------------------------------------------------
+
+void memory_manager::write_access_stats()
+{
+	emu_file file(OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	if (file.open("memstats.log") == FILERR_NONE)
+	{
+		astring buffer;
+		access_stats_report(buffer, 64);
+		file.puts(buffer);
+	}
+}
+
+
 //-------------------------------------------------
 //  region_alloc - allocates memory for a region
 //-------------------------------------------------
@@ -1670,12 +1784,19 @@ address_space::address_space(memory_manager &manager, device_memory_interface &m
 	  m_debugger_access(false),
 	  m_log_unmap(true),
 	  m_direct(*auto_alloc(memory.device().machine(), direct_read_data(*this))),
+	  m_access_stats(NULL),
+	  m_stats_storage(NULL),
 	  m_name(memory.space_config(spacenum)->name()),
 	  m_addrchars((m_config.m_addrbus_width + 3) / 4),
 	  m_logaddrchars((m_config.m_logaddr_width + 3) / 4),
+	  m_page_cache_xor((m_config.endianness() == ENDIANNESS_NATIVE) ? 0 : ~0),
+	  m_bus_bytes(m_config.data_width() / 8),
 	  m_manager(manager),
 	  m_machine(memory.device().machine())
 {
+	// start with an empty page cache
+	invalidate_page_cache();
+
 	// notify the device
 	memory.set_address_space(spacenum, *this);
 }
@@ -2149,6 +2270,54 @@ void address_space::locate_memory()
 }
 
 
+//-------------------------------------------------
+//  invalidate_page_cache - forget all cached page
+//  pointers for reads, writes or both
+//-------------------------------------------------
+
+void address_space::invalidate_page_cache(read_or_write readorwrite)
+{
+	if (readorwrite & ROW_READ)
+		memset(m_read_page_cache, 0xff, sizeof(m_read_page_cache));
+	if (readorwrite & ROW_WRITE)
+		memset(m_write_page_cache, 0xff, sizeof(m_write_page_cache));
+}
+
+
+//-------------------------------------------------
+//  page_cache_fill - look up a page that missed
+//  in the page cache; pages that are not wholly
+//  and linearly backed by a single bank are
+//  cached as NULL so they go straight to the
+//  regular dispatch next time
+//-------------------------------------------------
+
+void address_space::page_cache_fill(page_cache_entry &entry, offs_t page, read_or_write readorwrite)
+{
+	address_table &table = (readorwrite == ROW_READ) ? static_cast<address_table &>(read()) : static_cast<address_table &>(write());
+	entry.m_page = page;
+	entry.m_base = NULL;
+
+	// watchpoints and access counters need to see every access
+	if (table.watchpoints_enabled() || m_access_stats != NULL)
+		return;
+
+	// the whole page must map to one bank
+	offs_t pagestart = page << PAGE_CACHE_BITS;
+	offs_t pageend = pagestart + PAGE_CACHE_MASK;
+	offs_t bytestart, byteend;
+	UINT8 entrynum = table.derive_range(pagestart, bytestart, byteend);
+	if (entrynum < STATIC_BANK1 || entrynum > STATIC_BANKMAX || bytestart > pagestart || byteend < pageend)
+		return;
+
+	// and the bank must map it contiguously onto real memory
+	handler_entry &handler = table.handler(entrynum);
+	if ((handler.bytemask() & PAGE_CACHE_MASK) != PAGE_CACHE_MASK || (handler.bytestart() & PAGE_CACHE_MASK) != 0 || handler.ramptr() == NULL)
+		return;
+	entry.m_base = handler.ramptr(handler.byteoffset(pagestart));
+}
+
+
 //-------------------------------------------------
 //  set_decrypted_region - registers an address
 //  range as having a decrypted data pointer
@@ -2256,6 +2425,124 @@ const char *address_space::get_handler_string(read_or_write readorwrite, offs_t
 }
 
 
+//-------------------------------------------------
+//  enable_access_stats - start or stop counting
+//  accesses; counters survive being turned off
+//  and on again
+//-------------------------------------------------
+
+void address_space::enable_access_stats(bool enable)
+{
+	if (enable && m_access_stats == NULL)
+	{
+		if (m_stats_storage == NULL)
+			m_stats_storage = auto_alloc(machine(), memory_access_stats(machine(), m_bytemask));
+		m_access_stats = m_stats_storage;
+	}
+	else if (!enable)
+		m_access_stats = NULL;
+
+	// counted accesses must not bypass the dispatch
+	invalidate_page_cache();
+}
+
+
+//-------------------------------------------------
+//  reset_access_stats - clear the access counts
+//-------------------------------------------------
+
+void address_space::reset_access_stats()
+{
+	if (m_stats_storage != NULL)
+		m_stats_storage->reset();
+}
+
+
+//-------------------------------------------------
+//  access_stats_report - append a report of the
+//  busiest handlers and pages to the given buffer
+//-------------------------------------------------
+
+struct access_stats_item
+{
+	UINT64		count;
+	UINT32		index;
+};
+
+static int CLIB_DECL access_stats_compare(const void *item1, const void *item2)
+{
+	UINT64 count1 = reinterpret_cast<const access_stats_item *>(item1)->count;
+	UINT64 count2 = reinterpret_cast<const access_stats_item *>(item2)->count;
+	return (count1 < count2) ? 1 : (count1 > count2) ? -1 : 0;
+}
+
+void address_space::access_stats_report(astring &buffer, int maxentries)
+{
+	memory_access_stats *stats = m_stats_storage;
+	if (stats == NULL)
+		return;
+
+	for (int rw = 0; rw < 2; rw++)
+	{
+		const address_table &table = (rw == 0) ? static_cast<address_table &>(read()) : static_cast<address_table &>(write());
+		const char *rwname = (rw == 0) ? "read" : "write";
+
+		// gather and sort the handlers
+		access_stats_item handlers[256];
+		UINT64 total = 0, ramtotal = 0;
+		for (int entry = 0; entry < 256; entry++)
+		{
+			handlers[entry].count = stats->m_handler[rw][entry];
+			handlers[entry].index = entry;
+			total += handlers[entry].count;
+			if (entry <= STATIC_BANKMAX)
+				ramtotal += handlers[entry].count;
+		}
+		qsort(handlers, 256, sizeof(handlers[0]), access_stats_compare);
+
+		buffer.catprintf("Device '%s' %s space: %" I64FMT "u %ss (%" I64FMT "u to RAM, %" I64FMT "u to handlers)\n",
+				m_device.tag(), m_name, total, rwname, ramtotal, total - ramtotal);
+		if (total == 0)
+			continue;
+
+		// list the busiest handlers
+		for (int index = 0; index < 256 && index < maxentries && handlers[index].count != 0; index++)
+		{
+			UINT8 entry = handlers[index].index;
+			handler_entry &handler = table.handler(entry);
+			astring name(table.handler_name(entry));
+			buffer.catprintf("  %12" I64FMT "u %5.1f%%  %s-%s  %s %s\n", handlers[index].count,
+					100.0 * (double)handlers[index].count / (double)total,
+					core_i64_hex_format(byte_to_address(handler.bytestart()), m_addrchars),
+					core_i64_hex_format(byte_to_address_end(handler.byteend()), m_addrchars),
+					(entry <= STATIC_BANKMAX) ? "ram" : "handler", name.cstr());
+		}
+
+		// gather and sort the pages
+		access_stats_item *pages = global_alloc_array(access_stats_item, stats->m_pages);
+		for (UINT32 page = 0; page < stats->m_pages; page++)
+		{
+			pages[page].count = stats->m_page[rw][page];
+			pages[page].index = page;
+		}
+		qsort(pages, stats->m_pages, sizeof(pages[0]), access_stats_compare);
+
+		// list the busiest pages
+		buffer.catprintf("  hottest %X-byte pages:\n", 1 << stats->m_page_shift);
+		for (UINT32 index = 0; index < stats->m_pages && index < maxentries && pages[index].count != 0; index++)
+		{
+			offs_t bytestart = pages[index].index << stats->m_page_shift;
+			offs_t byteend = bytestart + (1 << stats->m_page_shift) - 1;
+			buffer.catprintf("  %12" I64FMT "u %5.1f%%  %s-%s\n", pages[index].count,
+					100.0 * (double)pages[index].count / (double)total,
+					core_i64_hex_format(byte_to_address(bytestart), m_addrchars),
+					core_i64_hex_format(byte_to_address_end(byteend), m_addrchars));
+		}
+		global_free(pages);
+	}
+}
+
+
 //-------------------------------------------------
 //  dump_map - dump the contents of a single
 //  address space
@@ -3037,6 +3324,7 @@ void address_table::map_range(offs_t addrstart, offs_t addrend, offs_t addrmask,
 
 	// recompute any direct access on this space if it is a read modification
 	m_space.m_direct.force_update(entry);
+	m_space.invalidate_page_cache();
 
 	//  verify_reference_counts();
 }
@@ -3163,6 +3451,7 @@ void address_table::setup_range_masked(offs_t addrstart, offs_t addrend, offs_t
 
 		// recompute any direct access on this space if it is a read modification
 		m_space.m_direct.force_update(entry);
+		m_space.invalidate_page_cache();
 	}
 
 	// Ranges in range_partial must duplicated then partially changed
@@ -3206,6 +3495,7 @@ void address_table::setup_range_masked(offs_t addrstart, offs_t addrend, offs_t
 
 			// recompute any direct access on this space if it is a read modification
 			m_space.m_direct.force_update(entry);
+			m_space.invalidate_page_cache();
 		}
 	}
 
@@ -3999,6 +4289,17 @@ direct_read_data::~direct_read_data()
 }
 
 
+//-------------------------------------------------
+//  count_access - count a direct read against the
+//  live entry and the page it falls in
+//-------------------------------------------------
+
+void direct_read_data::count_access(offs_t byteaddress)
+{
+	m_space.m_access_stats->count(0, m_entry, byteaddress & m_space.m_bytemask);
+}
+
+
 //-------------------------------------------------
 //  set_direct_region - called by device cores to
 //  update the opcode base for the given address
@@ -4288,7 +4589,10 @@ void memory_bank::invalidate_references()
 {
 	// invalidate all the direct references to any referenced address spaces
 	for (bank_reference *ref = m_reflist.first(); ref != NULL; ref = ref->next())
+	{
 		ref->space().direct().force_update();
+		ref->space().invalidate_page_cache(ref->readorwrite());
+	}
 }
 
 
@@ -4390,7 +4694,10 @@ void memory_bank::configure_entry(int entrynum, void *base)
 
 	// if the bank base is not configured, and we're the first entry, set us up
 	if (*m_baseptr == NULL && entrynum == 0)
+	{
 		*m_baseptr = m_entry[entrynum].m_raw;
+		invalidate_references();
+	}
 }
 
 
@@ -99,6 +99,7 @@ class address_space;
 class address_table;
 class address_table_read;
 class address_table_write;
+class memory_access_stats;
 
 
 // offsets and addresses are 32-bit (for now...)
@@ -240,6 +241,8 @@ public:
 
 private:
 	// internal helpers
+	bool read_is_valid(offs_t byteaddress);
+	void count_access(offs_t byteaddress);
 	bool set_direct_region(offs_t &byteaddress);
 	direct_range *find_range(offs_t byteaddress, UINT8 &entry);
 	void remove_intersecting_ranges(offs_t bytestart, offs_t byteend);
@@ -346,6 +349,12 @@ public:
 	void set_log_unmap(bool log) { m_log_unmap = log; }
 	void dump_map(FILE *file, read_or_write readorwrite);
 
+	// access instrumentation
+	void enable_access_stats(bool enable = true);
+	bool access_stats_enabled() const { return (m_access_stats != NULL); }
+	void reset_access_stats();
+	void access_stats_report(astring &buffer, int maxentries);
+
 	// watchpoint enablers
 	virtual void enable_read_watchpoints(bool enable = true) = 0;
 	virtual void enable_write_watchpoints(bool enable = true) = 0;
@@ -385,6 +394,18 @@ public:
 	virtual void write_qword_unaligned(offs_t byteaddress, UINT64 data) = 0;
 	virtual void write_qword_unaligned(offs_t byteaddress, UINT64 data, UINT64 mask) = 0;
 
+	// page cache accessors; aligned accesses no wider than the data bus that hit a
+	// RAM/ROM page go straight to host memory, everything else uses the accessors above
+	UINT8 read_byte_cached(offs_t byteaddress);
+	UINT16 read_word_cached(offs_t byteaddress);
+	UINT32 read_dword_cached(offs_t byteaddress);
+	UINT64 read_qword_cached(offs_t byteaddress);
+	void write_byte_cached(offs_t byteaddress, UINT8 data);
+	void write_word_cached(offs_t byteaddress, UINT16 data);
+	void write_dword_cached(offs_t byteaddress, UINT32 data);
+	void write_qword_cached(offs_t byteaddress, UINT64 data);
+	void invalidate_page_cache(read_or_write readorwrite = ROW_READWRITE);
+
 	// address-to-byte conversion helpers
 	offs_t address_to_byte(offs_t address) const { return m_config.addr2byte(address); }
 	offs_t address_to_byte_end(offs_t address) const { return m_config.addr2byte_end(address); }
@@ -535,9 +556,21 @@ public:
 	void locate_memory();
 
 private:
+	// page cache definitions
+	static const int PAGE_CACHE_BITS = 10;						// 1k pages
+	static const int PAGE_CACHE_ENTRIES = 256;					// direct-mapped entries per direction
+	static const offs_t PAGE_CACHE_MASK = (1 << PAGE_CACHE_BITS) - 1;
+	struct page_cache_entry
+	{
+		offs_t				m_page;				// page number, or ~0 if empty
+		UINT8 *				m_base;				// host pointer to the start of the page, or NULL if not RAM-backed
+	};
+
 	// internal helpers
 	virtual address_table_read &read() = 0;
 	virtual address_table_write &write() = 0;
+	UINT8 *page_cache_ptr(page_cache_entry *cache, offs_t byteaddress, UINT32 size, read_or_write readorwrite);
+	void page_cache_fill(page_cache_entry &entry, offs_t page, read_or_write readorwrite);
 	void populate_map_entry(const address_map_entry &entry, read_or_write readorwrite);
 	void unmap_generic(offs_t addrstart, offs_t addrend, offs_t addrmask, offs_t addrmirror, read_or_write readorwrite, bool quiet);
 	void *install_ram_generic(offs_t addrstart, offs_t addrend, offs_t addrmask, offs_t addrmirror, read_or_write readorwrite, void *baseptr);
@@ -564,11 +597,17 @@ protected:
 	bool					m_debugger_access;	// treat accesses as coming from the debugger
 	bool					m_log_unmap;		// log unmapped accesses in this space?
 	direct_read_data &		m_direct;			// fast direct-access read info
+	memory_access_stats *	m_access_stats;		// access counters, if instrumentation is enabled
+	memory_access_stats *	m_stats_storage;	// access counters, kept while instrumentation is disabled
 	const char *			m_name;				// friendly name of the address space
 	UINT8					m_addrchars;		// number of characters to use for physical addresses
 	UINT8					m_logaddrchars;		// number of characters to use for logical addresses
 
 private:
+	page_cache_entry		m_read_page_cache[PAGE_CACHE_ENTRIES];	// host pointers for reads
+	page_cache_entry		m_write_page_cache[PAGE_CACHE_ENTRIES];	// host pointers for writes
+	offs_t					m_page_cache_xor;	// address XOR for sub-bus-width accesses
+	UINT32					m_bus_bytes;		// data bus width in bytes
 	memory_manager &		m_manager;			// reference to the owning manager
 	running_machine &		m_machine;			// reference to the owning machine
 };
@@ -637,6 +676,7 @@ class memory_bank
 		// getters
 		bank_reference *next() const { return m_next; }
 		address_space &space() const { return m_space; }
+		read_or_write readorwrite() const { return m_readorwrite; }
 
 		// does this reference match the space+read/write combination?
 		bool matches(address_space &space, read_or_write readorwrite) const
@@ -830,6 +870,11 @@ public:
 	// dump the internal memory tables to the given file
 	void dump(FILE *file);
 
+	// access instrumentation for all spaces
+	void enable_access_stats(bool enable = true);
+	void reset_access_stats();
+	void access_stats_report(astring &buffer, int maxentries);
+
 	// pointers to a bank pointer (internal usage only)
 	UINT8 **bank_pointer_addr(UINT8 index, bool decrypted = false) { return decrypted ? &m_bankd_ptr[index] : &m_bank_ptr[index]; }
 
@@ -844,6 +889,7 @@ private:
 	memory_region *region(const char *tag) { return m_regionlist.find(tag); }
 	memory_share *shared(const char *tag) { return m_sharelist.find(tag); }
 	void bank_reattach();
+	void write_access_stats();
 
 	// internal state
 	running_machine &			m_machine;				// reference to the machine
@@ -970,6 +1016,118 @@ private:
 //  INLINE FUNCTIONS
 //**************************************************************************
 
+//-------------------------------------------------
+//  page_cache_ptr - return the host address for
+//  an access of the given size, or NULL if it
+//  must go through the regular dispatch
+//-------------------------------------------------
+
+inline UINT8 *address_space::page_cache_ptr(page_cache_entry *cache, offs_t byteaddress, UINT32 size, read_or_write readorwrite)
+{
+	// only aligned accesses that fit within one bus unit
+	byteaddress &= m_bytemask;
+	if (size > m_bus_bytes || (byteaddress & (size - 1)) != 0)
+		return NULL;
+
+	// look up the page, filling on a miss
+	offs_t page = byteaddress >> PAGE_CACHE_BITS;
+	page_cache_entry &entry = cache[page & (PAGE_CACHE_ENTRIES - 1)];
+	if (UNEXPECTED(entry.m_page != page))
+		page_cache_fill(entry, page, readorwrite);
+	if (entry.m_base == NULL)
+		return NULL;
+
+	// narrower accesses to opposite-endian spaces are swizzled like the BYTE/WORD_XOR macros
+	return entry.m_base + ((byteaddress & PAGE_CACHE_MASK) ^ (m_page_cache_xor & (m_bus_bytes - size)));
+}
+
+
+//-------------------------------------------------
+//  read_*_cached - page cache read accessors
+//-------------------------------------------------
+
+inline UINT8 address_space::read_byte_cached(offs_t byteaddress)
+{
+	UINT8 *ptr = page_cache_ptr(m_read_page_cache, byteaddress, 1, ROW_READ);
+	return EXPECTED(ptr != NULL) ? *ptr : read_byte(byteaddress);
+}
+
+inline UINT16 address_space::read_word_cached(offs_t byteaddress)
+{
+	UINT8 *ptr = page_cache_ptr(m_read_page_cache, byteaddress, 2, ROW_READ);
+	return EXPECTED(ptr != NULL) ? *reinterpret_cast<UINT16 *>(ptr) : read_word(byteaddress);
+}
+
+inline UINT32 address_space::read_dword_cached(offs_t byteaddress)
+{
+	UINT8 *ptr = page_cache_ptr(m_read_page_cache, byteaddress, 4, ROW_READ);
+	return EXPECTED(ptr != NULL) ? *reinterpret_cast<UINT32 *>(ptr) : read_dword(byteaddress);
+}
+
+inline UINT64 address_space::read_qword_cached(offs_t byteaddress)
+{
+	UINT8 *ptr = page_cache_ptr(m_read_page_cache, byteaddress, 8, ROW_READ);
+	return EXPECTED(ptr != NULL) ? *reinterpret_cast<UINT64 *>(ptr) : read_qword(byteaddress);
+}
+
+
+//-------------------------------------------------
+//  write_*_cached - page cache write accessors
+//-------------------------------------------------
+
+inline void address_space::write_byte_cached(offs_t byteaddress, UINT8 data)
+{
+	UINT8 *ptr = page_cache_ptr(m_write_page_cache, byteaddress, 1, ROW_WRITE);
+	if (EXPECTED(ptr != NULL))
+		*ptr = data;
+	else
+		write_byte(byteaddress, data);
+}
+
+inline void address_space::write_word_cached(offs_t byteaddress, UINT16 data)
+{
+	UINT8 *ptr = page_cache_ptr(m_write_page_cache, byteaddress, 2, ROW_WRITE);
+	if (EXPECTED(ptr != NULL))
+		*reinterpret_cast<UINT16 *>(ptr) = data;
+	else
+		write_word(byteaddress, data);
+}
+
+inline void address_space::write_dword_cached(offs_t byteaddress, UINT32 data)
+{
+	UINT8 *ptr = page_cache_ptr(m_write_page_cache, byteaddress, 4, ROW_WRITE);
+	if (EXPECTED(ptr != NULL))
+		*reinterpret_cast<UINT32 *>(ptr) = data;
+	else
+		write_dword(byteaddress, data);
+}
+
+inline void address_space::write_qword_cached(offs_t byteaddress, UINT64 data)
+{
+	UINT8 *ptr = page_cache_ptr(m_write_page_cache, byteaddress, 8, ROW_WRITE);
+	if (EXPECTED(ptr != NULL))
+		*reinterpret_cast<UINT64 *>(ptr) = data;
+	else
+		write_qword(byteaddress, data);
+}
+
+
+//-------------------------------------------------
+//  read_is_valid - see if an address is within
+//  bounds for a direct read, counting the read
+//  if access statistics are being kept
+//-------------------------------------------------
+
+inline bool direct_read_data::read_is_valid(offs_t byteaddress)
+{
+	if (!address_is_valid(byteaddress))
+		return false;
+	if (UNEXPECTED(m_space.m_access_stats != NULL))
+		count_access(byteaddress);
+	return true;
+}
+
+
 //-------------------------------------------------
 //  read_raw_ptr - return a pointer to valid RAM
 //  referenced by the address, or NULL if no RAM
@@ -978,14 +1136,14 @@ private:
 
 inline void *direct_read_data::read_raw_ptr(offs_t byteaddress, offs_t directxor)
 {
-	if (address_is_valid(byteaddress))
+	if (read_is_valid(byteaddress))
 		return &m_raw[(byteaddress ^ directxor) & m_bytemask];
 	return NULL;
 }
 
 inline void *direct_read_data::read_decrypted_ptr(offs_t byteaddress, offs_t directxor)
 {
-	if (address_is_valid(byteaddress))
+	if (read_is_valid(byteaddress))
 		return &m_decrypted[(byteaddress ^ directxor) & m_bytemask];
 	return NULL;
 }
@@ -998,14 +1156,14 @@ inline void *direct_read_data::read_decrypted_ptr(offs_t byteaddress, offs_t dir
 
 inline UINT8 direct_read_data::read_raw_byte(offs_t byteaddress, offs_t directxor)
 {
-	if (address_is_valid(byteaddress))
+	if (read_is_valid(byteaddress))
 		return m_raw[(byteaddress ^ directxor) & m_bytemask];
 	return m_space.read_byte(byteaddress);
 }
 
 inline UINT8 direct_read_data::read_decrypted_byte(offs_t byteaddress, offs_t directxor)
 {
-	if (address_is_valid(byteaddress))
+	if (read_is_valid(byteaddress))
 		return m_decrypted[(byteaddress ^ directxor) & m_bytemask];
 	return m_space.read_byte(byteaddress);
 }
@@ -1018,14 +1176,14 @@ inline UINT8 direct_read_data::read_decrypted_byte(offs_t byteaddress, offs_t di
 
 inline UINT16 direct_read_data::read_raw_word(offs_t byteaddress, offs_t directxor)
 {
-	if (address_is_valid(byteaddress))
+	if (read_is_valid(byteaddress))
 		return *reinterpret_cast<UINT16 *>(&m_raw[(byteaddress ^ directxor) & m_bytemask]);
 	return m_space.read_word(byteaddress);
 }
 
 inline UINT16 direct_read_data::read_decrypted_word(offs_t byteaddress, offs_t directxor)
 {
-	if (address_is_valid(byteaddress))
+	if (read_is_valid(byteaddress))
 		return *reinterpret_cast<UINT16 *>(&m_decrypted[(byteaddress ^ directxor) & m_bytemask]);
 	return m_space.read_word(byteaddress);
 }
@@ -1038,14 +1196,14 @@ inline UINT16 direct_read_data::read_decrypted_word(offs_t byteaddress, offs_t d
 
 inline UINT32 direct_read_data::read_raw_dword(offs_t byteaddress, offs_t directxor)
 {
-	if (address_is_valid(byteaddress))
+	if (read_is_valid(byteaddress))
 		return *reinterpret_cast<UINT32 *>(&m_raw[(byteaddress ^ directxor) & m_bytemask]);
 	return m_space.read_dword(byteaddress);
 }
 
 inline UINT32 direct_read_data::read_decrypted_dword(offs_t byteaddress, offs_t directxor)
 {
-	if (address_is_valid(byteaddress))
+	if (read_is_valid(byteaddress))
 		return *reinterpret_cast<UINT32 *>(&m_decrypted[(byteaddress ^ directxor) & m_bytemask]);
 	return m_space.read_dword(byteaddress);
 }
@@ -1058,14 +1216,14 @@ inline UINT32 direct_read_data::read_decrypted_dword(offs_t byteaddress, offs_t
 
 inline UINT64 direct_read_data::read_raw_qword(offs_t byteaddress, offs_t directxor)
 {
-	if (address_is_valid(byteaddress))
+	if (read_is_valid(byteaddress))
 		return *reinterpret_cast<UINT64 *>(&m_raw[(byteaddress ^ directxor) & m_bytemask]);
 	return m_space.read_qword(byteaddress);
 }
 
 inline UINT64 direct_read_data::read_decrypted_qword(offs_t byteaddress, offs_t directxor)
 {
-	if (address_is_valid(byteaddress))
+	if (read_is_valid(byteaddress))
 		return *reinterpret_cast<UINT64 *>(&m_decrypted[(byteaddress ^ directxor) & m_bytemask]);
 	return m_space.read_qword(byteaddress);
 }
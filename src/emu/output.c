@@ -19,6 +19,7 @@
 ***************************************************************************/
 
 #define HASH_SIZE		53
+#define MAX_INDEX		10000
 
 
 
@@ -35,7 +36,6 @@ struct _output_notify
 };
 
 
-typedef struct _output_item output_item;
 struct _output_item
 {
 	output_item *		next;			/* next item in list */
@@ -43,10 +43,21 @@ struct _output_item
 	UINT32				hash;			/* hash for this item name */
 	UINT32				id;				/* unique ID for this item */
 	INT32				value;			/* current value */
+	UINT8				pending;		/* TRUE until the first value is set */
 	output_notify *		notifylist;		/* list of notifier callbacks */
 };
 
 
+typedef struct _output_family output_family;
+struct _output_family
+{
+	output_family *		next;			/* next family in list */
+	const char *		basename;		/* base name shared by the indexed items */
+	output_item **		items;			/* items resolved so far, by index */
+	int					count;			/* number of entries in the items array */
+};
+
+
 
 /***************************************************************************
     GLOBAL VARIABLES
@@ -54,6 +65,7 @@ struct _output_item
 
 static output_item *itemtable[HASH_SIZE];
 static output_notify *global_notifylist;
+static output_family *familylist;
 static UINT32 uniqueid = 12345;
 
 
@@ -112,6 +124,43 @@ INLINE output_item *find_item(const char *string)
 }
 
 
+/*-------------------------------------------------
+    find_family - find the remembered handles for
+    an indexed basename
+-------------------------------------------------*/
+
+INLINE output_family *find_family(const char *basename)
+{
+	output_family *family;
+
+	for (family = familylist; family != NULL; family = family->next)
+		if (strcmp(family->basename, basename) == 0)
+			return family;
+
+	return NULL;
+}
+
+
+/*-------------------------------------------------
+    build_indexed_name - concatenate a basename
+    and an index into the given buffer
+-------------------------------------------------*/
+
+INLINE void build_indexed_name(char *dest, const char *basename, int index)
+{
+	/* copy the string */
+	while (*basename != 0)
+		*dest++ = *basename++;
+
+	/* append the index */
+	if (index >= 1000) *dest++ = '0' + ((index / 1000) % 10);
+	if (index >= 100) *dest++ = '0' + ((index / 100) % 10);
+	if (index >= 10) *dest++ = '0' + ((index / 10) % 10);
+	*dest++ = '0' + (index % 10);
+	*dest++ = 0;
+}
+
+
 /*-------------------------------------------------
     create_new_item - create a new item
 -------------------------------------------------*/
@@ -127,6 +176,7 @@ INLINE output_item *create_new_item(const char *outname, INT32 value)
 	item->hash = hash;
 	item->id = uniqueid++;
 	item->value = value;
+	item->pending = FALSE;
 	item->notifylist = NULL;
 
 	/* add us to the hash table */
@@ -156,6 +206,7 @@ void output_init(running_machine &machine)
 	/* reset the lists */
 	memset(itemtable, 0, sizeof(itemtable));
 	global_notifylist = NULL;
+	familylist = NULL;
 }
 
 
@@ -212,6 +263,17 @@ static void output_exit(running_machine &machine)
 		global_free(notify);
 		notify = next;
 	}
+
+	/* remove all indexed families */
+	while (familylist != NULL)
+	{
+		output_family *next = familylist->next;
+		global_free(familylist->basename);
+		if (familylist->items != NULL)
+			global_free(familylist->items);
+		global_free(familylist);
+		familylist = next;
+	}
 }
 
 
@@ -221,35 +283,7 @@ static void output_exit(running_machine &machine)
 
 void output_set_value(const char *outname, INT32 value)
 {
-	output_item *item = find_item(outname);
-	output_notify *notify;
-	INT32 oldval;
-
-	/* if no item of that name, create a new one and send the item's state */
-	if (item == NULL)
-	{
-		item = create_new_item(outname, value);
-		oldval = value + 1;
-	}
-
-	else
-	{
-		/* set the new value */
-		oldval = item->value;
-		item->value = value;
-	}
-
-	/* if the value is different, signal the notifier */
-	if (oldval != value)
-	{
-		/* call the local notifiers first */
-		for (notify = item->notifylist; notify != NULL; notify = notify->next)
-			(*notify->notifier)(outname, value, notify->param);
-
-		/* call the global notifiers next */
-		for (notify = global_notifylist; notify != NULL; notify = notify->next)
-			(*notify->notifier)(outname, value, notify->param);
-	}
+	output_set_item_value(output_get_item(outname), value);
 }
 
 
@@ -260,22 +294,7 @@ void output_set_value(const char *outname, INT32 value)
 
 void output_set_indexed_value(const char *basename, int index, int value)
 {
-	char buffer[100];
-	char *dest = buffer;
-
-	/* copy the string */
-	while (*basename != 0)
-		*dest++ = *basename++;
-
-	/* append the index */
-	if (index >= 1000) *dest++ = '0' + ((index / 1000) % 10);
-	if (index >= 100) *dest++ = '0' + ((index / 100) % 10);
-	if (index >= 10) *dest++ = '0' + ((index / 10) % 10);
-	*dest++ = '0' + (index % 10);
-	*dest++ = 0;
-
-	/* set the value */
-	output_set_value(buffer, value);
+	output_set_item_value(output_get_indexed_item(basename, index), value);
 }
 
 
@@ -302,21 +321,15 @@ INT32 output_get_value(const char *outname)
 
 INT32 output_get_indexed_value(const char *basename, int index)
 {
+	output_family *family = find_family(basename);
 	char buffer[100];
-	char *dest = buffer;
 
-	/* copy the string */
-	while (*basename != 0)
-		*dest++ = *basename++;
-
-	/* append the index */
-	if (index >= 1000) *dest++ = '0' + ((index / 1000) % 10);
-	if (index >= 100) *dest++ = '0' + ((index / 100) % 10);
-	if (index >= 10) *dest++ = '0' + ((index / 10) % 10);
-	*dest++ = '0' + (index % 10);
-	*dest++ = 0;
+	/* use the remembered handle if there is one */
+	if (family != NULL && index >= 0 && index < family->count && family->items[index] != NULL)
+		return family->items[index]->value;
 
-	/* set the value */
+	/* otherwise look it up by name; a query never creates the item */
+	build_indexed_name(buffer, basename, index);
 	return output_get_value(buffer);
 }
 
@@ -371,7 +384,8 @@ void output_notify_all(output_notifier_func callback, void *param)
 	/* remove all items */
 	for (hash = 0; hash < HASH_SIZE; hash++)
 		for (item = itemtable[hash]; item != NULL; item = item->next)
-			(*callback)(item->name, item->value, param);
+			if (!item->pending)
+				(*callback)(item->name, item->value, param);
 }
 
 
@@ -410,3 +424,144 @@ const char *output_id_to_name(UINT32 id)
 	/* nothing found, return NULL */
 	return NULL;
 }
+
+
+/*-------------------------------------------------
+    output_get_item - return a handle for the
+    given output, creating it if it doesn't exist
+-------------------------------------------------*/
+
+output_item *output_get_item(const char *outname)
+{
+	output_item *item = find_item(outname);
+
+	/* if no item of that name, create a new one; its first value will always be sent */
+	if (item == NULL)
+	{
+		item = create_new_item(outname, 0);
+		item->pending = TRUE;
+	}
+	return item;
+}
+
+
+/*-------------------------------------------------
+    output_get_indexed_item - return a handle for
+    an indexed output; handles are remembered per
+    basename so that repeated lookups avoid the
+    name hash
+-------------------------------------------------*/
+
+output_item *output_get_indexed_item(const char *basename, int index)
+{
+	output_family *family;
+	char buffer[100];
+
+	/* out-of-range indexes go through the name */
+	if (index < 0 || index >= MAX_INDEX)
+	{
+		build_indexed_name(buffer, basename, index);
+		return output_get_item(buffer);
+	}
+
+	/* find the family for this basename, creating it if needed */
+	family = find_family(basename);
+	if (family == NULL)
+	{
+		family = global_alloc(output_family);
+		family->next = familylist;
+		family->basename = copy_string(basename);
+		family->items = NULL;
+		family->count = 0;
+		familylist = family;
+	}
+
+	/* grow the items array to cover this index */
+	if (index >= family->count)
+	{
+		int newcount = MIN(MAX(index + 1, family->count * 2), MAX_INDEX);
+		output_item **newitems = global_alloc_array_clear(output_item *, newcount);
+		if (family->items != NULL)
+		{
+			memcpy(newitems, family->items, family->count * sizeof(newitems[0]));
+			global_free(family->items);
+		}
+		family->items = newitems;
+		family->count = newcount;
+	}
+
+	/* resolve the item the first time around */
+	if (family->items[index] == NULL)
+	{
+		build_indexed_name(buffer, basename, index);
+		family->items[index] = output_get_item(buffer);
+	}
+	return family->items[index];
+}
+
+
+/*-------------------------------------------------
+    output_set_item_value - set the value of an
+    output by handle
+-------------------------------------------------*/
+
+void output_set_item_value(output_item *item, INT32 value)
+{
+	output_notify *notify;
+
+	/* nothing to do if the value is unchanged */
+	if (item->value == value && !item->pending)
+		return;
+	item->value = value;
+	item->pending = FALSE;
+
+	/* call the local notifiers first */
+	for (notify = item->notifylist; notify != NULL; notify = notify->next)
+		(*notify->notifier)(item->name, value, notify->param);
+
+	/* call the global notifiers next */
+	for (notify = global_notifylist; notify != NULL; notify = notify->next)
+		(*notify->notifier)(item->name, value, notify->param);
+}
+
+
+/*-------------------------------------------------
+    output_get_item_value - return the value of an
+    output by handle
+-------------------------------------------------*/
+
+INT32 output_get_item_value(const output_item *item)
+{
+	return item->value;
+}
+
+
+/*-------------------------------------------------
+    output_set_item_values - set the values of a
+    group of outputs by handle
+-------------------------------------------------*/
+
+void output_set_item_values(output_item *const *items, const INT32 *values, int count)
+{
+	for (int itemnum = 0; itemnum < count; itemnum++)
+		if (items[itemnum]->value != values[itemnum] || items[itemnum]->pending)
+			output_set_item_value(items[itemnum], values[itemnum]);
+}
+
+
+/*-------------------------------------------------
+    output_set_indexed_bits - set a run of indexed
+    outputs from the bits of a mask, as used for
+    lamp and LED matrices
+-------------------------------------------------*/
+
+void output_set_indexed_bits(const char *basename, int firstindex, int count, UINT32 bits)
+{
+	for (int bitnum = 0; bitnum < count; bitnum++)
+	{
+		output_item *item = output_get_indexed_item(basename, firstindex + bitnum);
+		INT32 value = (bits >> bitnum) & 1;
+		if (item->value != value || item->pending)
+			output_set_item_value(item, value);
+	}
+}
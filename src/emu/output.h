@@ -25,6 +25,9 @@
 
 typedef void (*output_notifier_func)(const char *outname, INT32 value, void *param);
 
+/* opaque handle to a named output, valid until the machine exits */
+typedef struct _output_item output_item;
+
 
 
 /***************************************************************************
@@ -58,6 +61,24 @@ UINT32 output_name_to_id(const char *outname);
 /* map a unique ID back to a name */
 const char *output_id_to_name(UINT32 id);
 
+/* return a handle for a given output, creating it if needed */
+output_item *output_get_item(const char *outname);
+
+/* return a handle for an indexed output (basename + index), creating it if needed */
+output_item *output_get_indexed_item(const char *basename, int index);
+
+/* set the value of an output by handle; listeners are only notified of changes */
+void output_set_item_value(output_item *item, INT32 value);
+
+/* return the current value of an output by handle */
+INT32 output_get_item_value(const output_item *item);
+
+/* set the values of a group of outputs by handle */
+void output_set_item_values(output_item *const *items, const INT32 *values, int count);
+
+/* set count consecutive indexed outputs starting at firstindex to the low bits of a mask */
+void output_set_indexed_bits(const char *basename, int firstindex, int count, UINT32 bits);
+
 
 
 /***************************************************************************
@@ -79,6 +100,11 @@ INLINE void output_set_digit_value(int index, int value)
 	output_set_indexed_value("digit", index, value);
 }
 
+INLINE void output_set_lamp_bits(int firstindex, int count, UINT32 bits)
+{
+	output_set_indexed_bits("lamp", firstindex, count, bits);
+}
+
 
 INLINE INT32 output_get_led_value(int index)
 {
@@ -126,6 +126,23 @@ struct object_transform
 };
 
 
+// a cached element item primitive, along with everything that went into it
+struct render_target::item_cache_entry
+{
+	layout_element *	element;			// element the primitive was generated from
+	int					state;				// element state
+	int					blendmode;			// blend mode
+	object_transform	xform;				// item transform
+	bool				clipped;			// true if no primitive was generated
+	void *				refptr;				// object referenced by the primitive
+	render_bounds		bounds;				// primitive bounds
+	render_color		color;				// primitive color
+	UINT32				flags;				// primitive flags
+	render_texinfo		texture;			// primitive texture info
+	render_quad_texuv	texcoords;			// primitive texture coordinates
+};
+
+
 
 //**************************************************************************
 //  GLOBAL VARIABLES
@@ -366,7 +383,13 @@ render_texture::render_texture()
 	  m_bcglookup_entries(0),
 	  m_scaler(NULL),
 	  m_param(NULL),
-	  m_curseq(0)
+	  m_curseq(0),
+	  m_dirty_tracked(false),
+	  m_content_seq(0),
+	  m_prev_content_seq(0),
+	  m_dirty_miny(0),
+	  m_dirty_maxy(-1),
+	  m_palclient(NULL)
 {
 	m_sbounds.set(0, -1, 0, -1);
 	memset(m_scaled, 0, sizeof(m_scaled));
@@ -422,6 +445,13 @@ void render_texture::release()
 	m_format = TEXFORMAT_ARGB32;
 	m_curseq = 0;
 
+	// forget about any change tracking
+	m_dirty_tracked = false;
+	m_content_seq = m_prev_content_seq = 0;
+	if (m_palclient != NULL)
+		palette_client_free(m_palclient);
+	m_palclient = NULL;
+
 	// free any B/C/G lookup tables
 	auto_free(m_manager->machine(), m_bcglookup);
 	m_bcglookup = NULL;
@@ -445,6 +475,14 @@ void render_texture::set_bitmap(bitmap_t &bitmap, const rectangle &sbounds, text
 	if (&bitmap != m_bitmap && m_bitmap != NULL)
 		m_manager->invalidate_all(m_bitmap);
 
+	// the contents changed; only a change from the same source region can be described by rows
+	bool samesource = (&bitmap == m_bitmap && format == m_format && sbounds.min_x == m_sbounds.min_x && sbounds.max_x == m_sbounds.max_x &&
+						sbounds.min_y == m_sbounds.min_y && sbounds.max_y == m_sbounds.max_y);
+	m_prev_content_seq = samesource ? m_content_seq : 0;
+	m_content_seq = m_curseq + 1;
+	m_dirty_miny = 0;
+	m_dirty_maxy = sbounds.height() - 1;
+
 	// set the new bitmap/palette
 	m_bitmap = &bitmap;
 	m_sbounds = sbounds;
@@ -464,6 +502,74 @@ void render_texture::set_bitmap(bitmap_t &bitmap, const rectangle &sbounds, text
 }
 
 
+//-------------------------------------------------
+//  set_dirty_rows - narrow down the change made
+//  by the last set_bitmap to a range of rows;
+//  owners that call this promise to call
+//  set_bitmap whenever the contents change
+//-------------------------------------------------
+
+void render_texture::set_dirty_rows(INT32 miny, INT32 maxy)
+{
+	m_dirty_tracked = true;
+	m_dirty_miny = MAX(miny, m_sbounds.min_y) - m_sbounds.min_y;
+	m_dirty_maxy = MIN(maxy, m_sbounds.max_y) - m_sbounds.min_y;
+
+	// palette changes affect every row, so watch for them
+	palette_t *palette = (m_format == TEXFORMAT_PALETTE16 || m_format == TEXFORMAT_PALETTEA16) ? m_bitmap->palette() : NULL;
+	if (m_palclient != NULL && palette_client_get_palette(m_palclient) != palette)
+	{
+		palette_client_free(m_palclient);
+		m_palclient = NULL;
+	}
+	if (m_palclient == NULL && palette != NULL)
+		m_palclient = palette_client_alloc(palette);
+}
+
+
+//-------------------------------------------------
+//  palette_changed - fold a palette change into
+//  the changed rows; only rows that use one of
+//  the dirty entries need converting again
+//-------------------------------------------------
+
+void render_texture::palette_changed(UINT32 seqid, const UINT32 *dirty, UINT32 mindirty, UINT32 maxdirty)
+{
+	// find the first and last rows that use a dirty entry
+	INT32 height = m_sbounds.height();
+	INT32 width = m_sbounds.width();
+	INT32 miny, maxy;
+	for (miny = 0; miny < height; miny++)
+		if (palette_row_uses_dirty((UINT16 *)m_bitmap->raw_pixptr(m_sbounds.min_y + miny, m_sbounds.min_x), width, dirty, mindirty, maxdirty))
+			break;
+	for (maxy = height - 1; maxy > miny; maxy--)
+		if (palette_row_uses_dirty((UINT16 *)m_bitmap->raw_pixptr(m_sbounds.min_y + maxy, m_sbounds.min_x), width, dirty, mindirty, maxdirty))
+			break;
+
+	// nothing on screen uses the changed entries
+	if (miny >= height)
+		return;
+
+	// if the contents were just replaced, widen the band they already report;
+	// otherwise the palette alone made new contents
+	if (m_content_seq == seqid)
+	{
+		if (m_dirty_miny <= m_dirty_maxy)
+		{
+			miny = MIN(miny, m_dirty_miny);
+			maxy = MAX(maxy, m_dirty_maxy);
+		}
+	}
+	else
+	{
+		m_prev_content_seq = m_content_seq;
+		m_content_seq = seqid;
+	}
+	m_dirty_miny = miny;
+	m_dirty_maxy = maxy;
+}
+
+
 //-------------------------------------------------
 //  hq_scale - generic high quality resampling
 //  scaler
@@ -481,7 +587,7 @@ void render_texture::hq_scale(bitmap_argb32 &dest, bitmap_argb32 &source, const
 //  get_scaled - get a scaled bitmap (if we can)
 //-------------------------------------------------
 
-bool render_texture::get_scaled(UINT32 dwidth, UINT32 dheight, render_texinfo &texinfo, render_primitive_list &primlist)
+bool render_texture::get_scaled(UINT32 dwidth, UINT32 dheight, render_texinfo &texinfo, render_primitive_list &primlist, void **refptr)
 {
 	// source width/height come from the source bounds
 	int swidth = m_sbounds.width();
@@ -497,12 +603,28 @@ bool render_texture::get_scaled(UINT32 dwidth, UINT32 dheight, render_texinfo &t
 	{
 		// add a reference and set up the source bitmap
 		primlist.add_reference(m_bitmap);
+		if (refptr != NULL)
+			*refptr = m_bitmap;
 		texinfo.base = m_bitmap->raw_pixptr(m_sbounds.min_y, m_sbounds.min_x);
 		texinfo.rowpixels = m_bitmap->rowpixels();
 		texinfo.width = swidth;
 		texinfo.height = sheight;
 		texinfo.palette = palbase;
 		texinfo.seqid = ++m_curseq;
+
+		// report what changed since the previous contents, if our owner tells us
+		texinfo.content_seqid = texinfo.prev_seqid = 0;
+		if (m_dirty_tracked)
+		{
+			UINT32 mindirty, maxdirty;
+			const UINT32 *dirty = (m_palclient != NULL) ? palette_client_get_dirty_list(m_palclient, &mindirty, &maxdirty) : NULL;
+			if (dirty != NULL)
+				palette_changed(texinfo.seqid, dirty, mindirty, maxdirty);
+			texinfo.content_seqid = m_content_seq;
+			texinfo.prev_seqid = m_prev_content_seq;
+			texinfo.dirty_miny = m_dirty_miny;
+			texinfo.dirty_maxy = m_dirty_maxy;
+		}
 		return true;
 	}
 
@@ -551,12 +673,15 @@ bool render_texture::get_scaled(UINT32 dwidth, UINT32 dheight, render_texinfo &t
 
 	// finally fill out the new info
 	primlist.add_reference(scaled->bitmap);
+	if (refptr != NULL)
+		*refptr = scaled->bitmap;
 	texinfo.base = &scaled->bitmap->pix32(0);
 	texinfo.rowpixels = scaled->bitmap->rowpixels();
 	texinfo.width = dwidth;
 	texinfo.height = dheight;
 	texinfo.palette = palbase;
 	texinfo.seqid = scaled->seqid;
+	texinfo.content_seqid = texinfo.prev_seqid = 0;
 	return true;
 }
 
@@ -984,7 +1109,11 @@ render_target::render_target(render_manager &manager, const char *layoutfile, UI
 	  m_base_orientation(ROT0),
 	  m_maxtexwidth(65536),
 	  m_maxtexheight(65536),
-	  m_debug_containers(manager.machine().respool())
+	  m_wants_dirty_rows(false),
+	  m_debug_containers(manager.machine().respool()),
+	  m_item_cache(NULL),
+	  m_item_cache_size(0),
+	  m_item_cache_valid(-1)
 {
 	// determine the base layer configuration based on options
 	m_base_layerconfig.set_backdrops_enabled(manager.machine().options().use_backdrops());
@@ -1033,6 +1162,7 @@ render_target::render_target(render_manager &manager, const char *layoutfile, UI
 
 render_target::~render_target()
 {
+	auto_free(m_manager.machine(), m_item_cache);
 	auto_free(m_manager.machine(), &m_filelist);
 }
 
@@ -1071,6 +1201,7 @@ void render_target::set_bounds(INT32 width, INT32 height, float pixel_aspect)
 	m_bounds.x1 = (float)width;
 	m_bounds.y1 = (float)height;
 	m_pixel_aspect = pixel_aspect;
+	invalidate_item_cache();
 }
 
 
@@ -1086,6 +1217,7 @@ void render_target::set_view(int viewindex)
 	{
 		m_curview = view;
 		view->recompute(m_layerconfig);
+		invalidate_item_cache();
 	}
 }
 
@@ -1099,6 +1231,7 @@ void render_target::set_max_texture_size(int maxwidth, int maxheight)
 {
 	m_maxtexwidth = maxwidth;
 	m_maxtexheight = maxheight;
+	invalidate_item_cache();
 }
 
 
@@ -1348,6 +1481,7 @@ render_primitive_list &render_target::get_primitives()
     root_xform.no_center = false;
 
 	// iterate over layers back-to-front, but only if we're running
+	int itemnum = 0;
 	if (m_manager.machine().phase() >= MACHINE_PHASE_RESET)
 		for (item_layer layernum = ITEM_LAYER_FIRST; layernum < ITEM_LAYER_MAX; layernum++)
 		{
@@ -1380,7 +1514,7 @@ render_primitive_list &render_target::get_primitives()
 					if (curitem->screen() != NULL)
 						add_container_primitives(list, item_xform, curitem->screen()->container(), blendmode);
 					else
-						add_element_primitives(list, item_xform, *curitem->element(), curitem->state(), blendmode);
+						add_cached_element_primitives(list, item_xform, *curitem->element(), curitem->state(), blendmode, itemnum++);
 				}
 			}
 		}
@@ -1406,6 +1540,9 @@ render_primitive_list &render_target::get_primitives()
 		}
 	}
 
+	// cached entries are only valid up to the number of element items this frame
+	m_item_cache_valid = itemnum;
+
 	// process the debug containers
 	for (render_container *debug = m_debug_containers.first(); debug != NULL; debug = debug->next())
 	{
@@ -1481,6 +1618,11 @@ bool render_target::map_point_input(INT32 target_x, INT32 target_y, const char *
 
 void render_target::invalidate_all(void *refptr)
 {
+	// forget any cached primitives that reference this object
+	for (int itemnum = 0; itemnum < m_item_cache_size; itemnum++)
+		if (m_item_cache[itemnum].refptr == refptr)
+			m_item_cache[itemnum].element = NULL;
+
 	// iterate through all our primitive lists
 	for (int listnum = 0; listnum < ARRAY_LENGTH(m_primlist); listnum++)
 	{
@@ -1535,6 +1677,7 @@ void render_target::debug_top(render_container &container)
 void render_target::update_layer_config()
 {
 	m_curview->recompute(m_layerconfig);
+	invalidate_item_cache();
 }
 
 
@@ -1790,8 +1933,14 @@ void render_target::add_container_primitives(render_primitive_list &list, const
 					height = MIN(height, m_maxtexheight);
 					if (curitem->texture()->get_scaled(width, height, prim->texture, list))
 					{
-						// set the palette
+						// set the palette; user adjustments can change it without notice, so
+						// don't let the OSD rely on previous contents while there are any
 						prim->texture.palette = curitem->texture()->get_adjusted_palette(container);
+						if (container.has_brightness_contrast_gamma_changes())
+						{
+							prim->texture.content_seqid = prim->texture.prev_seqid = 0;
+							curitem->texture()->restart_content_tracking();
+						}
 
 						// determine UV coordinates and apply clipping
 						prim->texcoords = oriented_texcoords[finalorient];
@@ -1864,7 +2013,7 @@ void render_target::add_container_primitives(render_primitive_list &list, const
 //  for an element in the current state
 //-------------------------------------------------
 
-void render_target::add_element_primitives(render_primitive_list &list, const object_transform &xform, layout_element &element, int state, int blendmode)
+void render_target::add_element_primitives(render_primitive_list &list, const object_transform &xform, layout_element &element, int state, int blendmode, void **refptr)
 {
 	// if we're out of range, bail
 	if (state > element.maxstate())
@@ -1893,7 +2042,7 @@ void render_target::add_element_primitives(render_primitive_list &list, const ob
 
 		// get the scaled texture and append it
 		bool clipped = true;
-		if (texture->get_scaled(width, height, prim->texture, list))
+		if (texture->get_scaled(width, height, prim->texture, list, refptr))
 		{
 			// compute the clip rect
 			render_bounds cliprect;
@@ -1914,6 +2063,72 @@ void render_target::add_element_primitives(render_primitive_list &list, const ob
 }
 
 
+//-------------------------------------------------
+//  add_cached_element_primitives - add the
+//  primitive for a layout element item, reusing
+//  the one from the previous frame if nothing
+//  that went into it has changed
+//-------------------------------------------------
+
+void render_target::add_cached_element_primitives(render_primitive_list &list, const object_transform &xform, layout_element &element, int state, int blendmode, int itemnum)
+{
+	// grow the cache as needed
+	if (itemnum >= m_item_cache_size)
+	{
+		int newsize = MAX(m_item_cache_size * 2, 64);
+		item_cache_entry *newcache = auto_alloc_array_clear(m_manager.machine(), item_cache_entry, newsize);
+		if (m_item_cache != NULL)
+			memcpy(newcache, m_item_cache, m_item_cache_size * sizeof(newcache[0]));
+		auto_free(m_manager.machine(), m_item_cache);
+		m_item_cache = newcache;
+		m_item_cache_size = newsize;
+	}
+	item_cache_entry &entry = m_item_cache[itemnum];
+	bool valid = (itemnum < m_item_cache_valid);
+
+	// if everything matches, just copy the previous primitive
+	if (valid && entry.element == &element && entry.state == state && entry.blendmode == blendmode &&
+		entry.xform.xoffs == xform.xoffs && entry.xform.yoffs == xform.yoffs &&
+		entry.xform.xscale == xform.xscale && entry.xform.yscale == xform.yscale &&
+		entry.xform.color.r == xform.color.r && entry.xform.color.g == xform.color.g &&
+		entry.xform.color.b == xform.color.b && entry.xform.color.a == xform.color.a &&
+		entry.xform.orientation == xform.orientation)
+	{
+		if (!entry.clipped)
+		{
+			render_primitive *prim = list.alloc(render_primitive::QUAD);
+			prim->bounds = entry.bounds;
+			prim->color = entry.color;
+			prim->flags = entry.flags;
+			prim->texture = entry.texture;
+			prim->texcoords = entry.texcoords;
+			list.add_reference(entry.refptr);
+			list.append(*prim);
+		}
+		return;
+	}
+
+	// generate a new primitive and remember it
+	render_primitive *last = list.m_primlist.last();
+	entry.refptr = NULL;
+	add_element_primitives(list, xform, element, state, blendmode, &entry.refptr);
+	render_primitive *prim = list.m_primlist.last();
+	entry.element = &element;
+	entry.state = state;
+	entry.blendmode = blendmode;
+	entry.xform = xform;
+	entry.clipped = (prim == last);
+	if (!entry.clipped)
+	{
+		entry.bounds = prim->bounds;
+		entry.color = prim->color;
+		entry.flags = prim->flags;
+		entry.texture = prim->texture;
+		entry.texcoords = prim->texcoords;
+	}
+}
+
+
 //-------------------------------------------------
 //  map_point_internal - internal logic for
 //  mapping points
@@ -2481,6 +2696,21 @@ bool render_manager::is_live(screen_device &screen) const
 }
 
 
+//-------------------------------------------------
+//  wants_dirty_rows - return true if any live
+//  target showing the given screen has a renderer
+//  that uploads only the changed rows
+//-------------------------------------------------
+
+bool render_manager::wants_dirty_rows(screen_device &screen) const
+{
+	for (render_target *target = m_targetlist.first(); target != NULL; target = target->next())
+		if (!target->hidden() && target->wants_dirty_rows() && target->view_screens(target->view()).contains(screen))
+			return true;
+	return false;
+}
+
+
 //-------------------------------------------------
 //  max_update_rate - return the smallest maximum
 //  update rate across all targets
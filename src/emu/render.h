@@ -233,6 +233,29 @@ struct render_texinfo
 	UINT32				height;				// height of the image
 	const rgb_t *		palette;			// palette for PALETTE16 textures, LUTs for RGB15/RGB32
 	UINT32				seqid;				// sequence ID
+	UINT32				content_seqid;		// first sequence ID with the current contents, or 0 if unknown
+	UINT32				prev_seqid;			// first sequence ID with the previous contents, or 0 if unknown
+	INT32				dirty_miny;			// first row that differs from the previous contents
+	INT32				dirty_maxy;			// last row that differs from the previous contents
+
+	// given the sequence ID a copy of this texture was last refreshed from, compute the
+	// range of rows that need refreshing; returns false if the whole texture does
+	bool dirty_rows(UINT32 lastseqid, INT32 &miny, INT32 &maxy) const
+	{
+		if (content_seqid != 0 && lastseqid >= content_seqid && lastseqid < seqid)
+		{
+			miny = 0;
+			maxy = -1;
+			return true;
+		}
+		if (prev_seqid != 0 && lastseqid >= prev_seqid && lastseqid < content_seqid)
+		{
+			miny = dirty_miny;
+			maxy = dirty_maxy;
+			return true;
+		}
+		return false;
+	}
 };
 
 
@@ -434,6 +457,12 @@ class render_texture
 	// release resources when freed
 	void release();
 
+	// treat the contents as changed from the next sequence number on
+	void restart_content_tracking() { m_content_seq = m_curseq + 1; m_prev_content_seq = 0; }
+
+	// fold a palette change into the changed rows
+	void palette_changed(UINT32 seqid, const UINT32 *dirty, UINT32 mindirty, UINT32 maxdirty);
+
 public:
 	// getters
 	int format() const { return m_format; }
@@ -441,12 +470,15 @@ public:
 	// configure the texture bitmap
 	void set_bitmap(bitmap_t &bitmap, const rectangle &sbounds, texture_format format);
 
+	// after set_bitmap, report that only the given bitmap rows changed since the previous set_bitmap
+	void set_dirty_rows(INT32 miny, INT32 maxy);
+
 	// generic high-quality bitmap scaler
 	static void hq_scale(bitmap_argb32 &dest, bitmap_argb32 &source, const rectangle &sbounds, void *param);
 
 private:
 	// internal helpers
-	bool get_scaled(UINT32 dwidth, UINT32 dheight, render_texinfo &texinfo, render_primitive_list &primlist);
+	bool get_scaled(UINT32 dwidth, UINT32 dheight, render_texinfo &texinfo, render_primitive_list &primlist, void **refptr = NULL);
 	const rgb_t *get_adjusted_palette(render_container &container);
 
 	static const int MAX_TEXTURE_SCALES = 8;
@@ -472,6 +504,14 @@ private:
 	void *				m_param;					// scaling callback parameter
 	UINT32				m_curseq;					// current sequence number
 	scaled_texture		m_scaled[MAX_TEXTURE_SCALES];// array of scaled variants of this texture
+
+	// change tracking (unscaled only)
+	bool				m_dirty_tracked;			// true if the owner reports changed rows
+	UINT32				m_content_seq;				// first sequence number with the current contents
+	UINT32				m_prev_content_seq;			// first sequence number with the previous contents
+	INT32				m_dirty_miny;				// first changed row, relative to m_sbounds
+	INT32				m_dirty_maxy;				// last changed row, relative to m_sbounds
+	palette_client *	m_palclient;				// palette client to detect palette changes
 };
 
 
@@ -619,15 +659,17 @@ public:
 	render_layer_config layer_config() const { return m_layerconfig; }
 	int view() const { return view_index(*m_curview); }
 	bool hidden() const { return ((m_flags & RENDER_CREATE_HIDDEN) != 0); }
+	bool wants_dirty_rows() const { return m_wants_dirty_rows; }
 	bool is_ui_target() const;
 	int index() const;
 
 	// setters
 	void set_bounds(INT32 width, INT32 height, float pixel_aspect = 0);
 	void set_max_update_rate(float updates_per_second) { m_max_refresh = updates_per_second; }
-	void set_orientation(int orientation) { m_orientation = orientation; }
+	void set_orientation(int orientation) { m_orientation = orientation; invalidate_item_cache(); }
 	void set_view(int viewindex);
 	void set_max_texture_size(int maxwidth, int maxheight);
+	void set_wants_dirty_rows(bool wants) { m_wants_dirty_rows = wants; }
 
 	// layer config getters
 	bool backdrops_enabled() const { return m_layerconfig.backdrops_enabled(); }
@@ -679,7 +721,9 @@ private:
 	void load_layout_files(const char *layoutfile, bool singlefile);
 	bool load_layout_file(const char *dirname, const char *filename);
 	void add_container_primitives(render_primitive_list &list, const object_transform &xform, render_container &container, int blendmode);
-	void add_element_primitives(render_primitive_list &list, const object_transform &xform, layout_element &element, int state, int blendmode);
+	void add_element_primitives(render_primitive_list &list, const object_transform &xform, layout_element &element, int state, int blendmode, void **refptr = NULL);
+	void add_cached_element_primitives(render_primitive_list &list, const object_transform &xform, layout_element &element, int state, int blendmode, int itemnum);
+	void invalidate_item_cache() { m_item_cache_valid = 0; }
 	bool map_point_internal(INT32 target_x, INT32 target_y, render_container *container, float &mapped_x, float &mapped_y, const char *&mapped_input_tag, ioport_value &mapped_input_mask);
 
 	// config callbacks
@@ -700,6 +744,10 @@ private:
 	static const int NUM_PRIMLISTS = 3;
 	static const int MAX_CLEAR_EXTENTS = 1000;
 
+	// an item_cache_entry remembers the primitive generated for a layout element
+	// item, so that it can be reused for as long as the item is unchanged
+	struct item_cache_entry;
+
 	// internal state
 	render_target *			m_next;						// link to next target
 	render_manager &		m_manager;					// reference to our owning manager
@@ -720,9 +768,13 @@ private:
 	render_layer_config		m_base_layerconfig;			// the layer configuration at the time of first frame
 	int						m_maxtexwidth;				// maximum width of a texture
 	int						m_maxtexheight;				// maximum height of a texture
+	bool					m_wants_dirty_rows;			// does the OSD renderer use render_texinfo::dirty_rows?
 	simple_list<render_container> m_debug_containers;	// list of debug containers
 	INT32					m_clear_extent_count;		// number of clear extents
 	INT32					m_clear_extents[MAX_CLEAR_EXTENTS]; // array of clear extents
+	item_cache_entry *		m_item_cache;				// cached primitives for element items
+	int						m_item_cache_size;			// number of allocated cache entries
+	int						m_item_cache_valid;			// number of entries filled in by the previous frame
 
 	static const render_screen_list s_empty_screen_list;
 };
@@ -745,6 +797,7 @@ public:
 
 	// global queries
 	bool is_live(screen_device &screen) const;
+	bool wants_dirty_rows(screen_device &screen) const;
 	float max_update_rate() const;
 
 	// targets
@@ -2146,6 +2146,7 @@ void layout_view::recompute(render_layer_config layerconfig)
 layout_view::item::item(running_machine &machine, xml_data_node &itemnode, simple_list<layout_element> &elemlist)
 	: m_next(NULL),
 	  m_element(NULL),
+	  m_output(NULL),
 	  m_input_mask(0),
 	  m_screen(NULL),
 	  m_orientation(ROT0)
@@ -2179,7 +2180,10 @@ layout_view::item::item(running_machine &machine, xml_data_node &itemnode, simpl
 	}
 	m_input_mask = xml_get_attribute_int_with_subst(machine, itemnode, "inputmask", 0);
 	if (m_output_name[0] != 0 && m_element != NULL)
-		output_set_value(m_output_name, m_element->default_state());
+	{
+		m_output = output_get_item(m_output_name);
+		output_set_item_value(m_output, m_element->default_state());
+	}
 	parse_bounds(machine, xml_get_sibling(itemnode.child, "bounds"), m_rawbounds);
 	parse_color(machine, xml_get_sibling(itemnode.child, "color"), m_color);
 	parse_orientation(machine, xml_get_sibling(itemnode.child, "orientation"), m_orientation);
@@ -2218,8 +2222,8 @@ int layout_view::item::state() const
 	assert(m_element != NULL);
 
 	// if configured to an output, fetch the output value
-	if (m_output_name[0] != 0)
-		state = output_get_value(m_output_name);
+	if (m_output != NULL)
+		state = output_get_item_value(m_output);
 
 	// if configured to an input, fetch the input value
 	else if (m_input_tag[0] != 0)
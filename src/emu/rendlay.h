@@ -244,6 +244,7 @@ public:
 		item *				m_next;				// link to next item
 		layout_element *	m_element;			// pointer to the associated element (non-screens only)
 		astring				m_output_name;		// name of this item
+		output_item *		m_output;			// handle to the output, if bound to one
 		astring				m_input_tag;		// input tag of this item
 		ioport_value		m_input_mask;		// input mask of this item
 		screen_device *		m_screen;			// pointer to screen
@@ -357,6 +357,27 @@ UINT32 save_manager::signature() const
 }
 
 
+//-------------------------------------------------
+//  state_hash - compute a CRC over the current
+//  contents of all registered state, optionally
+//  only of entries whose names contain 'filter';
+//  the pre-save functions are not called, since
+//  some of them have side effects (flushing disks,
+//  updating streams) that would make a hashed run
+//  differ from a plain one
+//-------------------------------------------------
+
+UINT32 save_manager::state_hash(const char *filter) const
+{
+	// the data is hashed in native byte order
+	UINT32 crc = 0;
+	for (state_entry *entry = m_entry_list.first(); entry != NULL; entry = entry->next())
+		if (filter == NULL || filter[0] == 0 || strstr(entry->m_name.cstr(), filter) != NULL)
+			crc = crc32(crc, (UINT8 *)entry->m_data, entry->m_typesize * entry->m_typecount);
+	return crc;
+}
+
+
 //-------------------------------------------------
 //  dump_registry - dump the registry to the
 //  logfile
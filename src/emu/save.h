@@ -132,6 +132,8 @@ public:
 	running_machine &machine() const { return m_machine; }
 	int registration_count() const { return m_entry_list.count(); }
 	bool registration_allowed() const { return m_reg_allowed; }
+	UINT32 signature() const;
+	UINT32 state_hash(const char *filter = NULL) const;
 
 	// registration control
 	void allow_registration(bool allowed = true);
@@ -190,7 +192,6 @@ public:
 
 private:
 	// internal helpers
-	UINT32 signature() const;
 	void dump_registry() const;
 	static save_error validate_header(const UINT8 *header, const char *gamename, UINT32 signature, void (CLIB_DECL *errormsg)(const char *fmt, ...), const char *error_prefix);
 
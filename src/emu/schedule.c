@@ -341,9 +341,9 @@ void emu_timer::dump() const
 device_scheduler::device_scheduler(running_machine &machine) :
 	m_machine(machine),
 	m_executing_device(NULL),
+	m_executing_target(attotime::zero),
 	m_execute_list(NULL),
 	m_basetime(attotime::zero),
-//  m_cothread(co_active()),
 	m_timer_list(NULL),
 	m_timer_allocator(machine.respool()),
 	m_callback_timer(NULL),
@@ -462,60 +462,12 @@ void device_scheduler::timeslice()
 			// only process if our target is later than the CPU's current time (coarse check)
 			if (target.seconds >= exec->m_localtime.seconds)
 			{
-				// compute how many attoseconds to execute this CPU
-				attoseconds_t delta = target.attoseconds - exec->m_localtime.attoseconds;
-				if (delta < 0 && target.seconds > exec->m_localtime.seconds)
-					delta += ATTOSECONDS_PER_SECOND;
-				assert(delta == (target - exec->m_localtime).as_attoseconds());
-
-				// if we have enough for at least 1 cycle, do the math
-				if (delta >= exec->m_attoseconds_per_cycle)
+				// if the new local CPU time is less than our target, move the target up, but not before the base
+				if (execute_device(*exec, target, call_debugger) && exec->m_localtime < target)
 				{
-					// compute how many cycles we want to execute
-					int ran = exec->m_cycles_running = divu_64x32((UINT64)delta >> exec->m_divshift, exec->m_divisor);
-					LOG(("  cpu '%s': %d cycles\n", exec->device().tag(), exec->m_cycles_running));
-
-					// if we're not suspended, actually execute
-					if (exec->m_suspend == 0)
-					{
-						g_profiler.start(exec->m_profiler);
-
-						// note that this global variable cycles_stolen can be modified
-						// via the call to cpu_execute
-						exec->m_cycles_stolen = 0;
-						m_executing_device = exec;
-						*exec->m_icountptr = exec->m_cycles_running;
-						if (!call_debugger)
-							exec->run();
-						else
-						{
-							debugger_start_cpu_hook(&exec->device(), target);
-							exec->run();
-							debugger_stop_cpu_hook(&exec->device());
-						}
-
-						// adjust for any cycles we took back
-						assert(ran >= *exec->m_icountptr);
-						ran -= *exec->m_icountptr;
-						assert(ran >= exec->m_cycles_stolen);
-						ran -= exec->m_cycles_stolen;
-						g_profiler.stop();
-					}
-
-					// account for these cycles
-					exec->m_totalcycles += ran;
-
-					// update the local time for this CPU
-					exec->m_localtime += attotime(0, exec->m_attoseconds_per_cycle * ran);
-					LOG(("         %d ran, %d total, time = %s\n", ran, (INT32)exec->m_totalcycles, exec->m_localtime.as_string()));
-
-					// if the new local CPU time is less than our target, move the target up, but not before the base
-					if (exec->m_localtime < target)
-					{
-						assert(exec->m_localtime < target);
-						target = max(exec->m_localtime, m_basetime);
-						LOG(("         (new target)\n"));
-					}
+					assert(exec->m_localtime < target);
+					target = max(exec->m_localtime, m_basetime);
+					LOG(("         (new target)\n"));
 				}
 			}
 		}
@@ -527,6 +479,45 @@ void device_scheduler::timeslice()
 }
 
 
+//-------------------------------------------------
+//  catch_up - bring every other catch-up device
+//  up to the local time of the executing one;
+//  call this before a catch-up device touches a
+//  resource shared with the others
+//-------------------------------------------------
+
+void device_scheduler::catch_up()
+{
+	// only devices running on their own cothread need this
+	device_execute_interface *requester = m_executing_device;
+	if (requester == NULL || requester->m_cothread == NULL)
+		return;
+
+	// a device that is mid-run is always ahead of us, so only those idle and behind need to run
+	bool call_debugger = ((machine().debug_flags & DEBUG_FLAG_ENABLED) != 0);
+	attotime requester_target = m_executing_target;
+	attotime target = requester->local_time();
+	bool handed_off = false;
+	for (device_execute_interface *exec = m_execute_list; exec != NULL; exec = exec->m_nextexec)
+		if (exec != requester && exec->m_cothread != NULL && exec->m_cothread_caller == NULL && exec->m_suspend == 0 && exec->m_localtime < target)
+		{
+			// the debugger follows one live device at a time, so hand it over for the catch-up run
+			if (call_debugger && !handed_off)
+			{
+				debugger_stop_cpu_hook(&requester->device());
+				handed_off = true;
+			}
+			execute_device(*exec, target, call_debugger);
+		}
+
+	// the requester carries on from where it was
+	m_executing_device = requester;
+	m_executing_target = requester_target;
+	if (handed_off)
+		debugger_start_cpu_hook(&requester->device(), requester_target);
+}
+
+
 //-------------------------------------------------
 //  abort_timeslice - abort execution for the
 //  current timeslice
@@ -699,6 +690,66 @@ void device_scheduler::postload()
 }
 
 
+//-------------------------------------------------
+//  execute_device - run a device from its local
+//  time up to the target; returns false if the
+//  target was less than a cycle away
+//-------------------------------------------------
+
+bool device_scheduler::execute_device(device_execute_interface &exec, attotime target, bool call_debugger)
+{
+	// compute how many attoseconds to execute this CPU
+	attoseconds_t delta = target.attoseconds - exec.m_localtime.attoseconds;
+	if (delta < 0 && target.seconds > exec.m_localtime.seconds)
+		delta += ATTOSECONDS_PER_SECOND;
+	assert(delta == (target - exec.m_localtime).as_attoseconds());
+
+	// if we don't have enough for at least 1 cycle, do nothing
+	if (delta < exec.m_attoseconds_per_cycle)
+		return false;
+
+	// compute how many cycles we want to execute
+	int ran = exec.m_cycles_running = divu_64x32((UINT64)delta >> exec.m_divshift, exec.m_divisor);
+	LOG(("  cpu '%s': %d cycles\n", exec.device().tag(), exec.m_cycles_running));
+
+	// if we're not suspended, actually execute
+	if (exec.m_suspend == 0)
+	{
+		g_profiler.start(exec.m_profiler);
+
+		// note that this global variable cycles_stolen can be modified
+		// via the call to cpu_execute
+		exec.m_cycles_stolen = 0;
+		m_executing_device = &exec;
+		m_executing_target = target;
+		*exec.m_icountptr = exec.m_cycles_running;
+		if (!call_debugger)
+			exec.run();
+		else
+		{
+			debugger_start_cpu_hook(&exec.device(), target);
+			exec.run();
+			debugger_stop_cpu_hook(&exec.device());
+		}
+
+		// adjust for any cycles we took back
+		assert(ran >= *exec.m_icountptr);
+		ran -= *exec.m_icountptr;
+		assert(ran >= exec.m_cycles_stolen);
+		ran -= exec.m_cycles_stolen;
+		g_profiler.stop();
+	}
+
+	// account for these cycles
+	exec.m_totalcycles += ran;
+
+	// update the local time for this CPU
+	exec.m_localtime += attotime(0, exec.m_attoseconds_per_cycle * ran);
+	LOG(("         %d ran, %d total, time = %s\n", ran, (INT32)exec.m_totalcycles, exec.m_localtime.as_string()));
+	return true;
+}
+
+
 //-------------------------------------------------
 //  compute_perfect_interleave - compute the
 //  "perfect" interleave interval
@@ -165,7 +165,7 @@ public:
 	void abort_timeslice();
 	void trigger(int trigid, attotime after = attotime::zero);
 	void boost_interleave(attotime timeslice_time, attotime boost_duration);
-//  void make_active() { m_cothread.make_active(); }
+	void catch_up();
 
 	// timers, specified by callback/name
 	emu_timer *timer_alloc(timer_expired_delegate callback, void *ptr = NULL);
@@ -196,6 +196,7 @@ private:
 	void postload();
 
 	// scheduling helpers
+	bool execute_device(device_execute_interface &exec, attotime target, bool call_debugger);
 	void compute_perfect_interleave();
 	void rebuild_execute_list();
 	void add_scheduling_quantum(attotime quantum, attotime duration);
@@ -208,9 +209,9 @@ private:
 	// internal state
 	running_machine &			m_machine;					// reference to our machine
 	device_execute_interface *	m_executing_device;			// pointer to currently executing device
+	attotime					m_executing_target;			// time the currently executing device is running to
 	device_execute_interface *	m_execute_list;				// list of devices to be executed
 	attotime					m_basetime;					// global basetime; everything moves forward from here
-//  cothread                    m_cothread;                 // core scheduler thread
 
 	// list of active timers
 	emu_timer *					m_timer_list;				// head of the active list
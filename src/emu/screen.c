@@ -89,6 +89,9 @@ screen_device::screen_device(const machine_config &mconfig, const char *tag, dev
 	  m_curbitmap(0),
 	  m_curtexture(0),
 	  m_changed(true),
+	  m_commits(0),
+	  m_prev_changed_miny(0),
+	  m_prev_changed_maxy(-1),
 	  m_last_partial_scan(0),
 	  m_frame_period(DEFAULT_FRAME_PERIOD.as_attoseconds()),
 	  m_scantime(1),
@@ -521,6 +524,9 @@ void screen_device::realloc_screen_bitmaps()
 	// re-set up textures
 	m_texture[0]->set_bitmap(m_bitmap[0], m_visarea, m_bitmap[0].texformat());
 	m_texture[1]->set_bitmap(m_bitmap[1], m_visarea, m_bitmap[1].texformat());
+
+	// the bitmap contents can no longer be compared against earlier frames
+	m_commits = 0;
 }
 
 
@@ -862,7 +868,31 @@ bool screen_device::update_quads()
 			// if we're not skipping the frame and if the screen actually changed, then update the texture
 			if (!machine().video().skip_this_frame() && m_changed)
 			{
+				// find the rows that differ from the bitmap we committed last time; the
+				// compare is only worth doing if a renderer uploads just those rows
+				bool dirty_rows = machine().render().wants_dirty_rows(*this);
+				INT32 miny = m_visarea.min_y, maxy = m_visarea.max_y;
+				if (dirty_rows && m_commits >= 1)
+					find_changed_rows(miny, maxy);
+
 				m_texture[m_curbitmap]->set_bitmap(m_bitmap[m_curbitmap], m_visarea, m_bitmap[m_curbitmap].texformat());
+
+				// this texture last held the contents from two commits ago, so it needs
+				// the rows changed by both the previous commit and this one
+				if (dirty_rows && m_commits >= 2)
+				{
+					INT32 texminy = miny, texmaxy = maxy;
+					if (m_prev_changed_miny <= m_prev_changed_maxy)
+					{
+						texminy = (texminy <= texmaxy) ? MIN(texminy, m_prev_changed_miny) : m_prev_changed_miny;
+						texmaxy = MAX(texmaxy, m_prev_changed_maxy);
+					}
+					m_texture[m_curbitmap]->set_dirty_rows(texminy, texmaxy);
+				}
+				m_prev_changed_miny = miny;
+				m_prev_changed_maxy = maxy;
+				m_commits++;
+
 				m_curtexture = m_curbitmap;
 				m_curbitmap = 1 - m_curbitmap;
 			}
@@ -880,6 +910,38 @@ bool screen_device::update_quads()
 }
 
 
+//-------------------------------------------------
+//  find_changed_rows - compare the visible area
+//  of the bitmap about to be committed against
+//  the last committed one; returns an empty range
+//  (miny > maxy) if they are identical
+//-------------------------------------------------
+
+void screen_device::find_changed_rows(INT32 &miny, INT32 &maxy)
+{
+	bitmap_t &curbitmap = m_bitmap[m_curbitmap];
+	bitmap_t &prevbitmap = m_bitmap[m_curtexture];
+	size_t bytes = m_visarea.width() * curbitmap.bpp() / 8;
+
+	// scan down from the top for the first difference
+	for (miny = m_visarea.min_y; miny <= m_visarea.max_y; miny++)
+		if (memcmp(curbitmap.raw_pixptr(miny, m_visarea.min_x), prevbitmap.raw_pixptr(miny, m_visarea.min_x), bytes) != 0)
+			break;
+
+	// scan up from the bottom for the last one
+	for (maxy = m_visarea.max_y; maxy > miny; maxy--)
+		if (memcmp(curbitmap.raw_pixptr(maxy, m_visarea.min_x), prevbitmap.raw_pixptr(maxy, m_visarea.min_x), bytes) != 0)
+			break;
+
+	// normalize the empty case
+	if (miny > m_visarea.max_y)
+	{
+		miny = 0;
+		maxy = -1;
+	}
+}
+
+
 //-------------------------------------------------
 //  update_burnin - update the burnin bitmap
 //-------------------------------------------------
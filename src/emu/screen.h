@@ -257,6 +257,7 @@ private:
 	// internal helpers
 	void set_container(render_container &container) { m_container = &container; }
 	void realloc_screen_bitmaps();
+	void find_changed_rows(INT32 &miny, INT32 &maxy);
 	void vblank_begin();
 	void vblank_end();
 	void finalize_burnin();
@@ -289,6 +290,9 @@ private:
 	UINT8				m_curbitmap;				// current bitmap index
 	UINT8				m_curtexture;				// current texture index
 	bool				m_changed;					// has this bitmap changed?
+	UINT32				m_commits;					// number of texture commits since the bitmaps were reallocated
+	INT32				m_prev_changed_miny;		// first row changed by the previous commit
+	INT32				m_prev_changed_maxy;		// last row changed by the previous commit
 	INT32				m_last_partial_scan;		// scanline of last partial update
 	bitmap_argb32		m_screen_overlay_bitmap;	// screen overlay bitmap
 
@@ -946,6 +946,7 @@ static void AICA_w16(aica_state *AICA,unsigned int addr,unsigned short val)
 		else if(addr<0x3c00)
 		{
 			*((unsigned short *) (AICA->DSP.MPRO+(addr-0x3400)/2))=val;
+			AICA->DSP.Dirty=1;
 
 			if (addr == 0x3bfe)
 			{
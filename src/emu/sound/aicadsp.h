@@ -3,6 +3,15 @@
 #ifndef __AICADSP_H__
 #define __AICADSP_H__
 
+//a microcode step with its fields decoded, built from MPRO when the program changes
+struct _AICADSP_STEP
+{
+	UINT8 TRA,TWT,TWA;
+	UINT8 XSEL,YSEL,IRA,IWT,IWA;
+	UINT8 TABLE,MWT,MRD,EWT,EWA,ADRL,FRCL,SHIFT,YRL,NEGB,ZERO,BSEL;
+	UINT8 NOFL,COEF,MASA,ADREB,NXADR;
+};
+
 //the DSP Context
 struct _AICADSP
 {
@@ -30,6 +39,11 @@ struct _AICADSP
 
 	int Stopped;
 	int LastStep;
+
+//compiled program
+	struct _AICADSP_STEP Steps[128];	//steps that affect the output, in program order
+	int NumSteps;
+	int Dirty;	//MPRO was written since the program was compiled
 };
 
 void aica_dsp_init(struct _AICADSP *DSP);
@@ -672,6 +672,33 @@ typedef struct
 } FM_OPN;
 
 
+/***********************************************************/
+/* block renderer                                          */
+/***********************************************************/
+
+/* The update functions render FM in blocks of up to FM_BLOCK_SIZE samples.
+   The LFO and envelope generator timer only depend on the sample clock, so
+   they are stepped once per block into a timeline; each channel is then run
+   over the whole block on its own, which keeps its state in cache and lets
+   fully silent channels be skipped.  With the internal timer a CSM key-on
+   can happen on any sample, so blocks shrink to a single sample. */
+#if FM_INTERNAL_TIMER
+#define FM_BLOCK_SIZE	1
+#else
+#define FM_BLOCK_SIZE	128
+#endif
+
+typedef struct
+{
+	int		length;						/* samples in this block */
+	UINT32	eg_cnt;						/* eg_cnt at the start of the block */
+	UINT8	eg_ticks[FM_BLOCK_SIZE];	/* EG clocks falling on each sample */
+	UINT32	lfo_am[FM_BLOCK_SIZE];		/* LFO AM for each sample */
+	INT32	lfo_pm[FM_BLOCK_SIZE];		/* LFO PM for each sample */
+	INT32	out[6][FM_BLOCK_SIZE];		/* channel outputs */
+} FM_BLOCK;
+
+
 
 /* current chip state */
 
@@ -1109,7 +1136,7 @@ INLINE void advance_lfo(FM_OPN *OPN)
 }
 
 /* changed from INLINE to static here to work around gcc 4.2.1 codegen bug */
-static void advance_eg_channel(FM_OPN *OPN, FM_SLOT *SLOT)
+static void advance_eg_channel(UINT32 eg_cnt, FM_SLOT *SLOT)
 {
 	unsigned int out;
 	unsigned int swap_flag = 0;
@@ -1125,10 +1152,10 @@ static void advance_eg_channel(FM_OPN *OPN, FM_SLOT *SLOT)
 		switch(SLOT->state)
 		{
 		case EG_ATT:		/* attack phase */
-			if ( !(OPN->eg_cnt & ((1<<SLOT->eg_sh_ar)-1) ) )
+			if ( !(eg_cnt & ((1<<SLOT->eg_sh_ar)-1) ) )
 			{
 				SLOT->volume += (~SLOT->volume *
-                                  (eg_inc[SLOT->eg_sel_ar + ((OPN->eg_cnt>>SLOT->eg_sh_ar)&7)])
+                                  (eg_inc[SLOT->eg_sel_ar + ((eg_cnt>>SLOT->eg_sh_ar)&7)])
                                 ) >>4;
 
 				if (SLOT->volume <= MIN_ATT_INDEX)
@@ -1143,9 +1170,9 @@ static void advance_eg_channel(FM_OPN *OPN, FM_SLOT *SLOT)
 			{
 				if (SLOT->ssg&0x08)	/* SSG EG type envelope selected */
 				{
-					if ( !(OPN->eg_cnt & ((1<<SLOT->eg_sh_d1r)-1) ) )
+					if ( !(eg_cnt & ((1<<SLOT->eg_sh_d1r)-1) ) )
 					{
-						SLOT->volume += 4 * eg_inc[SLOT->eg_sel_d1r + ((OPN->eg_cnt>>SLOT->eg_sh_d1r)&7)];
+						SLOT->volume += 4 * eg_inc[SLOT->eg_sel_d1r + ((eg_cnt>>SLOT->eg_sh_d1r)&7)];
 
 						if ( SLOT->volume >= (INT32)(SLOT->sl) )
 							SLOT->state = EG_SUS;
@@ -1153,9 +1180,9 @@ static void advance_eg_channel(FM_OPN *OPN, FM_SLOT *SLOT)
 				}
 				else
 				{
-					if ( !(OPN->eg_cnt & ((1<<SLOT->eg_sh_d1r)-1) ) )
+					if ( !(eg_cnt & ((1<<SLOT->eg_sh_d1r)-1) ) )
 					{
-						SLOT->volume += eg_inc[SLOT->eg_sel_d1r + ((OPN->eg_cnt>>SLOT->eg_sh_d1r)&7)];
+						SLOT->volume += eg_inc[SLOT->eg_sel_d1r + ((eg_cnt>>SLOT->eg_sh_d1r)&7)];
 
 						if ( SLOT->volume >= (INT32)(SLOT->sl) )
 							SLOT->state = EG_SUS;
@@ -1167,10 +1194,10 @@ static void advance_eg_channel(FM_OPN *OPN, FM_SLOT *SLOT)
 		case EG_SUS:	/* sustain phase */
 			if (SLOT->ssg&0x08)	/* SSG EG type envelope selected */
 			{
-				if ( !(OPN->eg_cnt & ((1<<SLOT->eg_sh_d2r)-1) ) )
+				if ( !(eg_cnt & ((1<<SLOT->eg_sh_d2r)-1) ) )
 				{
 
-					SLOT->volume += 4 * eg_inc[SLOT->eg_sel_d2r + ((OPN->eg_cnt>>SLOT->eg_sh_d2r)&7)];
+					SLOT->volume += 4 * eg_inc[SLOT->eg_sel_d2r + ((eg_cnt>>SLOT->eg_sh_d2r)&7)];
 
 					if ( SLOT->volume >= ENV_QUIET )
 					{
@@ -1206,9 +1233,9 @@ static void advance_eg_channel(FM_OPN *OPN, FM_SLOT *SLOT)
 			}
 			else
 			{
-				if ( !(OPN->eg_cnt & ((1<<SLOT->eg_sh_d2r)-1) ) )
+				if ( !(eg_cnt & ((1<<SLOT->eg_sh_d2r)-1) ) )
 				{
-					SLOT->volume += eg_inc[SLOT->eg_sel_d2r + ((OPN->eg_cnt>>SLOT->eg_sh_d2r)&7)];
+					SLOT->volume += eg_inc[SLOT->eg_sel_d2r + ((eg_cnt>>SLOT->eg_sh_d2r)&7)];
 
 					if ( SLOT->volume >= MAX_ATT_INDEX )
 					{
@@ -1221,10 +1248,10 @@ static void advance_eg_channel(FM_OPN *OPN, FM_SLOT *SLOT)
 		break;
 
 		case EG_REL:	/* release phase */
-				if ( !(OPN->eg_cnt & ((1<<SLOT->eg_sh_rr)-1) ) )
+				if ( !(eg_cnt & ((1<<SLOT->eg_sh_rr)-1) ) )
 				{
 					/* SSG-EG affects Release phase also (Nemesis) */
-					SLOT->volume += eg_inc[SLOT->eg_sel_rr + ((OPN->eg_cnt>>SLOT->eg_sh_rr)&7)];
+					SLOT->volume += eg_inc[SLOT->eg_sel_rr + ((eg_cnt>>SLOT->eg_sh_rr)&7)];
 
 					if ( SLOT->volume >= MAX_ATT_INDEX )
 					{
@@ -1345,6 +1372,30 @@ INLINE void update_phase_lfo_channel(FM_OPN *OPN, FM_CH *CH)
 	}
 }
 
+/* advance the phase counters of a channel by one sample */
+INLINE void chan_update_phase(FM_OPN *OPN, FM_CH *CH, int chnum)
+{
+	if(CH->pms)
+	{
+		/* add support for 3 slot mode */
+		if ((OPN->ST.mode & 0xC0) && (chnum == 2))
+		{
+		        update_phase_lfo_slot(OPN, &CH->SLOT[SLOT1], CH->pms, OPN->SL3.block_fnum[1]);
+		        update_phase_lfo_slot(OPN, &CH->SLOT[SLOT2], CH->pms, OPN->SL3.block_fnum[2]);
+		        update_phase_lfo_slot(OPN, &CH->SLOT[SLOT3], CH->pms, OPN->SL3.block_fnum[0]);
+		        update_phase_lfo_slot(OPN, &CH->SLOT[SLOT4], CH->pms, CH->block_fnum);
+		}
+		else update_phase_lfo_channel(OPN, CH);
+	}
+	else	/* no LFO phase modulation */
+	{
+		CH->SLOT[SLOT1].phase += CH->SLOT[SLOT1].Incr;
+		CH->SLOT[SLOT2].phase += CH->SLOT[SLOT2].Incr;
+		CH->SLOT[SLOT3].phase += CH->SLOT[SLOT3].Incr;
+		CH->SLOT[SLOT4].phase += CH->SLOT[SLOT4].Incr;
+	}
+}
+
 INLINE void chan_calc(FM_OPN *OPN, FM_CH *CH, int chnum)
 {
 	unsigned int eg_out;
@@ -1399,25 +1450,115 @@ INLINE void chan_calc(FM_OPN *OPN, FM_CH *CH, int chnum)
 	CH->mem_value = OPN->mem;
 
 	/* update phase counters AFTER output calculations */
-	if(CH->pms)
+	chan_update_phase(OPN, CH, chnum);
+}
+
+/* a channel whose operators have all finished their release and whose
+   feedback and MEM delay lines are empty produces nothing but silence
+   until it is keyed on again; only its phase counters keep running */
+INLINE int chan_is_silent(FM_CH *CH)
+{
+	int s;
+
+	if (CH->op1_out[0] | CH->op1_out[1] | CH->mem_value)
+		return 0;
+
+	for (s = 0; s < 4; s++)
 	{
-		/* add support for 3 slot mode */
-		if ((OPN->ST.mode & 0xC0) && (chnum == 2))
+		FM_SLOT *SLOT = &CH->SLOT[s];
+
+		if (SLOT->state != EG_OFF || SLOT->volume < ENV_QUIET || SLOT->vol_out < ENV_QUIET)
+			return 0;
+	}
+	return 1;
+}
+
+/* step the LFO and the envelope generator timer across one block */
+INLINE void FM_block_timeline(FM_OPN *OPN, FM_BLOCK *blk, int length, int lfo)
+{
+	int i;
+
+	blk->length = length;
+	blk->eg_cnt = OPN->eg_cnt;
+
+	for (i = 0; i < length; i++)
+	{
+		UINT8 ticks = 0;
+
+		if (lfo)
+			advance_lfo(OPN);
+		blk->lfo_am[i] = OPN->LFO_AM;
+		blk->lfo_pm[i] = OPN->LFO_PM;
+
+		OPN->eg_timer += OPN->eg_timer_add;
+		while (OPN->eg_timer >= OPN->eg_timer_overflow)
 		{
-		        update_phase_lfo_slot(OPN, &CH->SLOT[SLOT1], CH->pms, OPN->SL3.block_fnum[1]);
-		        update_phase_lfo_slot(OPN, &CH->SLOT[SLOT2], CH->pms, OPN->SL3.block_fnum[2]);
-		        update_phase_lfo_slot(OPN, &CH->SLOT[SLOT3], CH->pms, OPN->SL3.block_fnum[0]);
-		        update_phase_lfo_slot(OPN, &CH->SLOT[SLOT4], CH->pms, CH->block_fnum);
+			OPN->eg_timer -= OPN->eg_timer_overflow;
+			OPN->eg_cnt++;
+			ticks++;
 		}
-		else update_phase_lfo_channel(OPN, CH);
+		blk->eg_ticks[i] = ticks;
 	}
-	else	/* no LFO phase modulation */
+}
+
+/* calculate one channel over a whole block into blk->out[chnum].
+   eg_first selects whether the envelope generator is clocked before
+   (YM2203/YM2610) or after (YM2608) the output of each sample */
+static void chan_calc_block(FM_OPN *OPN, FM_CH *CH, int chnum, FM_BLOCK *blk, int eg_first)
+{
+	UINT32 lfo_am = OPN->LFO_AM;
+	INT32 lfo_pm = OPN->LFO_PM;
+	UINT32 eg_cnt = blk->eg_cnt;
+	INT32 *out = blk->out[chnum];
+	int i, t, s;
+
+	if (chan_is_silent(CH))
 	{
-		CH->SLOT[SLOT1].phase += CH->SLOT[SLOT1].Incr;
-		CH->SLOT[SLOT2].phase += CH->SLOT[SLOT2].Incr;
-		CH->SLOT[SLOT3].phase += CH->SLOT[SLOT3].Incr;
-		CH->SLOT[SLOT4].phase += CH->SLOT[SLOT4].Incr;
+		memset(out, 0, blk->length * sizeof(*out));
+
+		if (CH->pms)
+		{
+			for (i = 0; i < blk->length; i++)
+			{
+				OPN->LFO_PM = blk->lfo_pm[i];
+				chan_update_phase(OPN, CH, chnum);
+			}
+		}
+		else
+		{
+			for (s = 0; s < 4; s++)
+				CH->SLOT[s].phase += CH->SLOT[s].Incr * blk->length;
+		}
+
+		/* an EG clock on a released operator only refreshes its output level */
+		if (OPN->eg_cnt != blk->eg_cnt)
+			for (s = 0; s < 4; s++)
+				CH->SLOT[s].vol_out = (UINT32)CH->SLOT[s].volume + CH->SLOT[s].tl;
+
+		OPN->out_fm[chnum] = 0;
 	}
+	else
+	{
+		for (i = 0; i < blk->length; i++)
+		{
+			if (eg_first)
+				for (t = blk->eg_ticks[i]; t; t--)
+					advance_eg_channel(++eg_cnt, &CH->SLOT[SLOT1]);
+
+			OPN->LFO_AM = blk->lfo_am[i];
+			OPN->LFO_PM = blk->lfo_pm[i];
+			OPN->out_fm[chnum] = 0;
+			chan_calc(OPN, CH, chnum);
+			out[i] = OPN->out_fm[chnum];
+
+			if (!eg_first)
+				for (t = blk->eg_ticks[i]; t; t--)
+					advance_eg_channel(++eg_cnt, &CH->SLOT[SLOT1]);
+		}
+	}
+
+	OPN->LFO_AM = lfo_am;
+	OPN->LFO_PM = lfo_pm;
 }
 
 /* update phase increment and envelope generator */
@@ -2101,9 +2242,10 @@ void ym2203_update_one(void *chip, FMSAMPLE *buffer, int length)
 {
 	YM2203 *F2203 = (YM2203 *)chip;
 	FM_OPN *OPN =   &F2203->OPN;
-	int i;
+	int i,j;
 	FMSAMPLE *buf = buffer;
 	FM_CH	*cch[3];
+	FM_BLOCK blk;
 
 	cch[0]   = &F2203->CH[0];
 	cch[1]   = &F2203->CH[1];
@@ -2133,35 +2275,21 @@ void ym2203_update_one(void *chip, FMSAMPLE *buffer, int length)
 	OPN->LFO_PM = 0;
 
 	/* buffering */
-	for (i=0; i < length ; i++)
+	for (i=0; i < length ; i += blk.length)
 	{
-		/* clear outputs */
-		OPN->out_fm[0] = 0;
-		OPN->out_fm[1] = 0;
-		OPN->out_fm[2] = 0;
+		FM_block_timeline(OPN, &blk, MIN(length - i, FM_BLOCK_SIZE), FALSE);
 
-		/* advance envelope generator */
-		OPN->eg_timer += OPN->eg_timer_add;
-		while (OPN->eg_timer >= OPN->eg_timer_overflow)
-		{
-			OPN->eg_timer -= OPN->eg_timer_overflow;
-			OPN->eg_cnt++;
-
-			advance_eg_channel(OPN, &cch[0]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[1]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[2]->SLOT[SLOT1]);
-		}
-
-		/* calculate FM */
-		chan_calc(OPN, cch[0], 0 );
-		chan_calc(OPN, cch[1], 1 );
-		chan_calc(OPN, cch[2], 2 );
+		/* calculate FM (envelope generator is advanced first) */
+		chan_calc_block(OPN, cch[0], 0, &blk, TRUE);
+		chan_calc_block(OPN, cch[1], 1, &blk, TRUE);
+		chan_calc_block(OPN, cch[2], 2, &blk, TRUE);
 
 		/* buffering */
+		for (j=0; j < blk.length ; j++)
 		{
 			int lt;
 
-			lt = OPN->out_fm[0] + OPN->out_fm[1] + OPN->out_fm[2];
+			lt = blk.out[0][j] + blk.out[1][j] + blk.out[2][j];
 
 			lt >>= FINAL_SH;
 
@@ -2172,15 +2300,16 @@ void ym2203_update_one(void *chip, FMSAMPLE *buffer, int length)
 			#endif
 
 			/* buffering */
-			buf[i] = lt;
-		}
+			buf[i + j] = lt;
 
-		/* timer A control */
-		INTERNAL_TIMER_A( &F2203->OPN.ST , cch[2] )
+			/* timer A control */
+			INTERNAL_TIMER_A( &F2203->OPN.ST , cch[2] )
+		}
 	}
 	INTERNAL_TIMER_B(&F2203->OPN.ST,length)
 }
 
+
 /* ---------- reset one of chip ---------- */
 void ym2203_reset_chip(void *chip)
 {
@@ -3271,10 +3400,10 @@ void ym2608_update_one(void *chip, FMSAMPLE **buffer, int length)
 	YM2608 *F2608 = (YM2608 *)chip;
 	FM_OPN *OPN   = &F2608->OPN;
 	YM_DELTAT *DELTAT = &F2608->deltaT;
-	int i,j;
+	int i,j,k;
 	FMSAMPLE  *bufL,*bufR;
 	FM_CH	*cch[6];
-	INT32 *out_fm = OPN->out_fm;
+	FM_BLOCK blk;
 
 	/* set bufer */
 	bufL = buffer[0];
@@ -3309,94 +3438,72 @@ void ym2608_update_one(void *chip, FMSAMPLE **buffer, int length)
 
 
 	/* buffering */
-	for(i=0; i < length ; i++)
+	for(i=0; i < length ; i += blk.length)
 	{
+		FM_block_timeline(OPN, &blk, MIN(length - i, FM_BLOCK_SIZE), TRUE);
 
-		advance_lfo(OPN);
-
-		/* clear output acc. */
-		OPN->out_adpcm[OUTD_LEFT] = OPN->out_adpcm[OUTD_RIGHT] = OPN->out_adpcm[OUTD_CENTER] = 0;
-		OPN->out_delta[OUTD_LEFT] = OPN->out_delta[OUTD_RIGHT] = OPN->out_delta[OUTD_CENTER] = 0;
-		/* clear outputs */
-		out_fm[0] = 0;
-		out_fm[1] = 0;
-		out_fm[2] = 0;
-		out_fm[3] = 0;
-		out_fm[4] = 0;
-		out_fm[5] = 0;
-
-		/* calculate FM */
-		chan_calc(OPN, cch[0], 0 );
-		chan_calc(OPN, cch[1], 1 );
-		chan_calc(OPN, cch[2], 2 );
-		chan_calc(OPN, cch[3], 3 );
-		chan_calc(OPN, cch[4], 4 );
-		chan_calc(OPN, cch[5], 5 );
-
-		/* deltaT ADPCM */
-		if( DELTAT->portstate&0x80 )
-			YM_DELTAT_ADPCM_CALC(DELTAT);
-
-		/* ADPCMA */
-		for( j = 0; j < 6; j++ )
-		{
-			if( F2608->adpcm[j].flag )
-				ADPCMA_calc_chan( F2608, &F2608->adpcm[j]);
-		}
-
-		/* advance envelope generator */
-		OPN->eg_timer += OPN->eg_timer_add;
-		while (OPN->eg_timer >= OPN->eg_timer_overflow)
-		{
-			OPN->eg_timer -= OPN->eg_timer_overflow;
-			OPN->eg_cnt++;
-
-			advance_eg_channel(OPN, &cch[0]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[1]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[2]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[3]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[4]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[5]->SLOT[SLOT1]);
-		}
+		/* calculate FM (envelope generator is advanced after the output) */
+		chan_calc_block(OPN, cch[0], 0, &blk, FALSE );
+		chan_calc_block(OPN, cch[1], 1, &blk, FALSE );
+		chan_calc_block(OPN, cch[2], 2, &blk, FALSE );
+		chan_calc_block(OPN, cch[3], 3, &blk, FALSE );
+		chan_calc_block(OPN, cch[4], 4, &blk, FALSE );
+		chan_calc_block(OPN, cch[5], 5, &blk, FALSE );
 
 		/* buffering */
+		for (j=0; j < blk.length ; j++)
 		{
 			int lt,rt;
 
+			/* clear output acc. */
+			OPN->out_adpcm[OUTD_LEFT] = OPN->out_adpcm[OUTD_RIGHT] = OPN->out_adpcm[OUTD_CENTER] = 0;
+			OPN->out_delta[OUTD_LEFT] = OPN->out_delta[OUTD_RIGHT] = OPN->out_delta[OUTD_CENTER] = 0;
+
+			/* deltaT ADPCM */
+			if( DELTAT->portstate&0x80 )
+				YM_DELTAT_ADPCM_CALC(DELTAT);
+
+			/* ADPCMA */
+			for( k = 0; k < 6; k++ )
+			{
+				if( F2608->adpcm[k].flag )
+					ADPCMA_calc_chan( F2608, &F2608->adpcm[k]);
+			}
+
 			lt =  OPN->out_adpcm[OUTD_LEFT]  + OPN->out_adpcm[OUTD_CENTER];
 			rt =  OPN->out_adpcm[OUTD_RIGHT] + OPN->out_adpcm[OUTD_CENTER];
 			lt += (OPN->out_delta[OUTD_LEFT]  + OPN->out_delta[OUTD_CENTER])>>9;
 			rt += (OPN->out_delta[OUTD_RIGHT] + OPN->out_delta[OUTD_CENTER])>>9;
-			lt += ((out_fm[0]>>1) & OPN->pan[0]);	/* shift right verified on real YM2608 */
-			rt += ((out_fm[0]>>1) & OPN->pan[1]);
-			lt += ((out_fm[1]>>1) & OPN->pan[2]);
-			rt += ((out_fm[1]>>1) & OPN->pan[3]);
-			lt += ((out_fm[2]>>1) & OPN->pan[4]);
-			rt += ((out_fm[2]>>1) & OPN->pan[5]);
-			lt += ((out_fm[3]>>1) & OPN->pan[6]);
-			rt += ((out_fm[3]>>1) & OPN->pan[7]);
-			lt += ((out_fm[4]>>1) & OPN->pan[8]);
-			rt += ((out_fm[4]>>1) & OPN->pan[9]);
-			lt += ((out_fm[5]>>1) & OPN->pan[10]);
-			rt += ((out_fm[5]>>1) & OPN->pan[11]);
+			lt += ((blk.out[0][j]>>1) & OPN->pan[0]);	/* shift right verified on real YM2608 */
+			rt += ((blk.out[0][j]>>1) & OPN->pan[1]);
+			lt += ((blk.out[1][j]>>1) & OPN->pan[2]);
+			rt += ((blk.out[1][j]>>1) & OPN->pan[3]);
+			lt += ((blk.out[2][j]>>1) & OPN->pan[4]);
+			rt += ((blk.out[2][j]>>1) & OPN->pan[5]);
+			lt += ((blk.out[3][j]>>1) & OPN->pan[6]);
+			rt += ((blk.out[3][j]>>1) & OPN->pan[7]);
+			lt += ((blk.out[4][j]>>1) & OPN->pan[8]);
+			rt += ((blk.out[4][j]>>1) & OPN->pan[9]);
+			lt += ((blk.out[5][j]>>1) & OPN->pan[10]);
+			rt += ((blk.out[5][j]>>1) & OPN->pan[11]);
 
 			lt >>= FINAL_SH;
 			rt >>= FINAL_SH;
 
 			Limit( lt, MAXOUT, MINOUT );
 			Limit( rt, MAXOUT, MINOUT );
-			/* buffering */
-			bufL[i] = lt;
-			bufR[i] = rt;
 
 			#ifdef SAVE_SAMPLE
 				SAVE_ALL_CHANNELS
 			#endif
 
-		}
+			/* buffering */
+			bufL[i + j] = lt;
+			bufR[i + j] = rt;
 
-		/* timer A control */
-		INTERNAL_TIMER_A( &OPN->ST , cch[2] )
+			/* timer A control */
+			INTERNAL_TIMER_A( &OPN->ST , cch[2] )
+		}
 	}
 	INTERNAL_TIMER_B(&OPN->ST,length)
 
@@ -3812,10 +3919,10 @@ void ym2610_update_one(void *chip, FMSAMPLE **buffer, int length)
 	YM2610 *F2610 = (YM2610 *)chip;
 	FM_OPN *OPN   = &F2610->OPN;
 	YM_DELTAT *DELTAT = &F2610->deltaT;
-	int i,j;
+	int i,j,k;
 	FMSAMPLE  *bufL,*bufR;
 	FM_CH	*cch[4];
-	INT32 *out_fm = OPN->out_fm;
+	FM_BLOCK blk;
 
 	/* buffer setup */
 	bufL = buffer[0];
@@ -3855,70 +3962,48 @@ void ym2610_update_one(void *chip, FMSAMPLE **buffer, int length)
 	refresh_fc_eg_chan( OPN, cch[3] );
 
 	/* buffering */
-	for(i=0; i < length ; i++)
+	for(i=0; i < length ; i += blk.length)
 	{
+		FM_block_timeline(OPN, &blk, MIN(length - i, FM_BLOCK_SIZE), TRUE);
 
-		advance_lfo(OPN);
-
-		/* clear output acc. */
-		OPN->out_adpcm[OUTD_LEFT] = OPN->out_adpcm[OUTD_RIGHT] = OPN->out_adpcm[OUTD_CENTER] = 0;
-		OPN->out_delta[OUTD_LEFT] = OPN->out_delta[OUTD_RIGHT] = OPN->out_delta[OUTD_CENTER] = 0;
-		/* clear outputs */
-		out_fm[1] = 0;
-		out_fm[2] = 0;
-		out_fm[4] = 0;
-		out_fm[5] = 0;
+		/* calculate FM (envelope generator is advanced first) */
+		chan_calc_block(OPN, cch[0], 1, &blk, TRUE );	/*remapped to 1*/
+		chan_calc_block(OPN, cch[1], 2, &blk, TRUE );	/*remapped to 2*/
+		chan_calc_block(OPN, cch[2], 4, &blk, TRUE );	/*remapped to 4*/
+		chan_calc_block(OPN, cch[3], 5, &blk, TRUE );	/*remapped to 5*/
 
-		/* advance envelope generator */
-		OPN->eg_timer += OPN->eg_timer_add;
-		while (OPN->eg_timer >= OPN->eg_timer_overflow)
+		/* buffering */
+		for (j=0; j < blk.length ; j++)
 		{
-			OPN->eg_timer -= OPN->eg_timer_overflow;
-			OPN->eg_cnt++;
-
-			advance_eg_channel(OPN, &cch[0]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[1]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[2]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[3]->SLOT[SLOT1]);
-		}
+			int lt,rt;
 
-		/* calculate FM */
-		chan_calc(OPN, cch[0], 1 );	/*remapped to 1*/
-		chan_calc(OPN, cch[1], 2 );	/*remapped to 2*/
-		chan_calc(OPN, cch[2], 4 );	/*remapped to 4*/
-		chan_calc(OPN, cch[3], 5 );	/*remapped to 5*/
+			/* clear output acc. */
+			OPN->out_adpcm[OUTD_LEFT] = OPN->out_adpcm[OUTD_RIGHT] = OPN->out_adpcm[OUTD_CENTER] = 0;
+			OPN->out_delta[OUTD_LEFT] = OPN->out_delta[OUTD_RIGHT] = OPN->out_delta[OUTD_CENTER] = 0;
 
-		/* deltaT ADPCM */
-		if( DELTAT->portstate&0x80 )
-			YM_DELTAT_ADPCM_CALC(DELTAT);
+			/* deltaT ADPCM */
+			if( DELTAT->portstate&0x80 )
+				YM_DELTAT_ADPCM_CALC(DELTAT);
 
-		/* ADPCMA */
-		for( j = 0; j < 6; j++ )
-		{
-			if( F2610->adpcm[j].flag )
-				ADPCMA_calc_chan( F2610, &F2610->adpcm[j]);
-		}
-
-		/* buffering */
-		{
-			int lt,rt;
+			/* ADPCMA */
+			for( k = 0; k < 6; k++ )
+			{
+				if( F2610->adpcm[k].flag )
+					ADPCMA_calc_chan( F2610, &F2610->adpcm[k]);
+			}
 
 			lt =  OPN->out_adpcm[OUTD_LEFT]  + OPN->out_adpcm[OUTD_CENTER];
 			rt =  OPN->out_adpcm[OUTD_RIGHT] + OPN->out_adpcm[OUTD_CENTER];
 			lt += (OPN->out_delta[OUTD_LEFT]  + OPN->out_delta[OUTD_CENTER])>>9;
 			rt += (OPN->out_delta[OUTD_RIGHT] + OPN->out_delta[OUTD_CENTER])>>9;
-
-
-			lt += ((out_fm[1]>>1) & OPN->pan[2]);	/* the shift right was verified on real chip */
-			rt += ((out_fm[1]>>1) & OPN->pan[3]);
-			lt += ((out_fm[2]>>1) & OPN->pan[4]);
-			rt += ((out_fm[2]>>1) & OPN->pan[5]);
-
-			lt += ((out_fm[4]>>1) & OPN->pan[8]);
-			rt += ((out_fm[4]>>1) & OPN->pan[9]);
-			lt += ((out_fm[5]>>1) & OPN->pan[10]);
-			rt += ((out_fm[5]>>1) & OPN->pan[11]);
-
+			lt += ((blk.out[1][j]>>1) & OPN->pan[2]);	/* the shift right was verified on real chip */
+			rt += ((blk.out[1][j]>>1) & OPN->pan[3]);
+			lt += ((blk.out[2][j]>>1) & OPN->pan[4]);
+			rt += ((blk.out[2][j]>>1) & OPN->pan[5]);
+			lt += ((blk.out[4][j]>>1) & OPN->pan[8]);
+			rt += ((blk.out[4][j]>>1) & OPN->pan[9]);
+			lt += ((blk.out[5][j]>>1) & OPN->pan[10]);
+			rt += ((blk.out[5][j]>>1) & OPN->pan[11]);
 
 			lt >>= FINAL_SH;
 			rt >>= FINAL_SH;
@@ -3931,12 +4016,12 @@ void ym2610_update_one(void *chip, FMSAMPLE **buffer, int length)
 			#endif
 
 			/* buffering */
-			bufL[i] = lt;
-			bufR[i] = rt;
-		}
+			bufL[i + j] = lt;
+			bufR[i + j] = rt;
 
-		/* timer A control */
-		INTERNAL_TIMER_A( &OPN->ST , cch[1] )
+			/* timer A control */
+			INTERNAL_TIMER_A( &OPN->ST , cch[1] )
+		}
 	}
 	INTERNAL_TIMER_B(&OPN->ST,length)
 
@@ -3949,10 +4034,10 @@ void ym2610b_update_one(void *chip, FMSAMPLE **buffer, int length)
 	YM2610 *F2610 = (YM2610 *)chip;
 	FM_OPN *OPN   = &F2610->OPN;
 	YM_DELTAT *DELTAT = &F2610->deltaT;
-	int i,j;
+	int i,j,k;
 	FMSAMPLE  *bufL,*bufR;
 	FM_CH	*cch[6];
-	INT32 *out_fm = OPN->out_fm;
+	FM_BLOCK blk;
 
 	/* buffer setup */
 	bufL = buffer[0];
@@ -3986,78 +4071,54 @@ void ym2610b_update_one(void *chip, FMSAMPLE **buffer, int length)
 	refresh_fc_eg_chan( OPN, cch[5] );
 
 	/* buffering */
-	for(i=0; i < length ; i++)
+	for(i=0; i < length ; i += blk.length)
 	{
+		FM_block_timeline(OPN, &blk, MIN(length - i, FM_BLOCK_SIZE), TRUE);
 
-		advance_lfo(OPN);
-
-		/* clear output acc. */
-		OPN->out_adpcm[OUTD_LEFT] = OPN->out_adpcm[OUTD_RIGHT] = OPN->out_adpcm[OUTD_CENTER] = 0;
-		OPN->out_delta[OUTD_LEFT] = OPN->out_delta[OUTD_RIGHT] = OPN->out_delta[OUTD_CENTER] = 0;
-		/* clear outputs */
-		out_fm[0] = 0;
-		out_fm[1] = 0;
-		out_fm[2] = 0;
-		out_fm[3] = 0;
-		out_fm[4] = 0;
-		out_fm[5] = 0;
+		/* calculate FM (envelope generator is advanced first) */
+		chan_calc_block(OPN, cch[0], 0, &blk, TRUE );
+		chan_calc_block(OPN, cch[1], 1, &blk, TRUE );
+		chan_calc_block(OPN, cch[2], 2, &blk, TRUE );
+		chan_calc_block(OPN, cch[3], 3, &blk, TRUE );
+		chan_calc_block(OPN, cch[4], 4, &blk, TRUE );
+		chan_calc_block(OPN, cch[5], 5, &blk, TRUE );
 
-		/* advance envelope generator */
-		OPN->eg_timer += OPN->eg_timer_add;
-		while (OPN->eg_timer >= OPN->eg_timer_overflow)
+		/* buffering */
+		for (j=0; j < blk.length ; j++)
 		{
-			OPN->eg_timer -= OPN->eg_timer_overflow;
-			OPN->eg_cnt++;
-
-			advance_eg_channel(OPN, &cch[0]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[1]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[2]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[3]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[4]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[5]->SLOT[SLOT1]);
-		}
-
-		/* calculate FM */
-		chan_calc(OPN, cch[0], 0 );
-		chan_calc(OPN, cch[1], 1 );
-		chan_calc(OPN, cch[2], 2 );
-		chan_calc(OPN, cch[3], 3 );
-		chan_calc(OPN, cch[4], 4 );
-		chan_calc(OPN, cch[5], 5 );
+			int lt,rt;
 
-		/* deltaT ADPCM */
-		if( DELTAT->portstate&0x80 )
-			YM_DELTAT_ADPCM_CALC(DELTAT);
+			/* clear output acc. */
+			OPN->out_adpcm[OUTD_LEFT] = OPN->out_adpcm[OUTD_RIGHT] = OPN->out_adpcm[OUTD_CENTER] = 0;
+			OPN->out_delta[OUTD_LEFT] = OPN->out_delta[OUTD_RIGHT] = OPN->out_delta[OUTD_CENTER] = 0;
 
-		/* ADPCMA */
-		for( j = 0; j < 6; j++ )
-		{
-			if( F2610->adpcm[j].flag )
-				ADPCMA_calc_chan( F2610, &F2610->adpcm[j]);
-		}
+			/* deltaT ADPCM */
+			if( DELTAT->portstate&0x80 )
+				YM_DELTAT_ADPCM_CALC(DELTAT);
 
-		/* buffering */
-		{
-			int lt,rt;
+			/* ADPCMA */
+			for( k = 0; k < 6; k++ )
+			{
+				if( F2610->adpcm[k].flag )
+					ADPCMA_calc_chan( F2610, &F2610->adpcm[k]);
+			}
 
 			lt =  OPN->out_adpcm[OUTD_LEFT]  + OPN->out_adpcm[OUTD_CENTER];
 			rt =  OPN->out_adpcm[OUTD_RIGHT] + OPN->out_adpcm[OUTD_CENTER];
 			lt += (OPN->out_delta[OUTD_LEFT]  + OPN->out_delta[OUTD_CENTER])>>9;
 			rt += (OPN->out_delta[OUTD_RIGHT] + OPN->out_delta[OUTD_CENTER])>>9;
-
-			lt += ((out_fm[0]>>1) & OPN->pan[0]);	/* the shift right is verified on YM2610 */
-			rt += ((out_fm[0]>>1) & OPN->pan[1]);
-			lt += ((out_fm[1]>>1) & OPN->pan[2]);
-			rt += ((out_fm[1]>>1) & OPN->pan[3]);
-			lt += ((out_fm[2]>>1) & OPN->pan[4]);
-			rt += ((out_fm[2]>>1) & OPN->pan[5]);
-			lt += ((out_fm[3]>>1) & OPN->pan[6]);
-			rt += ((out_fm[3]>>1) & OPN->pan[7]);
-			lt += ((out_fm[4]>>1) & OPN->pan[8]);
-			rt += ((out_fm[4]>>1) & OPN->pan[9]);
-			lt += ((out_fm[5]>>1) & OPN->pan[10]);
-			rt += ((out_fm[5]>>1) & OPN->pan[11]);
-
+			lt += ((blk.out[0][j]>>1) & OPN->pan[0]);	/* the shift right is verified on YM2610 */
+			rt += ((blk.out[0][j]>>1) & OPN->pan[1]);
+			lt += ((blk.out[1][j]>>1) & OPN->pan[2]);
+			rt += ((blk.out[1][j]>>1) & OPN->pan[3]);
+			lt += ((blk.out[2][j]>>1) & OPN->pan[4]);
+			rt += ((blk.out[2][j]>>1) & OPN->pan[5]);
+			lt += ((blk.out[3][j]>>1) & OPN->pan[6]);
+			rt += ((blk.out[3][j]>>1) & OPN->pan[7]);
+			lt += ((blk.out[4][j]>>1) & OPN->pan[8]);
+			rt += ((blk.out[4][j]>>1) & OPN->pan[9]);
+			lt += ((blk.out[5][j]>>1) & OPN->pan[10]);
+			rt += ((blk.out[5][j]>>1) & OPN->pan[11]);
 
 			lt >>= FINAL_SH;
 			rt >>= FINAL_SH;
@@ -4070,12 +4131,12 @@ void ym2610b_update_one(void *chip, FMSAMPLE **buffer, int length)
 			#endif
 
 			/* buffering */
-			bufL[i] = lt;
-			bufR[i] = rt;
-		}
+			bufL[i + j] = lt;
+			bufR[i + j] = rt;
 
-		/* timer A control */
-		INTERNAL_TIMER_A( &OPN->ST , cch[2] )
+			/* timer A control */
+			INTERNAL_TIMER_A( &OPN->ST , cch[2] )
+		}
 	}
 	INTERNAL_TIMER_B(&OPN->ST,length)
 
@@ -690,6 +690,28 @@ typedef struct
 	INT32		dacout;
 } YM2612;
 
+
+/* The update function renders in blocks of up to FM_BLOCK_SIZE samples: the
+   LFO and envelope generator timer are stepped once per block into a
+   timeline and each channel is then run over the whole block on its own,
+   so that channels which have gone silent can be skipped.  The internal
+   timer may trigger a CSM key-on on any sample, so it uses single samples. */
+#if FM_INTERNAL_TIMER
+#define FM_BLOCK_SIZE	1
+#else
+#define FM_BLOCK_SIZE	128
+#endif
+
+typedef struct
+{
+	int		length;						/* samples in this block */
+	UINT32	eg_cnt;						/* eg_cnt at the start of the block */
+	UINT8	eg_ticks[FM_BLOCK_SIZE];	/* EG clocks falling on each sample */
+	UINT32	lfo_am[FM_BLOCK_SIZE];		/* LFO AM for each sample */
+	UINT32	lfo_pm[FM_BLOCK_SIZE];		/* LFO PM for each sample */
+	INT32	out[6][FM_BLOCK_SIZE];		/* channel outputs */
+} FM_BLOCK;
+
 /* log output level */
 #define LOG_ERR  3      /* ERROR       */
 #define LOG_WAR  2      /* WARNING     */
@@ -1223,7 +1245,7 @@ INLINE void advance_lfo(FM_OPN *OPN)
 }
 
 /* changed from INLINE to static here to work around gcc 4.2.1 codegen bug */
-static void advance_eg_channel(FM_OPN *OPN, FM_SLOT *SLOT)
+static void advance_eg_channel(UINT32 eg_cnt, FM_SLOT *SLOT)
 {
 	unsigned int out;
 	unsigned int i = 4; /* four operators per channel */
@@ -1233,10 +1255,10 @@ static void advance_eg_channel(FM_OPN *OPN, FM_SLOT *SLOT)
 		switch(SLOT->state)
 		{
 			case EG_ATT:    /* attack phase */
-			if (!(OPN->eg_cnt & ((1<<SLOT->eg_sh_ar)-1)))
+			if (!(eg_cnt & ((1<<SLOT->eg_sh_ar)-1)))
 			{
 			        /* update attenuation level */
-			        SLOT->volume += (~SLOT->volume * (eg_inc[SLOT->eg_sel_ar + ((OPN->eg_cnt>>SLOT->eg_sh_ar)&7)]))>>4;
+			        SLOT->volume += (~SLOT->volume * (eg_inc[SLOT->eg_sel_ar + ((eg_cnt>>SLOT->eg_sh_ar)&7)]))>>4;
 
 			        /* check phase transition*/
 			        if (SLOT->volume <= MIN_ATT_INDEX)
@@ -1254,7 +1276,7 @@ static void advance_eg_channel(FM_OPN *OPN, FM_SLOT *SLOT)
 			break;
 
 			case EG_DEC:  /* decay phase */
-			if (!(OPN->eg_cnt & ((1<<SLOT->eg_sh_d1r)-1)))
+			if (!(eg_cnt & ((1<<SLOT->eg_sh_d1r)-1)))
 			{
 			        /* SSG EG type */
 			        if (SLOT->ssg&0x08)
@@ -1262,7 +1284,7 @@ static void advance_eg_channel(FM_OPN *OPN, FM_SLOT *SLOT)
 				        /* update attenuation level */
 				        if (SLOT->volume < 0x200)
 					{
-						SLOT->volume += 4 * eg_inc[SLOT->eg_sel_d1r + ((OPN->eg_cnt>>SLOT->eg_sh_d1r)&7)];
+						SLOT->volume += 4 * eg_inc[SLOT->eg_sel_d1r + ((eg_cnt>>SLOT->eg_sh_d1r)&7)];
 
 						/* recalculate EG output */
 						if (SLOT->ssgn ^ (SLOT->ssg&0x04))   /* SSG-EG Output Inversion */
@@ -1275,7 +1297,7 @@ static void advance_eg_channel(FM_OPN *OPN, FM_SLOT *SLOT)
 			        else
 			        {
 					/* update attenuation level */
-					SLOT->volume += eg_inc[SLOT->eg_sel_d1r + ((OPN->eg_cnt>>SLOT->eg_sh_d1r)&7)];
+					SLOT->volume += eg_inc[SLOT->eg_sel_d1r + ((eg_cnt>>SLOT->eg_sh_d1r)&7)];
 
 					/* recalculate EG output */
 					SLOT->vol_out = (UINT32)SLOT->volume + SLOT->tl;
@@ -1288,7 +1310,7 @@ static void advance_eg_channel(FM_OPN *OPN, FM_SLOT *SLOT)
 			break;
 
 			case EG_SUS:  /* sustain phase */
-			if (!(OPN->eg_cnt & ((1<<SLOT->eg_sh_d2r)-1)))
+			if (!(eg_cnt & ((1<<SLOT->eg_sh_d2r)-1)))
 			{
 			        /* SSG EG type */
 			        if (SLOT->ssg&0x08)
@@ -1296,7 +1318,7 @@ static void advance_eg_channel(FM_OPN *OPN, FM_SLOT *SLOT)
 					/* update attenuation level */
 					if (SLOT->volume < 0x200)
 					{
-						SLOT->volume += 4 * eg_inc[SLOT->eg_sel_d2r + ((OPN->eg_cnt>>SLOT->eg_sh_d2r)&7)];
+						SLOT->volume += 4 * eg_inc[SLOT->eg_sel_d2r + ((eg_cnt>>SLOT->eg_sh_d2r)&7)];
 
 						/* recalculate EG output */
 						if (SLOT->ssgn ^ (SLOT->ssg&0x04))   /* SSG-EG Output Inversion */
@@ -1308,7 +1330,7 @@ static void advance_eg_channel(FM_OPN *OPN, FM_SLOT *SLOT)
 			        else
 			        {
 				        /* update attenuation level */
-				        SLOT->volume += eg_inc[SLOT->eg_sel_d2r + ((OPN->eg_cnt>>SLOT->eg_sh_d2r)&7)];
+				        SLOT->volume += eg_inc[SLOT->eg_sel_d2r + ((eg_cnt>>SLOT->eg_sh_d2r)&7)];
 
 				        /* check phase transition*/
 				        if ( SLOT->volume >= MAX_ATT_INDEX )
@@ -1322,14 +1344,14 @@ static void advance_eg_channel(FM_OPN *OPN, FM_SLOT *SLOT)
 			break;
 
 			case EG_REL:  /* release phase */
-			if (!(OPN->eg_cnt & ((1<<SLOT->eg_sh_rr)-1)))
+			if (!(eg_cnt & ((1<<SLOT->eg_sh_rr)-1)))
 			{
 			        /* SSG EG type */
 			        if (SLOT->ssg&0x08)
 			        {
 				        /* update attenuation level */
 				        if (SLOT->volume < 0x200)
-					        SLOT->volume += 4 * eg_inc[SLOT->eg_sel_rr + ((OPN->eg_cnt>>SLOT->eg_sh_rr)&7)];
+					        SLOT->volume += 4 * eg_inc[SLOT->eg_sel_rr + ((eg_cnt>>SLOT->eg_sh_rr)&7)];
 					/* check phase transition */
 					if (SLOT->volume >= 0x200)
 					{
@@ -1340,7 +1362,7 @@ static void advance_eg_channel(FM_OPN *OPN, FM_SLOT *SLOT)
 			        else
 			        {
 				        /* update attenuation level */
-				        SLOT->volume += eg_inc[SLOT->eg_sel_rr + ((OPN->eg_cnt>>SLOT->eg_sh_rr)&7)];
+				        SLOT->volume += eg_inc[SLOT->eg_sel_rr + ((eg_cnt>>SLOT->eg_sh_rr)&7)];
 
 				        /* check phase transition*/
 				        if (SLOT->volume >= MAX_ATT_INDEX)
@@ -1589,6 +1611,30 @@ INLINE signed int op_calc1(UINT32 phase, unsigned int env, signed int pm)
   return tl_tab[p];
 }
 
+/* advance the phase counters of a channel by one sample */
+INLINE void chan_update_phase(YM2612 *F2612, FM_OPN *OPN, FM_CH *CH)
+{
+  if(CH->pms)
+  {
+    /* add support for 3 slot mode */
+    if ((OPN->ST.mode & 0xC0) && (CH == &F2612->CH[2]))
+    {
+      update_phase_lfo_slot(OPN, &CH->SLOT[SLOT1], CH->pms, OPN->SL3.block_fnum[1]);
+      update_phase_lfo_slot(OPN, &CH->SLOT[SLOT2], CH->pms, OPN->SL3.block_fnum[2]);
+      update_phase_lfo_slot(OPN, &CH->SLOT[SLOT3], CH->pms, OPN->SL3.block_fnum[0]);
+      update_phase_lfo_slot(OPN, &CH->SLOT[SLOT4], CH->pms, CH->block_fnum);
+    }
+    else update_phase_lfo_channel(OPN, CH);
+  }
+  else  /* no LFO phase modulation */
+  {
+    CH->SLOT[SLOT1].phase += CH->SLOT[SLOT1].Incr;
+    CH->SLOT[SLOT2].phase += CH->SLOT[SLOT2].Incr;
+    CH->SLOT[SLOT3].phase += CH->SLOT[SLOT3].Incr;
+    CH->SLOT[SLOT4].phase += CH->SLOT[SLOT4].Incr;
+  }
+}
+
 INLINE void chan_calc(YM2612 *F2612, FM_OPN *OPN, FM_CH *CH)
 {
   UINT32 AM = OPN->LFO_AM >> CH->ams;
@@ -1641,25 +1687,131 @@ INLINE void chan_calc(YM2612 *F2612, FM_OPN *OPN, FM_CH *CH)
   CH->mem_value = OPN->mem;
 
   /* update phase counters AFTER output calculations */
-  if(CH->pms)
-  {
-    /* add support for 3 slot mode */
-    if ((OPN->ST.mode & 0xC0) && (CH == &F2612->CH[2]))
-    {
-      update_phase_lfo_slot(OPN, &CH->SLOT[SLOT1], CH->pms, OPN->SL3.block_fnum[1]);
-      update_phase_lfo_slot(OPN, &CH->SLOT[SLOT2], CH->pms, OPN->SL3.block_fnum[2]);
-      update_phase_lfo_slot(OPN, &CH->SLOT[SLOT3], CH->pms, OPN->SL3.block_fnum[0]);
-      update_phase_lfo_slot(OPN, &CH->SLOT[SLOT4], CH->pms, CH->block_fnum);
-    }
-    else update_phase_lfo_channel(OPN, CH);
-  }
-  else  /* no LFO phase modulation */
-  {
-    CH->SLOT[SLOT1].phase += CH->SLOT[SLOT1].Incr;
-    CH->SLOT[SLOT2].phase += CH->SLOT[SLOT2].Incr;
-    CH->SLOT[SLOT3].phase += CH->SLOT[SLOT3].Incr;
-    CH->SLOT[SLOT4].phase += CH->SLOT[SLOT4].Incr;
-  }
+  chan_update_phase(F2612, OPN, CH);
+}
+
+/* a channel whose operators have all finished their release and whose
+   feedback and MEM delay lines are empty produces nothing but silence
+   until it is keyed on again; only its phase counters keep running */
+INLINE int chan_is_silent(FM_CH *CH)
+{
+	int s;
+
+	if (CH->op1_out[0] | CH->op1_out[1] | CH->mem_value)
+		return 0;
+
+	for (s = 0; s < 4; s++)
+	{
+		FM_SLOT *SLOT = &CH->SLOT[s];
+
+		if (SLOT->state != EG_OFF || SLOT->volume < ENV_QUIET || SLOT->vol_out < ENV_QUIET)
+			return 0;
+	}
+	return 1;
+}
+
+/* step the LFO and the envelope generator timer across one block; both are
+   advanced after the output of each sample */
+INLINE void FM_block_timeline(FM_OPN *OPN, FM_BLOCK *blk, int length)
+{
+	int i;
+
+	blk->length = length;
+	blk->eg_cnt = OPN->eg_cnt;
+
+	for (i = 0; i < length; i++)
+	{
+		UINT8 ticks = 0;
+
+		blk->lfo_am[i] = OPN->LFO_AM;
+		blk->lfo_pm[i] = OPN->LFO_PM;
+		advance_lfo(OPN);
+
+		OPN->eg_timer += OPN->eg_timer_add;
+		while (OPN->eg_timer >= OPN->eg_timer_overflow)
+		{
+			OPN->eg_timer -= OPN->eg_timer_overflow;
+			OPN->eg_cnt++;
+			ticks++;
+		}
+		blk->eg_ticks[i] = ticks;
+	}
+}
+
+/* calculate one channel over a whole block into blk->out[] */
+static void chan_calc_block(YM2612 *F2612, FM_OPN *OPN, FM_CH *CH, FM_BLOCK *blk)
+{
+	UINT32 lfo_am = OPN->LFO_AM;
+	UINT32 lfo_pm = OPN->LFO_PM;
+	UINT32 eg_cnt = blk->eg_cnt;
+	int chnum = CH - F2612->CH;
+	INT32 *out = blk->out[chnum];
+	int dac = (chnum == 5) && F2612->dacen;
+	int i, t, s;
+
+	if (!dac && chan_is_silent(CH))
+	{
+		memset(out, 0, blk->length * sizeof(*out));
+
+		if (CH->pms)
+		{
+			for (i = 0; i < blk->length; i++)
+			{
+				OPN->LFO_PM = blk->lfo_pm[i];
+				chan_update_phase(F2612, OPN, CH);
+			}
+		}
+		else
+		{
+			for (s = 0; s < 4; s++)
+				CH->SLOT[s].phase += CH->SLOT[s].Incr * blk->length;
+		}
+
+		/* an EG clock on a released operator only refreshes its output level */
+		if (OPN->eg_cnt != blk->eg_cnt)
+			for (s = 0; s < 4; s++)
+				CH->SLOT[s].vol_out = (UINT32)CH->SLOT[s].volume + CH->SLOT[s].tl;
+
+		OPN->out_fm[chnum] = 0;
+	}
+	else
+	{
+		for (i = 0; i < blk->length; i++)
+		{
+			/* update SSG-EG output */
+			update_ssg_eg_channel(&CH->SLOT[SLOT1]);
+
+			/* calculate FM; the DAC replaces channel 6 when enabled */
+			OPN->out_fm[chnum] = 0;
+			if (dac)
+				*CH->connect4 += F2612->dacout;
+			else
+			{
+				OPN->LFO_AM = blk->lfo_am[i];
+				OPN->LFO_PM = blk->lfo_pm[i];
+				chan_calc(F2612, OPN, CH);
+			}
+			out[i] = OPN->out_fm[chnum];
+
+			/* advance envelope generator */
+			for (t = blk->eg_ticks[i]; t; t--)
+				advance_eg_channel(++eg_cnt, &CH->SLOT[SLOT1]);
+
+#if !FM_INTERNAL_TIMER
+			/* CSM Mode Key OFF (verified by Nemesis on real hardware) */
+			if (chnum == 2)
+			{
+				FM_KEYOFF_CSM(CH,SLOT1);
+				FM_KEYOFF_CSM(CH,SLOT2);
+				FM_KEYOFF_CSM(CH,SLOT3);
+				FM_KEYOFF_CSM(CH,SLOT4);
+			}
+#endif
+		}
+	}
+
+	OPN->LFO_AM = lfo_am;
+	OPN->LFO_PM = lfo_pm;
 }
 
 static void FMCloseTable( void )
@@ -2176,10 +2328,10 @@ void ym2612_update_one(void *chip, FMSAMPLE **buffer, int length)
 {
 	YM2612 *F2612 = (YM2612 *)chip;
 	FM_OPN *OPN   = &F2612->OPN;
-	INT32 *out_fm = OPN->out_fm;
-	int i;
+	int i,j;
 	FMSAMPLE  *bufL,*bufR;
 	FM_CH	*cch[6];
+	FM_BLOCK blk;
 	int lt,rt;
 
 	/* set bufer */
@@ -2212,105 +2364,84 @@ void ym2612_update_one(void *chip, FMSAMPLE **buffer, int length)
 	refresh_fc_eg_chan( OPN, cch[5] );
 
 	/* buffering */
-	for(i=0; i < length ; i++)
+	for(i=0; i < length ; i += blk.length)
 	{
-		/* clear outputs */
-		out_fm[0] = 0;
-		out_fm[1] = 0;
-		out_fm[2] = 0;
-		out_fm[3] = 0;
-		out_fm[4] = 0;
-		out_fm[5] = 0;
-
-		/* update SSG-EG output */
-		update_ssg_eg_channel(&cch[0]->SLOT[SLOT1]);
-		update_ssg_eg_channel(&cch[1]->SLOT[SLOT1]);
-		update_ssg_eg_channel(&cch[2]->SLOT[SLOT1]);
-		update_ssg_eg_channel(&cch[3]->SLOT[SLOT1]);
-		update_ssg_eg_channel(&cch[4]->SLOT[SLOT1]);
-		update_ssg_eg_channel(&cch[5]->SLOT[SLOT1]);
+		FM_block_timeline(OPN, &blk, MIN(length - i, FM_BLOCK_SIZE));
 
 		/* calculate FM */
-		chan_calc(F2612, OPN, cch[0]);
-		chan_calc(F2612, OPN, cch[1]);
-		chan_calc(F2612, OPN, cch[2]);
-		chan_calc(F2612, OPN, cch[3]);
-		chan_calc(F2612, OPN, cch[4]);
-		if( F2612->dacen )
-			*cch[5]->connect4 += F2612->dacout;
-		else
-			chan_calc(F2612, OPN, cch[5]);
-
-		/* advance LFO */
-		advance_lfo(OPN);
-
-		/* advance envelope generator */
-		OPN->eg_timer += OPN->eg_timer_add;
-		while (OPN->eg_timer >= OPN->eg_timer_overflow)
+		chan_calc_block(F2612, OPN, cch[0], &blk);
+		chan_calc_block(F2612, OPN, cch[1], &blk);
+		chan_calc_block(F2612, OPN, cch[2], &blk);
+		chan_calc_block(F2612, OPN, cch[3], &blk);
+		chan_calc_block(F2612, OPN, cch[4], &blk);
+		chan_calc_block(F2612, OPN, cch[5], &blk);
+
+		for (j=0; j < blk.length ; j++)
 		{
-			OPN->eg_timer -= OPN->eg_timer_overflow;
-			OPN->eg_cnt++;
+			INT32 out_fm[6];
+
+			out_fm[0] = blk.out[0][j];
+			out_fm[1] = blk.out[1][j];
+			out_fm[2] = blk.out[2][j];
+			out_fm[3] = blk.out[3][j];
+			out_fm[4] = blk.out[4][j];
+			out_fm[5] = blk.out[5][j];
+
+			if (out_fm[0] > 8191) out_fm[0] = 8191;
+			else if (out_fm[0] < -8192) out_fm[0] = -8192;
+			if (out_fm[1] > 8191) out_fm[1] = 8191;
+			else if (out_fm[1] < -8192) out_fm[1] = -8192;
+			if (out_fm[2] > 8191) out_fm[2] = 8191;
+			else if (out_fm[2] < -8192) out_fm[2] = -8192;
+			if (out_fm[3] > 8191) out_fm[3] = 8191;
+			else if (out_fm[3] < -8192) out_fm[3] = -8192;
+			if (out_fm[4] > 8191) out_fm[4] = 8191;
+			else if (out_fm[4] < -8192) out_fm[4] = -8192;
+			if (out_fm[5] > 8191) out_fm[5] = 8191;
+			else if (out_fm[5] < -8192) out_fm[5] = -8192;
+
+			/* 6-channels mixing  */
+			lt  = ((out_fm[0]>>0) & OPN->pan[0]);
+			rt  = ((out_fm[0]>>0) & OPN->pan[1]);
+			lt += ((out_fm[1]>>0) & OPN->pan[2]);
+			rt += ((out_fm[1]>>0) & OPN->pan[3]);
+			lt += ((out_fm[2]>>0) & OPN->pan[4]);
+			rt += ((out_fm[2]>>0) & OPN->pan[5]);
+			lt += ((out_fm[3]>>0) & OPN->pan[6]);
+			rt += ((out_fm[3]>>0) & OPN->pan[7]);
+			lt += ((out_fm[4]>>0) & OPN->pan[8]);
+			rt += ((out_fm[4]>>0) & OPN->pan[9]);
+			lt += ((out_fm[5]>>0) & OPN->pan[10]);
+			rt += ((out_fm[5]>>0) & OPN->pan[11]);
+
+//          Limit( lt, MAXOUT, MINOUT );
+//          Limit( rt, MAXOUT, MINOUT );
+
+			#ifdef SAVE_SAMPLE
+				SAVE_ALL_CHANNELS
+			#endif
+
+			/* buffering */
+			bufL[i + j] = lt;
+			bufR[i + j] = rt;
+
+			/* CSM mode: if CSM Key ON has occurred, CSM Key OFF need to be sent       */
+			/* only if Timer A does not overflow again (i.e CSM Key ON not set again) */
+			OPN->SL3.key_csm <<= 1;
+
+			/* timer A control */
+			INTERNAL_TIMER_A( &OPN->ST , cch[2] )
 
-			advance_eg_channel(OPN, &cch[0]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[1]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[2]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[3]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[4]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[5]->SLOT[SLOT1]);
+#if FM_INTERNAL_TIMER
+			/* CSM Mode Key ON still disabled */
+			/* CSM Mode Key OFF (verified by Nemesis on real hardware) */
+			FM_KEYOFF_CSM(cch[2],SLOT1);
+			FM_KEYOFF_CSM(cch[2],SLOT2);
+			FM_KEYOFF_CSM(cch[2],SLOT3);
+			FM_KEYOFF_CSM(cch[2],SLOT4);
+#endif
+			OPN->SL3.key_csm = 0;
 		}
-
-		if (out_fm[0] > 8191) out_fm[0] = 8191;
-		else if (out_fm[0] < -8192) out_fm[0] = -8192;
-		if (out_fm[1] > 8191) out_fm[1] = 8191;
-		else if (out_fm[1] < -8192) out_fm[1] = -8192;
-		if (out_fm[2] > 8191) out_fm[2] = 8191;
-		else if (out_fm[2] < -8192) out_fm[2] = -8192;
-		if (out_fm[3] > 8191) out_fm[3] = 8191;
-		else if (out_fm[3] < -8192) out_fm[3] = -8192;
-		if (out_fm[4] > 8191) out_fm[4] = 8191;
-		else if (out_fm[4] < -8192) out_fm[4] = -8192;
-		if (out_fm[5] > 8191) out_fm[5] = 8191;
-		else if (out_fm[5] < -8192) out_fm[5] = -8192;
-
-		/* 6-channels mixing  */
-		lt  = ((out_fm[0]>>0) & OPN->pan[0]);
-		rt  = ((out_fm[0]>>0) & OPN->pan[1]);
-		lt += ((out_fm[1]>>0) & OPN->pan[2]);
-		rt += ((out_fm[1]>>0) & OPN->pan[3]);
-		lt += ((out_fm[2]>>0) & OPN->pan[4]);
-		rt += ((out_fm[2]>>0) & OPN->pan[5]);
-		lt += ((out_fm[3]>>0) & OPN->pan[6]);
-		rt += ((out_fm[3]>>0) & OPN->pan[7]);
-		lt += ((out_fm[4]>>0) & OPN->pan[8]);
-		rt += ((out_fm[4]>>0) & OPN->pan[9]);
-		lt += ((out_fm[5]>>0) & OPN->pan[10]);
-		rt += ((out_fm[5]>>0) & OPN->pan[11]);
-
-//      Limit( lt, MAXOUT, MINOUT );
-//      Limit( rt, MAXOUT, MINOUT );
-
-		#ifdef SAVE_SAMPLE
-			SAVE_ALL_CHANNELS
-		#endif
-
-		/* buffering */
-		bufL[i] = lt;
-		bufR[i] = rt;
-
-		/* CSM mode: if CSM Key ON has occurred, CSM Key OFF need to be sent       */
-		/* only if Timer A does not overflow again (i.e CSM Key ON not set again) */
-		OPN->SL3.key_csm <<= 1;
-
-		/* timer A control */
-		INTERNAL_TIMER_A( &OPN->ST , cch[2] )
-
-		/* CSM Mode Key ON still disabled */
-		/* CSM Mode Key OFF (verified by Nemesis on real hardware) */
-		FM_KEYOFF_CSM(cch[2],SLOT1);
-		FM_KEYOFF_CSM(cch[2],SLOT2);
-		FM_KEYOFF_CSM(cch[2],SLOT3);
-		FM_KEYOFF_CSM(cch[2],SLOT4);
-		OPN->SL3.key_csm = 0;
 	}
 
 	/* timer B control */
@@ -60,7 +60,117 @@ void SCSPDSP_Init(struct _SCSPDSP *DSP)
 	DSP->Stopped=1;
 }
 
-void SCSPDSP_Step(struct _SCSPDSP *DSP)
+//registers carried from one step to the next, tracked by the dead step pass
+#define REG_ACC		0x01
+#define REG_INPUTS	0x02
+#define REG_MEMVAL	0x04
+#define REG_FRC		0x08
+#define REG_Y		0x10
+#define REG_ADRS	0x20
+
+/*
+    Decode MPRO into a list of steps.  Steps are dropped, walking backwards,
+    when they have no side effect and none of the registers they write is
+    read before being written again; all registers start from zero on every
+    sample, so nothing is live past the last step.
+*/
+static void SCSPDSP_Compile(struct _SCSPDSP *DSP)
+{
+	struct _SCSPDSP_STEP Decoded[128];
+	UINT8 Keep[128];
+	UINT32 Needed=0;
+	int count,step,n;
+
+	DSP->Abort=0;
+	for(count=0;count<DSP->LastStep;++count)
+	{
+		UINT16 *IPtr=DSP->MPRO+count*4;
+		struct _SCSPDSP_STEP *S=&Decoded[count];
+
+		S->TRA=(IPtr[0]>>8)&0x7F;
+		S->TWT=(IPtr[0]>>7)&0x01;
+		S->TWA=(IPtr[0]>>0)&0x7F;
+
+		S->XSEL=(IPtr[1]>>15)&0x01;
+		S->YSEL=(IPtr[1]>>13)&0x03;
+		S->IRA=(IPtr[1]>>6)&0x3F;
+		S->IWT=(IPtr[1]>>5)&0x01;
+		S->IWA=(IPtr[1]>>0)&0x1F;
+
+		S->TABLE=(IPtr[2]>>15)&0x01;
+		S->MWT=(IPtr[2]>>14)&(count&1);	//memory only allowed on odd steps
+		S->MRD=(IPtr[2]>>13)&(count&1);
+		S->EWT=(IPtr[2]>>12)&0x01;
+		S->EWA=(IPtr[2]>>8)&0x0F;
+		S->ADRL=(IPtr[2]>>7)&0x01;
+		S->FRCL=(IPtr[2]>>6)&0x01;
+		S->SHIFT=(IPtr[2]>>4)&0x03;
+		S->YRL=(IPtr[2]>>3)&0x01;
+		S->NEGB=(IPtr[2]>>2)&0x01;
+		S->ZERO=(IPtr[2]>>1)&0x01;
+		S->BSEL=(IPtr[2]>>0)&0x01;
+
+		S->NOFL=(IPtr[3]>>15)&1;
+		S->COEF=(IPtr[3]>>9)&0x3f;
+
+		S->MASA=(IPtr[3]>>2)&0x1f;
+		S->ADREB=(IPtr[3]>>1)&0x1;
+		S->NXADR=(IPtr[3]>>0)&0x1;
+
+		//an invalid input stops the whole program, as it always has
+		if(S->IRA>0x31)
+		{
+			DSP->Abort=1;
+			break;
+		}
+	}
+
+	for(step=count-1;step>=0;--step)
+	{
+		const struct _SCSPDSP_STEP *S=&Decoded[step];
+		UINT32 Writes=REG_ACC|REG_INPUTS;
+		int UseShifted,UseProduct;
+
+		if(S->YRL) Writes|=REG_Y;
+		if(S->FRCL) Writes|=REG_FRC;
+		if(S->ADRL) Writes|=REG_ADRS;
+		if(S->MRD) Writes|=REG_MEMVAL;
+
+		Keep[step]=S->TWT || S->IWT || S->MWT || S->EWT || (Writes&Needed);
+		if(!Keep[step])
+			continue;
+
+		UseShifted=S->TWT || S->MWT || S->EWT || (S->FRCL && (Needed&REG_FRC)) || (S->ADRL && S->SHIFT==3 && (Needed&REG_ADRS));
+		UseProduct=(Needed&REG_ACC)!=0;
+
+		Needed&=~Writes;
+		if(UseProduct)
+		{
+			if(S->YSEL==0)
+				Needed|=REG_FRC;
+			else if(S->YSEL>=2)
+				Needed|=REG_Y;
+			if(!S->ZERO && S->BSEL)
+				Needed|=REG_ACC;
+		}
+		if(UseShifted)
+			Needed|=REG_ACC;
+		if(S->IWT)
+			Needed|=REG_MEMVAL;
+		if((S->MRD || S->MWT) && S->ADREB)
+			Needed|=REG_ADRS;
+	}
+
+	n=0;
+	for(step=0;step<count;++step)
+		if(Keep[step])
+			DSP->Steps[n++]=Decoded[step];
+	DSP->NumSteps=n;
+	DSP->Dirty=0;
+}
+
+//one pass of the compiled program
+static void SCSPDSP_Run(struct _SCSPDSP *DSP)
 {
 	INT32 ACC=0;	//26 bit
 	INT32 SHIFTED=0;	//24 bit
@@ -73,261 +183,165 @@ void SCSPDSP_Step(struct _SCSPDSP *DSP)
 	INT32 Y_REG=0;		//24 bit
 	UINT32 ADDR=0;
 	UINT32 ADRS_REG=0;	//13 bit
-	int step;
-
-	if(DSP->Stopped)
-		return;
+	const struct _SCSPDSP_STEP *S=DSP->Steps;
+	const struct _SCSPDSP_STEP *End=DSP->Steps+DSP->NumSteps;
 
 	memset(DSP->EFREG,0,2*16);
-#if 0
-	int dump=0;
-	FILE *f=NULL;
-	if(dump)
-		f=fopen("dsp.txt","wt");
-#endif
-	for(step=0;step</*128*/DSP->LastStep;++step)
+	for(;S!=End;++S)
 	{
-		UINT16 *IPtr=DSP->MPRO+step*4;
-
-//      if(IPtr[0]==0 && IPtr[1]==0 && IPtr[2]==0 && IPtr[3]==0)
-//          break;
-
-		UINT32 TRA=(IPtr[0]>>8)&0x7F;
-		UINT32 TWT=(IPtr[0]>>7)&0x01;
-		UINT32 TWA=(IPtr[0]>>0)&0x7F;
-
-		UINT32 XSEL=(IPtr[1]>>15)&0x01;
-		UINT32 YSEL=(IPtr[1]>>13)&0x03;
-		UINT32 IRA=(IPtr[1]>>6)&0x3F;
-		UINT32 IWT=(IPtr[1]>>5)&0x01;
-		UINT32 IWA=(IPtr[1]>>0)&0x1F;
-
-		UINT32 TABLE=(IPtr[2]>>15)&0x01;
-		UINT32 MWT=(IPtr[2]>>14)&0x01;
-		UINT32 MRD=(IPtr[2]>>13)&0x01;
-		UINT32 EWT=(IPtr[2]>>12)&0x01;
-		UINT32 EWA=(IPtr[2]>>8)&0x0F;
-		UINT32 ADRL=(IPtr[2]>>7)&0x01;
-		UINT32 FRCL=(IPtr[2]>>6)&0x01;
-		UINT32 SHIFT=(IPtr[2]>>4)&0x03;
-		UINT32 YRL=(IPtr[2]>>3)&0x01;
-		UINT32 NEGB=(IPtr[2]>>2)&0x01;
-		UINT32 ZERO=(IPtr[2]>>1)&0x01;
-		UINT32 BSEL=(IPtr[2]>>0)&0x01;
-
-		UINT32 NOFL=(IPtr[3]>>15)&1;		//????
-		UINT32 COEF=(IPtr[3]>>9)&0x3f;
-
-		UINT32 MASA=(IPtr[3]>>2)&0x1f;	//???
-		UINT32 ADREB=(IPtr[3]>>1)&0x1;
-		UINT32 NXADR=(IPtr[3]>>0)&0x1;
-
 		INT64 v;
 
-		//operations are done at 24 bit precision
-#if 0
-		if(MASA)
-			int a=1;
-		if(NOFL)
-			int a=1;
-
-//      int dump=0;
-
-		if(f)
-		{
-#define DUMP(v)	fprintf(f," " #v ": %04X",v);
-
-			fprintf(f,"%d: ",step);
-			DUMP(ACC);
-			DUMP(SHIFTED);
-			DUMP(X);
-			DUMP(Y);
-			DUMP(B);
-			DUMP(INPUTS);
-			DUMP(MEMVAL);
-			DUMP(FRC_REG);
-			DUMP(Y_REG);
-			DUMP(ADDR);
-			DUMP(ADRS_REG);
-			fprintf(f,"\n");
-		}
-#endif
 		//INPUTS RW
-// colmns97 hits this
-//      assert(IRA<0x32);
-		if(IRA<=0x1f)
-			INPUTS=DSP->MEMS[IRA];
-		else if(IRA<=0x2F)
-			INPUTS=DSP->MIXS[IRA-0x20]<<4;	//MIXS is 20 bit
-		else if(IRA<=0x31)
-			INPUTS=0;
+		if(S->IRA<=0x1f)
+			INPUTS=DSP->MEMS[S->IRA];
+		else if(S->IRA<=0x2F)
+			INPUTS=DSP->MIXS[S->IRA-0x20]<<4;	//MIXS is 20 bit
 		else
-			return;
+			INPUTS=0;
 
 		INPUTS<<=8;
 		INPUTS>>=8;
-		//if(INPUTS&0x00800000)
-		//  INPUTS|=0xFF000000;
 
-		if(IWT)
+		if(S->IWT)
 		{
-			DSP->MEMS[IWA]=MEMVAL;	//MEMVAL was selected in previous MRD
-			if(IRA==IWA)
+			DSP->MEMS[S->IWA]=MEMVAL;	//MEMVAL was selected in previous MRD
+			if(S->IRA==S->IWA)
 				INPUTS=MEMVAL;
 		}
 
 		//Operand sel
 		//B
-		if(!ZERO)
+		if(!S->ZERO)
 		{
-			if(BSEL)
+			if(S->BSEL)
 				B=ACC;
 			else
 			{
-				B=DSP->TEMP[(TRA+DSP->DEC)&0x7F];
+				B=DSP->TEMP[(S->TRA+DSP->DEC)&0x7F];
 				B<<=8;
 				B>>=8;
-				//if(B&0x00800000)
-				//  B|=0xFF000000;  //Sign extend
 			}
-			if(NEGB)
+			if(S->NEGB)
 				B=0-B;
 		}
 		else
 			B=0;
 
 		//X
-		if(XSEL)
+		if(S->XSEL)
 			X=INPUTS;
 		else
 		{
-			X=DSP->TEMP[(TRA+DSP->DEC)&0x7F];
+			X=DSP->TEMP[(S->TRA+DSP->DEC)&0x7F];
 			X<<=8;
 			X>>=8;
-			//if(X&0x00800000)
-			//  X|=0xFF000000;
 		}
 
 		//Y
-		if(YSEL==0)
+		if(S->YSEL==0)
 			Y=FRC_REG;
-		else if(YSEL==1)
-			Y=DSP->COEF[COEF]>>3;	//COEF is 16 bits
-		else if(YSEL==2)
+		else if(S->YSEL==1)
+			Y=DSP->COEF[S->COEF]>>3;	//COEF is 16 bits
+		else if(S->YSEL==2)
 			Y=(Y_REG>>11)&0x1FFF;
-		else if(YSEL==3)
+		else
 			Y=(Y_REG>>4)&0x0FFF;
 
-		if(YRL)
+		if(S->YRL)
 			Y_REG=INPUTS;
 
 		//Shifter
-		if(SHIFT==0)
+		if(S->SHIFT&2)
 		{
-			SHIFTED=ACC;
-			if(SHIFTED>0x007FFFFF)
-				SHIFTED=0x007FFFFF;
-			if(SHIFTED<(-0x00800000))
-				SHIFTED=-0x00800000;
+			SHIFTED=(S->SHIFT==2)?ACC*2:ACC;
+			SHIFTED<<=8;
+			SHIFTED>>=8;
 		}
-		else if(SHIFT==1)
+		else
 		{
-			SHIFTED=ACC*2;
+			SHIFTED=(S->SHIFT==1)?ACC*2:ACC;
 			if(SHIFTED>0x007FFFFF)
 				SHIFTED=0x007FFFFF;
 			if(SHIFTED<(-0x00800000))
 				SHIFTED=-0x00800000;
 		}
-		else if(SHIFT==2)
-		{
-			SHIFTED=ACC*2;
-			SHIFTED<<=8;
-			SHIFTED>>=8;
-			//SHIFTED&=0x00FFFFFF;
-			//if(SHIFTED&0x00800000)
-			//  SHIFTED|=0xFF000000;
-		}
-		else if(SHIFT==3)
-		{
-			SHIFTED=ACC;
-			SHIFTED<<=8;
-			SHIFTED>>=8;
-			//SHIFTED&=0x00FFFFFF;
-			//if(SHIFTED&0x00800000)
-			//  SHIFTED|=0xFF000000;
-		}
 
 		//ACCUM
 		Y<<=19;
 		Y>>=19;
-		//if(Y&0x1000)
-		//  Y|=0xFFFFF000;
 
 		v=(((INT64) X*(INT64) Y)>>12);
 		ACC=(int) v+B;
 
-		if(TWT)
-			DSP->TEMP[(TWA+DSP->DEC)&0x7F]=SHIFTED;
+		if(S->TWT)
+			DSP->TEMP[(S->TWA+DSP->DEC)&0x7F]=SHIFTED;
 
-		if(FRCL)
+		if(S->FRCL)
 		{
-			if(SHIFT==3)
+			if(S->SHIFT==3)
 				FRC_REG=SHIFTED&0x0FFF;
 			else
 				FRC_REG=(SHIFTED>>11)&0x1FFF;
 		}
 
-		if(MRD || MWT)
-		//if(0)
+		if(S->MRD || S->MWT)
 		{
-			ADDR=DSP->MADRS[MASA];
-			if(!TABLE)
+			ADDR=DSP->MADRS[S->MASA];
+			if(!S->TABLE)
 				ADDR+=DSP->DEC;
-			if(ADREB)
+			if(S->ADREB)
 				ADDR+=ADRS_REG&0x0FFF;
-			if(NXADR)
+			if(S->NXADR)
 				ADDR++;
-			if(!TABLE)
+			if(!S->TABLE)
 				ADDR&=DSP->RBL-1;
 			else
 				ADDR&=0xFFFF;
-			//ADDR<<=1;
-			//ADDR+=DSP->RBP<<13;
-			//MEMVAL=DSP->SCSPRAM[ADDR>>1];
 			ADDR+=DSP->RBP<<12;
 			if (ADDR > 0x7ffff) ADDR = 0;
-			if(MRD && (step&1))	//memory only allowed on odd? DoA inserts NOPs on even
+			if(S->MRD)
 			{
-				if(NOFL)
+				if(S->NOFL)
 					MEMVAL=DSP->SCSPRAM[ADDR]<<8;
 				else
 					MEMVAL=UNPACK(DSP->SCSPRAM[ADDR]);
 			}
-			if(MWT && (step&1))
+			if(S->MWT)
 			{
-				if(NOFL)
-			    		DSP->SCSPRAM[ADDR]=SHIFTED>>8;
+				if(S->NOFL)
+					DSP->SCSPRAM[ADDR]=SHIFTED>>8;
 				else
 					DSP->SCSPRAM[ADDR]=PACK(SHIFTED);
 			}
 		}
 
-		if(ADRL)
+		if(S->ADRL)
 		{
-			if(SHIFT==3)
+			if(S->SHIFT==3)
 				ADRS_REG=(SHIFTED>>12)&0xFFF;
 			else
 				ADRS_REG=(INPUTS>>16);
 		}
 
-		if(EWT)
-			DSP->EFREG[EWA]+=SHIFTED>>8;
-
+		if(S->EWT)
+			DSP->EFREG[S->EWA]+=SHIFTED>>8;
 	}
+
+	if(DSP->Abort)
+		return;
 	--DSP->DEC;
 	memset(DSP->MIXS,0,4*16);
-//  if(f)
-//      fclose(f);
+}
+
+void SCSPDSP_Step(struct _SCSPDSP *DSP)
+{
+	if(DSP->Stopped)
+		return;
+
+	if(DSP->Dirty)
+		SCSPDSP_Compile(DSP);
+
+	SCSPDSP_Run(DSP);
 }
 
 void SCSPDSP_SetSample(struct _SCSPDSP *DSP,INT32 sample,int SEL,int MXL)
@@ -350,5 +364,6 @@ void SCSPDSP_Start(struct _SCSPDSP *DSP)
 			break;
 	}
 	DSP->LastStep=i+1;
+	DSP->Dirty=1;
 
 }
@@ -3,6 +3,15 @@
 #ifndef __SCSPDSP_H__
 #define __SCSPDSP_H__
 
+//a microcode step with its fields decoded, built from MPRO when the program changes
+struct _SCSPDSP_STEP
+{
+	UINT8 TRA,TWT,TWA;
+	UINT8 XSEL,YSEL,IRA,IWT,IWA;
+	UINT8 TABLE,MWT,MRD,EWT,EWA,ADRL,FRCL,SHIFT,YRL,NEGB,ZERO,BSEL;
+	UINT8 NOFL,COEF,MASA,ADREB,NXADR;
+};
+
 //the DSP Context
 struct _SCSPDSP
 {
@@ -30,6 +39,12 @@ struct _SCSPDSP
 
 	int Stopped;
 	int LastStep;
+
+//compiled program
+	struct _SCSPDSP_STEP Steps[128];	//steps that affect the output, in program order
+	int NumSteps;
+	int Abort;	//the program ends on an invalid input, skipping the DEC update
+	int Dirty;	//MPRO was written since the program was compiled
 };
 
 void SCSPDSP_Init(struct _SCSPDSP *DSP);
@@ -171,6 +171,30 @@ typedef struct
 } YM2151;
 
 
+/* The update function renders in blocks of up to YM2151_BLOCK_SIZE samples.
+   The envelope generator timer, the LFO and the noise generator only depend
+   on the sample clock, so they are stepped once per block into a timeline
+   and each channel is then run over the whole block on its own, which lets
+   channels that have gone silent be skipped.  Without the MAME timers,
+   timer A may request a CSM key-on on any sample, so single samples are used. */
+#ifdef USE_MAME_TIMERS
+#define YM2151_BLOCK_SIZE	128
+#else
+#define YM2151_BLOCK_SIZE	1
+#endif
+
+typedef struct
+{
+	int			length;							/* samples in this block */
+	UINT32		eg_cnt;							/* eg_cnt at the start of the block */
+	UINT8		eg_ticks[YM2151_BLOCK_SIZE];	/* EG clocks falling on each sample */
+	UINT32		lfa[YM2151_BLOCK_SIZE];			/* LFO AM seen by the operators */
+	INT32		lfp[YM2151_BLOCK_SIZE];			/* LFO PM seen by the phase generator */
+	UINT32		noise_rng[YM2151_BLOCK_SIZE];	/* noise shift register seen by channel 7 */
+	signed int	out[8][YM2151_BLOCK_SIZE];		/* channel outputs */
+} YM2151_BLOCK;
+
+
 #define FREQ_SH			16  /* 16.16 fixed point (frequency calculations) */
 #define EG_SH			16  /* 16.16 fixed point (envelope generator timing) */
 #define LFO_SH			10  /* 22.10 fixed point (LFO calculations)       */
@@ -2004,93 +2028,81 @@ rate 11 1         |
                                  --
 */
 
-INLINE void advance_eg(YM2151 *PSG)
+/* clock the envelope generator of the four operators of a channel once */
+INLINE void advance_eg_channel(YM2151Operator *op, UINT32 eg_cnt)
 {
-	YM2151Operator *op;
 	unsigned int i;
 
-
-
-	PSG->eg_timer += PSG->eg_timer_add;
-
-	while (PSG->eg_timer >= PSG->eg_timer_overflow)
+	/* envelope generator */
+	i = 4;
+	do
 	{
-		PSG->eg_timer -= PSG->eg_timer_overflow;
-
-		PSG->eg_cnt++;
-
-		/* envelope generator */
-		op = &PSG->oper[0];	/* CH 0 M1 */
-		i = 32;
-		do
+		switch(op->state)
 		{
-			switch(op->state)
+		case EG_ATT:	/* attack phase */
+			if ( !(eg_cnt & ((1<<op->eg_sh_ar)-1) ) )
 			{
-			case EG_ATT:	/* attack phase */
-				if ( !(PSG->eg_cnt & ((1<<op->eg_sh_ar)-1) ) )
-				{
-					op->volume += (~op->volume *
-                                   (eg_inc[op->eg_sel_ar + ((PSG->eg_cnt>>op->eg_sh_ar)&7)])
+				op->volume += (~op->volume *
+                                   (eg_inc[op->eg_sel_ar + ((eg_cnt>>op->eg_sh_ar)&7)])
                                   ) >>4;
 
-					if (op->volume <= MIN_ATT_INDEX)
-					{
-						op->volume = MIN_ATT_INDEX;
-						op->state = EG_DEC;
-					}
-
+				if (op->volume <= MIN_ATT_INDEX)
+				{
+					op->volume = MIN_ATT_INDEX;
+					op->state = EG_DEC;
 				}
-			break;
 
-			case EG_DEC:	/* decay phase */
-				if ( !(PSG->eg_cnt & ((1<<op->eg_sh_d1r)-1) ) )
-				{
-					op->volume += eg_inc[op->eg_sel_d1r + ((PSG->eg_cnt>>op->eg_sh_d1r)&7)];
+			}
+		break;
 
-					if ( op->volume >= op->d1l )
-						op->state = EG_SUS;
+		case EG_DEC:	/* decay phase */
+			if ( !(eg_cnt & ((1<<op->eg_sh_d1r)-1) ) )
+			{
+				op->volume += eg_inc[op->eg_sel_d1r + ((eg_cnt>>op->eg_sh_d1r)&7)];
 
-				}
-			break;
+				if ( op->volume >= op->d1l )
+					op->state = EG_SUS;
 
-			case EG_SUS:	/* sustain phase */
-				if ( !(PSG->eg_cnt & ((1<<op->eg_sh_d2r)-1) ) )
-				{
-					op->volume += eg_inc[op->eg_sel_d2r + ((PSG->eg_cnt>>op->eg_sh_d2r)&7)];
+			}
+		break;
 
-					if ( op->volume >= MAX_ATT_INDEX )
-					{
-						op->volume = MAX_ATT_INDEX;
-						op->state = EG_OFF;
-					}
+		case EG_SUS:	/* sustain phase */
+			if ( !(eg_cnt & ((1<<op->eg_sh_d2r)-1) ) )
+			{
+				op->volume += eg_inc[op->eg_sel_d2r + ((eg_cnt>>op->eg_sh_d2r)&7)];
 
+				if ( op->volume >= MAX_ATT_INDEX )
+				{
+					op->volume = MAX_ATT_INDEX;
+					op->state = EG_OFF;
 				}
-			break;
 
-			case EG_REL:	/* release phase */
-				if ( !(PSG->eg_cnt & ((1<<op->eg_sh_rr)-1) ) )
-				{
-					op->volume += eg_inc[op->eg_sel_rr + ((PSG->eg_cnt>>op->eg_sh_rr)&7)];
+			}
+		break;
 
-					if ( op->volume >= MAX_ATT_INDEX )
-					{
-						op->volume = MAX_ATT_INDEX;
-						op->state = EG_OFF;
-					}
+		case EG_REL:	/* release phase */
+			if ( !(eg_cnt & ((1<<op->eg_sh_rr)-1) ) )
+			{
+				op->volume += eg_inc[op->eg_sel_rr + ((eg_cnt>>op->eg_sh_rr)&7)];
 
+				if ( op->volume >= MAX_ATT_INDEX )
+				{
+					op->volume = MAX_ATT_INDEX;
+					op->state = EG_OFF;
 				}
-			break;
+
 			}
-			op++;
-			i--;
-		}while (i);
-	}
+		break;
+		}
+		op++;
+		i--;
+	}while (i);
 }
 
 
-INLINE void advance(YM2151 *PSG)
+/* advance the LFO to the next sample */
+INLINE void advance_lfo(YM2151 *PSG)
 {
-	YM2151Operator *op;
 	unsigned int i;
 	int a,p;
 
@@ -2172,7 +2184,12 @@ INLINE void advance(YM2151 *PSG)
 	}
 	PSG->lfa = a * PSG->amd / 128;
 	PSG->lfp = p * PSG->pmd / 128;
+}
 
+/* advance the noise generator to the next sample */
+INLINE void advance_noise(YM2151 *PSG)
+{
+	unsigned int i;
 
 	/*  The Noise Generator of the YM2151 is 17-bit shift register.
     *   Input to the bit16 is negated (bit0 XOR bit3) (EXNOR).
@@ -2189,49 +2206,50 @@ INLINE void advance(YM2151 *PSG)
 		PSG->noise_rng = (j<<16) | (PSG->noise_rng>>1);
 		i--;
 	}
+}
 
-
+/* advance the phase counters of the four operators of a channel by one sample */
+INLINE void advance_phase_channel(YM2151 *PSG, YM2151Operator *op, INT32 lfp)
+{
 	/* phase generator */
-	op = &PSG->oper[0];	/* CH 0 M1 */
-	i = 8;
-	do
+	if (op->pms)	/* only when phase modulation from LFO is enabled for this channel */
 	{
-		if (op->pms)	/* only when phase modulation from LFO is enabled for this channel */
-		{
-			INT32 mod_ind = PSG->lfp;		/* -128..+127 (8bits signed) */
-			if (op->pms < 6)
-				mod_ind >>= (6 - op->pms);
-			else
-				mod_ind <<= (op->pms - 5);
+		INT32 mod_ind = lfp;		/* -128..+127 (8bits signed) */
+		if (op->pms < 6)
+			mod_ind >>= (6 - op->pms);
+		else
+			mod_ind <<= (op->pms - 5);
 
-			if (mod_ind)
-			{
-				UINT32 kc_channel =	op->kc_i + mod_ind;
-				(op+0)->phase += ( (PSG->freq[ kc_channel + (op+0)->dt2 ] + (op+0)->dt1) * (op+0)->mul ) >> 1;
-				(op+1)->phase += ( (PSG->freq[ kc_channel + (op+1)->dt2 ] + (op+1)->dt1) * (op+1)->mul ) >> 1;
-				(op+2)->phase += ( (PSG->freq[ kc_channel + (op+2)->dt2 ] + (op+2)->dt1) * (op+2)->mul ) >> 1;
-				(op+3)->phase += ( (PSG->freq[ kc_channel + (op+3)->dt2 ] + (op+3)->dt1) * (op+3)->mul ) >> 1;
-			}
-			else		/* phase modulation from LFO is equal to zero */
-			{
-				(op+0)->phase += (op+0)->freq;
-				(op+1)->phase += (op+1)->freq;
-				(op+2)->phase += (op+2)->freq;
-				(op+3)->phase += (op+3)->freq;
-			}
+		if (mod_ind)
+		{
+			UINT32 kc_channel =	op->kc_i + mod_ind;
+			(op+0)->phase += ( (PSG->freq[ kc_channel + (op+0)->dt2 ] + (op+0)->dt1) * (op+0)->mul ) >> 1;
+			(op+1)->phase += ( (PSG->freq[ kc_channel + (op+1)->dt2 ] + (op+1)->dt1) * (op+1)->mul ) >> 1;
+			(op+2)->phase += ( (PSG->freq[ kc_channel + (op+2)->dt2 ] + (op+2)->dt1) * (op+2)->mul ) >> 1;
+			(op+3)->phase += ( (PSG->freq[ kc_channel + (op+3)->dt2 ] + (op+3)->dt1) * (op+3)->mul ) >> 1;
 		}
-		else			/* phase modulation from LFO is disabled */
+		else		/* phase modulation from LFO is equal to zero */
 		{
 			(op+0)->phase += (op+0)->freq;
 			(op+1)->phase += (op+1)->freq;
 			(op+2)->phase += (op+2)->freq;
 			(op+3)->phase += (op+3)->freq;
 		}
+	}
+	else			/* phase modulation from LFO is disabled */
+	{
+		(op+0)->phase += (op+0)->freq;
+		(op+1)->phase += (op+1)->freq;
+		(op+2)->phase += (op+2)->freq;
+		(op+3)->phase += (op+3)->freq;
+	}
+}
 
-		op+=4;
-		i--;
-	}while (i);
-
+/* run a pending CSM KEY ON / KEY OFF sequence */
+INLINE void advance_csm(YM2151 *PSG)
+{
+	YM2151Operator *op;
+	unsigned int i;
 
 	/* CSM is calculated *after* the phase generator calculations (verified on real chip)
     * CSM keyon line seems to be ORed with the KO line inside of the chip.
@@ -2271,6 +2289,108 @@ INLINE void advance(YM2151 *PSG)
 	}
 }
 
+/* a channel whose operators have all finished their release and whose
+   feedback and MEM delay lines are empty produces nothing but silence
+   (channel 7 noise included) until it is keyed on again; only its phase
+   counters keep running */
+INLINE int chan_is_silent(YM2151Operator *op)
+{
+	int s;
+
+	if (op->fb_out_prev | op->fb_out_curr | op->mem_value)
+		return 0;
+
+	for (s = 0; s < 4; s++)
+		if (op[s].state != EG_OFF || op[s].volume < MAX_ATT_INDEX)
+			return 0;
+
+	return 1;
+}
+
+/* step the envelope generator timer, the LFO and the noise generator
+   across one block */
+INLINE void block_timeline(YM2151 *PSG, YM2151_BLOCK *blk, int length)
+{
+	int i;
+
+	blk->length = length;
+	blk->eg_cnt = PSG->eg_cnt;
+
+	for (i = 0; i < length; i++)
+	{
+		UINT8 ticks = 0;
+
+		PSG->eg_timer += PSG->eg_timer_add;
+		while (PSG->eg_timer >= PSG->eg_timer_overflow)
+		{
+			PSG->eg_timer -= PSG->eg_timer_overflow;
+			PSG->eg_cnt++;
+			ticks++;
+		}
+		blk->eg_ticks[i] = ticks;
+
+		/* the output uses the current values, LFO and noise advance afterwards */
+		blk->lfa[i] = PSG->lfa;
+		blk->noise_rng[i] = PSG->noise_rng;
+
+		advance_lfo(PSG);
+		advance_noise(PSG);
+		blk->lfp[i] = PSG->lfp;
+	}
+}
+
+/* calculate one channel over a whole block into blk->out[chan] */
+static void chan_calc_block(YM2151 *PSG, unsigned int chan, YM2151_BLOCK *blk)
+{
+	YM2151Operator *op = &PSG->oper[chan*4];
+	UINT32 lfa = PSG->lfa;
+	UINT32 noise_rng = PSG->noise_rng;
+	UINT32 eg_cnt = blk->eg_cnt;
+	signed int *out = blk->out[chan];
+	int i, t, s;
+
+	if (chan_is_silent(op))
+	{
+		/* released operators are not touched by the envelope generator */
+		memset(out, 0, blk->length * sizeof(*out));
+
+		if (op->pms)
+		{
+			for (i = 0; i < blk->length; i++)
+				advance_phase_channel(PSG, op, blk->lfp[i]);
+		}
+		else
+		{
+			for (s = 0; s < 4; s++)
+				op[s].phase += op[s].freq * blk->length;
+		}
+		PSG->chanout[chan] = 0;
+		return;
+	}
+
+	for (i = 0; i < blk->length; i++)
+	{
+		for (t = blk->eg_ticks[i]; t; t--)
+			advance_eg_channel(op, ++eg_cnt);
+
+		PSG->lfa = blk->lfa[i];
+		PSG->chanout[chan] = 0;
+		if (chan == 7)
+		{
+			PSG->noise_rng = blk->noise_rng[i];
+			chan7_calc(PSG);
+		}
+		else
+			chan_calc(PSG, chan);
+		out[i] = PSG->chanout[chan];
+
+		advance_phase_channel(PSG, op, blk->lfp[i]);
+	}
+
+	PSG->lfa = lfa;
+	PSG->noise_rng = noise_rng;
+}
+
 #if 0
 INLINE signed int acc_calc(signed int value)
 {
@@ -2376,8 +2496,8 @@ INLINE signed int acc_calc(signed int value)
 void ym2151_update_one(void *chip, SAMP **buffers, int length)
 {
 	YM2151 *PSG = (YM2151 *)chip;
-	signed int *chanout = PSG->chanout;
-	int i;
+	YM2151_BLOCK blk;
+	int i,j;
 	signed int outl,outr;
 	SAMP *bufL, *bufR;
 
@@ -2403,86 +2523,94 @@ void ym2151_update_one(void *chip, SAMP **buffers, int length)
 	}
 #endif
 
-	for (i=0; i<length; i++)
+	for (i=0; i<length; i+=blk.length)
 	{
-		advance_eg(PSG);
-
-		chanout[0] = 0;
-		chanout[1] = 0;
-		chanout[2] = 0;
-		chanout[3] = 0;
-		chanout[4] = 0;
-		chanout[5] = 0;
-		chanout[6] = 0;
-		chanout[7] = 0;
-
-		chan_calc(PSG, 0);
-		SAVE_SINGLE_CHANNEL(0)
-		chan_calc(PSG, 1);
-		SAVE_SINGLE_CHANNEL(1)
-		chan_calc(PSG, 2);
-		SAVE_SINGLE_CHANNEL(2)
-		chan_calc(PSG, 3);
-		SAVE_SINGLE_CHANNEL(3)
-		chan_calc(PSG, 4);
-		SAVE_SINGLE_CHANNEL(4)
-		chan_calc(PSG, 5);
-		SAVE_SINGLE_CHANNEL(5)
-		chan_calc(PSG, 6);
-		SAVE_SINGLE_CHANNEL(6)
-		chan7_calc(PSG);
-		SAVE_SINGLE_CHANNEL(7)
-
-		outl = chanout[0] & PSG->pan[0];
-		outr = chanout[0] & PSG->pan[1];
-		outl += (chanout[1] & PSG->pan[2]);
-		outr += (chanout[1] & PSG->pan[3]);
-		outl += (chanout[2] & PSG->pan[4]);
-		outr += (chanout[2] & PSG->pan[5]);
-		outl += (chanout[3] & PSG->pan[6]);
-		outr += (chanout[3] & PSG->pan[7]);
-		outl += (chanout[4] & PSG->pan[8]);
-		outr += (chanout[4] & PSG->pan[9]);
-		outl += (chanout[5] & PSG->pan[10]);
-		outr += (chanout[5] & PSG->pan[11]);
-		outl += (chanout[6] & PSG->pan[12]);
-		outr += (chanout[6] & PSG->pan[13]);
-		outl += (chanout[7] & PSG->pan[14]);
-		outr += (chanout[7] & PSG->pan[15]);
-
-		outl >>= FINAL_SH;
-		outr >>= FINAL_SH;
-		if (outl > MAXOUT) outl = MAXOUT;
-			else if (outl < MINOUT) outl = MINOUT;
-		if (outr > MAXOUT) outr = MAXOUT;
-			else if (outr < MINOUT) outr = MINOUT;
-		((SAMP*)bufL)[i] = (SAMP)outl;
-		((SAMP*)bufR)[i] = (SAMP)outr;
-
-		SAVE_ALL_CHANNELS
+		/* a pending CSM sequence changes the key state after this sample */
+		block_timeline(PSG, &blk, PSG->csm_req ? 1 : MIN(length - i, YM2151_BLOCK_SIZE));
+
+		chan_calc_block(PSG, 0, &blk);
+		chan_calc_block(PSG, 1, &blk);
+		chan_calc_block(PSG, 2, &blk);
+		chan_calc_block(PSG, 3, &blk);
+		chan_calc_block(PSG, 4, &blk);
+		chan_calc_block(PSG, 5, &blk);
+		chan_calc_block(PSG, 6, &blk);
+		chan_calc_block(PSG, 7, &blk);
+
+		for (j=0; j<blk.length; j++)
+		{
+			signed int chanout[8];
+
+			chanout[0] = blk.out[0][j];
+			chanout[1] = blk.out[1][j];
+			chanout[2] = blk.out[2][j];
+			chanout[3] = blk.out[3][j];
+			chanout[4] = blk.out[4][j];
+			chanout[5] = blk.out[5][j];
+			chanout[6] = blk.out[6][j];
+			chanout[7] = blk.out[7][j];
+
+			SAVE_SINGLE_CHANNEL(0)
+			SAVE_SINGLE_CHANNEL(1)
+			SAVE_SINGLE_CHANNEL(2)
+			SAVE_SINGLE_CHANNEL(3)
+			SAVE_SINGLE_CHANNEL(4)
+			SAVE_SINGLE_CHANNEL(5)
+			SAVE_SINGLE_CHANNEL(6)
+			SAVE_SINGLE_CHANNEL(7)
+
+			outl = chanout[0] & PSG->pan[0];
+			outr = chanout[0] & PSG->pan[1];
+			outl += (chanout[1] & PSG->pan[2]);
+			outr += (chanout[1] & PSG->pan[3]);
+			outl += (chanout[2] & PSG->pan[4]);
+			outr += (chanout[2] & PSG->pan[5]);
+			outl += (chanout[3] & PSG->pan[6]);
+			outr += (chanout[3] & PSG->pan[7]);
+			outl += (chanout[4] & PSG->pan[8]);
+			outr += (chanout[4] & PSG->pan[9]);
+			outl += (chanout[5] & PSG->pan[10]);
+			outr += (chanout[5] & PSG->pan[11]);
+			outl += (chanout[6] & PSG->pan[12]);
+			outr += (chanout[6] & PSG->pan[13]);
+			outl += (chanout[7] & PSG->pan[14]);
+			outr += (chanout[7] & PSG->pan[15]);
+
+			outl >>= FINAL_SH;
+			outr >>= FINAL_SH;
+			if (outl > MAXOUT) outl = MAXOUT;
+				else if (outl < MINOUT) outl = MINOUT;
+			if (outr > MAXOUT) outr = MAXOUT;
+				else if (outr < MINOUT) outr = MINOUT;
+			((SAMP*)bufL)[i+j] = (SAMP)outl;
+			((SAMP*)bufR)[i+j] = (SAMP)outr;
+
+			SAVE_ALL_CHANNELS
 
 #ifdef USE_MAME_TIMERS
-		/* ASG 980324 - handled by real timers now */
+			/* ASG 980324 - handled by real timers now */
 #else
-		/* calculate timer A */
-		if (PSG->tim_A)
-		{
-			PSG->tim_A_val -= ( 1 << TIMER_SH );
-			if (PSG->tim_A_val <= 0)
+			/* calculate timer A */
+			if (PSG->tim_A)
 			{
-				PSG->tim_A_val += PSG->tim_A_tab[ PSG->timer_A_index ];
-				if (PSG->irq_enable & 0x04)
+				PSG->tim_A_val -= ( 1 << TIMER_SH );
+				if (PSG->tim_A_val <= 0)
 				{
-					int oldstate = PSG->status & 3;
-					PSG->status |= 1;
-					if ((!oldstate) && (PSG->irqhandler)) (*PSG->irqhandler)(chip->device, 1);
+					PSG->tim_A_val += PSG->tim_A_tab[ PSG->timer_A_index ];
+					if (PSG->irq_enable & 0x04)
+					{
+						int oldstate = PSG->status & 3;
+						PSG->status |= 1;
+						if ((!oldstate) && (PSG->irqhandler)) (*PSG->irqhandler)(chip->device, 1);
+					}
+					if (PSG->irq_enable & 0x80)
+						PSG->csm_req = 2;	/* request KEY ON / KEY OFF sequence */
 				}
-				if (PSG->irq_enable & 0x80)
-					PSG->csm_req = 2;	/* request KEY ON / KEY OFF sequence */
 			}
-		}
 #endif
-		advance(PSG);
+		}
+
+		advance_csm(PSG);
 	}
 }
 
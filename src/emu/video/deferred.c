@@ -0,0 +1,271 @@
+/***************************************************************************
+
+    deferred.c
+
+    Deferred, parallel scanline rendering helper.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "emuopts.h"
+#include "deferred.h"
+
+
+/***************************************************************************
+    TYPE DEFINITIONS
+***************************************************************************/
+
+/* work item for one band of lines */
+typedef struct _deferred_band deferred_band;
+struct _deferred_band
+{
+	deferred_manager *	deferred;				/* back pointer to the manager */
+	void *				state;					/* driver per-band state */
+	int					first;					/* first line record */
+	int					count;					/* number of line records */
+};
+
+
+/* deferred scanline manager */
+struct _deferred_manager
+{
+	osd_work_queue *	queue;					/* work queue the bands are drawn on */
+	deferred_band_func	band_func;				/* draws a band */
+	deferred_done_func	done_func;				/* called once all bands are drawn */
+	void *				param;					/* parameter for both callbacks */
+
+	UINT8 *				lines;					/* line records */
+	int *				line_snapshot;			/* snapshot index per line; snapshot_count means live memory */
+	size_t				record_size;			/* size of a line record */
+	int					max_lines;				/* number of line records */
+	int					count;					/* number of recorded lines */
+	int					last_line;				/* last line captured */
+	int					immediate;				/* rendering immediately until the end of the frame */
+
+	UINT8 *				snapshots;				/* memory snapshots */
+	size_t				snapshot_size;			/* size of a snapshot */
+	int					snapshot_count;			/* number of snapshots taken */
+	int					snapshot_used;			/* lines have been recorded since the last snapshot */
+
+	deferred_band *		band;					/* band work items */
+	int					numbands;				/* number of bands */
+};
+
+
+
+/***************************************************************************
+    IMPLEMENTATION
+***************************************************************************/
+
+/*-------------------------------------------------
+    deferred_band_callback - work item callback
+    for a band
+-------------------------------------------------*/
+
+static void *deferred_band_callback(void *param, int threadid)
+{
+	deferred_band *band = (deferred_band *)param;
+	deferred_manager *deferred = band->deferred;
+
+	(*deferred->band_func)(deferred, deferred->param, band->state, band->first, band->count);
+	return NULL;
+}
+
+
+/*-------------------------------------------------
+    deferred_presave - draw the pending lines
+    before the state is saved
+-------------------------------------------------*/
+
+static void deferred_presave(deferred_manager *deferred)
+{
+	deferred_sync(deferred);
+}
+
+
+/*-------------------------------------------------
+    deferred_exit - release the work queue
+-------------------------------------------------*/
+
+static void deferred_exit(deferred_manager *deferred)
+{
+	if (deferred->queue != NULL)
+		osd_work_queue_free(deferred->queue);
+	deferred->queue = NULL;
+}
+
+
+/*-------------------------------------------------
+    deferred_alloc - allocate a deferred manager
+    if deferred rendering is enabled
+-------------------------------------------------*/
+
+deferred_manager *deferred_alloc(running_machine &machine, int max_lines, size_t record_size, size_t snapshot_size, void *bands, size_t band_size, int numbands, deferred_band_func band_func, deferred_done_func done_func, void *param)
+{
+	deferred_manager *deferred;
+	osd_work_queue *queue;
+	int bandnum;
+
+	if (!machine.options().deferred_scanlines())
+		return NULL;
+
+	queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+	if (queue == NULL)
+		return NULL;
+
+	/* allocate the manager itself */
+	deferred = auto_alloc_clear(machine, deferred_manager);
+	deferred->queue = queue;
+	deferred->band_func = band_func;
+	deferred->done_func = done_func;
+	deferred->param = param;
+
+	/* allocate the line records and snapshots; there is at most one snapshot per line */
+	deferred->lines = auto_alloc_array(machine, UINT8, max_lines * record_size);
+	deferred->line_snapshot = auto_alloc_array(machine, int, max_lines);
+	deferred->record_size = record_size;
+	deferred->max_lines = max_lines;
+	deferred->last_line = -1;
+	if (snapshot_size != 0)
+		deferred->snapshots = auto_alloc_array(machine, UINT8, max_lines * snapshot_size);
+	deferred->snapshot_size = snapshot_size;
+
+	/* set up the band work items */
+	deferred->band = auto_alloc_array_clear(machine, deferred_band, numbands);
+	deferred->numbands = numbands;
+	for (bandnum = 0; bandnum < numbands; bandnum++)
+	{
+		deferred->band[bandnum].deferred = deferred;
+		deferred->band[bandnum].state = (UINT8 *)bands + bandnum * band_size;
+	}
+
+	machine.add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(FUNC(deferred_exit), deferred));
+	machine.save().register_presave(save_prepost_delegate(FUNC(deferred_presave), deferred));
+	return deferred;
+}
+
+
+/*-------------------------------------------------
+    deferred_capture - record a line; a line at or
+    above the last one starts a new frame, as does
+    'restart'
+-------------------------------------------------*/
+
+void *deferred_capture(deferred_manager *deferred, int line, int restart)
+{
+	int index;
+
+	if (deferred == NULL)
+		return NULL;
+
+	/* a new frame starts deferring again */
+	if (line <= deferred->last_line || restart || deferred->count == deferred->max_lines)
+	{
+		deferred_render(deferred);
+		deferred->immediate = FALSE;
+	}
+	deferred->last_line = line;
+
+	if (deferred->immediate)
+		return NULL;
+
+	index = deferred->count++;
+	deferred->line_snapshot[index] = deferred->snapshot_count;
+	deferred->snapshot_used = TRUE;
+	return &deferred->lines[index * deferred->record_size];
+}
+
+
+/*-------------------------------------------------
+    deferred_snapshot - get the snapshot to fill
+    in for the lines recorded so far
+-------------------------------------------------*/
+
+void *deferred_snapshot(deferred_manager *deferred)
+{
+	if (deferred == NULL || deferred->count == 0 || !deferred->snapshot_used)
+		return NULL;
+
+	deferred->snapshot_used = FALSE;
+	return &deferred->snapshots[deferred->snapshot_count++ * deferred->snapshot_size];
+}
+
+
+/*-------------------------------------------------
+    deferred_render - draw all the recorded lines
+-------------------------------------------------*/
+
+void deferred_render(deferred_manager *deferred)
+{
+	int numbands, bandnum, first = 0;
+
+	if (deferred == NULL || deferred->count == 0)
+		return;
+
+	g_profiler.start(PROFILER_VIDEO);
+
+	/* split the recorded lines into contiguous bands */
+	numbands = MIN(deferred->numbands, deferred->count);
+	for (bandnum = 0; bandnum < numbands; bandnum++)
+	{
+		deferred_band *band = &deferred->band[bandnum];
+		int last = deferred->count * (bandnum + 1) / numbands;
+
+		band->first = first;
+		band->count = last - first;
+		first = last;
+	}
+
+	osd_work_item_queue_multiple(deferred->queue, deferred_band_callback, numbands, deferred->band, sizeof(deferred->band[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+	osd_work_queue_wait(deferred->queue, 100 * osd_ticks_per_second());
+
+	if (deferred->done_func != NULL)
+		(*deferred->done_func)(deferred, deferred->param, deferred->band[0].state, numbands);
+
+	deferred->count = 0;
+	deferred->snapshot_count = 0;
+	deferred->snapshot_used = FALSE;
+
+	g_profiler.stop();
+}
+
+
+/*-------------------------------------------------
+    deferred_sync - draw the recorded lines and
+    render the rest of the frame immediately
+-------------------------------------------------*/
+
+int deferred_sync(deferred_manager *deferred)
+{
+	if (deferred == NULL || deferred->count == 0)
+		return FALSE;
+
+	deferred_render(deferred);
+	deferred->immediate = TRUE;
+	return TRUE;
+}
+
+
+/*-------------------------------------------------
+    deferred_get_line - get the record for a line
+-------------------------------------------------*/
+
+const void *deferred_get_line(deferred_manager *deferred, int index)
+{
+	return &deferred->lines[index * deferred->record_size];
+}
+
+
+/*-------------------------------------------------
+    deferred_get_line_snapshot - get the snapshot
+    a line was recorded against
+-------------------------------------------------*/
+
+void *deferred_get_line_snapshot(deferred_manager *deferred, int index)
+{
+	int snapshot = deferred->line_snapshot[index];
+
+	if (snapshot >= deferred->snapshot_count)
+		return NULL;
+	return &deferred->snapshots[snapshot * deferred->snapshot_size];
+}
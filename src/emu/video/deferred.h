@@ -0,0 +1,81 @@
+/***************************************************************************
+
+    deferred.h
+
+    Deferred, parallel scanline rendering helper.
+
+****************************************************************************
+
+    With -deferred_scanlines, a driver that supports it records the video
+    state a scanline depends on when the beam reaches that line, instead
+    of drawing it. The recorded lines are drawn in contiguous bands on the
+    osd work queue when the driver asks for them (normally at the end of
+    the visible area).
+
+    Memory the renderer reads directly (palettes, sprite tables) can be
+    snapshotted before it is modified; each line is drawn against the
+    snapshot that was current when it was recorded. State that cannot be
+    recorded or snapshotted is handled by calling deferred_sync, which
+    draws the pending lines and renders the rest of the frame immediately.
+
+***************************************************************************/
+
+#pragma once
+
+#ifndef __DEFERRED_H__
+#define __DEFERRED_H__
+
+
+/***************************************************************************
+    TYPE DEFINITIONS
+***************************************************************************/
+
+/* opaque reference to the deferred scanline manager */
+typedef struct _deferred_manager deferred_manager;
+
+
+/* callback to draw recorded lines first..first+count-1 using the per-band state 'band' */
+typedef void (*deferred_band_func)(deferred_manager *deferred, void *param, void *band, int first, int count);
+
+/* optional callback once all the bands have been drawn, on the emulation thread */
+typedef void (*deferred_done_func)(deferred_manager *deferred, void *param, void *bands, int numbands);
+
+
+
+/***************************************************************************
+    FUNCTION PROTOTYPES
+***************************************************************************/
+
+/* ----- initialization ----- */
+
+/* allocate a deferred manager; returns NULL if deferred rendering is disabled */
+deferred_manager *deferred_alloc(running_machine &machine, int max_lines, size_t record_size, size_t snapshot_size, void *bands, size_t band_size, int numbands, deferred_band_func band_func, deferred_done_func done_func, void *param);
+
+
+
+/* ----- emulation side ----- */
+
+/* record a line; returns a record to fill in, or NULL if the line must be drawn right away */
+void *deferred_capture(deferred_manager *deferred, int line, int restart);
+
+/* get a snapshot to fill in before snapshotted memory changes, or NULL if none is needed */
+void *deferred_snapshot(deferred_manager *deferred);
+
+/* draw all the recorded lines */
+void deferred_render(deferred_manager *deferred);
+
+/* draw the recorded lines and render the rest of the frame immediately; returns TRUE if there were any */
+int deferred_sync(deferred_manager *deferred);
+
+
+
+/* ----- band renderer side ----- */
+
+/* get the record for a line */
+const void *deferred_get_line(deferred_manager *deferred, int index);
+
+/* get the snapshot a line was recorded against, or NULL if it uses the live memory */
+void *deferred_get_line_snapshot(deferred_manager *deferred, int index);
+
+
+#endif	/* __DEFERRED_H__ */
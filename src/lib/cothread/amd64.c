@@ -37,7 +37,7 @@ static void (*co_swap)(cothread_t, cothread_t) = 0;
 
   #include <windows.h>
 
-  void co_init() {
+  void co_init(void) {
     DWORD old_privileges;
     VirtualProtect(co_swap_function, sizeof co_swap_function, PAGE_EXECUTE_READWRITE, &old_privileges);
   }
@@ -53,7 +53,7 @@ static void (*co_swap)(cothread_t, cothread_t) = 0;
   #include <unistd.h>
   #include <sys/mman.h>
 
-  void co_init() {
+  void co_init(void) {
     unsigned long long addr = (unsigned long long)co_swap_function;
     unsigned long long base = addr - (addr % sysconf(_SC_PAGESIZE));
     unsigned long long size = (addr - base) + sizeof co_swap_function;
@@ -61,11 +61,11 @@ static void (*co_swap)(cothread_t, cothread_t) = 0;
   }
 #endif
 
-static void crash() {
+static void crash(void) {
   assert(0); /* called only if cothread_t entrypoint returns */
 }
 
-cothread_t co_active() {
+cothread_t co_active(void) {
   if(!co_active_handle) co_active_handle = &co_active_buffer;
   return co_active_handle;
 }
@@ -21,7 +21,7 @@ static void __stdcall co_thunk(void *coentry) {
   ((void (*)(void))coentry)();
 }
 
-cothread_t co_active() {
+cothread_t co_active(void) {
   if(!co_active_) {
     ConvertThreadToFiber(0);
     co_active_ = GetCurrentFiber();
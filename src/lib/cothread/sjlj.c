@@ -36,7 +36,7 @@ static void springboard(int ignored) {
   }
 }
 
-cothread_t co_active() {
+cothread_t co_active(void) {
   if(!co_running) co_running = &co_primary;
   return (cothread_t)co_running;
 }
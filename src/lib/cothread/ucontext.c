@@ -28,7 +28,7 @@ extern "C" {
 static thread_local ucontext_t co_primary;
 static thread_local ucontext_t *co_running = 0;
 
-cothread_t co_active() {
+cothread_t co_active(void) {
   if(!co_running) co_running = &co_primary;
   return (cothread_t)co_running;
 }
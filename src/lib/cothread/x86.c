@@ -34,7 +34,7 @@ static unsigned char co_swap_function[] = {
 #ifdef _WIN32
   #include <windows.h>
 
-  void co_init() {
+  void co_init(void) {
     DWORD old_privileges;
     VirtualProtect(co_swap_function, sizeof co_swap_function, PAGE_EXECUTE_READWRITE, &old_privileges);
   }
@@ -42,14 +42,14 @@ static unsigned char co_swap_function[] = {
   #define INCL_DOS
   #include <os2.h>
 
-  void co_init() {
+  void co_init(void) {
     DosSetMem(co_swap_function, sizeof co_swap_function, PAG_READ | PAG_WRITE | PAG_EXECUTE);
   }
 #else
   #include <unistd.h>
   #include <sys/mman.h>
 
-  void co_init() {
+  void co_init(void) {
     unsigned long addr = (unsigned long)co_swap_function;
     unsigned long base = addr - (addr % sysconf(_SC_PAGESIZE));
     unsigned long size = (addr - base) + sizeof co_swap_function;
@@ -57,11 +57,11 @@ static unsigned char co_swap_function[] = {
   }
 #endif
 
-static void crash() {
+static void crash(void) {
   assert(0); /* called only if cothread_t entrypoint returns */
 }
 
-cothread_t co_active() {
+cothread_t co_active(void) {
   if(!co_active_handle) co_active_handle = &co_active_buffer;
   return co_active_handle;
 }
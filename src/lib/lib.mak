@@ -22,6 +22,7 @@ OBJDIRS += \
 	$(LIBOBJ)/libjpeg \
 	$(LIBOBJ)/libflac \
 	$(LIBOBJ)/lib7z \
+	$(LIBOBJ)/cothread \
 
 
 
@@ -64,6 +65,21 @@ $(OBJ)/libutil.a: $(UTILOBJS)
 
 
 
+#-------------------------------------------------
+# cothread library objects
+#-------------------------------------------------
+
+COTHREADOBJS = \
+	$(LIBOBJ)/cothread/libco.o \
+
+$(OBJ)/libco.a: $(COTHREADOBJS)
+
+$(LIBOBJ)/cothread/%.o: $(LIBSRC)/cothread/%.c | $(OSPREBUILD)
+	@echo Compiling $<...
+	$(CC) $(CDEFS) $(CCOMFLAGS) $(CONLYFLAGS) -c $< -o $@
+
+
+
 #-------------------------------------------------
 # expat library objects
 #-------------------------------------------------
@@ -82,18 +82,54 @@ const int ECC_Q_OFFSET = ECC_P_OFFSET + 2 * ECC_P_NUM_BYTES;
 const int ECC_Q_NUM_BYTES = 52;		// 2 lots of 52
 const int ECC_Q_COMP = 43;			// 43 bytes each
 
+const int CACHE_HUNKS = 64;			// hunks held in the sector cache
+const int CACHE_STREAMS = 2;		// sequential streams tracked for read-ahead
+const int READAHEAD_HUNKS = 8;		// hunks to read ahead of a sequential stream
+
 
 
 /***************************************************************************
     TYPE DEFINITIONS
 ***************************************************************************/
 
+/* a hunk held in the sector cache */
+struct cdrom_cache_entry
+{
+	UINT32				hunknum;			/* hunk number, or ~0 if unused */
+	UINT32				lastuse;			/* cache clock at last access */
+	UINT8 *				data;				/* hunk contents */
+};
+
+
+/* a sequential reader, such as the data path or CD audio playback */
+struct cdrom_stream
+{
+	cdrom_file *		file;				/* owning file */
+	UINT32				lasthunk;			/* last hunk read by this stream */
+	UINT32				lastuse;			/* cache clock at last access */
+	UINT32				prefetchnext;		/* next hunk to read ahead */
+	UINT32				prefetchend;		/* end of the read-ahead range */
+	UINT8				prefetching;		/* is a read-ahead work item queued? */
+	UINT8 *				prefetchdata;		/* hunk buffer read-ahead decodes into */
+};
+
+
 struct _cdrom_file
 {
 	chd_file *			chd;				/* CHD file */
 	cdrom_toc			cdtoc;				/* TOC for the CD */
 	chdcd_track_input_info track_info;		/* track info */
 	core_file *			fhandle[CD_MAX_TRACKS];/* file handle */
+
+	/* sector cache for CHDs; while present, all CHD accesses happen under chdlock */
+	UINT32				framesperhunk;		/* frames in each CHD hunk */
+	cdrom_cache_entry	cache[CACHE_HUNKS];	/* cached hunks */
+	dynamic_buffer		cachedata;			/* hunk data for all entries and streams */
+	UINT32				cacheclock;			/* clock for least-recently-used replacement */
+	cdrom_stream		stream[CACHE_STREAMS];/* sequential streams */
+	osd_lock *			lock;				/* lock protecting the cache and the streams */
+	osd_lock *			chdlock;			/* lock serializing reads from the CHD */
+	osd_work_queue *	queue;				/* queue for read-ahead */
 };
 
 
@@ -126,6 +162,217 @@ INLINE UINT32 physical_to_chd_lba(cdrom_file *file, UINT32 physlba, UINT32 &trac
 
 
 
+/***************************************************************************
+    SECTOR CACHE
+***************************************************************************/
+
+/*-------------------------------------------------
+    cache_find - find the cache entry holding
+    a hunk; must hold the lock
+-------------------------------------------------*/
+
+static cdrom_cache_entry *cache_find(cdrom_file *file, UINT32 hunknum)
+{
+	for (int entrynum = 0; entrynum < CACHE_HUNKS; entrynum++)
+		if (file->cache[entrynum].hunknum == hunknum)
+		{
+			file->cache[entrynum].lastuse = ++file->cacheclock;
+			return &file->cache[entrynum];
+		}
+	return NULL;
+}
+
+
+/*-------------------------------------------------
+    cache_victim - pick the least recently used
+    cache entry and empty it; must hold the lock
+-------------------------------------------------*/
+
+static cdrom_cache_entry *cache_victim(cdrom_file *file)
+{
+	cdrom_cache_entry *victim = &file->cache[0];
+	for (int entrynum = 1; entrynum < CACHE_HUNKS && victim->hunknum != ~0; entrynum++)
+		if (file->cache[entrynum].hunknum == ~0 || file->cache[entrynum].lastuse - victim->lastuse > 0x80000000)
+			victim = &file->cache[entrynum];
+
+	victim->hunknum = ~0;
+	return victim;
+}
+
+
+/*-------------------------------------------------
+    cache_load - read a hunk into the least
+    recently used cache entry; must hold both
+    the lock and the CHD lock
+-------------------------------------------------*/
+
+static cdrom_cache_entry *cache_load(cdrom_file *file, UINT32 hunknum)
+{
+	cdrom_cache_entry *victim = cache_victim(file);
+	if (file->chd->read_hunk(hunknum, victim->data) != CHDERR_NONE)
+		return NULL;
+	victim->hunknum = hunknum;
+	victim->lastuse = ++file->cacheclock;
+	return victim;
+}
+
+
+/*-------------------------------------------------
+    prefetch_callback - work queue callback to
+    read ahead of a sequential stream
+-------------------------------------------------*/
+
+static void *prefetch_callback(void *param, int threadid)
+{
+	cdrom_stream *stream = (cdrom_stream *)param;
+	cdrom_file *file = stream->file;
+
+	osd_lock_acquire(file->lock);
+	while (stream->prefetchnext < stream->prefetchend)
+	{
+		UINT32 hunknum = stream->prefetchnext++;
+		if (cache_find(file, hunknum) != NULL)
+			continue;
+
+		/* decode into our own buffer with the cache unlocked, so hits are never held up */
+		osd_lock_release(file->lock);
+		osd_lock_acquire(file->chdlock);
+		chd_error err = file->chd->read_hunk(hunknum, stream->prefetchdata);
+		osd_lock_release(file->chdlock);
+		osd_lock_acquire(file->lock);
+
+		/* publish by swapping buffers with a victim, unless a demand read got there first */
+		if (err == CHDERR_NONE && cache_find(file, hunknum) == NULL)
+		{
+			cdrom_cache_entry *victim = cache_victim(file);
+			UINT8 *data = victim->data;
+			victim->data = stream->prefetchdata;
+			stream->prefetchdata = data;
+			victim->hunknum = hunknum;
+			victim->lastuse = ++file->cacheclock;
+		}
+	}
+	stream->prefetching = FALSE;
+	osd_lock_release(file->lock);
+	return NULL;
+}
+
+
+/*-------------------------------------------------
+    cache_track_stream - note an access to a hunk
+    and start reading ahead if it continues a
+    sequential stream; must hold the lock
+-------------------------------------------------*/
+
+static void cache_track_stream(cdrom_file *file, UINT32 hunknum)
+{
+	/* find the stream this access continues, or replace the oldest one */
+	cdrom_stream *stream = NULL;
+	cdrom_stream *oldest = &file->stream[0];
+	for (int streamnum = 0; streamnum < CACHE_STREAMS; streamnum++)
+	{
+		cdrom_stream *curstream = &file->stream[streamnum];
+		if (hunknum == curstream->lasthunk || hunknum == curstream->lasthunk + 1)
+		{
+			stream = curstream;
+			break;
+		}
+		if (curstream->lastuse - oldest->lastuse > 0x80000000)
+			oldest = curstream;
+	}
+	if (stream == NULL)
+	{
+		oldest->lasthunk = hunknum;
+		oldest->lastuse = file->cacheclock;
+		oldest->prefetchnext = oldest->prefetchend = 0;
+		return;
+	}
+	stream->lasthunk = hunknum;
+	stream->lastuse = file->cacheclock;
+
+	/* extend the read-ahead window past this hunk */
+	UINT32 end = MIN(hunknum + 1 + READAHEAD_HUNKS, file->chd->hunk_count());
+	if (end <= stream->prefetchend)
+		return;
+	if (stream->prefetchnext < hunknum + 1 || stream->prefetchnext > stream->prefetchend)
+		stream->prefetchnext = hunknum + 1;
+	stream->prefetchend = end;
+	if (!stream->prefetching)
+	{
+		stream->prefetching = TRUE;
+		if (osd_work_item_queue(file->queue, prefetch_callback, stream, WORK_ITEM_FLAG_AUTO_RELEASE) == NULL)
+			stream->prefetching = FALSE;
+	}
+}
+
+
+/*-------------------------------------------------
+    cache_read - read part of a frame through the
+    sector cache
+-------------------------------------------------*/
+
+static chd_error cache_read(cdrom_file *file, void *dest, UINT32 chdsector, UINT32 startoffs, UINT32 length)
+{
+	UINT32 hunknum = chdsector / file->framesperhunk;
+	chd_error err = CHDERR_NONE;
+
+	osd_lock_acquire(file->lock);
+	cdrom_cache_entry *entry = cache_find(file, hunknum);
+	if (entry == NULL)
+	{
+		/* wait out any read-ahead decode in progress, since it may be the hunk we want */
+		osd_lock_release(file->lock);
+		osd_lock_acquire(file->chdlock);
+		osd_lock_acquire(file->lock);
+		entry = cache_find(file, hunknum);
+		if (entry == NULL)
+			entry = cache_load(file, hunknum);
+		osd_lock_release(file->chdlock);
+	}
+	if (entry != NULL)
+	{
+		memcpy(dest, &entry->data[(chdsector % file->framesperhunk) * CD_FRAME_SIZE + startoffs], length);
+		cache_track_stream(file, hunknum);
+	}
+	else
+		err = CHDERR_READ_ERROR;
+	osd_lock_release(file->lock);
+	return err;
+}
+
+
+/*-------------------------------------------------
+    cache_init - set up the sector cache for a
+    CHD-backed CD-ROM
+-------------------------------------------------*/
+
+static bool cache_init(cdrom_file *file)
+{
+	UINT32 hunkbytes = file->chd->hunk_bytes();
+
+	file->framesperhunk = hunkbytes / CD_FRAME_SIZE;
+	file->cachedata.resize((CACHE_HUNKS + CACHE_STREAMS) * hunkbytes);
+	for (int entrynum = 0; entrynum < CACHE_HUNKS; entrynum++)
+	{
+		file->cache[entrynum].hunknum = ~0;
+		file->cache[entrynum].lastuse = 0;
+		file->cache[entrynum].data = &file->cachedata[entrynum * hunkbytes];
+	}
+	for (int streamnum = 0; streamnum < CACHE_STREAMS; streamnum++)
+	{
+		file->stream[streamnum].file = file;
+		file->stream[streamnum].lasthunk = ~0;
+		file->stream[streamnum].prefetchdata = &file->cachedata[(CACHE_HUNKS + streamnum) * hunkbytes];
+	}
+
+	file->lock = osd_lock_alloc();
+	file->chdlock = osd_lock_alloc();
+	file->queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_IO);
+	return (file->lock != NULL && file->chdlock != NULL && file->queue != NULL);
+}
+
+
+
 /***************************************************************************
     BASE FUNCTIONALITY
 ***************************************************************************/
@@ -232,6 +479,13 @@ cdrom_file *cdrom_open(chd_file *chd)
 		return NULL;
 	}
 
+	/* set up the sector cache */
+	if (!cache_init(file))
+	{
+		cdrom_close(file);
+		return NULL;
+	}
+
 	LOG(("CD has %d tracks\n", file->cdtoc.numtrks));
 
 	/* calculate the starting frame for each track, keeping in mind that CHDMAN
@@ -283,6 +537,17 @@ void cdrom_close(cdrom_file *file)
 		}
 	}
 
+	/* stop any read-ahead before freeing the cache */
+	if (file->queue != NULL)
+	{
+		osd_work_queue_wait(file->queue, 60 * osd_ticks_per_second());
+		osd_work_queue_free(file->queue);
+	}
+	if (file->lock != NULL)
+		osd_lock_free(file->lock);
+	if (file->chdlock != NULL)
+		osd_lock_free(file->chdlock);
+
 	delete file;
 }
 
@@ -294,9 +559,9 @@ void cdrom_close(cdrom_file *file)
 
 chd_error read_partial_sector(cdrom_file *file, void *dest, UINT32 chdsector, UINT32 tracknum, UINT32 startoffs, UINT32 length)
 {
-	// if a CHD, just read
+	// if a CHD, read through the sector cache
 	if (file->chd != NULL)
-		return file->chd->read_bytes(UINT64(chdsector) * UINT64(CD_FRAME_SIZE) + startoffs, dest, length);
+		return cache_read(file, dest, chdsector, startoffs, length);
 
 	// else read from the appropriate file
 	core_file *srcfile = file->fhandle[tracknum];
@@ -131,6 +131,21 @@ struct chd_file::metadata_hash
 };
 
 
+// ======================> chd_lock_holder
+
+// holds a CHD's lock for as long as it is in scope, so that it is released
+// even when a file access throws
+class chd_lock_holder
+{
+public:
+	chd_lock_holder(osd_lock *lock) : m_lock(lock) { osd_lock_acquire(m_lock); }
+	~chd_lock_holder() { osd_lock_release(m_lock); }
+
+private:
+	osd_lock *				m_lock;			// the lock we hold
+};
+
+
 
 //**************************************************************************
 //  INLINE FUNCTIONS
@@ -201,7 +216,8 @@ inline void chd_file::file_read(UINT64 offset, void *dest, UINT32 length)
 	if (m_file == NULL)
 		throw CHDERR_NOT_OPEN;
 
-	// seek and read
+	// seek and read; other threads share the file position
+	chd_lock_holder lock(m_lock);
 	core_fseek(m_file, offset, SEEK_SET);
 	UINT32 count = core_fread(m_file, dest, length);
 	if (count != length)
@@ -220,7 +236,8 @@ inline void chd_file::file_write(UINT64 offset, const void *source, UINT32 lengt
 	if (m_file == NULL)
 		throw CHDERR_NOT_OPEN;
 
-	// seek and write
+	// seek and write; other threads share the file position
+	chd_lock_holder lock(m_lock);
 	core_fseek(m_file, offset, SEEK_SET);
 	UINT32 count = core_fwrite(m_file, source, length);
 	if (count != length)
@@ -240,7 +257,8 @@ inline UINT64 chd_file::file_append(const void *source, UINT32 length, UINT32 al
 	if (m_file == NULL)
 		throw CHDERR_NOT_OPEN;
 
-	// seek to the end and align if necessary
+	// seek to the end and align if necessary; other threads share the file position
+	chd_lock_holder lock(m_lock);
 	core_fseek(m_file, 0, SEEK_END);
 	if (alignment != 0)
 	{
@@ -297,7 +315,9 @@ inline UINT8 chd_file::bits_for_value(UINT64 value)
 
 chd_file::chd_file()
 	: m_file(NULL),
-      m_owns_file(false)
+      m_owns_file(false),
+	  m_lock(osd_lock_alloc()),
+	  m_reader(NULL)
 {
 	// reset state
 	memset(m_decompressor, 0, sizeof(m_decompressor));
@@ -313,6 +333,7 @@ chd_file::~chd_file()
 {
 	// close any open files
 	close();
+	osd_lock_free(m_lock);
 }
 
 
@@ -394,6 +415,9 @@ sha1_t chd_file::parent_sha1()
 
 chd_error chd_file::hunk_info(UINT32 hunknum, chd_codec_type &compressor, UINT32 &compbytes)
 {
+	// the map can change under a writer on another thread
+	chd_lock_holder lock(m_lock);
+
 	// error if invalid
 	if (hunknum >= m_hunkcount)
 		return CHDERR_HUNK_OUT_OF_RANGE;
@@ -703,6 +727,9 @@ chd_error chd_file::open(core_file &file, bool writeable, chd_file *parent)
 
 void chd_file::close()
 {
+	// wait for any access in progress on another thread
+	chd_lock_holder lock(m_lock);
+
 	// reset file characteristics
 	if (m_owns_file && m_file != NULL)
 		core_fclose(m_file);
@@ -755,6 +782,142 @@ void chd_file::close()
 
 chd_error chd_file::read_hunk(UINT32 hunknum, void *buffer)
 {
+	// decoding shares buffers and decompressors, so only one thread at a time
+	chd_lock_holder lock(m_lock);
+
+	// let an attached parallel reader handle it
+	if (m_reader != NULL)
+		return m_reader->read_hunk(hunknum, buffer);
+	return read_hunk_direct(hunknum, buffer);
+}
+
+
+//-------------------------------------------------
+//  read_compressed_hunk - read the compressed
+//  data for a hunk so the caller can decompress
+//  it on its own thread; codec is set to
+//  CHD_CODEC_NONE if the hunk is not stored
+//  compressed, in which case use read_hunk;
+//  crc and crcbits are for verify_hunk
+//-------------------------------------------------
+
+chd_error chd_file::read_compressed_hunk(UINT32 hunknum, dynamic_buffer &buffer, chd_codec_type &codec, UINT32 &crc, UINT8 &crcbits)
+{
+	// the map can change under a writer on another thread
+	chd_lock_holder lock(m_lock);
+
+	// wrap this for clean reporting
+	try
+	{
+		// punt if no file
+		if (m_file == NULL)
+			throw CHDERR_NOT_OPEN;
+
+		// return an error if out of range
+		if (hunknum >= m_hunkcount)
+			throw CHDERR_HUNK_OUT_OF_RANGE;
+
+		// find the data; anything but a plain compressed hunk is left to read_hunk
+		UINT64 blockoffs;
+		UINT32 blocklen;
+		UINT8 codecindex;
+		codec = CHD_CODEC_NONE;
+		crcbits = 0;
+		if (!compressed_hunk_location(hunknum, blockoffs, blocklen, codecindex, crc, crcbits))
+			return CHDERR_NONE;
+
+		// read it
+		buffer.resize(blocklen);
+		file_read(blockoffs, buffer, blocklen);
+		codec = m_compression[codecindex];
+
+		// lossy codecs checksum the compressed data, so there is nothing left to verify
+		if (m_decompressor[codecindex] != NULL && m_decompressor[codecindex]->lossy())
+		{
+			if (crcbits == 16 && crc16_creator::simple(buffer, blocklen) != crc)
+				throw CHDERR_DECOMPRESSION_ERROR;
+			crcbits = 0;
+		}
+		return CHDERR_NONE;
+	}
+
+	// just return errors
+	catch (chd_error &err)
+	{
+		return err;
+	}
+}
+
+
+//-------------------------------------------------
+//  verify_hunk - check a hunk decoded from the
+//  data returned by read_compressed_hunk against
+//  the CRC stored in the map
+//-------------------------------------------------
+
+chd_error chd_file::verify_hunk(const void *buffer, UINT32 crc, UINT8 crcbits) const
+{
+	if (crcbits == 16 && crc16_creator::simple(buffer, m_hunkbytes) != crc)
+		return CHDERR_DECOMPRESSION_ERROR;
+	if (crcbits == 32 && crc32_creator::simple(buffer, m_hunkbytes) != crc)
+		return CHDERR_DECOMPRESSION_ERROR;
+	return CHDERR_NONE;
+}
+
+
+//-------------------------------------------------
+//  compressed_hunk_location - find the compressed
+//  data for a hunk in the map; returns false if
+//  the hunk is not stored compressed
+//-------------------------------------------------
+
+bool chd_file::compressed_hunk_location(UINT32 hunknum, UINT64 &offset, UINT32 &length, UINT8 &codec, UINT32 &crc, UINT8 &crcbits)
+{
+	switch (m_version)
+	{
+		// v3/v4 map entries
+		case 3:
+		case 4:
+		{
+			UINT8 *rawmap = m_rawmap + 16 * hunknum;
+			if ((rawmap[15] & V34_MAP_ENTRY_FLAG_TYPE_MASK) != V34_MAP_ENTRY_TYPE_COMPRESSED)
+				return false;
+			offset = be_read(&rawmap[0], 8);
+			crc = be_read(&rawmap[8], 4);
+			crcbits = (rawmap[15] & V34_MAP_ENTRY_FLAG_NO_CRC) ? 0 : 32;
+			length = be_read(&rawmap[12], 2) + (rawmap[14] << 16);
+			codec = 0;
+			return true;
+		}
+
+		// v5 map entries
+		case 5:
+		{
+			UINT8 *rawmap = m_rawmap + m_mapentrybytes * hunknum;
+			if (!compressed() || rawmap[0] > COMPRESSION_TYPE_3)
+				return false;
+			length = be_read(&rawmap[1], 3);
+			offset = be_read(&rawmap[4], 6);
+			crc = be_read(&rawmap[10], 2);
+			crcbits = 16;
+			codec = rawmap[0];
+			return true;
+		}
+	}
+	return false;
+}
+
+
+//-------------------------------------------------
+//  read_hunk_direct - read a single hunk from the
+//  CHD file on this thread
+//-------------------------------------------------
+
+chd_error chd_file::read_hunk_direct(UINT32 hunknum, void *buffer)
+{
+	// decoding shares buffers and decompressors, so only one thread at a time
+	chd_lock_holder lock(m_lock);
+
 	// wrap this for clean reporting
 	try
 	{
@@ -805,7 +968,7 @@ chd_error chd_file::read_hunk(UINT32 hunknum, void *buffer)
 						return CHDERR_NONE;
 
 					case V34_MAP_ENTRY_TYPE_SELF_HUNK:
-						return read_hunk(blockoffs, dest);
+						return read_hunk_direct(blockoffs, dest);
 
 					case V34_MAP_ENTRY_TYPE_PARENT_HUNK:
 						if (m_parent_missing)
@@ -858,7 +1021,7 @@ chd_error chd_file::read_hunk(UINT32 hunknum, void *buffer)
 						return CHDERR_NONE;
 
 					case COMPRESSION_SELF:
-						return read_hunk(blockoffs, dest);
+						return read_hunk_direct(blockoffs, dest);
 
 					case COMPRESSION_PARENT:
 						if (m_parent_missing)
@@ -886,6 +1049,9 @@ chd_error chd_file::read_hunk(UINT32 hunknum, void *buffer)
 
 chd_error chd_file::write_hunk(UINT32 hunknum, const void *buffer)
 {
+	// the map and the cached hunk are shared with other threads
+	chd_lock_holder lock(m_lock);
+
 	// wrap this for clean reporting
 	try
 	{
@@ -981,6 +1147,9 @@ chd_error chd_file::write_units(UINT64 unitnum, const void *buffer, UINT32 count
 
 chd_error chd_file::read_bytes(UINT64 offset, void *buffer, UINT32 bytes)
 {
+	// the cached hunk is shared with other threads
+	chd_lock_holder lock(m_lock);
+
 	// iterate over hunks
 	UINT32 first_hunk = offset / m_hunkbytes;
 	UINT32 last_hunk = (offset + bytes - 1) / m_hunkbytes;
@@ -1025,6 +1194,9 @@ chd_error chd_file::read_bytes(UINT64 offset, void *buffer, UINT32 bytes)
 
 chd_error chd_file::write_bytes(UINT64 offset, const void *buffer, UINT32 bytes)
 {
+	// the cached hunk is shared with other threads
+	chd_lock_holder lock(m_lock);
+
 	// iterate over hunks
 	UINT32 first_hunk = offset / m_hunkbytes;
 	UINT32 last_hunk = (offset + bytes - 1) / m_hunkbytes;
@@ -1070,6 +1242,9 @@ chd_error chd_file::write_bytes(UINT64 offset, const void *buffer, UINT32 bytes)
 
 chd_error chd_file::read_metadata(chd_metadata_tag searchtag, UINT32 searchindex, astring &output)
 {
+	// walking the metadata list takes several reads
+	chd_lock_holder lock(m_lock);
+
 	// wrap this for clean reporting
 	try
 	{
@@ -1092,6 +1267,8 @@ chd_error chd_file::read_metadata(chd_metadata_tag searchtag, UINT32 searchindex
 
 chd_error chd_file::read_metadata(chd_metadata_tag searchtag, UINT32 searchindex, dynamic_buffer &output)
 {
+	chd_lock_holder lock(m_lock);
+
 	// wrap this for clean reporting
 	try
 	{
@@ -1115,6 +1292,8 @@ chd_error chd_file::read_metadata(chd_metadata_tag searchtag, UINT32 searchindex
 
 chd_error chd_file::read_metadata(chd_metadata_tag searchtag, UINT32 searchindex, void *output, UINT32 outputlen, UINT32 &resultlen)
 {
+	chd_lock_holder lock(m_lock);
+
 	// wrap this for clean reporting
 	try
 	{
@@ -1138,6 +1317,8 @@ chd_error chd_file::read_metadata(chd_metadata_tag searchtag, UINT32 searchindex
 
 chd_error chd_file::read_metadata(chd_metadata_tag searchtag, UINT32 searchindex, dynamic_buffer &output, chd_metadata_tag &resulttag, UINT8 &resultflags)
 {
+	chd_lock_holder lock(m_lock);
+
 	// wrap this for clean reporting
 	try
 	{
@@ -1169,6 +1350,8 @@ chd_error chd_file::read_metadata(chd_metadata_tag searchtag, UINT32 searchindex
 
 chd_error chd_file::write_metadata(chd_metadata_tag metatag, UINT32 metaindex, const void *inputbuf, UINT32 inputlen, UINT8 flags)
 {
+	chd_lock_holder lock(m_lock);
+
 	// wrap this for clean reporting
 	try
 	{
@@ -1241,6 +1424,8 @@ chd_error chd_file::write_metadata(chd_metadata_tag metatag, UINT32 metaindex, c
 
 chd_error chd_file::delete_metadata(chd_metadata_tag metatag, UINT32 metaindex)
 {
+	chd_lock_holder lock(m_lock);
+
 	// wrap this for clean reporting
 	try
 	{
@@ -2035,6 +2220,11 @@ chd_error chd_file::open_common(bool writeable)
 		m_allow_reads = true;
 		m_allow_writes = writeable;
 
+		// read-only files are best served straight from a mapping; this is
+		// only a hint, so failure just leaves us on regular reads
+		if (!writeable)
+			core_fmap(m_file);
+
 		// read the raw header
 		UINT8 rawheader[MAX_HEADER_SIZE];
 		file_read(0, rawheader, sizeof(rawheader));
@@ -2322,6 +2512,293 @@ int CLIB_DECL chd_file::metadata_hash_compare(const void *elem1, const void *ele
 
 
 
+//**************************************************************************
+//  CHD PARALLEL READER
+//**************************************************************************
+
+//-------------------------------------------------
+//  chd_parallel_reader - constructor; attaches
+//  to the given CHD
+//-------------------------------------------------
+
+chd_parallel_reader::chd_parallel_reader(chd_file &chd, bool compute_sha1)
+	: m_chd(chd),
+	  m_window_start(0),
+	  m_window_end(0),
+	  m_work_queue(NULL),
+	  m_hash_queue(NULL),
+	  m_hashing(compute_sha1),
+	  m_hash_hunk(0)
+{
+	// zap arrays
+	memset(m_work_item, 0, sizeof(m_work_item));
+	memset(m_codecs, 0, sizeof(m_codecs));
+
+	// allocate buffers
+	m_data_buffer.resize(chd.hunk_bytes() * READ_AHEAD_HUNKS);
+	m_compressed_buffer.resize(chd.hunk_bytes() * READ_AHEAD_HUNKS);
+	for (int itemnum = 0; itemnum < READ_AHEAD_HUNKS; itemnum++)
+	{
+		work_item &item = m_work_item[itemnum];
+		item.m_reader = this;
+		item.m_data = m_data_buffer + chd.hunk_bytes() * itemnum;
+		item.m_compressed = m_compressed_buffer + chd.hunk_bytes() * itemnum;
+	}
+
+	// allocate work queues; hashing uses a single thread so hunks are hashed in order
+	m_work_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+	if (m_hashing)
+		m_hash_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_IO);
+
+	// attach to the CHD
+	assert(chd.m_reader == NULL);
+	chd.m_reader = this;
+}
+
+
+//-------------------------------------------------
+//  ~chd_parallel_reader - destructor; detaches
+//  from the CHD
+//-------------------------------------------------
+
+chd_parallel_reader::~chd_parallel_reader()
+{
+	// finish any outstanding work
+	restart(0);
+
+	// detach from the CHD
+	m_chd.m_reader = NULL;
+
+	// free the work queues
+	osd_work_queue_free(m_work_queue);
+	if (m_hash_queue != NULL)
+		osd_work_queue_free(m_hash_queue);
+
+	// delete allocated decompressors
+	for (int threadnum = 0; threadnum < WORK_MAX_THREADS; threadnum++)
+		for (int codecnum = 0; codecnum < 4; codecnum++)
+			delete m_codecs[threadnum][codecnum];
+}
+
+
+//-------------------------------------------------
+//  read_hunk - return a hunk from the window,
+//  keeping the decompressors busy with the ones
+//  that follow
+//-------------------------------------------------
+
+chd_error chd_parallel_reader::read_hunk(UINT32 hunknum, void *buffer)
+{
+	// the window is shared by every thread reading through the CHD
+	chd_lock_holder lock(m_chd.m_lock);
+
+	// punt if no file
+	if (!m_chd.opened())
+		return CHDERR_NOT_OPEN;
+
+	// return an error if out of range
+	if (hunknum >= m_chd.hunk_count())
+		return CHDERR_HUNK_OUT_OF_RANGE;
+
+	// anything other than reading forward starts a new window
+	if (hunknum < m_window_start || hunknum > m_window_end)
+		restart(hunknum);
+
+	// drop hunks we've moved past, then top up the window
+	while (m_window_start < hunknum)
+		retire(m_work_item[m_window_start++ % READ_AHEAD_HUNKS]);
+	while (m_window_end < m_chd.hunk_count() && m_window_end - m_window_start < READ_AHEAD_HUNKS)
+		submit(m_window_end++);
+
+	// wait for our hunk
+	work_item &item = m_work_item[hunknum % READ_AHEAD_HUNKS];
+	assert(item.m_hunknum == hunknum);
+	if (item.m_osd != NULL)
+	{
+		osd_work_item_wait(item.m_osd, 100 * osd_ticks_per_second());
+		osd_work_item_release(item.m_osd);
+		item.m_osd = NULL;
+	}
+
+	// hash it if it's the next one in order; anything else means we'll never see the whole thing in order
+	if (m_hashing && item.m_error == CHDERR_NONE)
+	{
+		if (hunknum == m_hash_hunk)
+		{
+			item.m_hash_osd = osd_work_item_queue(m_hash_queue, async_hash_static, &item, 0);
+			m_hashing = (item.m_hash_osd != NULL);
+			m_hash_hunk++;
+		}
+		else if (hunknum > m_hash_hunk)
+			m_hashing = false;
+	}
+
+	// copy out the data
+	if (buffer != NULL && item.m_error == CHDERR_NONE)
+		memcpy(buffer, item.m_data, m_chd.hunk_bytes());
+	return item.m_error;
+}
+
+
+//-------------------------------------------------
+//  raw_sha1 - wait for hashing to complete and
+//  return the SHA-1 of all the data
+//-------------------------------------------------
+
+sha1_t chd_parallel_reader::raw_sha1()
+{
+	if (!m_hashing || m_hash_hunk != m_chd.hunk_count())
+		return sha1_t::null;
+	osd_work_queue_wait(m_hash_queue, 100 * osd_ticks_per_second());
+	for (int itemnum = 0; itemnum < READ_AHEAD_HUNKS; itemnum++)
+		if (m_work_item[itemnum].m_hash_osd != NULL)
+		{
+			osd_work_item_release(m_work_item[itemnum].m_hash_osd);
+			m_work_item[itemnum].m_hash_osd = NULL;
+		}
+	m_hashing = false;
+	return m_rawsha1.finish();
+}
+
+
+//-------------------------------------------------
+//  restart - wait for everything in the window
+//  and start a new, empty one at the given hunk
+//-------------------------------------------------
+
+void chd_parallel_reader::restart(UINT32 hunknum)
+{
+	while (m_window_start < m_window_end)
+		retire(m_work_item[m_window_start++ % READ_AHEAD_HUNKS]);
+	m_window_start = m_window_end = hunknum;
+}
+
+
+//-------------------------------------------------
+//  retire - wait for a hunk's work to finish so
+//  its slot can be reused
+//-------------------------------------------------
+
+void chd_parallel_reader::retire(work_item &item)
+{
+	if (item.m_osd != NULL)
+	{
+		osd_work_item_wait(item.m_osd, 100 * osd_ticks_per_second());
+		osd_work_item_release(item.m_osd);
+		item.m_osd = NULL;
+	}
+	if (item.m_hash_osd != NULL)
+	{
+		osd_work_item_wait(item.m_hash_osd, 100 * osd_ticks_per_second());
+		osd_work_item_release(item.m_hash_osd);
+		item.m_hash_osd = NULL;
+	}
+}
+
+
+//-------------------------------------------------
+//  submit - read the compressed data for a hunk
+//  and queue its decompression; hunks that don't
+//  need a decompressor are read right away
+//-------------------------------------------------
+
+void chd_parallel_reader::submit(UINT32 hunknum)
+{
+	work_item &item = m_work_item[hunknum % READ_AHEAD_HUNKS];
+	assert(item.m_osd == NULL && item.m_hash_osd == NULL);
+	item.m_hunknum = hunknum;
+	item.m_error = CHDERR_NONE;
+
+	// wrap this for clean reporting
+	try
+	{
+		// find compressed hunks in the map
+		UINT64 blockoffs = 0;
+		if (!m_chd.compressed_hunk_location(hunknum, blockoffs, item.m_complen, item.m_codec, item.m_crc, item.m_crcbits))
+			item.m_complen = 0;
+
+		// lossy codecs need per-CHD configuration, so leave them and everything else to the CHD
+		chd_decompressor *decompressor = (item.m_complen != 0) ? m_chd.m_decompressor[item.m_codec] : NULL;
+		if (decompressor == NULL || decompressor->lossy() || item.m_complen > m_chd.hunk_bytes())
+		{
+			item.m_error = m_chd.read_hunk_direct(hunknum, item.m_data);
+			return;
+		}
+
+		// read the compressed data here and hand off the rest
+		m_chd.file_read(blockoffs, item.m_compressed, item.m_complen);
+		item.m_osd = osd_work_item_queue(m_work_queue, async_decompress_static, &item, 0);
+		if (item.m_osd == NULL)
+			async_decompress(item, 0);
+	}
+	catch (chd_error &err)
+	{
+		item.m_error = err;
+	}
+}
+
+
+//-------------------------------------------------
+//  async_decompress_static - thread entry point
+//  for decompressing a hunk
+//-------------------------------------------------
+
+void *chd_parallel_reader::async_decompress_static(void *param, int threadid)
+{
+	work_item *item = reinterpret_cast<work_item *>(param);
+	item->m_reader->async_decompress(*item, threadid);
+	return NULL;
+}
+
+
+//-------------------------------------------------
+//  async_decompress - decompress and check a hunk
+//  with this thread's codec instances
+//-------------------------------------------------
+
+void chd_parallel_reader::async_decompress(work_item &item, int threadid)
+{
+	try
+	{
+		// create this thread's decompressor on first use
+		chd_decompressor *&decompressor = m_codecs[threadid][item.m_codec];
+		if (decompressor == NULL)
+			decompressor = chd_codec_list::new_decompressor(m_chd.m_compression[item.m_codec], m_chd);
+		if (decompressor == NULL)
+			throw CHDERR_UNKNOWN_COMPRESSION;
+
+		// decompress and verify
+		decompressor->decompress(item.m_compressed, item.m_complen, item.m_data, m_chd.hunk_bytes());
+		if (item.m_crcbits == 16 && crc16_creator::simple(item.m_data, m_chd.hunk_bytes()) != item.m_crc)
+			throw CHDERR_DECOMPRESSION_ERROR;
+		if (item.m_crcbits == 32 && crc32_creator::simple(item.m_data, m_chd.hunk_bytes()) != item.m_crc)
+			throw CHDERR_DECOMPRESSION_ERROR;
+	}
+	catch (chd_error &err)
+	{
+		item.m_error = err;
+	}
+}
+
+
+//-------------------------------------------------
+//  async_hash_static - thread entry point for
+//  adding a hunk to the SHA-1
+//-------------------------------------------------
+
+void *chd_parallel_reader::async_hash_static(void *param, int threadid)
+{
+	work_item *item = reinterpret_cast<work_item *>(param);
+	chd_parallel_reader &reader = *item->m_reader;
+
+	// the last hunk may extend past the end of the logical data
+	UINT64 offset = UINT64(item->m_hunknum) * UINT64(reader.m_chd.hunk_bytes());
+	UINT32 length = (UINT32)MIN(UINT64(reader.m_chd.hunk_bytes()), reader.m_chd.logical_bytes() - offset);
+	reader.m_rawsha1.append(item->m_data, length);
+	return NULL;
+}
+
+
 //**************************************************************************
 //  CHD COMPRESSOR
 //**************************************************************************
@@ -2339,7 +2816,8 @@ chd_file_compressor::chd_file_compressor()
 	  m_read_done_offset(0),
 	  m_read_error(false),
 	  m_work_queue(NULL),
-	  m_write_hunk(0)
+	  m_write_hunk(0),
+	  m_decode_weight(0)
 {
 	// zap arrays
 	memset(m_work_item, 0, sizeof(m_work_item));
@@ -2405,6 +2883,7 @@ void chd_file_compressor::compress_begin()
 	{
 		delete m_codecs[instance];
 		m_codecs[instance] = new chd_compressor_group(*this, m_compression);
+		m_codecs[instance]->set_decode_weight(*this, m_decode_weight);
 	}
 
 	// reset write state
@@ -2412,6 +2891,28 @@ void chd_file_compressor::compress_begin()
 }
 
 
+//-------------------------------------------------
+//  decode_stats - return the decode measurements
+//  for a codec, summed across all threads
+//-------------------------------------------------
+
+void chd_file_compressor::decode_stats(int codecnum, UINT64 &decoded, UINT64 &chosen, osd_ticks_t &ticks) const
+{
+	decoded = chosen = 0;
+	ticks = 0;
+	for (int instance = 0; instance < ARRAY_LENGTH(m_codecs); instance++)
+		if (m_codecs[instance] != NULL)
+		{
+			UINT32 curdecoded, curchosen;
+			osd_ticks_t curticks;
+			m_codecs[instance]->decode_stats(codecnum, curdecoded, curchosen, curticks);
+			decoded += curdecoded;
+			chosen += curchosen;
+			ticks += curticks;
+		}
+}
+
+
 //-------------------------------------------------
 //  compress_continue - continue compression
 //-------------------------------------------------
@@ -308,6 +308,7 @@ enum chd_error
 //**************************************************************************
 
 class chd_codec;
+class chd_parallel_reader;
 
 
 // ======================> chd_file
@@ -317,6 +318,7 @@ class chd_file
 {
 	friend class chd_file_compressor;
 	friend class chd_verifier;
+	friend class chd_parallel_reader;
 
 	// constants
 	static const UINT32 HEADER_VERSION = 5;
@@ -373,6 +375,8 @@ public:
 	chd_error write_units(UINT64 unitnum, const void *buffer, UINT32 count = 1);
 	chd_error read_bytes(UINT64 offset, void *buffer, UINT32 bytes);
 	chd_error write_bytes(UINT64 offset, const void *buffer, UINT32 bytes);
+	chd_error read_compressed_hunk(UINT32 hunknum, dynamic_buffer &buffer, chd_codec_type &codec, UINT32 &crc, UINT8 &crcbits);
+	chd_error verify_hunk(const void *buffer, UINT32 crc, UINT8 crcbits) const;
 
 	// metadata management
 	chd_error read_metadata(chd_metadata_tag searchtag, UINT32 searchindex, astring &output);
@@ -413,6 +417,8 @@ private:
 	void parse_v3_header(UINT8 *rawheader, sha1_t &parentsha1);
 	void parse_v4_header(UINT8 *rawheader, sha1_t &parentsha1);
 	void parse_v5_header(UINT8 *rawheader, sha1_t &parentsha1);
+	chd_error read_hunk_direct(UINT32 hunknum, void *buffer);
+	bool compressed_hunk_location(UINT32 hunknum, UINT64 &offset, UINT32 &length, UINT8 &codec, UINT32 &crc, UINT8 &crcbits);
 	chd_error compress_v5_map();
 	void decompress_v5_map();
 	chd_error create_common();
@@ -430,6 +436,7 @@ private:
 	// file characteristics
 	core_file *				m_file;				// handle to the open core file
 	bool					m_owns_file;		// flag indicating if this file should be closed on chd_close()
+	osd_lock *				m_lock;				// serializes file access and the shared buffers across threads
 	bool					m_allow_reads;		// permit reads from this CHD?
 	bool					m_allow_writes;		// permit writes to this CHD?
 
@@ -464,6 +471,71 @@ private:
 	// caching
 	dynamic_buffer			m_cache;			// single-hunk cache for partial reads/writes
 	UINT32					m_cachehunk;		// which hunk is in the cache?
+	chd_parallel_reader *	m_reader;			// attached parallel reader, or NULL
+};
+
+
+// ======================> chd_parallel_reader
+
+// while attached to a CHD, decompresses the hunks following each one read on
+// worker threads and optionally computes the raw SHA-1 of the data read, so
+// sequential readers of the CHD (including cdrom_file) use all processors
+class chd_parallel_reader
+{
+public:
+	// construction/destruction
+	chd_parallel_reader(chd_file &chd, bool compute_sha1 = false);
+	~chd_parallel_reader();
+
+	// read a hunk, normally from the read-ahead window
+	chd_error read_hunk(UINT32 hunknum, void *buffer);
+
+	// SHA-1 of all the data read, or sha1_t::null if it wasn't read once from start to end in order
+	sha1_t raw_sha1();
+
+private:
+	// number of hunks decompressed ahead of the reader
+	static const int READ_AHEAD_HUNKS = 64;
+
+	// a single hunk in the window
+	struct work_item
+	{
+		osd_work_item *		m_osd;				// OSD work item decompressing this hunk
+		osd_work_item *		m_hash_osd;			// OSD work item hashing this hunk
+		chd_parallel_reader *m_reader;			// pointer back to the reader
+		UINT32				m_hunknum;			// number of the hunk we're working on
+		UINT8 *				m_data;				// pointer to the decompressed data
+		UINT8 *				m_compressed;		// pointer to the compressed data
+		UINT32				m_complen;			// compressed data length
+		UINT8				m_codec;			// index of the codec to decompress with
+		UINT32				m_crc;				// expected CRC of the decompressed data
+		UINT8				m_crcbits;			// 16 or 32 for CRC-16/CRC-32, 0 for none
+		chd_error			m_error;			// result of reading this hunk
+	};
+
+	// internal helpers
+	void restart(UINT32 hunknum);
+	void retire(work_item &item);
+	void submit(UINT32 hunknum);
+	static void *async_decompress_static(void *param, int threadid);
+	void async_decompress(work_item &item, int threadid);
+	static void *async_hash_static(void *param, int threadid);
+
+	// internal state
+	chd_file &				m_chd;				// CHD we're reading
+	UINT32					m_window_start;		// first hunk held in the window
+	UINT32					m_window_end;		// first hunk past the window
+	osd_work_queue *		m_work_queue;		// queue for decompression
+	dynamic_buffer			m_data_buffer;		// buffer containing decompressed hunks
+	dynamic_buffer			m_compressed_buffer;// buffer containing compressed hunks
+	work_item				m_work_item[READ_AHEAD_HUNKS]; // status of each hunk
+	chd_decompressor *		m_codecs[WORK_MAX_THREADS][4]; // per-thread decompressors
+
+	// hashing state
+	osd_work_queue *		m_hash_queue;		// queue for hashing, in order
+	bool					m_hashing;			// computing the SHA-1?
+	UINT32					m_hash_hunk;		// next hunk to be hashed
+	sha1_creator			m_rawsha1;			// running SHA-1 on raw data
 };
 
 
@@ -481,6 +553,11 @@ public:
 	void compress_begin();
 	chd_error compress_continue(double &progress, double &ratio);
 
+	// decode-speed-aware codec selection; see chd_compressor_group::set_decode_weight
+	void set_decode_weight(double weight) { m_decode_weight = weight; }
+	double decode_weight() const { return m_decode_weight; }
+	void decode_stats(int codecnum, UINT64 &decoded, UINT64 &chosen, osd_ticks_t &ticks) const;
+
 protected:
 	// required override: read more data
 	virtual UINT32 read_data(void *dest, UINT64 offset, UINT32 length) = 0;
@@ -591,6 +668,9 @@ private:
 
 	// output state
 	UINT32					m_write_hunk;		// next hunk to write
+
+	// codec selection
+	double					m_decode_weight;	// weight of decode time against size
 };
 
 
@@ -492,18 +492,18 @@ private:
 const chd_codec_list::codec_entry chd_codec_list::s_codec_list[] =
 {
 	// general codecs
-	{ CHD_CODEC_ZLIB,		false,	"Deflate",				&chd_codec_list::construct_compressor<chd_zlib_compressor>,		&chd_codec_list::construct_decompressor<chd_zlib_decompressor> },
-	{ CHD_CODEC_LZMA,		false,	"LZMA",					&chd_codec_list::construct_compressor<chd_lzma_compressor>,		&chd_codec_list::construct_decompressor<chd_lzma_decompressor> },
-	{ CHD_CODEC_HUFFMAN,	false,	"Huffman",				&chd_codec_list::construct_compressor<chd_huffman_compressor>,	&chd_codec_list::construct_decompressor<chd_huffman_decompressor> },
-	{ CHD_CODEC_FLAC,		false,	"FLAC",					&chd_codec_list::construct_compressor<chd_flac_compressor>,		&chd_codec_list::construct_decompressor<chd_flac_decompressor> },
+	{ CHD_CODEC_ZLIB,		false,	"Deflate",				250,	&chd_codec_list::construct_compressor<chd_zlib_compressor>,		&chd_codec_list::construct_decompressor<chd_zlib_decompressor> },
+	{ CHD_CODEC_LZMA,		false,	"LZMA",					45,		&chd_codec_list::construct_compressor<chd_lzma_compressor>,		&chd_codec_list::construct_decompressor<chd_lzma_decompressor> },
+	{ CHD_CODEC_HUFFMAN,	false,	"Huffman",				200,	&chd_codec_list::construct_compressor<chd_huffman_compressor>,	&chd_codec_list::construct_decompressor<chd_huffman_decompressor> },
+	{ CHD_CODEC_FLAC,		false,	"FLAC",					200,	&chd_codec_list::construct_compressor<chd_flac_compressor>,		&chd_codec_list::construct_decompressor<chd_flac_decompressor> },
 
 	// general codecs with CD frontend
-	{ CHD_CODEC_CD_ZLIB,	false,	"CD Deflate",			&chd_codec_list::construct_compressor<chd_cd_compressor<chd_zlib_compressor, chd_zlib_compressor> >,		&chd_codec_list::construct_decompressor<chd_cd_decompressor<chd_zlib_decompressor, chd_zlib_decompressor> > },
-	{ CHD_CODEC_CD_LZMA,	false,	"CD LZMA",				&chd_codec_list::construct_compressor<chd_cd_compressor<chd_lzma_compressor, chd_zlib_compressor> >,		&chd_codec_list::construct_decompressor<chd_cd_decompressor<chd_lzma_decompressor, chd_zlib_decompressor> > },
-	{ CHD_CODEC_CD_FLAC,	false,	"CD FLAC",				&chd_codec_list::construct_compressor<chd_cd_flac_compressor>,	&chd_codec_list::construct_decompressor<chd_cd_flac_decompressor> },
+	{ CHD_CODEC_CD_ZLIB,	false,	"CD Deflate",			250,	&chd_codec_list::construct_compressor<chd_cd_compressor<chd_zlib_compressor, chd_zlib_compressor> >,		&chd_codec_list::construct_decompressor<chd_cd_decompressor<chd_zlib_decompressor, chd_zlib_decompressor> > },
+	{ CHD_CODEC_CD_LZMA,	false,	"CD LZMA",				45,		&chd_codec_list::construct_compressor<chd_cd_compressor<chd_lzma_compressor, chd_zlib_compressor> >,		&chd_codec_list::construct_decompressor<chd_cd_decompressor<chd_lzma_decompressor, chd_zlib_decompressor> > },
+	{ CHD_CODEC_CD_FLAC,	false,	"CD FLAC",				200,	&chd_codec_list::construct_compressor<chd_cd_flac_compressor>,	&chd_codec_list::construct_decompressor<chd_cd_flac_decompressor> },
 
 	// A/V codecs
-	{ CHD_CODEC_AVHUFF,		false,	"A/V Huffman",			&chd_codec_list::construct_compressor<chd_avhuff_compressor>,	&chd_codec_list::construct_decompressor<chd_avhuff_decompressor> },
+	{ CHD_CODEC_AVHUFF,		false,	"A/V Huffman",			150,	&chd_codec_list::construct_compressor<chd_avhuff_compressor>,	&chd_codec_list::construct_decompressor<chd_avhuff_decompressor> },
 };
 
 
@@ -618,6 +618,18 @@ const char *chd_codec_list::codec_name(chd_codec_type type)
 }
 
 
+//-------------------------------------------------
+//  codec_decode_rate - return the typical decode
+//  throughput of a codec, in bytes per microsecond
+//-------------------------------------------------
+
+UINT32 chd_codec_list::codec_decode_rate(chd_codec_type type)
+{
+	const codec_entry *entry = find_in_list(type);
+	return (entry == NULL) ? 0 : entry->m_decode_rate;
+}
+
+
 //-------------------------------------------------
 //  find_in_list - create a new compressor
 //  instance of the given type
@@ -648,7 +660,15 @@ chd_compressor_group::chd_compressor_group(chd_file &chd, UINT32 compressor_list
 #if CHDCODEC_VERIFY_COMPRESSION
 	  ,m_decompressed(m_hunkbytes)
 #endif
+	  ,m_decode_weight(0)
 {
+	// zap arrays
+	memset(m_decode_cost, 0, sizeof(m_decode_cost));
+	memset(m_decode_test, 0, sizeof(m_decode_test));
+	memset(m_decoded, 0, sizeof(m_decoded));
+	memset(m_chosen, 0, sizeof(m_chosen));
+	memset(m_decode_ticks, 0, sizeof(m_decode_ticks));
+
 	// verify the compression types and initialize the codecs
 	for (int codecnum = 0; codecnum < ARRAY_LENGTH(m_compressor); codecnum++)
 	{
@@ -676,7 +696,54 @@ chd_compressor_group::~chd_compressor_group()
 {
 	// delete the codecs and the test buffer
 	for (int codecnum = 0; codecnum < ARRAY_LENGTH(m_compressor); codecnum++)
+	{
 		delete m_compressor[codecnum];
+		delete m_decode_test[codecnum];
+	}
+}
+
+
+//-------------------------------------------------
+//  set_decode_weight - trade compressed size
+//  against decode time when choosing codecs
+//-------------------------------------------------
+
+void chd_compressor_group::set_decode_weight(chd_file &chd, double weight)
+{
+	m_decode_weight = weight;
+	if (weight <= 0)
+		return;
+
+	// the choice is made on each codec's typical decode rate rather than on
+	// the measured time, so the output does not depend on machine load
+	m_decode_buffer.resize(m_hunkbytes);
+	for (int codecnum = 0; codecnum < ARRAY_LENGTH(m_compressor); codecnum++)
+		if (m_compressor[codecnum] != NULL)
+		{
+			UINT32 rate = chd_codec_list::codec_decode_rate(chd.compression(codecnum));
+			m_decode_cost[codecnum] = (rate != 0) ? double(m_hunkbytes) / double(rate) : 0;
+
+			// the round-trip check and the timing need a decompressor
+			if (m_decode_test[codecnum] == NULL)
+			{
+				m_decode_test[codecnum] = chd_codec_list::new_decompressor(chd.compression(codecnum), chd);
+				if (m_decode_test[codecnum] == NULL)
+					throw CHDERR_UNKNOWN_COMPRESSION;
+			}
+		}
+}
+
+
+//-------------------------------------------------
+//  decode_stats - return decode measurements for
+//  a codec
+//-------------------------------------------------
+
+void chd_compressor_group::decode_stats(int codecnum, UINT32 &decoded, UINT32 &chosen, osd_ticks_t &ticks) const
+{
+	decoded = m_decoded[codecnum];
+	chosen = m_chosen[codecnum];
+	ticks = m_decode_ticks[codecnum];
 }
 
 
@@ -688,6 +755,10 @@ chd_compressor_group::~chd_compressor_group()
 
 INT8 chd_compressor_group::find_best_compressor(const UINT8 *src, UINT8 *compressed, UINT32 &complen)
 {
+	// weigh decode time as well if requested
+	if (m_decode_weight > 0)
+		return find_fastest_compressor(src, compressed, complen);
+
 	// determine best compression technique
 	complen = m_hunkbytes;
 	INT8 compression = -1;
@@ -740,6 +811,60 @@ printf("   codec%d=%d bytes            \n", codecnum, compbytes);
 }
 
 
+//-------------------------------------------------
+//  find_fastest_compressor - iterate over all
+//  codecs to find the one with the best
+//  combination of size and typical decode time
+//  for this hunk; ties go to the earlier codec
+//-------------------------------------------------
+
+INT8 chd_compressor_group::find_fastest_compressor(const UINT8 *src, UINT8 *compressed, UINT32 &complen)
+{
+	// storing the hunk uncompressed costs its size and no decode time
+	double bestcost = double(m_hunkbytes);
+	complen = m_hunkbytes;
+	INT8 compression = -1;
+	for (int codecnum = 0; codecnum < ARRAY_LENGTH(m_compressor); codecnum++)
+		if (m_compressor[codecnum] != NULL)
+		{
+			// attempt to compress and decompress, swallowing errors
+			try
+			{
+				UINT32 compbytes = m_compressor[codecnum]->compress(src, m_hunkbytes, m_compress_test);
+				if (compbytes >= m_hunkbytes)
+					continue;
+
+				// a codec that doesn't round-trip is never chosen; the decode is
+				// timed for the statistics only
+				osd_ticks_t start = osd_ticks();
+				m_decode_test[codecnum]->decompress(m_compress_test, compbytes, m_decode_buffer, m_hunkbytes);
+				m_decode_ticks[codecnum] += osd_ticks() - start;
+				m_decoded[codecnum]++;
+				if (!m_decode_test[codecnum]->lossy() && memcmp(src, m_decode_buffer, m_hunkbytes) != 0)
+					continue;
+
+				// if this is the best one, copy the data into the permanent buffer
+				double cost = double(compbytes) + m_decode_weight * m_decode_cost[codecnum];
+				if (cost < bestcost)
+				{
+					bestcost = cost;
+					compression = codecnum;
+					complen = compbytes;
+					memcpy(compressed, m_compress_test, compbytes);
+				}
+			}
+			catch (...) { }
+		}
+
+	// if the best is none, copy it over
+	if (compression == -1)
+		memcpy(compressed, src, m_hunkbytes);
+	else
+		m_chosen[compression]++;
+	return compression;
+}
+
+
 
 //**************************************************************************
 //  ZLIB ALLOCATOR HELPER
@@ -139,6 +139,7 @@ public:
 	// utilities
 	static bool codec_exists(chd_codec_type type) { return (find_in_list(type) != NULL); }
 	static const char *codec_name(chd_codec_type type);
+	static UINT32 codec_decode_rate(chd_codec_type type);
 
 private:
 	// an entry in the list
@@ -147,6 +148,7 @@ private:
 		chd_codec_type		m_type;
 		bool				m_lossy;
 		const char *		m_name;
+		UINT32				m_decode_rate;		// typical decode throughput, in bytes per microsecond
 		chd_compressor *	(*m_construct_compressor)(chd_file &, UINT32, bool);
 		chd_decompressor *	(*m_construct_decompressor)(chd_file &, UINT32, bool);
 	};
@@ -178,6 +180,10 @@ public:
 	// find the best compressor
 	INT8 find_best_compressor(const UINT8 *src, UINT8 *compressed, UINT32 &complen);
 
+	// decode cost: when nonzero, each microsecond a hunk typically takes to decode counts as this many compressed bytes
+	void set_decode_weight(chd_file &chd, double weight);
+	void decode_stats(int codecnum, UINT32 &decoded, UINT32 &chosen, osd_ticks_t &ticks) const;
+
 private:
 	// internal state
 	UINT32					m_hunkbytes;		// number of bytes in a hunk
@@ -187,6 +193,18 @@ private:
 	chd_decompressor *		m_decompressor[4];	// array of active codecs
 	dynamic_buffer			m_decompressed;		// verification buffer
 #endif
+
+	// decode cost measurement
+	double					m_decode_weight;	// bytes per microsecond of decode time, or 0
+	double					m_decode_cost[4];	// typical decode time of a hunk for each codec, in microseconds
+	chd_decompressor *		m_decode_test[4];	// decompressors for the round-trip check and timing
+	dynamic_buffer			m_decode_buffer;	// round-trip buffer
+	UINT32					m_decoded[4];		// number of hunks test-decoded by each codec
+	UINT32					m_chosen[4];		// number of hunks each codec was chosen for
+	osd_ticks_t				m_decode_ticks[4];	// total time spent test-decoding
+
+	// internal helpers
+	INT8 find_fastest_compressor(const UINT8 *src, UINT8 *compressed, UINT32 &complen);
 };
 
 
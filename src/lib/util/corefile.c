@@ -64,6 +64,9 @@
 
 #define OPEN_FLAG_HAS_CRC		0x10000
 
+/* largest file we will map on hosts with a 32-bit address space */
+#define MAX_MAP_LENGTH_32BIT	(256 * 1024 * 1024)
+
 
 
 /***************************************************************************
@@ -100,6 +103,7 @@ struct _core_file
 	UINT32			openflags;					/* flags we were opened with */
 	UINT8			data_allocated;				/* was the data allocated by us? */
 	UINT8 *			data;						/* file data, if RAM-based */
+	osd_mapping *	mapping;					/* OSD mapping backing the data, if mapped */
 	UINT64			offset;						/* current file offset */
 	UINT64			length;						/* total file length */
 	text_file_type	text_type;					/* text output format */
@@ -246,6 +250,8 @@ void core_fclose(core_file *file)
 		osd_close(file->file);
 	if (file->data != NULL && file->data_allocated)
 		free(file->data);
+	if (file->mapping != NULL)
+		osd_unmap(file->mapping);
 	free(file);
 }
 
@@ -472,9 +478,13 @@ UINT32 core_fread(core_file *file, void *buffer, UINT32 length)
 		}
 	}
 
-	/* handle RAM-based files */
-	else
-		bytes_read += safe_buffer_copy(file->data, (UINT32)file->offset, file->length, buffer, bytes_read, length);
+	/* handle RAM-based and mapped files; these may exceed 4GB */
+	else if (file->offset < file->length)
+	{
+		UINT64 bytes_left = file->length - file->offset;
+		bytes_read = (bytes_left < length) ? (UINT32)bytes_left : length;
+		memcpy(buffer, file->data + file->offset, bytes_read);
+	}
 
 	/* return the number of bytes read */
 	file->offset += bytes_read;
@@ -692,6 +702,10 @@ const void *core_fbuffer(core_file *file)
 	if (file->data != NULL)
 		return file->data;
 
+	/* read-only files can simply be mapped */
+	if (core_fmap(file) == FILERR_NONE)
+		return file->data;
+
 	/* allocate some memory */
 	file->data = (UINT8 *)malloc(file->length);
 	if (file->data == NULL)
@@ -714,6 +728,44 @@ const void *core_fbuffer(core_file *file)
 }
 
 
+/*-------------------------------------------------
+    core_fmap - map a read-only file into memory
+    so that subsequent reads and core_fbuffer
+    are served from the OS page cache instead of
+    a private heap copy
+-------------------------------------------------*/
+
+file_error core_fmap(core_file *file)
+{
+	file_error filerr;
+	void *base;
+
+	/* if we already have data, there is nothing to do */
+	if (file->data != NULL)
+		return FILERR_NONE;
+
+	/* only uncompressed, read-only files on disk can be mapped */
+	if (file->file == NULL || file->zdata != NULL || (file->openflags & OPEN_FLAG_WRITE) != 0)
+		return FILERR_INVALID_ACCESS;
+
+	/* don't eat up a small address space with big files */
+	if (sizeof(void *) < 8 && file->length > MAX_MAP_LENGTH_32BIT)
+		return FILERR_OUT_OF_MEMORY;
+
+	/* map the whole file */
+	filerr = osd_map(file->file, 0, file->length, &file->mapping, &base);
+	if (filerr != FILERR_NONE)
+		return filerr;
+	file->data = (UINT8 *)base;
+	file->bufferbytes = 0;
+
+	/* the mapping outlives the handle, so close the file */
+	osd_close(file->file);
+	file->file = NULL;
+	return FILERR_NONE;
+}
+
+
 /*-------------------------------------------------
     core_fload - open a file with the specified
     filename, read it into memory, and return a
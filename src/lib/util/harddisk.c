@@ -40,20 +40,170 @@
 #include "harddisk.h"
 
 #include <stdlib.h>
+#include <string.h>
 
 
 /***************************************************************************
     TYPE DEFINITIONS
 ***************************************************************************/
 
+/* a hunk held in the write-back cache */
+struct hard_disk_cache_entry
+{
+	UINT32				hunknum;			/* hunk number, or ~0 if unused */
+	UINT32				lastuse;			/* cache clock at last access */
+	UINT8				dirty;				/* needs writing to the CHD? */
+	UINT8 *				data;				/* hunk contents */
+};
+
+
 struct hard_disk_file
 {
 	chd_file *			chd;				/* CHD file */
 	hard_disk_info		info;				/* hard disk info */
+
+	/* write-back cache; while enabled, all CHD accesses happen under the lock */
+	UINT32				cachehunks;			/* number of hunks in the cache, or 0 if disabled */
+	hard_disk_cache_entry *cache;			/* array of cache entries */
+	UINT8 *				cachedata;			/* hunk data for all entries */
+	UINT32				cacheclock;			/* clock for least-recently-used replacement */
+	UINT32				dirtycount;			/* number of dirty entries */
+	osd_lock *			lock;				/* lock protecting the cache and the CHD */
+	osd_work_queue *	queue;				/* queue for background flushing, or NULL once the CHD is exposed */
+	volatile INT32		flushpending;		/* is a background flush queued or running? */
+	chd_error			writeerror;			/* first write-back error not yet reported */
 };
 
 
 
+/***************************************************************************
+    CACHE HELPERS
+***************************************************************************/
+
+/*-------------------------------------------------
+    cache_write_entry - write a dirty cache entry
+    back to the CHD; on failure the entry stays
+    dirty and the error is latched for the next
+    write or flush to report; must hold the lock
+-------------------------------------------------*/
+
+static chd_error cache_write_entry(hard_disk_file *file, hard_disk_cache_entry *entry)
+{
+	chd_error err = file->chd->write_hunk(entry->hunknum, entry->data);
+	if (err != CHDERR_NONE)
+	{
+		if (file->writeerror == CHDERR_NONE)
+			file->writeerror = err;
+		return err;
+	}
+	entry->dirty = FALSE;
+	file->dirtycount--;
+	return err;
+}
+
+
+/*-------------------------------------------------
+    cache_take_error - return and clear the
+    latched write-back error; must hold the lock
+-------------------------------------------------*/
+
+static chd_error cache_take_error(hard_disk_file *file)
+{
+	chd_error err = file->writeerror;
+	file->writeerror = CHDERR_NONE;
+	return err;
+}
+
+
+/*-------------------------------------------------
+    cache_find - find the cache entry holding
+    a hunk; must hold the lock
+-------------------------------------------------*/
+
+static hard_disk_cache_entry *cache_find(hard_disk_file *file, UINT32 hunknum)
+{
+	for (UINT32 entrynum = 0; entrynum < file->cachehunks; entrynum++)
+		if (file->cache[entrynum].hunknum == hunknum)
+		{
+			file->cache[entrynum].lastuse = ++file->cacheclock;
+			return &file->cache[entrynum];
+		}
+	return NULL;
+}
+
+
+/*-------------------------------------------------
+    cache_allocate - load a hunk into the cache,
+    replacing the least recently used entry and
+    preferring clean ones; must hold the lock
+-------------------------------------------------*/
+
+static hard_disk_cache_entry *cache_allocate(hard_disk_file *file, UINT32 hunknum)
+{
+	hard_disk_cache_entry *victim = NULL;
+	hard_disk_cache_entry *dirtyvictim = NULL;
+
+	/* find an unused entry, or the oldest clean and dirty ones */
+	for (UINT32 entrynum = 0; entrynum < file->cachehunks; entrynum++)
+	{
+		hard_disk_cache_entry *entry = &file->cache[entrynum];
+		if (entry->hunknum == ~0)
+		{
+			victim = entry;
+			break;
+		}
+		if (!entry->dirty && (victim == NULL || entry->lastuse - victim->lastuse > 0x80000000))
+			victim = entry;
+		if (entry->dirty && (dirtyvictim == NULL || entry->lastuse - dirtyvictim->lastuse > 0x80000000))
+			dirtyvictim = entry;
+	}
+
+	/* if everything is dirty, write one back now */
+	if (victim == NULL)
+	{
+		victim = dirtyvictim;
+		if (cache_write_entry(file, victim) != CHDERR_NONE)
+			return NULL;
+	}
+
+	/* fill it from the CHD */
+	victim->hunknum = ~0;
+	if (file->chd->read_hunk(hunknum, victim->data) != CHDERR_NONE)
+		return NULL;
+	victim->hunknum = hunknum;
+	victim->lastuse = ++file->cacheclock;
+	return victim;
+}
+
+
+/*-------------------------------------------------
+    cache_flush_callback - work queue callback
+    to write dirty hunks back in the background
+-------------------------------------------------*/
+
+static void *cache_flush_callback(void *param, int threadid)
+{
+	hard_disk_file *file = (hard_disk_file *)param;
+
+	/* write one hunk at a time so the emulation never waits long for the lock; */
+	/* stop at the first failure, leaving the rest dirty for a later flush */
+	for (UINT32 entrynum = 0; entrynum < file->cachehunks; entrynum++)
+	{
+		osd_lock_acquire(file->lock);
+		chd_error err = CHDERR_NONE;
+		if (file->cache[entrynum].dirty)
+			err = cache_write_entry(file, &file->cache[entrynum]);
+		osd_lock_release(file->lock);
+		if (err != CHDERR_NONE)
+			break;
+	}
+
+	file->flushpending = FALSE;
+	return NULL;
+}
+
+
+
 /***************************************************************************
     CORE IMPLEMENTATION
 ***************************************************************************/
@@ -89,6 +239,7 @@ hard_disk_file *hard_disk_open(chd_file *chd)
 		return NULL;
 
 	/* fill in the data */
+	memset(file, 0, sizeof(*file));
 	file->chd = chd;
 	file->info.cylinders = cylinders;
 	file->info.heads = heads;
@@ -98,23 +249,126 @@ hard_disk_file *hard_disk_open(chd_file *chd)
 }
 
 
+/*-------------------------------------------------
+    hard_disk_enable_write_cache - hold up to the
+    given number of hunks in memory, writing
+    modified ones back to the CHD on a background
+    thread; the owner must call hard_disk_flush
+    before anything else relies on the CHD
+    contents (saving state, exiting, unloading)
+-------------------------------------------------*/
+
+int hard_disk_enable_write_cache(hard_disk_file *file, UINT32 hunks)
+{
+	UINT32 hunkbytes = file->chd->hunk_bytes();
+
+	/* only whole sectors within a hunk can be cached */
+	if (file->cachehunks != 0 || hunks == 0 || hunkbytes % file->info.sectorbytes != 0)
+		return FALSE;
+
+	/* allocate memory */
+	file->cache = (hard_disk_cache_entry *)malloc(hunks * sizeof(file->cache[0]));
+	file->cachedata = (UINT8 *)malloc(hunks * hunkbytes);
+	file->lock = osd_lock_alloc();
+	file->queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_IO);
+	if (file->cache == NULL || file->cachedata == NULL || file->lock == NULL || file->queue == NULL)
+	{
+		free(file->cache);
+		free(file->cachedata);
+		if (file->lock != NULL)
+			osd_lock_free(file->lock);
+		if (file->queue != NULL)
+			osd_work_queue_free(file->queue);
+		file->cache = NULL;
+		file->cachedata = NULL;
+		file->lock = NULL;
+		file->queue = NULL;
+		return FALSE;
+	}
+
+	/* start with every entry unused */
+	for (UINT32 entrynum = 0; entrynum < hunks; entrynum++)
+	{
+		file->cache[entrynum].hunknum = ~0;
+		file->cache[entrynum].lastuse = 0;
+		file->cache[entrynum].dirty = FALSE;
+		file->cache[entrynum].data = file->cachedata + entrynum * hunkbytes;
+	}
+	file->cachehunks = hunks;
+	return TRUE;
+}
+
+
+/*-------------------------------------------------
+    hard_disk_flush - write all cached changes
+    back to the CHD; fails if anything could not
+    be written, now or by an earlier background
+    flush
+-------------------------------------------------*/
+
+int hard_disk_flush(hard_disk_file *file)
+{
+	if (file->cachehunks == 0)
+		return TRUE;
+
+	/* let any background flush finish, then write whatever is left */
+	if (file->queue != NULL)
+		osd_work_queue_wait(file->queue, 60 * osd_ticks_per_second());
+	osd_lock_acquire(file->lock);
+	for (UINT32 entrynum = 0; entrynum < file->cachehunks; entrynum++)
+		if (file->cache[entrynum].dirty)
+			cache_write_entry(file, &file->cache[entrynum]);
+	chd_error err = cache_take_error(file);
+	osd_lock_release(file->lock);
+	return (err == CHDERR_NONE);
+}
+
+
 /*-------------------------------------------------
     hard_disk_close - close a hard disk handle
 -------------------------------------------------*/
 
 void hard_disk_close(hard_disk_file *file)
 {
+	/* write back and free the cache */
+	if (file->cachehunks != 0)
+	{
+		hard_disk_flush(file);
+		if (file->queue != NULL)
+			osd_work_queue_free(file->queue);
+		osd_lock_free(file->lock);
+		free(file->cachedata);
+		free(file->cache);
+	}
 	free(file);
 }
 
 
 /*-------------------------------------------------
     hard_disk_get_chd - get a handle to a CHD
-    from a hard disk
+    from a hard disk; this gives up background
+    writing for good, so callers that only need
+    metadata should use hard_disk_read_metadata
 -------------------------------------------------*/
 
 chd_file *hard_disk_get_chd(hard_disk_file *file)
 {
+	/* callers access the CHD directly from now on, so bring it up to date and */
+	/* stop writing it from the background; a failed write-back stays latched */
+	if (file->queue != NULL)
+	{
+		osd_work_queue_wait(file->queue, 60 * osd_ticks_per_second());
+		osd_work_queue_free(file->queue);
+		file->queue = NULL;
+	}
+	if (file->cachehunks != 0)
+	{
+		osd_lock_acquire(file->lock);
+		for (UINT32 entrynum = 0; entrynum < file->cachehunks; entrynum++)
+			if (file->cache[entrynum].dirty)
+				cache_write_entry(file, &file->cache[entrynum]);
+		osd_lock_release(file->lock);
+	}
 	return file->chd;
 }
 
@@ -130,6 +384,24 @@ hard_disk_info *hard_disk_get_info(hard_disk_file *file)
 }
 
 
+/*-------------------------------------------------
+    hard_disk_read_metadata - read metadata from
+    the CHD without giving up the write cache
+-------------------------------------------------*/
+
+chd_error hard_disk_read_metadata(hard_disk_file *file, chd_metadata_tag searchtag, UINT32 searchindex, void *output, UINT32 outputlen, UINT32 &resultlen)
+{
+	if (file->cachehunks == 0)
+		return file->chd->read_metadata(searchtag, searchindex, output, outputlen, resultlen);
+
+	/* background write-backs use the CHD too, so take the lock */
+	osd_lock_acquire(file->lock);
+	chd_error err = file->chd->read_metadata(searchtag, searchindex, output, outputlen, resultlen);
+	osd_lock_release(file->lock);
+	return err;
+}
+
+
 /*-------------------------------------------------
     hard_disk_read - read sectors from a hard
     disk
@@ -137,7 +409,28 @@ hard_disk_info *hard_disk_get_info(hard_disk_file *file)
 
 UINT32 hard_disk_read(hard_disk_file *file, UINT32 lbasector, void *buffer)
 {
-	chd_error err = file->chd->read_units(lbasector, buffer);
+	chd_error err;
+
+	if (file->cachehunks == 0)
+		err = file->chd->read_units(lbasector, buffer);
+
+	/* if cached, read from the cache; otherwise straight from the CHD, under the lock */
+	else
+	{
+		UINT64 offset = UINT64(lbasector) * file->info.sectorbytes;
+		UINT32 hunkbytes = file->chd->hunk_bytes();
+
+		osd_lock_acquire(file->lock);
+		hard_disk_cache_entry *entry = cache_find(file, offset / hunkbytes);
+		if (entry != NULL)
+		{
+			memcpy(buffer, &entry->data[offset % hunkbytes], file->info.sectorbytes);
+			err = CHDERR_NONE;
+		}
+		else
+			err = file->chd->read_units(lbasector, buffer);
+		osd_lock_release(file->lock);
+	}
 	return (err == CHDERR_NONE);
 }
 
@@ -149,6 +442,60 @@ UINT32 hard_disk_read(hard_disk_file *file, UINT32 lbasector, void *buffer)
 
 UINT32 hard_disk_write(hard_disk_file *file, UINT32 lbasector, const void *buffer)
 {
-	chd_error err = file->chd->write_units(lbasector, buffer);
-	return (err == CHDERR_NONE);
+	if (file->cachehunks == 0)
+	{
+		chd_error err = file->chd->write_units(lbasector, buffer);
+		return (err == CHDERR_NONE);
+	}
+
+	/* range check like the CHD would */
+	UINT64 offset = UINT64(lbasector) * file->info.sectorbytes;
+	UINT32 hunkbytes = file->chd->hunk_bytes();
+	if (offset / hunkbytes >= file->chd->hunk_count())
+		return FALSE;
+
+	/* report a failed write-back from earlier */
+	osd_lock_acquire(file->lock);
+	if (cache_take_error(file) != CHDERR_NONE)
+	{
+		osd_lock_release(file->lock);
+		return FALSE;
+	}
+
+	/* update the cached copy of the hunk */
+	hard_disk_cache_entry *entry = cache_find(file, offset / hunkbytes);
+	if (entry == NULL)
+		entry = cache_allocate(file, offset / hunkbytes);
+	if (entry == NULL)
+	{
+		osd_lock_release(file->lock);
+		return FALSE;
+	}
+	memcpy(&entry->data[offset % hunkbytes], buffer, file->info.sectorbytes);
+	if (!entry->dirty)
+	{
+		entry->dirty = TRUE;
+		file->dirtycount++;
+	}
+
+	/* once a quarter of the cache is dirty, start writing it back; once the CHD */
+	/* has been handed out, only this thread may touch it, so write through */
+	if (file->queue == NULL)
+	{
+		chd_error err = cache_write_entry(file, entry);
+		if (err != CHDERR_NONE)
+		{
+			cache_take_error(file);
+			osd_lock_release(file->lock);
+			return FALSE;
+		}
+	}
+	else if (file->dirtycount >= (file->cachehunks + 3) / 4 && !file->flushpending)
+	{
+		file->flushpending = TRUE;
+		if (osd_work_item_queue(file->queue, cache_flush_callback, file, WORK_ITEM_FLAG_AUTO_RELEASE) == NULL)
+			file->flushpending = FALSE;
+	}
+	osd_lock_release(file->lock);
+	return TRUE;
 }
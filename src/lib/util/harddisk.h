@@ -69,8 +69,12 @@ struct hard_disk_info
 hard_disk_file *hard_disk_open(chd_file *chd);
 void hard_disk_close(hard_disk_file *file);
 
+int hard_disk_enable_write_cache(hard_disk_file *file, UINT32 hunks);
+int hard_disk_flush(hard_disk_file *file);
+
 chd_file *hard_disk_get_chd(hard_disk_file *file);
 hard_disk_info *hard_disk_get_info(hard_disk_file *file);
+chd_error hard_disk_read_metadata(hard_disk_file *file, chd_metadata_tag searchtag, UINT32 searchindex, void *output, UINT32 outputlen, UINT32 &resultlen);
 
 UINT32 hard_disk_read(hard_disk_file *file, UINT32 lbasector, void *buffer);
 UINT32 hard_disk_write(hard_disk_file *file, UINT32 lbasector, const void *buffer);
@@ -38,7 +38,6 @@
 ***************************************************************************/
 
 #include "hashing.h"
-#include "zlib.h"
 
 
 //**************************************************************************
@@ -52,6 +51,36 @@ const sha1_t sha1_t::null = { { 0 } };
 
 
 
+//**************************************************************************
+//  CRC-32 TABLES
+//**************************************************************************
+
+// slice-by-8 tables for the reflected CRC-32 polynomial used by zlib; table
+// n gives the contribution of a byte that is followed by n further bytes
+class crc32_tables
+{
+public:
+	crc32_tables()
+	{
+		for (UINT32 index = 0; index < 256; index++)
+		{
+			UINT32 crc = index;
+			for (int bit = 0; bit < 8; bit++)
+				crc = (crc >> 1) ^ ((crc & 1) ? 0xedb88320 : 0);
+			m_table[0][index] = crc;
+		}
+		for (UINT32 index = 0; index < 256; index++)
+			for (int slice = 1; slice < 8; slice++)
+				m_table[slice][index] = (m_table[slice - 1][index] >> 8) ^ m_table[0][m_table[slice - 1][index] & 0xff];
+	}
+
+	UINT32 m_table[8][256];
+};
+
+static const crc32_tables s_crc32;
+
+
+
 //**************************************************************************
 //  INLINE FUNCTIONS
 //**************************************************************************
@@ -208,7 +237,34 @@ const char *crc32_t::as_string(astring &buffer) const
 
 void crc32_creator::append(const void *data, UINT32 length)
 {
-	m_accum.m_raw = crc32(m_accum, reinterpret_cast<const Bytef *>(data), length);
+	const UINT8 *src = reinterpret_cast<const UINT8 *>(data);
+	const UINT32 (*table)[256] = s_crc32.m_table;
+	UINT32 crc = ~m_accum.m_raw;
+
+	// process bytes individually until we are 8-byte aligned
+	while (length != 0 && (reinterpret_cast<size_t>(src) & 7) != 0)
+	{
+		crc = table[0][(crc ^ *src++) & 0xff] ^ (crc >> 8);
+		length--;
+	}
+
+	// then 8 bytes at a time, composing the words byte-wise so that this
+	// works regardless of host endianness
+	while (length >= 8)
+	{
+		UINT32 one = crc ^ (src[0] | (src[1] << 8) | (src[2] << 16) | (src[3] << 24));
+		UINT32 two = src[4] | (src[5] << 8) | (src[6] << 16) | (src[7] << 24);
+		crc = table[7][one & 0xff] ^ table[6][(one >> 8) & 0xff] ^ table[5][(one >> 16) & 0xff] ^ table[4][one >> 24] ^
+				table[3][two & 0xff] ^ table[2][(two >> 8) & 0xff] ^ table[1][(two >> 16) & 0xff] ^ table[0][two >> 24];
+		src += 8;
+		length -= 8;
+	}
+
+	// and finally any leftovers
+	while (length-- != 0)
+		crc = table[0][(crc ^ *src++) & 0xff] ^ (crc >> 8);
+
+	m_accum.m_raw = ~crc;
 }
 
 
@@ -41,6 +41,17 @@
 #include <stdlib.h>
 #include <math.h>
 
+/* GCC 4.9 and later can compile the AVX2 gather lookup without -mavx2; we
+   select it at runtime via CPUID */
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__)) && \
+	(__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))
+#define PALETTE_X86_AVX2	1
+#include <cpuid.h>
+#include <immintrin.h>
+#else
+#define PALETTE_X86_AVX2	0
+#endif
+
 
 
 /***************************************************************************
@@ -416,7 +427,7 @@ const UINT32 *palette_client_get_dirty_list(palette_client *client, UINT32 *mind
 
 	/* erase relevant entries in the new live one */
 	if (client->live.mindirty <= client->live.maxdirty)
-		memset(client->live.dirty, client->live.mindirty / 8, (client->live.maxdirty / 8) + 1 - (client->live.mindirty / 8));
+		memset((UINT8 *)client->live.dirty + client->live.mindirty / 8, 0, (client->live.maxdirty / 8) + 1 - (client->live.mindirty / 8));
 	client->live.mindirty = client->palette->numcolors * client->palette->numgroups;
 	client->live.maxdirty = 0;
 
@@ -719,6 +730,119 @@ void palette_normalize_range(palette_t *palette, UINT32 start, UINT32 end, int l
 }
 
 
+/*-------------------------------------------------
+    palette_lookup_row_c - portable row lookup
+-------------------------------------------------*/
+
+static void palette_lookup_row_c(UINT32 *dest, const UINT16 *source, int count, const rgb_t *entries, rgb_t ormask)
+{
+	for ( ; count >= 4; count -= 4, source += 4, dest += 4)
+	{
+		UINT32 pix0 = entries[source[0]];
+		UINT32 pix1 = entries[source[1]];
+		UINT32 pix2 = entries[source[2]];
+		UINT32 pix3 = entries[source[3]];
+		dest[0] = pix0 | ormask;
+		dest[1] = pix1 | ormask;
+		dest[2] = pix2 | ormask;
+		dest[3] = pix3 | ormask;
+	}
+	for ( ; count > 0; count--)
+		*dest++ = entries[*source++] | ormask;
+}
+
+
+#if PALETTE_X86_AVX2
+
+/*-------------------------------------------------
+    palette_lookup_row_avx2 - row lookup using
+    AVX2 gathers, 16 pixels at a time
+-------------------------------------------------*/
+
+__attribute__((target("avx2")))
+static void palette_lookup_row_avx2(UINT32 *dest, const UINT16 *source, int count, const rgb_t *entries, rgb_t ormask)
+{
+	const __m256i mask = _mm256_set1_epi32(ormask);
+
+	for ( ; count >= 16; count -= 16, source += 16, dest += 16)
+	{
+		__m256i index0 = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)source));
+		__m256i index1 = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)(source + 8)));
+		__m256i pix0 = _mm256_i32gather_epi32((const int *)entries, index0, 4);
+		__m256i pix1 = _mm256_i32gather_epi32((const int *)entries, index1, 4);
+		_mm256_storeu_si256((__m256i *)dest, _mm256_or_si256(pix0, mask));
+		_mm256_storeu_si256((__m256i *)(dest + 8), _mm256_or_si256(pix1, mask));
+	}
+	palette_lookup_row_c(dest, source, count, entries, ormask);
+}
+
+
+/*-------------------------------------------------
+    palette_cpu_has_avx2 - return TRUE if the CPU
+    and OS support AVX2
+-------------------------------------------------*/
+
+static int palette_cpu_has_avx2(void)
+{
+	unsigned int eax, ebx, ecx, edx;
+
+	/* AVX2 is CPUID.(EAX=7,ECX=0):EBX[5]; the OS must also save YMM state (OSXSAVE, then XCR0[2:1]) */
+	if (__get_cpuid_max(0, NULL) < 7)
+		return FALSE;
+	__cpuid(1, eax, ebx, ecx, edx);
+	if ((ecx & (1 << 27)) == 0 || (ecx & (1 << 28)) == 0)
+		return FALSE;
+	__asm__ __volatile__ ("xgetbv" : "=a" (eax), "=d" (edx) : "c" (0));
+	if ((eax & 6) != 6)
+		return FALSE;
+	__cpuid_count(7, 0, eax, ebx, ecx, edx);
+	return (ebx & (1 << 5)) != 0;
+}
+
+#endif
+
+
+/*-------------------------------------------------
+    palette_lookup_row - look up a row of palette
+    indexes, ORing each color with ormask
+-------------------------------------------------*/
+
+typedef void (*palette_lookup_row_func)(UINT32 *dest, const UINT16 *source, int count, const rgb_t *entries, rgb_t ormask);
+
+void palette_lookup_row(UINT32 *dest, const UINT16 *source, int count, const rgb_t *entries, rgb_t ormask)
+{
+	/* the selection is idempotent, so racing threads all store the same value */
+	static palette_lookup_row_func lookup_row;
+	if (lookup_row == NULL)
+	{
+#if PALETTE_X86_AVX2
+		lookup_row = palette_cpu_has_avx2() ? palette_lookup_row_avx2 : palette_lookup_row_c;
+#else
+		lookup_row = palette_lookup_row_c;
+#endif
+	}
+	(*lookup_row)(dest, source, count, entries, ormask);
+}
+
+
+/*-------------------------------------------------
+    palette_row_uses_dirty - return TRUE if any
+    of a row of palette indexes refers to an entry
+    in a client's dirty list
+-------------------------------------------------*/
+
+int palette_row_uses_dirty(const UINT16 *source, int count, const UINT32 *dirty, UINT32 mindirty, UINT32 maxdirty)
+{
+	for ( ; count > 0; count--)
+	{
+		UINT32 index = *source++;
+		if (index >= mindirty && index <= maxdirty && (dirty[index / 32] & (1 << (index % 32))) != 0)
+			return TRUE;
+	}
+	return FALSE;
+}
+
+
 
 /***************************************************************************
     INTERNAL ROUTINES
@@ -189,6 +189,12 @@ void palette_group_set_contrast(palette_t *palette, UINT32 group, float contrast
    brightness to lum_max; if either value is < 0, that boundary value is not modified */
 void palette_normalize_range(palette_t *palette, UINT32 start, UINT32 end, int lum_min, int lum_max);
 
+/* look up a row of palette indexes in an entry list, ORing each color with ormask */
+void palette_lookup_row(UINT32 *dest, const UINT16 *source, int count, const rgb_t *entries, rgb_t ormask);
+
+/* return TRUE if any of a row of palette indexes refers to an entry in a client's dirty list */
+int palette_row_uses_dirty(const UINT16 *source, int count, const UINT32 *dirty, UINT32 mindirty, UINT32 maxdirty);
+
 
 
 /***************************************************************************
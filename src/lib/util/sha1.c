@@ -29,6 +29,18 @@
 #include <stdlib.h>
 #include <string.h>
 
+/* SHA extensions (SHA-NI) are available on recent x86 CPUs; compile the
+   accelerated block function whenever the compiler can target them and
+   select it at runtime via CPUID */
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__)) && \
+	(__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))
+#define SHA1_X86_SHANI	1
+#include <cpuid.h>
+#include <immintrin.h>
+#else
+#define SHA1_X86_SHANI	0
+#endif
+
 static unsigned int READ_UINT32(const UINT8* data)
 {
 	return ((UINT32)data[0] << 24) |
@@ -248,21 +260,151 @@ sha1_transform(UINT32 *state, UINT32 *data)
   state[4] += E;
 }
 
+/* Process a run of complete blocks with the portable C transform */
+
 static void
-sha1_block(struct sha1_ctx *ctx, const UINT8 *block)
+sha1_blocks_c(UINT32 *state, const UINT8 *block, unsigned count)
 {
   UINT32 data[SHA1_DATA_LENGTH];
   int i;
 
+  for ( ; count > 0; count--)
+    {
+      /* Endian independent conversion */
+      for (i = 0; i<SHA1_DATA_LENGTH; i++, block += 4)
+	data[i] = READ_UINT32(block);
+
+      sha1_transform(state, data);
+    }
+}
+
+#if SHA1_X86_SHANI
+
+/* Process a run of complete blocks using the SHA extensions. Each group of
+   four rounds consumes one 128-bit message vector; vectors beyond the first
+   four are derived from the previous four with SHA1MSG1/SHA1MSG2, and the
+   E value for each group is derived from the A value four rounds back with
+   SHA1NEXTE */
+
+#define SHANI_GROUP_FIRST() \
+  do { \
+    E = _mm_add_epi32(E, msg[0]); \
+    prev = abcd; \
+    abcd = _mm_sha1rnds4_epu32(abcd, E, 0); \
+  } while (0)
+
+#define SHANI_GROUP_LOAD(i) \
+  do { \
+    msg[i] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(block + 16 * (i))), mask); \
+    E = _mm_sha1nexte_epu32(prev, msg[i]); \
+    prev = abcd; \
+    abcd = _mm_sha1rnds4_epu32(abcd, E, 0); \
+  } while (0)
+
+#define SHANI_GROUP(i, func) \
+  do { \
+    msg[(i) & 3] = _mm_sha1msg2_epu32(_mm_xor_si128(_mm_sha1msg1_epu32(msg[(i) & 3], msg[((i) + 1) & 3]), msg[((i) + 2) & 3]), msg[((i) + 3) & 3]); \
+    E = _mm_sha1nexte_epu32(prev, msg[(i) & 3]); \
+    prev = abcd; \
+    abcd = _mm_sha1rnds4_epu32(abcd, E, func); \
+  } while (0)
+
+__attribute__((target("sha,sse4.1")))
+static void
+sha1_blocks_shani(UINT32 *state, const UINT8 *block, unsigned count)
+{
+  const __m128i mask = _mm_set_epi64x(0x0001020304050607ULL, 0x08090a0b0c0d0e0fULL);
+  __m128i abcd, abcd_save, e0, e0_save, E, prev;
+  __m128i msg[4];
+
+  /* A lives in the most significant lane */
+  abcd = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)state), 0x1b);
+  e0 = _mm_set_epi32(state[4], 0, 0, 0);
+
+  for ( ; count > 0; count--, block += SHA1_DATA_SIZE)
+    {
+      abcd_save = abcd;
+      e0_save = e0;
+
+      /* Rounds 0-15 consume the input directly */
+      msg[0] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)block), mask);
+      E = e0;
+      SHANI_GROUP_FIRST();
+      SHANI_GROUP_LOAD(1);
+      SHANI_GROUP_LOAD(2);
+      SHANI_GROUP_LOAD(3);
+
+      /* Rounds 16-79 use the expanded schedule */
+      SHANI_GROUP(4, 0);
+      SHANI_GROUP(5, 1);  SHANI_GROUP(6, 1);  SHANI_GROUP(7, 1);  SHANI_GROUP(8, 1);  SHANI_GROUP(9, 1);
+      SHANI_GROUP(10, 2); SHANI_GROUP(11, 2); SHANI_GROUP(12, 2); SHANI_GROUP(13, 2); SHANI_GROUP(14, 2);
+      SHANI_GROUP(15, 3); SHANI_GROUP(16, 3); SHANI_GROUP(17, 3); SHANI_GROUP(18, 3); SHANI_GROUP(19, 3);
+
+      /* Fold back into the running state */
+      e0 = _mm_sha1nexte_epu32(prev, e0_save);
+      abcd = _mm_add_epi32(abcd, abcd_save);
+    }
+
+  _mm_storeu_si128((__m128i *)state, _mm_shuffle_epi32(abcd, 0x1b));
+  state[4] = _mm_extract_epi32(e0, 3);
+}
+
+#undef SHANI_GROUP_FIRST
+#undef SHANI_GROUP_LOAD
+#undef SHANI_GROUP
+
+static int
+sha1_cpu_has_shani(void)
+{
+  unsigned int eax, ebx, ecx, edx;
+
+  /* SHA is CPUID.(EAX=7,ECX=0):EBX[29]; SSSE3 and SSE4.1 are CPUID.1:ECX[9,19] */
+  if (__get_cpuid_max(0, NULL) < 7)
+    return 0;
+  __cpuid(1, eax, ebx, ecx, edx);
+  if ((ecx & (1 << 9)) == 0 || (ecx & (1 << 19)) == 0)
+    return 0;
+  __cpuid_count(7, 0, eax, ebx, ecx, edx);
+  return (ebx & (1 << 29)) != 0;
+}
+
+#endif
+
+/* Block function selected on first use; the selection is idempotent, so
+   racing threads all store the same value */
+
+typedef void (*sha1_blocks_func)(UINT32 *state, const UINT8 *block, unsigned count);
+static sha1_blocks_func sha1_blocks_impl;
+
+static sha1_blocks_func
+sha1_select_blocks(void)
+{
+  if (sha1_blocks_impl == NULL)
+    {
+#if SHA1_X86_SHANI
+      sha1_blocks_impl = sha1_cpu_has_shani() ? sha1_blocks_shani : sha1_blocks_c;
+#else
+      sha1_blocks_impl = sha1_blocks_c;
+#endif
+    }
+  return sha1_blocks_impl;
+}
+
+int
+sha1_accelerated(void)
+{
+  return sha1_select_blocks() != sha1_blocks_c;
+}
+
+static void
+sha1_blocks(struct sha1_ctx *ctx, const UINT8 *block, unsigned count)
+{
   /* Update block count */
-  if (!++ctx->count_low)
+  ctx->count_low += count;
+  if (ctx->count_low < count)
     ++ctx->count_high;
 
-  /* Endian independent conversion */
-  for (i = 0; i<SHA1_DATA_LENGTH; i++, block += 4)
-    data[i] = READ_UINT32(block);
-
-  sha1_transform(ctx->digest, data);
+  (*sha1_select_blocks())(ctx->digest, block, count);
 }
 
 void
@@ -281,16 +423,17 @@ sha1_update(struct sha1_ctx *ctx,
       else
 	{
 	  memcpy(ctx->block + ctx->index, buffer, left);
-	  sha1_block(ctx, ctx->block);
+	  sha1_blocks(ctx, ctx->block, 1);
 	  buffer += left;
 	  length -= left;
 	}
     }
-  while (length >= SHA1_DATA_SIZE)
+  if (length >= SHA1_DATA_SIZE)
     {
-      sha1_block(ctx, buffer);
-      buffer += SHA1_DATA_SIZE;
-      length -= SHA1_DATA_SIZE;
+      unsigned count = length / SHA1_DATA_SIZE;
+      sha1_blocks(ctx, buffer, count);
+      buffer += count * SHA1_DATA_SIZE;
+      length -= count * SHA1_DATA_SIZE;
     }
   ctx->index = length;
   if (length)
@@ -58,4 +58,8 @@ sha1_digest(const struct sha1_ctx *ctx,
 	    unsigned length,
 	    UINT8 *digest);
 
+/* Returns non-zero if a hardware-accelerated block function is in use */
+int
+sha1_accelerated(void);
+
 #endif /* NETTLE_SHA1_H_INCLUDED */
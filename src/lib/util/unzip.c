@@ -50,8 +50,24 @@
     CONSTANTS
 ***************************************************************************/
 
-/* number of open files to cache */
-#define ZIP_CACHE_SIZE	8
+/* open file cache limits; the cache holds between MIN and MAX files, */
+/* evicting beyond MIN only when the memory budget is exceeded */
+#define ZIP_CACHE_MIN			8
+#define ZIP_CACHE_MAX			64
+#define ZIP_CACHE_BYTES			(4 * 1024 * 1024)
+
+/* decompressed member cache limits */
+#define ZIP_MEMBER_CACHE_BYTES	(16 * 1024 * 1024)
+#define ZIP_MEMBER_CACHE_MAX	(4 * 1024 * 1024)
+
+/* members at least this large get a random-access index on first range read */
+#define ZIP_INDEX_THRESHOLD		(1024 * 1024)
+
+/* uncompressed distance between index checkpoints */
+#define ZIP_INDEX_SPAN			(256 * 1024)
+
+/* size of the deflate window saved at each checkpoint */
+#define ZIP_WINDOW_SIZE			32768
 
 /* offsets in end of central directory structure */
 #define ZIPESIG			0x00
@@ -118,11 +134,68 @@ INLINE UINT32 read_dword(UINT8 *buf)
 
 
 
+/***************************************************************************
+    TYPE DEFINITIONS
+***************************************************************************/
+
+/* a point in a deflate stream from which decompression can resume */
+typedef struct _zip_checkpoint zip_checkpoint;
+struct _zip_checkpoint
+{
+	UINT32			out;					/* uncompressed offset */
+	UINT64			in;						/* file offset of the first full compressed byte */
+	int				bits;					/* number of bits of the preceding byte still unused */
+	UINT8			window[ZIP_WINDOW_SIZE];/* preceding uncompressed data */
+};
+
+
+/* a list of checkpoints for a single member */
+struct _zip_index
+{
+	zip_index *		next;					/* next index in this zip_file */
+	UINT32			local_header_offset;	/* identifies the member */
+	UINT32			count;					/* number of checkpoints */
+	zip_checkpoint *points;					/* array of checkpoints */
+};
+
+
+/* an inflate stream positioned partway through a member */
+struct _zip_stream
+{
+	UINT32			local_header_offset;	/* identifies the member */
+	int				active;					/* is the stream positioned and error-free? */
+	UINT32			out;					/* uncompressed offset of the next byte inflated */
+	UINT64			in;						/* file offset of the next compressed byte to read */
+	z_stream		z;						/* zlib state */
+	UINT8			buffer[ZIP_DECOMPRESS_BUFSIZE];	/* compressed input not yet consumed */
+};
+
+
+/* a decompressed member kept in memory */
+typedef struct _zip_member zip_member;
+struct _zip_member
+{
+	zip_member *	next;					/* next member, in MRU order */
+	char *			filename;				/* ZIP filename */
+	UINT32			local_header_offset;	/* identifies the member */
+	UINT32			crc;					/* CRC of the member, as a sanity check */
+	UINT32			length;					/* uncompressed length */
+	UINT8 *			data;					/* uncompressed data */
+};
+
+
+
 /***************************************************************************
     GLOBAL VARIABLES
 ***************************************************************************/
 
-static zip_file *zip_cache[ZIP_CACHE_SIZE];
+static zip_file *zip_cache[ZIP_CACHE_MAX];
+
+/* the member cache is shared by every thread reading a ZIP, so it is */
+/* only touched with zip_member_lock held */
+static osd_lock *zip_member_lock = osd_lock_alloc();
+static zip_member *zip_member_cache;
+static UINT32 zip_member_cache_bytes;
 
 
 
@@ -132,6 +205,17 @@ static zip_file *zip_cache[ZIP_CACHE_SIZE];
 
 /* cache management */
 static void free_zip_file(zip_file *zip);
+static UINT32 zip_file_footprint(const zip_file *zip);
+static int copy_member(zip_file *zip, UINT32 offset, void *buffer, UINT32 length);
+static void add_member(zip_file *zip, const void *data);
+static void free_member(zip_member *member);
+
+/* random access */
+static zip_error decompress_range_type_8(zip_file *zip, UINT64 dataoffset, UINT32 offset, void *buffer, UINT32 length);
+static zip_error build_index(zip_file *zip, UINT64 offset, zip_index **result);
+static zip_error stream_start(zip_file *zip, zip_stream *stream, UINT64 dataoffset, const zip_checkpoint *point);
+static zip_error stream_read(zip_file *zip, zip_stream *stream, UINT32 offset, void *buffer, UINT32 length);
+static void free_stream(zip_file *zip);
 
 /* ZIP file parsing */
 static zip_error read_ecd(zip_file *zip);
@@ -244,6 +328,7 @@ error:
 
 void zip_file_close(zip_file *zip)
 {
+	UINT32 total_bytes;
 	int cachenum;
 
 	/* close the open files */
@@ -251,6 +336,9 @@ void zip_file_close(zip_file *zip)
 		osd_close(zip->file);
 	zip->file = NULL;
 
+	/* cached files don't keep a stream, since the next reader starts over */
+	free_stream(zip);
+
 	/* find the first NULL entry in the cache */
 	for (cachenum = 0; cachenum < ARRAY_LENGTH(zip_cache); cachenum++)
 		if (zip_cache[cachenum] == NULL)
@@ -264,6 +352,23 @@ void zip_file_close(zip_file *zip)
 	if (cachenum != 0)
 		memmove(&zip_cache[1], &zip_cache[0], cachenum * sizeof(zip_cache[0]));
 	zip_cache[0] = zip;
+	cachenum++;
+
+	/* beyond the minimum, keep entries only while they fit the memory budget */
+	total_bytes = 0;
+	for (int entry = 0; entry < cachenum; entry++)
+	{
+		total_bytes += zip_file_footprint(zip_cache[entry]);
+		if (entry >= ZIP_CACHE_MIN && total_bytes > ZIP_CACHE_BYTES)
+		{
+			for ( ; entry < cachenum; entry++)
+			{
+				free_zip_file(zip_cache[entry]);
+				zip_cache[entry] = NULL;
+			}
+			break;
+		}
+	}
 }
 
 
@@ -283,6 +388,17 @@ void zip_file_cache_clear(void)
 			free_zip_file(zip_cache[cachenum]);
 			zip_cache[cachenum] = NULL;
 		}
+
+	/* and all decompressed members */
+	osd_lock_acquire(zip_member_lock);
+	while (zip_member_cache != NULL)
+	{
+		zip_member *member = zip_member_cache;
+		zip_member_cache = member->next;
+		free_member(member);
+	}
+	zip_member_cache_bytes = 0;
+	osd_lock_release(zip_member_lock);
 }
 
 
@@ -379,6 +495,10 @@ zip_error zip_file_decompress(zip_file *zip, void *buffer, UINT32 length)
 	if (zip->header.start_disk_number != zip->ecd.disk_number)
 		return ZIPERR_UNSUPPORTED;
 
+	/* if we decompressed this member recently, just copy it */
+	if (copy_member(zip, 0, buffer, zip->header.uncompressed_length))
+		return ZIPERR_NONE;
+
     /* get the compressed data offset */
     ziperr = get_compressed_data_offset(zip, &offset);
     if (ziperr != ZIPERR_NONE)
@@ -399,10 +519,76 @@ zip_error zip_file_decompress(zip_file *zip, void *buffer, UINT32 length)
     		ziperr = ZIPERR_UNSUPPORTED;
     		break;
     }
+
+	/* remember the result for next time */
+	if (ziperr == ZIPERR_NONE)
+		add_member(zip, buffer);
 	return ziperr;
 }
 
 
+/*-------------------------------------------------
+    zip_file_decompress_range - decompress part
+    of a file from a ZIP into the target buffer;
+    deflated members carry on from where the
+    previous read stopped, and large ones are
+    indexed so that jumps resume from the nearest
+    checkpoint instead of the start
+-------------------------------------------------*/
+
+zip_error zip_file_decompress_range(zip_file *zip, UINT32 offset, void *buffer, UINT32 length)
+{
+	zip_error ziperr;
+	UINT64 dataoffset;
+
+	/* clamp to the member */
+	if (offset > zip->header.uncompressed_length || length > zip->header.uncompressed_length - offset)
+		return ZIPERR_BUFFER_TOO_SMALL;
+	if (length == 0)
+		return ZIPERR_NONE;
+
+	/* make sure the info in the header aligns with what we know */
+	if (zip->header.start_disk_number != zip->ecd.disk_number)
+		return ZIPERR_UNSUPPORTED;
+
+	/* if it's already in memory, copy from there */
+	if (copy_member(zip, offset, buffer, length))
+		return ZIPERR_NONE;
+
+	/* get the compressed data offset */
+	ziperr = get_compressed_data_offset(zip, &dataoffset);
+	if (ziperr != ZIPERR_NONE)
+		return ziperr;
+
+	/* stored data can be read directly */
+	if (zip->header.compression == 0)
+	{
+		UINT32 read_length;
+		file_error filerr = osd_read(zip->file, buffer, dataoffset + offset, length, &read_length);
+		if (filerr != FILERR_NONE)
+			return ZIPERR_FILE_ERROR;
+		return (read_length == length) ? ZIPERR_NONE : ZIPERR_FILE_TRUNCATED;
+	}
+	if (zip->header.compression != 8)
+		return ZIPERR_UNSUPPORTED;
+
+	/* small deflated members are cheapest to decompress whole */
+	if (zip->header.uncompressed_length < ZIP_INDEX_THRESHOLD)
+	{
+		UINT8 *temp = (UINT8 *)malloc(zip->header.uncompressed_length);
+		if (temp == NULL)
+			return ZIPERR_OUT_OF_MEMORY;
+		ziperr = zip_file_decompress(zip, temp, zip->header.uncompressed_length);
+		if (ziperr == ZIPERR_NONE)
+			memcpy(buffer, temp + offset, length);
+		free(temp);
+		return ziperr;
+	}
+
+	return decompress_range_type_8(zip, dataoffset, offset, buffer, length);
+}
+
+
 
 /***************************************************************************
     CACHE MANAGEMENT
@@ -417,6 +603,14 @@ static void free_zip_file(zip_file *zip)
 {
 	if (zip != NULL)
 	{
+		while (zip->index != NULL)
+		{
+			zip_index *index = zip->index;
+			zip->index = index->next;
+			free(index->points);
+			free(index);
+		}
+		free_stream(zip);
 		if (zip->file != NULL)
 			osd_close(zip->file);
 		if (zip->filename != NULL)
@@ -431,6 +625,123 @@ static void free_zip_file(zip_file *zip)
 
 
 
+/*-------------------------------------------------
+    zip_file_footprint - return the approximate
+    memory held by a cached zip_file
+-------------------------------------------------*/
+
+static UINT32 zip_file_footprint(const zip_file *zip)
+{
+	UINT32 bytes = sizeof(*zip) + zip->ecd.rawlength + zip->ecd.cd_size;
+	const zip_index *index;
+
+	for (index = zip->index; index != NULL; index = index->next)
+		bytes += sizeof(*index) + index->count * sizeof(index->points[0]);
+	return bytes;
+}
+
+
+/*-------------------------------------------------
+    copy_member - copy part of the current file of
+    a ZIP out of the decompressed member cache,
+    moving it to the head; returns FALSE if it is
+    not cached
+-------------------------------------------------*/
+
+static int copy_member(zip_file *zip, UINT32 offset, void *buffer, UINT32 length)
+{
+	zip_member **prevptr;
+	int found = FALSE;
+
+	osd_lock_acquire(zip_member_lock);
+	for (prevptr = &zip_member_cache; *prevptr != NULL; prevptr = &(*prevptr)->next)
+	{
+		zip_member *member = *prevptr;
+		if (member->local_header_offset == zip->header.local_header_offset && member->crc == zip->header.crc &&
+			member->length == zip->header.uncompressed_length && strcmp(member->filename, zip->filename) == 0)
+		{
+			*prevptr = member->next;
+			member->next = zip_member_cache;
+			zip_member_cache = member;
+			memcpy(buffer, member->data + offset, length);
+			found = TRUE;
+			break;
+		}
+	}
+	osd_lock_release(zip_member_lock);
+	return found;
+}
+
+
+/*-------------------------------------------------
+    add_member - add the current file of a ZIP to
+    the decompressed member cache, evicting the
+    least recently used members to make room
+-------------------------------------------------*/
+
+static void add_member(zip_file *zip, const void *data)
+{
+	UINT32 length = zip->header.uncompressed_length;
+	zip_member **prevptr;
+	zip_member *member;
+
+	/* don't bother with anything too large or unnamed */
+	if (length > ZIP_MEMBER_CACHE_MAX || zip->filename == NULL)
+		return;
+
+	/* allocate and fill in a new member */
+	member = (zip_member *)malloc(sizeof(*member));
+	if (member == NULL)
+		return;
+	memset(member, 0, sizeof(*member));
+	member->filename = (char *)malloc(strlen(zip->filename) + 1);
+	member->data = (UINT8 *)malloc(length ? length : 1);
+	if (member->filename == NULL || member->data == NULL)
+	{
+		free_member(member);
+		return;
+	}
+	strcpy(member->filename, zip->filename);
+	member->local_header_offset = zip->header.local_header_offset;
+	member->crc = zip->header.crc;
+	member->length = length;
+	memcpy(member->data, data, length);
+
+	/* evict from the tail until we fit */
+	osd_lock_acquire(zip_member_lock);
+	while (zip_member_cache != NULL && zip_member_cache_bytes + length > ZIP_MEMBER_CACHE_BYTES)
+	{
+		zip_member *victim;
+		for (prevptr = &zip_member_cache; (*prevptr)->next != NULL; prevptr = &(*prevptr)->next) ;
+		victim = *prevptr;
+		*prevptr = NULL;
+		zip_member_cache_bytes -= victim->length;
+		free_member(victim);
+	}
+
+	/* link at the head */
+	member->next = zip_member_cache;
+	zip_member_cache = member;
+	zip_member_cache_bytes += length;
+	osd_lock_release(zip_member_lock);
+}
+
+
+/*-------------------------------------------------
+    free_member - free a decompressed member
+-------------------------------------------------*/
+
+static void free_member(zip_member *member)
+{
+	if (member->filename != NULL)
+		free(member->filename);
+	if (member->data != NULL)
+		free(member->data);
+	free(member);
+}
+
+
+
 /***************************************************************************
     ZIP FILE PARSING
 ***************************************************************************/
@@ -643,3 +954,314 @@ static zip_error decompress_data_type_8(zip_file *zip, UINT64 offset, void *buff
 
 	return ZIPERR_NONE;
 }
+
+
+
+/***************************************************************************
+    RANDOM ACCESS
+***************************************************************************/
+
+/*-------------------------------------------------
+    decompress_range_type_8 - read part of a
+    deflated member, carrying on from the last
+    read when moving forward and jumping through
+    the index otherwise
+-------------------------------------------------*/
+
+static zip_error decompress_range_type_8(zip_file *zip, UINT64 dataoffset, UINT32 offset, void *buffer, UINT32 length)
+{
+	zip_stream *stream = zip->stream;
+	const zip_checkpoint *point = NULL;
+	zip_index *index;
+	zip_error ziperr;
+	int resume;
+
+	/* allocate the stream on first use */
+	if (stream == NULL)
+	{
+		stream = (zip_stream *)malloc(sizeof(*stream));
+		if (stream == NULL)
+			return ZIPERR_OUT_OF_MEMORY;
+		memset(stream, 0, sizeof(*stream));
+		if (inflateInit2(&stream->z, -MAX_WBITS) != Z_OK)
+		{
+			free(stream);
+			return ZIPERR_DECOMPRESS_ERROR;
+		}
+		zip->stream = stream;
+	}
+
+	/* sequential reads just carry on from where the last one stopped */
+	resume = (stream->active && stream->local_header_offset == zip->header.local_header_offset && stream->out <= offset);
+
+	/* find this member's index; build it if we have to jump anywhere past the first span */
+	for (index = zip->index; index != NULL; index = index->next)
+		if (index->local_header_offset == zip->header.local_header_offset)
+			break;
+	if (index == NULL && !resume && offset >= ZIP_INDEX_SPAN)
+	{
+		ziperr = build_index(zip, dataoffset, &index);
+		if (ziperr != ZIPERR_NONE)
+			return ziperr;
+	}
+
+	/* find the last checkpoint at or before the offset */
+	if (index != NULL)
+	{
+		UINT32 pointnum;
+		point = &index->points[0];
+		for (pointnum = 1; pointnum < index->count && index->points[pointnum].out <= offset; pointnum++)
+			point = &index->points[pointnum];
+	}
+
+	/* restart if we went backwards, or if a checkpoint gets us closer than the stream is */
+	if (!resume || (point != NULL && point->out > stream->out))
+	{
+		ziperr = stream_start(zip, stream, dataoffset, point);
+		if (ziperr != ZIPERR_NONE)
+			return ziperr;
+	}
+	return stream_read(zip, stream, offset, buffer, length);
+}
+
+
+/*-------------------------------------------------
+    build_index - decompress a deflated member
+    once, recording a checkpoint at a block
+    boundary roughly every ZIP_INDEX_SPAN bytes
+-------------------------------------------------*/
+
+static zip_error build_index(zip_file *zip, UINT64 offset, zip_index **result)
+{
+	UINT32 input_remaining = zip->header.compressed_length;
+	UINT32 maxpoints = zip->header.uncompressed_length / ZIP_INDEX_SPAN + 2;
+	UINT32 totin = 0, totout = 0, last = 0;
+	UINT8 *window;
+	zip_index *index;
+	z_stream stream;
+	int zerr = Z_OK;
+
+	/* make sure we don't need a newer mechanism */
+	if (zip->header.version_needed > 0x14)
+		return ZIPERR_UNSUPPORTED;
+
+	/* allocate the index and a scratch window */
+	index = (zip_index *)malloc(sizeof(*index));
+	window = (UINT8 *)malloc(ZIP_WINDOW_SIZE);
+	if (index != NULL)
+		index->points = (zip_checkpoint *)malloc(maxpoints * sizeof(index->points[0]));
+	if (index == NULL || index->points == NULL || window == NULL)
+	{
+		if (index != NULL)
+			free(index->points);
+		free(index);
+		free(window);
+		return ZIPERR_OUT_OF_MEMORY;
+	}
+	index->local_header_offset = zip->header.local_header_offset;
+
+	/* the start of the stream is always a valid checkpoint */
+	index->points[0].out = 0;
+	index->points[0].in = offset;
+	index->points[0].bits = 0;
+	index->count = 1;
+
+	memset(&stream, 0, sizeof(stream));
+	if (inflateInit2(&stream, -MAX_WBITS) != Z_OK)
+	{
+		free(index->points);
+		free(index);
+		free(window);
+		return ZIPERR_DECOMPRESS_ERROR;
+	}
+
+	/* decompress block by block, cycling the output through the window */
+	while (zerr != Z_STREAM_END)
+	{
+		/* read in the next chunk of data, if there is any left */
+		if (input_remaining > 0)
+		{
+			UINT32 read_length;
+			file_error filerr = osd_read(zip->file, zip->buffer, offset + totin, MIN(input_remaining, sizeof(zip->buffer)), &read_length);
+			if (filerr != FILERR_NONE || read_length == 0)
+			{
+				zerr = Z_ERRNO;
+				break;
+			}
+			stream.next_in = zip->buffer;
+			stream.avail_in = read_length;
+			input_remaining -= read_length;
+		}
+
+		do
+		{
+			if (stream.avail_out == 0)
+			{
+				stream.next_out = window;
+				stream.avail_out = ZIP_WINDOW_SIZE;
+			}
+
+			totin += stream.avail_in;
+			totout += stream.avail_out;
+			zerr = inflate(&stream, Z_BLOCK);
+			totin -= stream.avail_in;
+			totout -= stream.avail_out;
+			if (zerr != Z_OK)
+				break;
+
+			/* at the end of a block (but not the last one), maybe add a checkpoint */
+			if ((stream.data_type & 128) != 0 && (stream.data_type & 64) == 0 &&
+				totout - last >= ZIP_INDEX_SPAN && index->count < maxpoints)
+			{
+				zip_checkpoint *point = &index->points[index->count++];
+				UINT32 left = stream.avail_out;
+
+				point->out = totout;
+				point->in = offset + totin;
+				point->bits = stream.data_type & 7;
+
+				/* unroll the circular window so the oldest byte comes first */
+				if (left != 0)
+					memcpy(point->window, window + ZIP_WINDOW_SIZE - left, left);
+				if (left < ZIP_WINDOW_SIZE)
+					memcpy(point->window + left, window, ZIP_WINDOW_SIZE - left);
+				last = totout;
+			}
+		} while (stream.avail_in != 0);
+
+		/* running out of input is only an error once there is none left to read */
+		if (zerr == Z_BUF_ERROR && input_remaining > 0)
+			zerr = Z_OK;
+		if (zerr != Z_OK && zerr != Z_STREAM_END)
+			break;
+	}
+	inflateEnd(&stream);
+	free(window);
+
+	if (zerr != Z_STREAM_END || totout != zip->header.uncompressed_length)
+	{
+		free(index->points);
+		free(index);
+		return ZIPERR_DECOMPRESS_ERROR;
+	}
+
+	/* link it into the zip_file */
+	index->next = zip->index;
+	zip->index = index;
+	*result = index;
+	return ZIPERR_NONE;
+}
+
+
+/*-------------------------------------------------
+    stream_start - position a member's stream at
+    a checkpoint, or at the start of the member
+    if there is none
+-------------------------------------------------*/
+
+static zip_error stream_start(zip_file *zip, zip_stream *stream, UINT64 dataoffset, const zip_checkpoint *point)
+{
+	/* forget whatever we were doing before */
+	stream->active = FALSE;
+	if (inflateReset(&stream->z) != Z_OK)
+		return ZIPERR_DECOMPRESS_ERROR;
+	stream->z.avail_in = 0;
+	stream->local_header_offset = zip->header.local_header_offset;
+	stream->out = 0;
+	stream->in = dataoffset;
+
+	if (point != NULL && point->out != 0)
+	{
+		/* prime any leftover bits from the byte before, then restore the window */
+		if (point->bits != 0)
+		{
+			UINT8 prime;
+			UINT32 read_length;
+			if (osd_read(zip->file, &prime, point->in - 1, 1, &read_length) != FILERR_NONE || read_length != 1)
+				return ZIPERR_FILE_ERROR;
+			inflatePrime(&stream->z, point->bits, prime >> (8 - point->bits));
+		}
+		inflateSetDictionary(&stream->z, point->window, ZIP_WINDOW_SIZE);
+		stream->out = point->out;
+		stream->in = point->in;
+	}
+
+	stream->active = TRUE;
+	return ZIPERR_NONE;
+}
+
+
+/*-------------------------------------------------
+    stream_read - inflate forward from a stream's
+    current position to the offset, then into
+    the target buffer
+-------------------------------------------------*/
+
+static zip_error stream_read(zip_file *zip, zip_stream *stream, UINT32 offset, void *buffer, UINT32 length)
+{
+	UINT8 discard[ZIP_WINDOW_SIZE];
+	int zerr = Z_OK;
+
+	while (length != 0)
+	{
+		UINT32 skip = offset - stream->out;
+		UINT32 read_length = 1;
+		UINT32 produced;
+
+		/* refill the input once the last chunk is used up */
+		if (stream->z.avail_in == 0)
+		{
+			if (osd_read(zip->file, stream->buffer, stream->in, sizeof(stream->buffer), &read_length) != FILERR_NONE)
+			{
+				stream->active = FALSE;
+				return ZIPERR_FILE_ERROR;
+			}
+			stream->in += read_length;
+			stream->z.next_in = stream->buffer;
+			stream->z.avail_in = read_length;
+		}
+
+		/* inflate into the discard buffer until we reach the offset, then into the target */
+		produced = (skip != 0) ? MIN(skip, sizeof(discard)) : length;
+		stream->z.next_out = (skip != 0) ? discard : (Bytef *)buffer;
+		stream->z.avail_out = produced;
+		zerr = inflate(&stream->z, Z_NO_FLUSH);
+		produced -= stream->z.avail_out;
+		stream->out += produced;
+		if (skip == 0)
+		{
+			buffer = (UINT8 *)buffer + produced;
+			offset += produced;
+			length -= produced;
+		}
+
+		/* stop at the end of the stream, on errors, or if we are starved of input */
+		if (zerr == Z_STREAM_END)
+			break;
+		if (zerr != Z_OK && (zerr != Z_BUF_ERROR || read_length == 0))
+			break;
+	}
+
+	/* a stream that came up short can't be resumed */
+	if (length != 0)
+	{
+		stream->active = FALSE;
+		return ZIPERR_DECOMPRESS_ERROR;
+	}
+	return ZIPERR_NONE;
+}
+
+
+/*-------------------------------------------------
+    free_stream - release a zip_file's stream
+-------------------------------------------------*/
+
+static void free_stream(zip_file *zip)
+{
+	if (zip->stream != NULL)
+	{
+		inflateEnd(&zip->stream->z);
+		free(zip->stream);
+		zip->stream = NULL;
+	}
+}
@@ -120,6 +120,14 @@ struct _zip_ecd
 };
 
 
+/* random-access index for a deflated member (opaque) */
+typedef struct _zip_index zip_index;
+
+
+/* resumable decompression state for a deflated member (opaque) */
+typedef struct _zip_stream zip_stream;
+
+
 /* describes an open ZIP file */
 typedef struct _zip_file zip_file;
 struct _zip_file
@@ -133,6 +141,8 @@ struct _zip_file
 	UINT8 *			cd;						/* central directory raw data */
 	UINT32			cd_pos;					/* position in central directory */
 	zip_file_header	header;					/* current file header */
+	zip_index *		index;					/* list of random-access indexes for large members */
+	zip_stream *	stream;					/* where the last range read of a deflated member left off */
 
 	UINT8			buffer[ZIP_DECOMPRESS_BUFSIZE];	/* buffer for decompression */
 };
@@ -167,5 +177,8 @@ const zip_file_header *zip_file_next_file(zip_file *zip);
 /* decompress the most recently found file in the ZIP */
 zip_error zip_file_decompress(zip_file *zip, void *buffer, UINT32 length);
 
+/* decompress part of the most recently found file in the ZIP */
+zip_error zip_file_decompress_range(zip_file *zip, UINT32 offset, void *buffer, UINT32 length);
+
 
 #endif	/* __UNZIP_H__ */
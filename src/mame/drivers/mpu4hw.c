@@ -580,7 +580,6 @@ static const ptm6840_interface ptm_ic2_intf =
 /* IC3, lamp data lines + alpha numeric display */
 WRITE8_MEMBER(mpu4_state::pia_ic3_porta_w)
 {
-	int i;
 	LOG_IC3(("%s: IC3 PIA Port A Set to %2x (lamp strobes 1 - 9)\n", machine().describe_context(),data));
 
 	if(m_ic23_active)
@@ -591,10 +590,7 @@ WRITE8_MEMBER(mpu4_state::pia_ic3_porta_w)
 			// As a consequence, the lamp column data can change before the input strobe without
 			// causing the relevant lamps to black out.
 
-			for (i = 0; i < 8; i++)
-			{
-				output_set_lamp_value((8*m_input_strobe)+i, ((data  & (1 << i)) !=0));
-			}
+			output_set_lamp_bits(8*m_input_strobe, 8, data);
 			m_lamp_strobe = m_input_strobe;
 		}
 	}
@@ -609,10 +605,7 @@ WRITE8_MEMBER(mpu4_state::pia_ic3_portb_w)
 	{
 		if (m_lamp_strobe2 != m_input_strobe)
 		{
-			for (i = 0; i < 8; i++)
-			{
-				output_set_lamp_value((8*m_input_strobe)+i+64, ((data  & (1 << i)) !=0));
-			}
+			output_set_lamp_bits((8*m_input_strobe)+64, 8, data);
 			m_lamp_strobe2 = m_input_strobe;
 		}
 
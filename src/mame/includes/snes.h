@@ -669,8 +669,6 @@ struct SNES_PPU_STRUCT	/* once all the regs are saved in this structure, it woul
 	UINT8 ppu1_version, ppu2_version;
 	UINT8 window1_left, window1_right, window2_left, window2_right;
 
-	UINT16 mosaic_table[16][4096];
-	UINT8 clipmasks[6][SNES_SCR_WIDTH];
 	UINT8 update_windows;
 	UINT8 update_offsets;
 	UINT8 update_oam_list;
@@ -682,6 +680,10 @@ struct SNES_PPU_STRUCT	/* once all the regs are saved in this structure, it woul
 	UINT8 pseudo_hires;
 	UINT8 color_modes;
 	UINT8 stat77_flags;
+
+	/* derived from the window registers by the renderer; keep this last, since
+       the deferred line records only capture the registers that precede it */
+	UINT8 clipmasks[6][SNES_SCR_WIDTH];
 };
 
 extern struct snes_cart_info snes_cart;
@@ -71,6 +71,7 @@
 ***************************************************************************/
 
 #include "emu.h"
+#include "video/deferred.h"
 #include "includes/snes.h"
 
 #define SNES_MAINSCREEN    0
@@ -120,8 +121,22 @@ struct SCANLINE
 	UINT8  blend_exception[SNES_SCR_WIDTH];
 };
 
-static struct SCANLINE scanlines[2];
+struct OAM
+{
+	UINT16 tile;
+	INT16 x, y;
+	UINT8 size, vflip, hflip, priority_bits, pal;
+	int height, width;
+};
+
+struct TILELIST {
+	INT16 x;
+	UINT16 priority, pal, tileaddr;
+	int hflip;
+};
+
 struct SNES_PPU_STRUCT snes_ppu;
+static UINT16 snes_mosaic_table[16][4096];
 
 enum
 {
@@ -134,13 +149,71 @@ static UINT8  *snes_vram;		/* Video RAM (Should be 16-bit, but it's easier this
 static UINT16 *snes_cgram;		/* Colour RAM */
 static UINT16 *snes_oam;		/* Object Attribute Memory */
 
+/*****************************************
+ * snes_line_renderer
+ *
+ * Draws scanlines from the PPU state it is
+ * bound to. The snes_ppu and snes_cgram
+ * members deliberately shadow the globals:
+ * the immediate renderer is bound to the
+ * live PPU state, while each deferred
+ * rendering band gets its own copy of the
+ * captured line records.
+ *****************************************/
+
+class snes_line_renderer
+{
+public:
+	snes_line_renderer( struct SNES_PPU_STRUCT &ppu ) : snes_ppu(ppu), snes_cgram(NULL) { }
+
+	void snes_refresh_scanline( running_machine &machine, bitmap_rgb32 &bitmap, UINT16 curline, int blurring );
+	void snes_update_obsel( void );
+
+	struct SNES_PPU_STRUCT &snes_ppu;
+	UINT16 *snes_cgram;
+
+private:
+	UINT16 snes_get_bgcolor( UINT8 direct_colors, UINT16 palette, UINT8 color );
+	void snes_set_scanline_pixel( int screen, INT16 x, UINT16 color, UINT8 priority, UINT8 layer, int blend );
+	void snes_draw_bgtile_lores( UINT8 layer, INT16 ii, UINT8 colour, UINT16 pal, UINT8 direct_colors, UINT8 priority );
+	void snes_draw_bgtile_hires( UINT8 layer, INT16 ii, UINT8 colour, UINT16 pal, UINT8 direct_colors, UINT8 priority );
+	void snes_draw_oamtile( INT16 ii, UINT8 colour, UINT16 pal, UINT8 priority );
+	void snes_draw_tile( UINT8 planes, UINT8 layer, UINT32 tileaddr, INT16 x, UINT8 priority, UINT8 flip, UINT8 direct_colors, UINT16 pal, UINT8 hires );
+	UINT32 snes_get_tmap_addr( UINT8 layer, UINT8 tile_size, UINT32 base, UINT32 x, UINT32 y );
+	void snes_update_line( UINT16 curline, UINT8 layer, UINT8 priority_b, UINT8 priority_a, UINT8 color_depth, UINT8 hires, UINT8 offset_per_tile, UINT8 direct_colors );
+	void snes_update_line_mode7( UINT16 curline, UINT8 layer, UINT8 priority_b, UINT8 priority_a );
+	void snes_oam_list_build( void );
+	int is_sprite_on_scanline( UINT16 curline, UINT8 sprite );
+	void snes_update_objects_rto( UINT16 curline );
+	void snes_update_objects( UINT8 priority_oam0, UINT8 priority_oam1, UINT8 priority_oam2, UINT8 priority_oam3 );
+	void snes_update_mode_0( UINT16 curline );
+	void snes_update_mode_1( UINT16 curline );
+	void snes_update_mode_2( UINT16 curline );
+	void snes_update_mode_3( UINT16 curline );
+	void snes_update_mode_4( UINT16 curline );
+	void snes_update_mode_5( UINT16 curline );
+	void snes_update_mode_6( UINT16 curline );
+	void snes_update_mode_7( UINT16 curline );
+	void snes_draw_screens( UINT16 curline );
+	void snes_update_windowmasks( void );
+	void snes_update_offsets( void );
+	void snes_draw_blend( UINT16 offset, UINT16 *colour, UINT8 prevent_color_math, UINT8 black_pen_clip, int switch_screens );
+
+	struct SCANLINE scanlines[2];
+	struct OAM oam_spritelist[SNES_SCR_WIDTH / 2];
+	UINT8 oam_itemlist[32];
+	struct TILELIST oam_tilelist[34];
+};
+
+static snes_line_renderer snes_immediate(snes_ppu);
+
 /*****************************************
  * snes_get_bgcolor()
  *
  * Get the proper color (direct or from cgram)
  *****************************************/
 
-INLINE UINT16 snes_get_bgcolor( UINT8 direct_colors, UINT16 palette, UINT8 color )
+inline UINT16 snes_line_renderer::snes_get_bgcolor( UINT8 direct_colors, UINT16 palette, UINT8 color )
 {
 	UINT16 c = 0;
 
@@ -164,7 +237,7 @@ INLINE UINT16 snes_get_bgcolor( UINT8 direct_colors, UINT16 palette, UINT8 color
  * proper scanline
  *****************************************/
 
-INLINE void snes_set_scanline_pixel( int screen, INT16 x, UINT16 color, UINT8 priority, UINT8 layer, int blend )
+inline void snes_line_renderer::snes_set_scanline_pixel( int screen, INT16 x, UINT16 color, UINT8 priority, UINT8 layer, int blend )
 {
 	scanlines[screen].buffer[x] = color;
 	scanlines[screen].priority[x] = priority;
@@ -195,7 +268,7 @@ INLINE void snes_set_scanline_pixel( int screen, INT16 x, UINT16 color, UINT8 pr
  * or lores)
  *****************************************/
 
-INLINE void snes_draw_bgtile_lores( UINT8 layer, INT16 ii, UINT8 colour, UINT16 pal, UINT8 direct_colors, UINT8 priority )
+inline void snes_line_renderer::snes_draw_bgtile_lores( UINT8 layer, INT16 ii, UINT8 colour, UINT16 pal, UINT8 direct_colors, UINT8 priority )
 {
 	int screen;
 	UINT16 c;
@@ -229,7 +302,7 @@ INLINE void snes_draw_bgtile_lores( UINT8 layer, INT16 ii, UINT8 colour, UINT16
 	}
 }
 
-INLINE void snes_draw_bgtile_hires( UINT8 layer, INT16 ii, UINT8 colour, UINT16 pal, UINT8 direct_colors, UINT8 priority )
+inline void snes_line_renderer::snes_draw_bgtile_hires( UINT8 layer, INT16 ii, UINT8 colour, UINT16 pal, UINT8 direct_colors, UINT8 priority )
 {
 	int screen;
 	UINT16 c;
@@ -264,7 +337,7 @@ INLINE void snes_draw_bgtile_hires( UINT8 layer, INT16 ii, UINT8 colour, UINT16
 	}
 }
 
-INLINE void snes_draw_oamtile( INT16 ii, UINT8 colour, UINT16 pal, UINT8 priority )
+inline void snes_line_renderer::snes_draw_oamtile( INT16 ii, UINT8 colour, UINT16 pal, UINT8 priority )
 {
 	int screen;
 	int blend;
@@ -307,7 +380,7 @@ INLINE void snes_draw_oamtile( INT16 ii, UINT8 colour, UINT16 pal, UINT8 priorit
  * (depending on layer and resolution)
  *****************************************/
 
-INLINE void snes_draw_tile( UINT8 planes, UINT8 layer, UINT32 tileaddr, INT16 x, UINT8 priority, UINT8 flip, UINT8 direct_colors, UINT16 pal, UINT8 hires )
+inline void snes_line_renderer::snes_draw_tile( UINT8 planes, UINT8 layer, UINT32 tileaddr, INT16 x, UINT8 priority, UINT8 flip, UINT8 direct_colors, UINT16 pal, UINT8 hires )
 {
 	UINT8 plane[8];
 	INT16 ii, jj;
@@ -390,7 +463,7 @@ INLINE void snes_draw_tile( UINT8 planes, UINT8 layer, UINT32 tileaddr, INT16 x,
  * Find the address in VRAM of the tile (x,y)
  *********************************************/
 
-INLINE UINT32 snes_get_tmap_addr( UINT8 layer, UINT8 tile_size, UINT32 base, UINT32 x, UINT32 y )
+inline UINT32 snes_line_renderer::snes_get_tmap_addr( UINT8 layer, UINT8 tile_size, UINT32 base, UINT32 x, UINT32 y )
 {
 	UINT32 res = base;
 	x  >>= (3 + tile_size);
@@ -413,7 +486,7 @@ INLINE UINT32 snes_get_tmap_addr( UINT8 layer, UINT8 tile_size, UINT32 base, UIN
  * Update an entire line of tiles.
  *********************************************/
 
-INLINE void snes_update_line( UINT16 curline, UINT8 layer, UINT8 priority_b, UINT8 priority_a, UINT8 color_depth, UINT8 hires, UINT8 offset_per_tile, UINT8 direct_colors )
+inline void snes_line_renderer::snes_update_line( UINT16 curline, UINT8 layer, UINT8 priority_b, UINT8 priority_a, UINT8 color_depth, UINT8 hires, UINT8 offset_per_tile, UINT8 direct_colors )
 {
 	UINT32 tmap, tile, xoff, yoff, charaddr, addr;
 	UINT16 ii = 0, vflip, hflip, pal, pal_direct, tilemap;
@@ -598,7 +671,7 @@ INLINE void snes_update_line( UINT16 curline, UINT8 layer, UINT8 priority_b, UIN
 
 #define MODE7_CLIP(x) (((x) & 0x2000) ? ((x) | ~0x03ff) : ((x) & 0x03ff))
 
-static void snes_update_line_mode7( UINT16 curline, UINT8 layer, UINT8 priority_b, UINT8 priority_a )
+void snes_line_renderer::snes_update_line_mode7( UINT16 curline, UINT8 layer, UINT8 priority_b, UINT8 priority_a )
 {
 	UINT32 tiled;
 	INT16 ma, mb, mc, md;
@@ -662,20 +735,20 @@ static void snes_update_line_mode7( UINT16 curline, UINT8 layer, UINT8 priority_
 	/* MOSAIC - to be verified */
 	if (layer == SNES_BG2)	// BG2 use two different bits for horizontal and vertical mosaic
 	{
-		mosaic_x = snes_ppu.mosaic_table[snes_ppu.layer[SNES_BG2].mosaic_enabled ? snes_ppu.mosaic_size : 0];
-		mosaic_y = snes_ppu.mosaic_table[snes_ppu.layer[SNES_BG1].mosaic_enabled ? snes_ppu.mosaic_size : 0];
+		mosaic_x = snes_mosaic_table[snes_ppu.layer[SNES_BG2].mosaic_enabled ? snes_ppu.mosaic_size : 0];
+		mosaic_y = snes_mosaic_table[snes_ppu.layer[SNES_BG1].mosaic_enabled ? snes_ppu.mosaic_size : 0];
 	}
 	else	// BG1 works as usual
 	{
-		mosaic_x =  snes_ppu.mosaic_table[snes_ppu.layer[SNES_BG1].mosaic_enabled ? snes_ppu.mosaic_size : 0];
-		mosaic_y =  snes_ppu.mosaic_table[snes_ppu.layer[SNES_BG1].mosaic_enabled ? snes_ppu.mosaic_size : 0];
+		mosaic_x =  snes_mosaic_table[snes_ppu.layer[SNES_BG1].mosaic_enabled ? snes_ppu.mosaic_size : 0];
+		mosaic_y =  snes_mosaic_table[snes_ppu.layer[SNES_BG1].mosaic_enabled ? snes_ppu.mosaic_size : 0];
 	}
 
 #if SNES_LAYER_DEBUG
 	if (debug_options.mosaic_disabled)
 	{
-		mosaic_x =  snes_ppu.mosaic_table[0];
-		mosaic_y =  snes_ppu.mosaic_table[0];
+		mosaic_x =  snes_mosaic_table[0];
+		mosaic_y =  snes_mosaic_table[0];
 	}
 #endif /* SNES_LAYER_DEBUG */
 
@@ -797,33 +870,13 @@ static void snes_update_line_mode7( UINT16 curline, UINT8 layer, UINT8 priority_
  * test their priority with the one of the correct sprite - see snes_update_objects.
  *************************************************************************************************/
 
-struct OAM
-{
-	UINT16 tile;
-	INT16 x, y;
-	UINT8 size, vflip, hflip, priority_bits, pal;
-	int height, width;
-};
-
-static struct OAM oam_spritelist[SNES_SCR_WIDTH / 2];
-
-static UINT8 oam_itemlist[32];
-
-struct TILELIST {
-	INT16 x;
-	UINT16 priority, pal, tileaddr;
-	int hflip;
-};
-
-static struct TILELIST oam_tilelist[34];
-
 /*********************************************
  * snes_update_obsel()
  *
  * Update sprite settings for next line.
  *********************************************/
 
-static void snes_update_obsel( void )
+void snes_line_renderer::snes_update_obsel( void )
 {
 	snes_ppu.layer[SNES_OAM].charmap = snes_ppu.oam.next_charmap;
 	snes_ppu.oam.name_select = snes_ppu.oam.next_name_select;
@@ -841,7 +894,7 @@ static void snes_update_obsel( void )
  * Build a list of the available obj in OAM ram.
  *********************************************/
 
-static void snes_oam_list_build( void )
+void snes_line_renderer::snes_oam_list_build( void )
 {
 	UINT8 *oamram = (UINT8 *)snes_oam;
 	INT16 oam = 0x1ff;
@@ -928,7 +981,7 @@ static void snes_oam_list_build( void )
  * scanline
  *********************************************/
 
-static int is_sprite_on_scanline( UINT16 curline, UINT8 sprite )
+int snes_line_renderer::is_sprite_on_scanline( UINT16 curline, UINT8 sprite )
 {
 	//if sprite is entirely offscreen and doesn't wrap around to the left side of the screen,
 	//then it is not counted. this *should* be 256, and not 255, even though dot 256 is offscreen.
@@ -953,7 +1006,7 @@ static int is_sprite_on_scanline( UINT16 curline, UINT8 sprite )
  * scanline.
  *********************************************/
 
-static void snes_update_objects_rto( UINT16 curline )
+void snes_line_renderer::snes_update_objects_rto( UINT16 curline )
 {
 	int ii, jj, active_sprite;
 	UINT8 range_over, time_over;
@@ -1067,7 +1120,7 @@ static void snes_update_objects_rto( UINT16 curline )
  * Update an entire line of sprites.
  *********************************************/
 
-static void snes_update_objects( UINT8 priority_oam0, UINT8 priority_oam1, UINT8 priority_oam2, UINT8 priority_oam3 )
+void snes_line_renderer::snes_update_objects( UINT8 priority_oam0, UINT8 priority_oam1, UINT8 priority_oam2, UINT8 priority_oam3 )
 {
 	UINT8 pri, priority[4];
 	UINT32 charaddr;
@@ -1128,7 +1181,7 @@ static void snes_update_objects( UINT8 priority_oam0, UINT8 priority_oam1, UINT8
  * Update Mode X line.
  *********************************************/
 
-static void snes_update_mode_0( UINT16 curline )
+void snes_line_renderer::snes_update_mode_0( UINT16 curline )
 {
 #if SNES_LAYER_DEBUG
 	if (debug_options.mode_disabled[0])
@@ -1142,7 +1195,7 @@ static void snes_update_mode_0( UINT16 curline )
 	snes_update_line(curline, SNES_BG4, 1, 4,  SNES_COLOR_DEPTH_2BPP, 0, SNES_OPT_NONE, 0);
 }
 
-static void snes_update_mode_1( UINT16 curline )
+void snes_line_renderer::snes_update_mode_1( UINT16 curline )
 {
 #if SNES_LAYER_DEBUG
 	if (debug_options.mode_disabled[1])
@@ -1165,7 +1218,7 @@ static void snes_update_mode_1( UINT16 curline )
 	}
 }
 
-static void snes_update_mode_2( UINT16 curline )
+void snes_line_renderer::snes_update_mode_2( UINT16 curline )
 {
 #if SNES_LAYER_DEBUG
 	if (debug_options.mode_disabled[2])
@@ -1177,7 +1230,7 @@ static void snes_update_mode_2( UINT16 curline )
 	snes_update_line(curline, SNES_BG2, 1, 5, SNES_COLOR_DEPTH_4BPP, 0, SNES_OPT_MODE2, 0);
 }
 
-static void snes_update_mode_3( UINT16 curline )
+void snes_line_renderer::snes_update_mode_3( UINT16 curline )
 {
 #if SNES_LAYER_DEBUG
 	if (debug_options.mode_disabled[3])
@@ -1189,7 +1242,7 @@ static void snes_update_mode_3( UINT16 curline )
 	snes_update_line(curline, SNES_BG2, 1, 5, SNES_COLOR_DEPTH_4BPP, 0, SNES_OPT_NONE, 0);
 }
 
-static void snes_update_mode_4( UINT16 curline )
+void snes_line_renderer::snes_update_mode_4( UINT16 curline )
 {
 #if SNES_LAYER_DEBUG
 	if (debug_options.mode_disabled[4])
@@ -1201,7 +1254,7 @@ static void snes_update_mode_4( UINT16 curline )
 	snes_update_line(curline, SNES_BG2, 1, 5, SNES_COLOR_DEPTH_2BPP, 0, SNES_OPT_MODE4, 0);
 }
 
-static void snes_update_mode_5( UINT16 curline )
+void snes_line_renderer::snes_update_mode_5( UINT16 curline )
 {
 #if SNES_LAYER_DEBUG
 	if (debug_options.mode_disabled[5])
@@ -1213,7 +1266,7 @@ static void snes_update_mode_5( UINT16 curline )
 	snes_update_line(curline, SNES_BG2, 1, 5, SNES_COLOR_DEPTH_2BPP, 1, SNES_OPT_NONE, 0);
 }
 
-static void snes_update_mode_6( UINT16 curline )
+void snes_line_renderer::snes_update_mode_6( UINT16 curline )
 {
 #if SNES_LAYER_DEBUG
 	if (debug_options.mode_disabled[6])
@@ -1224,7 +1277,7 @@ static void snes_update_mode_6( UINT16 curline )
 	snes_update_line(curline, SNES_BG1, 2, 5, SNES_COLOR_DEPTH_4BPP, 1, SNES_OPT_MODE6, 0);
 }
 
-static void snes_update_mode_7( UINT16 curline )
+void snes_line_renderer::snes_update_mode_7( UINT16 curline )
 {
 #if SNES_LAYER_DEBUG
 	if (debug_options.mode_disabled[7])
@@ -1250,7 +1303,7 @@ static void snes_update_mode_7( UINT16 curline )
  * Draw the whole screen (Mode 0 -> 7).
  *********************************************/
 
-static void snes_draw_screens( UINT16 curline )
+void snes_line_renderer::snes_draw_screens( UINT16 curline )
 {
 	switch (snes_ppu.mode)
 	{
@@ -1278,7 +1331,7 @@ static void snes_draw_screens( UINT16 curline )
  * XNOR: ###...##...###     ...###..###...
  *********************************************/
 
-static void snes_update_windowmasks( void )
+void snes_line_renderer::snes_update_windowmasks( void )
 {
 	UINT16 ii, jj;
 	INT8 w1, w2;
@@ -1352,7 +1405,7 @@ static void snes_update_windowmasks( void )
  * possibly be handy for some minor optimization
  *********************************************/
 
-static void snes_update_offsets( void )
+void snes_line_renderer::snes_update_offsets( void )
 {
 	int ii;
 	for (ii = 0; ii < 4; ii++)
@@ -1369,7 +1422,7 @@ static void snes_update_offsets( void )
  * color math.
  *****************************************/
 
-INLINE void snes_draw_blend( UINT16 offset, UINT16 *colour, UINT8 prevent_color_math, UINT8 black_pen_clip, int switch_screens )
+inline void snes_line_renderer::snes_draw_blend( UINT16 offset, UINT16 *colour, UINT8 prevent_color_math, UINT8 black_pen_clip, int switch_screens )
 {
 #if SNES_LAYER_DEBUG
 	if (debug_options.colormath_disabled)
@@ -1497,7 +1550,7 @@ INLINE void snes_draw_blend( UINT16 offset, UINT16 *colour, UINT8 prevent_color_
  * the optimized averaging algorithm.
  *********************************************/
 
-static void snes_refresh_scanline( running_machine &machine, bitmap_rgb32 &bitmap, UINT16 curline )
+void snes_line_renderer::snes_refresh_scanline( running_machine &machine, bitmap_rgb32 &bitmap, UINT16 curline, int blurring )
 {
 	UINT16 ii;
 	int x;
@@ -1505,9 +1558,6 @@ static void snes_refresh_scanline( running_machine &machine, bitmap_rgb32 &bitma
 	struct SCANLINE *scanline1, *scanline2;
 	UINT16 c;
 	UINT16 prev_colour = 0;
-	int blurring = machine.root_device().ioport("OPTIONS")->read_safe(0) & 0x01;
-
-	g_profiler.start(PROFILER_VIDEO);
 
 	if (snes_ppu.screen_disabled) /* screen is forced blank */
 		for (x = 0; x < SNES_SCR_WIDTH * 2; x++)
@@ -1554,10 +1604,7 @@ static void snes_refresh_scanline( running_machine &machine, bitmap_rgb32 &bitma
 
 #if SNES_LAYER_DEBUG
 		if (snes_dbg_video(machine, curline))
-		{
-			g_profiler.stop();
 			return;
-		}
 
 		/* Toggle drawing of SNES_SUBSCREEN or SNES_MAINSCREEN */
 		if (debug_options.draw_subscreen)
@@ -1652,8 +1699,142 @@ static void snes_refresh_scanline( running_machine &machine, bitmap_rgb32 &bitma
 			}
 		}
 	}
+}
+
+/*********************************************
+ * Deferred scanline rendering
+ *
+ * With -deferred_scanlines, reaching a line
+ * only captures the PPU registers into a line
+ * record; the collected lines are drawn in
+ * parallel bands once the last visible line
+ * has been captured.
+ * CGRAM (and fixed colour) changes mid-frame
+ * are handled by snapshotting CGRAM for the
+ * lines captured so far. VRAM and OAM changes
+ * and reads of the sprite overflow flags
+ * cannot be captured: they draw the pending
+ * lines right away and fall back to immediate
+ * rendering for the rest of the frame.
+ *********************************************/
+
+#define SNES_DEFERRED_BANDS    8
+#define SNES_DEFERRED_LINES    (SNES_VTOTAL_PAL * 2)
+#define SNES_PPU_RECORD_SIZE   offsetof(struct SNES_PPU_STRUCT, clipmasks)
+
+struct SNES_LINE_RECORD
+{
+	UINT16 curline;
+	UINT8  ppu[SNES_PPU_RECORD_SIZE];
+};
+
+struct SNES_RENDER_BAND
+{
+	SNES_RENDER_BAND() : ppu(), renderer(ppu) { }
+
+	struct SNES_PPU_STRUCT ppu;
+	snes_line_renderer renderer;
+	UINT8 stat77_flags;
+};
+
+static deferred_manager *snes_deferred;
+static bitmap_rgb32 *snes_deferred_bitmap;
+static int snes_deferred_blurring;
+
+static void snes_render_band( deferred_manager *deferred, void *param, void *bandptr, int first, int count )
+{
+	running_machine &machine = *(running_machine *)param;
+	struct SNES_RENDER_BAND *band = (struct SNES_RENDER_BAND *)bandptr;
+	int update_windows = 1;
+	int i;
+
+	band->stat77_flags = 0;
+	for (i = first; i < first + count; i++)
+	{
+		const struct SNES_LINE_RECORD *line = (const struct SNES_LINE_RECORD *)deferred_get_line(deferred, i);
+		UINT16 *cgram = (UINT16 *)deferred_get_line_snapshot(deferred, i);
+
+		memcpy(&band->ppu, line->ppu, SNES_PPU_RECORD_SIZE);
+		band->ppu.stat77_flags = 0;
+
+		/* the window masks are not part of the record: rebuild them until a drawn line did so */
+		band->ppu.update_windows |= update_windows;
+		band->renderer.snes_cgram = (cgram != NULL) ? cgram : snes_cgram;
+
+		band->renderer.snes_refresh_scanline(machine, *snes_deferred_bitmap, line->curline, snes_deferred_blurring);
+		update_windows = band->ppu.update_windows;
+		band->stat77_flags |= band->ppu.stat77_flags;
+	}
+}
+
+static void snes_render_done( deferred_manager *deferred, void *param, void *bandptr, int numbands )
+{
+	struct SNES_RENDER_BAND *bands = (struct SNES_RENDER_BAND *)bandptr;
+	int bandnum;
+
+	for (bandnum = 0; bandnum < numbands; bandnum++)
+		snes_ppu.stat77_flags |= bands[bandnum].stat77_flags;
+
+	/* the live window masks were not kept up to date while deferring */
+	snes_ppu.update_windows = 1;
+}
+
+/*********************************************
+ * snes_deferred_capture()
+ *
+ * Record the PPU state for a line; returns
+ * FALSE if the line must be drawn right away
+ *********************************************/
+
+static int snes_deferred_capture( bitmap_rgb32 &bitmap, UINT16 curline, int blurring )
+{
+	struct SNES_LINE_RECORD *line;
+
+	/* a new bitmap starts deferring again */
+	line = (struct SNES_LINE_RECORD *)deferred_capture(snes_deferred, curline, &bitmap != snes_deferred_bitmap);
+	snes_deferred_bitmap = &bitmap;
+	snes_deferred_blurring = blurring;
+
+	if (line == NULL)
+		return FALSE;
+
+	line->curline = curline;
+	memcpy(line->ppu, &snes_ppu, SNES_PPU_RECORD_SIZE);
+
+	/* advance the live state the way drawing the line would have */
+	if (!snes_ppu.screen_disabled)
+	{
+		snes_ppu.update_windows = 0;
+		snes_immediate.snes_update_obsel();
+	}
+	return TRUE;
+}
+
+/*********************************************
+ * snes_deferred_cgram_write()
+ *
+ * Called before CGRAM is modified
+ *********************************************/
 
-	g_profiler.stop();
+INLINE void snes_deferred_cgram_write( void )
+{
+	UINT16 *cgram = (UINT16 *)deferred_snapshot(snes_deferred);
+
+	if (cgram != NULL)
+		memcpy(cgram, snes_cgram, SNES_CGRAM_SIZE);
+}
+
+static void snes_deferred_init( running_machine &machine )
+{
+	snes_deferred = NULL;
+	snes_deferred_bitmap = NULL;
+	snes_deferred_blurring = 0;
+
+#if !SNES_LAYER_DEBUG
+	snes_deferred = deferred_alloc(machine, SNES_DEFERRED_LINES, sizeof(struct SNES_LINE_RECORD), SNES_CGRAM_SIZE,
+			auto_alloc_array(machine, struct SNES_RENDER_BAND, SNES_DEFERRED_BANDS), sizeof(struct SNES_RENDER_BAND), SNES_DEFERRED_BANDS,
+			snes_render_band, snes_render_done, &machine);
+#endif
 }
 
 VIDEO_START( snes )
@@ -1667,6 +1848,9 @@ VIDEO_START( snes )
 	snes_vram = auto_alloc_array(machine, UINT8, SNES_VRAM_SIZE);
 	snes_cgram = auto_alloc_array(machine, UINT16, SNES_CGRAM_SIZE/2);
 	snes_oam = auto_alloc_array(machine, UINT16, SNES_OAM_SIZE/2);
+	snes_immediate.snes_cgram = snes_cgram;
+
+	snes_deferred_init(machine);
 
 	/* Inititialize registers/variables */
 	snes_ppu.update_windows = 1;
@@ -1683,7 +1867,7 @@ VIDEO_START( snes )
 	for (j = 0; j < 16; j++)
 	{
 		for (i = 0; i < 4096; i++)
-			snes_ppu.mosaic_table[j][i] = (i / (j + 1)) * (j + 1);
+			snes_mosaic_table[j][i] = (i / (j + 1)) * (j + 1);
 	}
 
 	/* Init VRAM */
@@ -1790,13 +1974,24 @@ VIDEO_START( snes )
 
 SCREEN_UPDATE_RGB32( snes )
 {
+	running_machine &machine = screen.machine();
+	int blurring = machine.root_device().ioport("OPTIONS")->read_safe(0) & 0x01;
 	int y;
 
 	/*NTSC SNES draw range is 1-225. */
 	for (y = cliprect.min_y; y <= cliprect.max_y; y++)
 	{
-		snes_refresh_scanline(screen.machine(), bitmap, y + 1);
+		if (snes_deferred_capture(bitmap, y + 1, blurring))
+			continue;
+
+		g_profiler.start(PROFILER_VIDEO);
+		snes_immediate.snes_refresh_scanline(machine, bitmap, y + 1, blurring);
+		g_profiler.stop();
 	}
+
+	/* draw the captured lines before the frame is shown */
+	if (cliprect.max_y >= screen.visible_area().max_y)
+		deferred_render(snes_deferred);
 	return 0;
 }
 
@@ -1919,9 +2114,13 @@ static WRITE8_HANDLER( snes_vram_write )
 	offset &= 0x1ffff;
 
 	if (snes_ppu.screen_disabled)
+	{
+		deferred_sync(snes_deferred);
 		snes_vram[offset] = data;
+	}
 	else
 	{
+		/* writes only land outside active display, where no lines are pending */
 		UINT16 v = space->machine().primary_screen->vpos();
 		UINT16 h = space->machine().primary_screen->hpos();
 		if (v == 0)
@@ -2009,6 +2208,7 @@ static WRITE8_HANDLER( snes_oam_write )
 			offset = 0x010c;
 	}
 
+	deferred_sync(snes_deferred);
 	if (!(snes_ram[OAMDATA]))
 		snes_oam[offset] = (snes_oam[offset] & 0xff00) | (data << 0);
 	else
@@ -2085,6 +2285,7 @@ static WRITE8_HANDLER( snes_cgram_write )
 	if (offset & 0x01)
 		data &= 0x7f;
 
+	snes_deferred_cgram_write();
 	((UINT8 *)snes_cgram)[offset] = data;
 }
 
@@ -2215,6 +2416,7 @@ READ8_HANDLER( snes_ppu_read )
 			state->m_read_opvct ^= 1;
 			return snes_ppu.ppu2_open_bus;
 		case STAT77:	/* PPU status flag and version number */
+			deferred_sync(snes_deferred);
 			value = snes_ppu.stat77_flags & 0xc0; // 0x80 & 0x40 are Time Over / Range Over Sprite flags, set by the video code
 			// 0x20 - Master/slave mode select. Little is known about this bit. We always seem to read back 0 here.
 			value |= (snes_ppu.ppu1_open_bus & 0x10);
@@ -2622,6 +2824,7 @@ WRITE8_HANDLER( snes_ppu_write )
 					g = data & 0x1f;
 				if (data & 0x80)
 					b = data & 0x1f;
+				snes_deferred_cgram_write();
 				snes_cgram[FIXED_COLOUR] = (r | (g << 5) | (b << 10));
 			} break;
 		case SETINI:	/* Screen mode/video select */
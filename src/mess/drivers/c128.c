@@ -742,12 +742,14 @@ static MACHINE_CONFIG_START( common, c128_state )
 	MCFG_CPU_ADD("maincpu", Z80, VIC6567_CLOCK)
 	MCFG_CPU_PROGRAM_MAP( c128_z80_mem)
 	MCFG_CPU_IO_MAP( c128_z80_io)
+	MCFG_DEVICE_CATCHUP()
 	MCFG_CPU_VBLANK_INT("screen", c128_frame_interrupt)
 	//MCFG_CPU_PERIODIC_INT(vic2_raster_irq, VIC6567_HRETRACERATE)
 
 	MCFG_CPU_ADD("m8502", M8502, VIC6567_CLOCK)
 	MCFG_CPU_PROGRAM_MAP( c128_mem)
 	MCFG_CPU_CONFIG( c128_m8502_interface )
+	MCFG_DEVICE_CATCHUP()
 	MCFG_CPU_VBLANK_INT("screen", c128_frame_interrupt)
 	// MCFG_CPU_PERIODIC_INT(vic2_raster_irq, VIC6567_HRETRACERATE)
 
@@ -1096,7 +1096,7 @@ static MACHINE_CONFIG_START( ntsc, c64_state )
 	MCFG_CPU_PROGRAM_MAP(c64_mem)
 	MCFG_CPU_CONFIG(cpu_intf)
 	MCFG_CPU_VBLANK_INT(SCREEN_TAG, c64_frame_interrupt)
-	MCFG_QUANTUM_PERFECT_CPU(M6510_TAG)
+	MCFG_DEVICE_CATCHUP()
 
 	// video hardware
 	MCFG_MOS6567_ADD(MOS6567_TAG, SCREEN_TAG, VIC6567_CLOCK, vic_intf, vic_videoram_map, vic_colorram_map)
@@ -1155,7 +1155,7 @@ static MACHINE_CONFIG_START( ntsc_sx, sx64_state )
 	MCFG_CPU_PROGRAM_MAP(c64_mem)
 	MCFG_CPU_CONFIG(sx64_cpu_intf)
 	MCFG_CPU_VBLANK_INT(SCREEN_TAG, c64_frame_interrupt)
-	MCFG_QUANTUM_PERFECT_CPU(M6510_TAG)
+	MCFG_DEVICE_CATCHUP()
 
 	// video hardware
 	MCFG_MOS6567_ADD(MOS6567_TAG, SCREEN_TAG, VIC6567_CLOCK, vic_intf, vic_videoram_map, vic_colorram_map)
@@ -1208,7 +1208,7 @@ static MACHINE_CONFIG_START( ntsc_dx, sx64_state )
 	MCFG_CPU_PROGRAM_MAP(c64_mem)
 	MCFG_CPU_CONFIG(sx64_cpu_intf)
 	MCFG_CPU_VBLANK_INT(SCREEN_TAG, c64_frame_interrupt)
-	MCFG_QUANTUM_PERFECT_CPU(M6510_TAG)
+	MCFG_DEVICE_CATCHUP()
 
 	// video hardware
 	MCFG_MOS6567_ADD(MOS6567_TAG, SCREEN_TAG, VIC6567_CLOCK, vic_intf, vic_videoram_map, vic_colorram_map)
@@ -1261,7 +1261,7 @@ static MACHINE_CONFIG_START( ntsc_c, c64c_state )
 	MCFG_CPU_PROGRAM_MAP(c64_mem)
 	MCFG_CPU_CONFIG(cpu_intf)
 	MCFG_CPU_VBLANK_INT(SCREEN_TAG, c64_frame_interrupt)
-	MCFG_QUANTUM_PERFECT_CPU(M6510_TAG)
+	MCFG_DEVICE_CATCHUP()
 
 	// video hardware
 	MCFG_MOS8562_ADD(MOS6567_TAG, SCREEN_TAG, VIC6567_CLOCK, vic_intf, vic_videoram_map, vic_colorram_map)
@@ -1311,7 +1311,7 @@ static MACHINE_CONFIG_START( pal, c64_state )
 	MCFG_CPU_PROGRAM_MAP(c64_mem)
 	MCFG_CPU_CONFIG(cpu_intf)
 	MCFG_CPU_VBLANK_INT(SCREEN_TAG, c64_frame_interrupt)
-	MCFG_QUANTUM_PERFECT_CPU(M6510_TAG)
+	MCFG_DEVICE_CATCHUP()
 
 	// video hardware
 	MCFG_MOS6569_ADD(MOS6569_TAG, SCREEN_TAG, VIC6569_CLOCK, vic_intf, vic_videoram_map, vic_colorram_map)
@@ -1361,7 +1361,7 @@ static MACHINE_CONFIG_START( pal_sx, sx64_state )
 	MCFG_CPU_PROGRAM_MAP(c64_mem)
 	MCFG_CPU_CONFIG(sx64_cpu_intf)
 	MCFG_CPU_VBLANK_INT(SCREEN_TAG, c64_frame_interrupt)
-	MCFG_QUANTUM_PERFECT_CPU(M6510_TAG)
+	MCFG_DEVICE_CATCHUP()
 
 	// video hardware
 	MCFG_MOS6569_ADD(MOS6569_TAG, SCREEN_TAG, VIC6569_CLOCK, vic_intf, vic_videoram_map, vic_colorram_map)
@@ -1414,7 +1414,7 @@ static MACHINE_CONFIG_START( pal_c, c64c_state )
 	MCFG_CPU_PROGRAM_MAP(c64_mem)
 	MCFG_CPU_CONFIG(cpu_intf)
 	MCFG_CPU_VBLANK_INT(SCREEN_TAG, c64_frame_interrupt)
-	MCFG_QUANTUM_PERFECT_CPU(M6510_TAG)
+	MCFG_DEVICE_CATCHUP()
 
 	// video hardware
 	MCFG_MOS8565_ADD(MOS6569_TAG, SCREEN_TAG, VIC6569_CLOCK, vic_intf, vic_videoram_map, vic_colorram_map)
@@ -1464,7 +1464,7 @@ static MACHINE_CONFIG_START( pal_gs, c64gs_state )
 	MCFG_CPU_PROGRAM_MAP(c64_mem)
 	MCFG_CPU_CONFIG(c64gs_cpu_intf)
 	MCFG_CPU_VBLANK_INT(SCREEN_TAG, c64_frame_interrupt)
-	MCFG_QUANTUM_PERFECT_CPU(M6510_TAG)
+	MCFG_DEVICE_CATCHUP()
 
 	// video hardware
 	MCFG_MOS8565_ADD(MOS6569_TAG, SCREEN_TAG, VIC6569_CLOCK, vic_intf, vic_videoram_map, vic_colorram_map)
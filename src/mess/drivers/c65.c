@@ -285,6 +285,7 @@ static MACHINE_CONFIG_START( c65, c65_state )
 	/* basic machine hardware */
 	MCFG_CPU_ADD("maincpu", M4510, 3500000)  /* or VIC6567_CLOCK, */
 	MCFG_CPU_PROGRAM_MAP(c65_mem)
+	MCFG_DEVICE_CATCHUP()
 	MCFG_CPU_VBLANK_INT("screen", c65_frame_interrupt)
 	MCFG_CPU_PERIODIC_INT(vic3_raster_irq, VIC6567_HRETRACERATE)
 
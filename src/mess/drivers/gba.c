@@ -1931,16 +1931,19 @@ INLINE UINT32 COMBINE_DATA32_16(UINT32 prev, UINT32 data, UINT32 mem_mask)
 
 WRITE32_MEMBER(gba_state::gba_pram_w)
 {
+	gba_video_snapshot(machine());
 	m_gba_pram[offset] = COMBINE_DATA32_16(m_gba_pram[offset], data, mem_mask);
 }
 
 WRITE32_MEMBER(gba_state::gba_vram_w)
 {
+	gba_video_sync(machine());
 	m_gba_vram[offset] = COMBINE_DATA32_16(m_gba_vram[offset], data, mem_mask);
 }
 
 WRITE32_MEMBER(gba_state::gba_oam_w)
 {
+	gba_video_snapshot(machine());
 	m_gba_oam[offset] = COMBINE_DATA32_16(m_gba_oam[offset], data, mem_mask);
 }
 
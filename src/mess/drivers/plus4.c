@@ -900,6 +900,7 @@ static MACHINE_CONFIG_START( ntsc, plus4_state )
 	MCFG_CPU_ADD(MOS7501_TAG, M7501, XTAL_14_31818MHz/16)
 	MCFG_CPU_PROGRAM_MAP(plus4_mem)
 	MCFG_CPU_CONFIG(cpu_intf)
+	MCFG_DEVICE_CATCHUP()
 	MCFG_CPU_VBLANK_INT(SCREEN_TAG, c16_frame_interrupt)
 	MCFG_CPU_PERIODIC_INT(c16_raster_interrupt, TED7360_HRETRACERATE)
 	MCFG_QUANTUM_TIME(attotime::from_hz(60))
@@ -939,6 +940,7 @@ static MACHINE_CONFIG_START( pal, plus4_state )
 	MCFG_CPU_ADD(MOS7501_TAG, M7501, XTAL_17_73447MHz/20)
 	MCFG_CPU_PROGRAM_MAP(plus4_mem)
 	MCFG_CPU_CONFIG(cpu_intf)
+	MCFG_DEVICE_CATCHUP()
 	MCFG_CPU_VBLANK_INT(SCREEN_TAG, c16_frame_interrupt)
 	MCFG_CPU_PERIODIC_INT(c16_raster_interrupt, TED7360_HRETRACERATE)
 	MCFG_QUANTUM_TIME(attotime::from_hz(60))
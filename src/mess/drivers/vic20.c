@@ -842,6 +842,7 @@ static MACHINE_CONFIG_DERIVED( vic20_ntsc, vic20_common )
 	// basic machine hardware
 	MCFG_CPU_ADD(M6502_TAG, M6502, MOS6560_CLOCK)
 	MCFG_CPU_PROGRAM_MAP(vic20_mem)
+	MCFG_DEVICE_CATCHUP()
 	MCFG_CPU_PERIODIC_INT(vic20_raster_interrupt, MOS656X_HRETRACERATE)
 
 	// video hardware
@@ -876,6 +877,7 @@ static MACHINE_CONFIG_DERIVED( vic20_pal, vic20_common )
 	// basic machine hardware
 	MCFG_CPU_ADD(M6502_TAG, M6502, MOS6561_CLOCK)
 	MCFG_CPU_PROGRAM_MAP(vic20_mem)
+	MCFG_DEVICE_CATCHUP()
 	MCFG_CPU_PERIODIC_INT(vic20_raster_interrupt, MOS656X_HRETRACERATE)
 
 	// video hardware
@@ -132,8 +132,35 @@ enum
 	EEP_READFIRST
 };
 
+/* video registers and memory as seen by the scanline renderer; kept apart from
+   the rest of the driver state so that a line can be captured and drawn later */
+struct gba_video_regs
+{
+	UINT32 m_BG2X, m_BG2Y, m_BG3X, m_BG3Y;
+	UINT16 m_DISPCNT;
+	UINT16 m_BG0CNT, m_BG1CNT, m_BG2CNT, m_BG3CNT;
+	UINT16 m_BG0HOFS, m_BG0VOFS, m_BG1HOFS, m_BG1VOFS, m_BG2HOFS, m_BG2VOFS, m_BG3HOFS, m_BG3VOFS;
+	UINT16 m_BG2PA, m_BG2PB, m_BG2PC, m_BG2PD, m_BG3PA, m_BG3PB, m_BG3PC, m_BG3PD;
+	UINT16 m_WIN0H, m_WIN1H, m_WIN0V, m_WIN1V, m_WININ, m_WINOUT;
+	UINT16 m_MOSAIC;
+	UINT16 m_BLDCNT;
+	UINT16 m_BLDALPHA;
+	UINT16 m_BLDY;
+
+	UINT8  m_windowOn;
+	UINT8  m_fxOn;
+	INT32  m_gfxBG2X;		// affine reference points, latched for the current line
+	INT32  m_gfxBG2Y;
+	INT32  m_gfxBG3X;
+	INT32  m_gfxBG3Y;
+
+	UINT32 *m_video_pram;	// palette, VRAM and OAM the renderer reads from
+	UINT32 *m_video_vram;
+	UINT32 *m_video_oam;
+};
+
 /* driver state */
-class gba_state : public driver_device
+class gba_state : public driver_device, public gba_video_regs
 {
 public:
 	gba_state(const machine_config &mconfig, device_type type, const char *tag)
@@ -153,16 +180,7 @@ public:
 	bitmap_ind16 m_bitmap;
 
 	UINT32 m_DISPSTAT;
-	UINT32 m_BG2X, m_BG2Y, m_BG3X, m_BG3Y;
-	UINT16 m_DISPCNT,	m_GRNSWAP;
-	UINT16 m_BG0CNT, m_BG1CNT, m_BG2CNT, m_BG3CNT;
-	UINT16 m_BG0HOFS, m_BG0VOFS, m_BG1HOFS, m_BG1VOFS, m_BG2HOFS, m_BG2VOFS, m_BG3HOFS, m_BG3VOFS;
-	UINT16 m_BG2PA, m_BG2PB, m_BG2PC, m_BG2PD, m_BG3PA, m_BG3PB, m_BG3PC, m_BG3PD;
-	UINT16 m_WIN0H, m_WIN1H, m_WIN0V, m_WIN1V, m_WININ, m_WINOUT;
-	UINT16 m_MOSAIC;
-	UINT16 m_BLDCNT;
-	UINT16 m_BLDALPHA;
-	UINT16 m_BLDY;
+	UINT16 m_GRNSWAP;
 	UINT8  m_SOUNDCNT_X;
 	UINT16 m_SOUNDCNT_H;
 	UINT16 m_SOUNDBIAS;
@@ -178,14 +196,8 @@ public:
 	UINT8  m_POSTFLG;
 	UINT8  m_HALTCNT;
 
-	UINT8  m_windowOn;
-	UINT8  m_fxOn;
 	UINT8  m_gfxBG2Changed;
 	UINT8  m_gfxBG3Changed;
-	INT32  m_gfxBG2X;
-	INT32  m_gfxBG2Y;
-	INT32  m_gfxBG3X;
-	INT32  m_gfxBG3Y;
 
 
 
@@ -242,5 +254,7 @@ public:
 /*----------- defined in video/gba.c -----------*/
 
 void gba_draw_scanline(running_machine &machine, int y);
+void gba_video_sync(running_machine &machine);
+void gba_video_snapshot(running_machine &machine);
 
 #endif
@@ -734,7 +734,7 @@ const floppy_interface c1541_floppy_interface =
 static MACHINE_CONFIG_FRAGMENT( c1541 )
 	MCFG_CPU_ADD(M6502_TAG, M6502, XTAL_16MHz/16)
 	MCFG_CPU_PROGRAM_MAP(c1541_mem)
-    MCFG_QUANTUM_PERFECT_CPU(M6502_TAG)
+    MCFG_DEVICE_CATCHUP()
 
 	MCFG_VIA6522_ADD(M6522_0_TAG, XTAL_16MHz/16, c1541_via0_intf)
 	MCFG_VIA6522_ADD(M6522_1_TAG, XTAL_16MHz/16, c1541_via1_intf)
@@ -751,7 +751,7 @@ MACHINE_CONFIG_END
 static MACHINE_CONFIG_FRAGMENT( c1541c )
 	MCFG_CPU_ADD(M6502_TAG, M6502, XTAL_16MHz/16)
 	MCFG_CPU_PROGRAM_MAP(c1541_mem)
-    MCFG_QUANTUM_PERFECT_CPU(M6502_TAG)
+    MCFG_DEVICE_CATCHUP()
 
 	MCFG_VIA6522_ADD(M6522_0_TAG, XTAL_16MHz/16, c1541c_via0_intf)
 	MCFG_VIA6522_ADD(M6522_1_TAG, XTAL_16MHz/16, c1541_via1_intf)
@@ -768,7 +768,7 @@ MACHINE_CONFIG_END
 static MACHINE_CONFIG_FRAGMENT( c1541dd )
     MCFG_CPU_ADD(M6502_TAG, M6502, XTAL_16MHz/16)
     MCFG_CPU_PROGRAM_MAP(c1541dd_mem)
-    MCFG_QUANTUM_PERFECT_CPU(M6502_TAG)
+    MCFG_DEVICE_CATCHUP()
 
     MCFG_VIA6522_ADD(M6522_0_TAG, XTAL_16MHz/16, c1541_via0_intf)
     MCFG_VIA6522_ADD(M6522_1_TAG, XTAL_16MHz/16, c1541_via1_intf)
@@ -785,7 +785,7 @@ MACHINE_CONFIG_END
 static MACHINE_CONFIG_FRAGMENT( c1541pd )
     MCFG_CPU_ADD(M6502_TAG, M6502, XTAL_16MHz/16)
     MCFG_CPU_PROGRAM_MAP(c1541pd_mem)
-    MCFG_QUANTUM_PERFECT_CPU(M6502_TAG)
+    MCFG_DEVICE_CATCHUP()
 
     MCFG_VIA6522_ADD(M6522_0_TAG, XTAL_16MHz/16, c1541_via0_intf)
     MCFG_VIA6522_ADD(M6522_1_TAG, XTAL_16MHz/16, c1541_via1_intf)
@@ -602,7 +602,7 @@ static const floppy_interface c1570_floppy_interface =
 static MACHINE_CONFIG_FRAGMENT( c1571 )
 	MCFG_CPU_ADD(M6502_TAG, M6502, XTAL_16MHz/16)
 	MCFG_CPU_PROGRAM_MAP(c1571_mem)
-	MCFG_QUANTUM_PERFECT_CPU(M6502_TAG)
+	MCFG_DEVICE_CATCHUP()
 
 	MCFG_VIA6522_ADD(M6522_0_TAG, XTAL_16MHz/16, via0_intf)
 	MCFG_VIA6522_ADD(M6522_1_TAG, XTAL_16MHz/16, via1_intf)
@@ -621,7 +621,7 @@ MACHINE_CONFIG_END
 static MACHINE_CONFIG_FRAGMENT( c1570 )
 	MCFG_CPU_ADD(M6502_TAG, M6502, XTAL_16MHz/16)
 	MCFG_CPU_PROGRAM_MAP(c1571_mem)
-	MCFG_QUANTUM_PERFECT_CPU(M6502_TAG)
+	MCFG_DEVICE_CATCHUP()
 
 	MCFG_VIA6522_ADD(M6522_0_TAG, XTAL_16MHz/16, via0_intf)
 	MCFG_VIA6522_ADD(M6522_1_TAG, XTAL_16MHz/16, via1_intf)
@@ -327,6 +327,7 @@ static const floppy_interface c1581_floppy_interface =
 static MACHINE_CONFIG_FRAGMENT( c1581 )
 	MCFG_CPU_ADD(M6502_TAG, M6502, XTAL_16MHz/8)
 	MCFG_CPU_PROGRAM_MAP(c1581_mem)
+	MCFG_DEVICE_CATCHUP()
 
 	MCFG_MOS8520_ADD(M8520_TAG, XTAL_16MHz/8, cia_intf)
 	MCFG_WD1770_ADD(WD1770_TAG, /*XTAL_16MHz/2,*/ fdc_intf)
@@ -150,6 +150,7 @@ static const pia6821_interface pia1_intf =
 static MACHINE_CONFIG_FRAGMENT( c64_multiscreen )
 	MCFG_CPU_ADD(MC6802P_TAG, M6802, XTAL_4MHz)
 	MCFG_CPU_PROGRAM_MAP(multiscreen_mem)
+	MCFG_QUANTUM_PERFECT_CPU(MC6802P_TAG)
 
 	MCFG_PIA6821_ADD(MC6821P_0_TAG, pia0_intf)
 	MCFG_PIA6821_ADD(MC6821P_1_TAG, pia1_intf)
@@ -319,6 +319,9 @@ inline void cbm_iec_device::set_signal(device_t *device, int signal, int state)
 {
 	bool changed = false;
 
+	// let devices using catch-up scheduling get up to date with the bus
+	machine().scheduler().catch_up();
+
 	if (device == this)
 	{
 		if (m_line[signal] != state)
@@ -401,6 +404,8 @@ inline void cbm_iec_device::set_signal(device_t *device, int signal, int state)
 
 inline int cbm_iec_device::get_signal(int signal)
 {
+	machine().scheduler().catch_up();
+
 	int state = m_line[signal];
 
 	if (state)
@@ -131,6 +131,7 @@ static I8255A_INTERFACE( ppi_intf )
 static MACHINE_CONFIG_FRAGMENT( cmd_hd )
 	MCFG_CPU_ADD(M6502_TAG, M6502, 2000000)
 	MCFG_CPU_PROGRAM_MAP(cmd_hd_mem)
+	MCFG_DEVICE_CATCHUP()
 
 	MCFG_VIA6522_ADD(M6522_1_TAG, 2000000, via1_intf)
 	MCFG_VIA6522_ADD(M6522_2_TAG, 2000000, via2_intf)
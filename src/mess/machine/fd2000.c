@@ -135,6 +135,7 @@ static const struct upd765_interface fdc_intf =
 static MACHINE_CONFIG_FRAGMENT( fd2000 )
 	MCFG_CPU_ADD(M6502_TAG, M65C02, 2000000)
 	MCFG_CPU_PROGRAM_MAP(fd2000_mem)
+	MCFG_DEVICE_CATCHUP()
 
 	MCFG_VIA6522_ADD(M6522_TAG, 2000000, via_intf)
 	MCFG_UPD765A_ADD(DP8473_TAG, fdc_intf)
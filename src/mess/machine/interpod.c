@@ -198,6 +198,7 @@ static ACIA6850_INTERFACE( acia_intf )
 static MACHINE_CONFIG_FRAGMENT( interpod )
 	MCFG_CPU_ADD(R6502_TAG, M6502, 1000000)
 	MCFG_CPU_PROGRAM_MAP(interpod_mem)
+	MCFG_DEVICE_CATCHUP()
 
 	MCFG_VIA6522_ADD(R6522_TAG, 1000000, via_intf)
 	MCFG_RIOT6532_ADD(R6532_TAG, 1000000, riot_intf)
@@ -71,6 +71,7 @@ ADDRESS_MAP_END
 static MACHINE_CONFIG_FRAGMENT( serial_box )
 	MCFG_CPU_ADD(M6502_TAG, M65C02, XTAL_4MHz/4)
 	MCFG_CPU_PROGRAM_MAP(serial_box_mem)
+	MCFG_DEVICE_CATCHUP()
 MACHINE_CONFIG_END
 
 
@@ -9,6 +9,7 @@
 ***************************************************************************/
 
 #include "emu.h"
+#include "video/deferred.h"
 #include "includes/gba.h"
 
 #define VERBOSE_LEVEL	(0)
@@ -32,15 +33,15 @@ static const int coeff[32] = {
 };
 
 /* Drawing functions */
-static void draw_roz_bitmap_scanline(gba_state *state, UINT32 *scanline, int ypos, UINT32 enablemask, UINT32 ctrl, INT32 X, INT32 Y, INT32 PA, INT32 PB, INT32 PC, INT32 PD, INT32 *currentx, INT32 *currenty, int changed, int depth);
-static void draw_roz_scanline(gba_state *state, UINT32 *scanline, int ypos, UINT32 enablemask, UINT32 ctrl, INT32 X, INT32 Y, INT32 PA, INT32 PB, INT32 PC, INT32 PD, INT32 *currentx, INT32 *currenty, int changed);
-static void draw_bg_scanline(gba_state *state, UINT32 *scanline, int ypos, UINT32 enablemask, UINT32 ctrl, UINT32 hofs, UINT32 vofs);
-static void draw_gba_oam_window(gba_state *state, running_machine &machine, UINT32 *scanline, int y);
-static void draw_gba_oam(gba_state *state, running_machine &machine, UINT32 *scanline, int y);
-static void invalid_gba_draw_function(running_machine &machine, gba_state *state, int y, UINT32* line0, UINT32* line1, UINT32* line2, UINT32* line3, UINT32* lineOBJ, UINT32* lineOBJWin, UINT32* lineMix, int aux);
+static void draw_roz_bitmap_scanline(gba_video_regs *state, UINT32 *scanline, int ypos, UINT32 enablemask, UINT32 ctrl, INT32 X, INT32 Y, INT32 PA, INT32 PB, INT32 PC, INT32 PD, INT32 currentx, INT32 currenty, int depth);
+static void draw_roz_scanline(gba_video_regs *state, UINT32 *scanline, int ypos, UINT32 enablemask, UINT32 ctrl, INT32 X, INT32 Y, INT32 PA, INT32 PB, INT32 PC, INT32 PD, INT32 currentx, INT32 currenty);
+static void draw_bg_scanline(gba_video_regs *state, UINT32 *scanline, int ypos, UINT32 enablemask, UINT32 ctrl, UINT32 hofs, UINT32 vofs);
+static void draw_gba_oam_window(gba_video_regs *state, running_machine &machine, UINT32 *scanline, int y);
+static void draw_gba_oam(gba_video_regs *state, running_machine &machine, UINT32 *scanline, int y);
+static void invalid_gba_draw_function(running_machine &machine, gba_video_regs *state, int y, UINT32* line0, UINT32* line1, UINT32* line2, UINT32* line3, UINT32* lineOBJ, UINT32* lineOBJWin, UINT32* lineMix, int aux);
 
 /* Utility functions */
-INLINE int is_in_window(gba_state *state, int x, int window);
+INLINE int is_in_window(gba_video_regs *state, int x, int window);
 INLINE UINT32 alpha_blend_pixel(UINT32 color0, UINT32 color1, int ca, int cb);
 INLINE UINT32 increase_brightness(UINT32 color, int coeff_);
 INLINE UINT32 decrease_brightness(UINT32 color, int coeff_);
@@ -50,7 +51,7 @@ INLINE UINT32 decrease_brightness(UINT32 color, int coeff_);
 #include "gbamode2.c"
 #include "gbam345.c"
 
-static void (*const gba_draw_scanline_modes[8][3])(running_machine &machine, gba_state *state, int y, UINT32* line0, UINT32* line1, UINT32* line2, UINT32* line3, UINT32* lineOBJ, UINT32* lineOBJWin, UINT32* lineMix, int aux) =
+static void (*const gba_draw_scanline_modes[8][3])(running_machine &machine, gba_video_regs *state, int y, UINT32* line0, UINT32* line1, UINT32* line2, UINT32* line3, UINT32* lineOBJ, UINT32* lineOBJWin, UINT32* lineMix, int aux) =
 {
 	/* All modes have three sub-modes: No effects, effects, and windowed effects. */
 	{	/* Mode 0: 4 non-rotatable tilemaps and 1 OAM layer */
@@ -95,16 +96,16 @@ static void (*const gba_draw_scanline_modes[8][3])(running_machine &machine, gba
 	},
 };
 
-static void invalid_gba_draw_function(running_machine &machine, gba_state *state, int y, UINT32* line0, UINT32* line1, UINT32* line2, UINT32* line3, UINT32* lineOBJ, UINT32* lineOBJWin, UINT32* lineMix, int aux)
+static void invalid_gba_draw_function(running_machine &machine, gba_video_regs *state, int y, UINT32* line0, UINT32* line1, UINT32* line2, UINT32* line3, UINT32* lineOBJ, UINT32* lineOBJWin, UINT32* lineMix, int aux)
 {
 	fatalerror( "Invalid screen mode (6 or 7)!" );
 }
 
-static void draw_roz_bitmap_scanline(gba_state *state, UINT32 *scanline, int ypos, UINT32 enablemask, UINT32 ctrl, INT32 X, INT32 Y, INT32 PA, INT32 PB, INT32 PC, INT32 PD, INT32 *currentx, INT32 *currenty, int changed, int depth)
+static void draw_roz_bitmap_scanline(gba_video_regs *state, UINT32 *scanline, int ypos, UINT32 enablemask, UINT32 ctrl, INT32 X, INT32 Y, INT32 PA, INT32 PB, INT32 PC, INT32 PD, INT32 currentx, INT32 currenty, int depth)
 {
-	UINT8 *src8 = (UINT8 *)state->m_gba_vram.target();
-	UINT16 *src16 = (UINT16 *)state->m_gba_vram.target();
-	UINT16 *palette = (UINT16 *)state->m_gba_pram.target();
+	UINT8 *src8 = (UINT8 *)state->m_video_vram;
+	UINT16 *src16 = (UINT16 *)state->m_video_vram;
+	UINT16 *palette = (UINT16 *)state->m_video_pram;
 	INT32 sx = (depth == 4) ? 160 : 240;
 	INT32 sy = (depth == 4) ? 128 : 160;
 	UINT32 prio = ((ctrl & BGCNT_PRIORITY) << 25) + 0x1000000;
@@ -133,21 +134,8 @@ static void draw_roz_bitmap_scanline(gba_state *state, UINT32 *scanline, int ypo
 	startx = X;
 	starty = Y;
 
-	if(ypos == 0)
-		changed = 3;
-
-	if(changed & 1)
-		*currentx = startx;
-	else
-		*currentx += dmx;
-
-	if(changed & 2)
-		*currenty = starty;
-	else
-		*currenty += dmy;
-
-	rx = *currentx;
-	ry = *currenty;
+	rx = currentx;
+	ry = currenty;
 
 	if(ctrl & BGCNT_MOSAIC)
 	{
@@ -206,14 +194,14 @@ static void draw_roz_bitmap_scanline(gba_state *state, UINT32 *scanline, int ypo
 	}
 }
 
-static void draw_roz_scanline(gba_state *state, UINT32 *scanline, int ypos, UINT32 enablemask, UINT32 ctrl, INT32 X, INT32 Y, INT32 PA, INT32 PB, INT32 PC, INT32 PD, INT32 *currentx, INT32 *currenty, int changed)
+static void draw_roz_scanline(gba_video_regs *state, UINT32 *scanline, int ypos, UINT32 enablemask, UINT32 ctrl, INT32 X, INT32 Y, INT32 PA, INT32 PB, INT32 PC, INT32 PD, INT32 currentx, INT32 currenty)
 {
 	UINT32 base, mapbase, size;
 	static const INT32 sizes[4] = { 128, 256, 512, 1024 };
 	INT32 cx, cy, x, pixx, pixy;
-	UINT8 *mgba_vram = (UINT8 *)state->m_gba_vram.target();
+	UINT8 *mgba_vram = (UINT8 *)state->m_video_vram;
 	UINT32 tile;
-	UINT16 *pgba_pram = (UINT16 *)state->m_gba_pram.target();
+	UINT16 *pgba_pram = (UINT16 *)state->m_video_pram;
 	UINT16 pixel;
 	UINT32 prio = ((ctrl & BGCNT_PRIORITY) << 25) + 0x1000000;
 
@@ -229,38 +217,13 @@ static void draw_roz_scanline(gba_state *state, UINT32 *scanline, int ypos, UINT
 		size = (ctrl & BGCNT_SCREENSIZE) >> BGCNT_SCREENSIZE_SHIFT;					// size of map in submaps
 
 		// sign extend roz parameters
-		if (X & 0x08000000) X |= 0xf0000000;
-		if (Y & 0x08000000) Y |= 0xf0000000;
 		if (PA & 0x8000) PA |= 0xffff0000;
 		if (PB & 0x8000) PB |= 0xffff0000;
 		if (PC & 0x8000) PC |= 0xffff0000;
 		if (PD & 0x8000) PD |= 0xffff0000;
 
-		if(ypos == 0)
-		{
-			changed = 3;
-		}
-
-		if(changed & 1)
-		{
-			*currentx = X;
-		}
-		else
-		{
-			*currentx += PB;
-		}
-
-		if(changed & 2)
-		{
-			*currenty = Y;
-		}
-		else
-		{
-			*currenty += PD;
-		}
-
-		cx = *currentx;
-		cy = *currenty;
+		cx = currentx;
+		cy = currenty;
 
 		if(ctrl & BGCNT_MOSAIC)
 		{
@@ -391,10 +354,10 @@ static void draw_roz_scanline(gba_state *state, UINT32 *scanline, int ypos, UINT
 	}
 }
 
-static void draw_bg_scanline(gba_state *state, UINT32 *scanline, int ypos, UINT32 enablemask, UINT32 ctrl, UINT32 hofs, UINT32 vofs)
+static void draw_bg_scanline(gba_video_regs *state, UINT32 *scanline, int ypos, UINT32 enablemask, UINT32 ctrl, UINT32 hofs, UINT32 vofs)
 {
-	UINT8 *vram = (UINT8*)state->m_gba_vram.target();
-	UINT16 *palette = (UINT16*)state->m_gba_pram.target();
+	UINT8 *vram = (UINT8*)state->m_video_vram;
+	UINT16 *palette = (UINT16*)state->m_video_pram;
 	UINT8 *chardata = &vram[((ctrl & BGCNT_CHARBASE) >> BGCNT_CHARBASE_SHIFT) * 0x4000];
 	UINT16 *screendata = (UINT16*)&vram[((ctrl & BGCNT_SCREENBASE) >> BGCNT_SCREENBASE_SHIFT) * 0x800];
 	UINT32 priority = ((ctrl & BGCNT_PRIORITY) << 25) + 0x1000000;
@@ -615,14 +578,14 @@ static void draw_bg_scanline(gba_state *state, UINT32 *scanline, int ypos, UINT3
 	}
 }
 
-static void draw_gba_oam_window(gba_state *state, running_machine &machine, UINT32 *scanline, int y)
+static void draw_gba_oam_window(gba_video_regs *state, running_machine &machine, UINT32 *scanline, int y)
 {
 	INT16 gba_oamindex;
 	UINT32 tilebytebase, tileindex, tiledrawindex;
 	UINT32 width, height;
-	UINT16 *pgba_oam = (UINT16 *)state->m_gba_oam.target();
+	UINT16 *pgba_oam = (UINT16 *)state->m_video_oam;
 	int x = 0;
-	UINT8 *src = (UINT8*)state->m_gba_vram.target();
+	UINT8 *src = (UINT8*)state->m_video_vram;
 
 	for(x = 0; x < 240; x++)
 	{
@@ -1061,7 +1024,7 @@ static void draw_gba_oam_window(gba_state *state, running_machine &machine, UINT
 	}
 }
 
-static void draw_gba_oam(gba_state *state, running_machine &machine, UINT32 *scanline, int y)
+static void draw_gba_oam(gba_video_regs *state, running_machine &machine, UINT32 *scanline, int y)
 {
 	INT16 gba_oamindex;
 	INT32 mosaiccnt = 0;
@@ -1069,9 +1032,9 @@ static void draw_gba_oam(gba_state *state, running_machine &machine, UINT32 *sca
 	INT32 mosaicx = ((state->m_MOSAIC & 0x0f00) >>  8) + 1;
 	UINT32 tileindex, tiledrawindex; //, tilebytebase
 	UINT8 width, height;
-	UINT16 *pgba_oam = (UINT16 *)state->m_gba_oam.target();
-	UINT8 *src = (UINT8 *)state->m_gba_vram.target();
-	UINT16 *palette = (UINT16*)state->m_gba_pram.target();
+	UINT16 *pgba_oam = (UINT16 *)state->m_video_oam;
+	UINT8 *src = (UINT8 *)state->m_video_vram;
+	UINT16 *palette = (UINT16*)state->m_video_pram;
 	int x = 0;
 
 	for(x = 0; x < 240; x++)
@@ -1654,7 +1617,7 @@ static void draw_gba_oam(gba_state *state, running_machine &machine, UINT32 *sca
 	}
 }
 
-INLINE int is_in_window(gba_state *state, int x, int window)
+INLINE int is_in_window(gba_video_regs *state, int x, int window)
 {
 	int x0 = state->m_WIN0H >> 8;
 	int x1 = state->m_WIN0H & 0x00ff;
@@ -1740,10 +1703,8 @@ INLINE UINT32 decrease_brightness(UINT32 color, int coeff_)
 	return (color & 0xffff0000) | (b << 10) | (g << 5) | r;
 }
 
-void gba_draw_scanline(running_machine &machine, int y)
+static void gba_render_scanline(running_machine &machine, gba_video_regs *state, bitmap_ind16 &bitmap, int y, UINT32 (*xferscan)[240+2048])
 {
-	gba_state *state = machine.driver_data<gba_state>();
-	bitmap_ind16 &bitmap = state->m_bitmap;
 	UINT16 *scanline = &bitmap.pix16(y);
 	int i, x;
 	UINT8 submode = 0;
@@ -1788,24 +1749,165 @@ void gba_draw_scanline(running_machine &machine, int y)
 			break;
 	}
 
-	gba_draw_scanline_modes[state->m_DISPCNT & 7][submode](machine, state, y, &state->m_xferscan[0][1024], &state->m_xferscan[1][1024], &state->m_xferscan[2][1024], &state->m_xferscan[3][1024], &state->m_xferscan[4][1024], &state->m_xferscan[5][1024], &state->m_xferscan[6][1024], bpp);
+	gba_draw_scanline_modes[state->m_DISPCNT & 7][submode](machine, state, y, &xferscan[0][1024], &xferscan[1][1024], &xferscan[2][1024], &xferscan[3][1024], &xferscan[4][1024], &xferscan[5][1024], &xferscan[6][1024], bpp);
 
 	for(x = 0; x < 240; x++)
 	{
-		scanline[x] = state->m_xferscan[6][1024 + x] & 0x7fff;
+		scanline[x] = xferscan[6][1024 + x] & 0x7fff;
 	}
 
 	return;
 }
 
+/* advance the affine reference points to line y; this is emulation state, so
+   it happens when the line is reached even if drawing it is deferred */
+static void gba_latch_roz_line(int y, INT32 X, INT32 Y, INT32 PB, INT32 PD, INT32 *currentx, INT32 *currenty, int changed)
+{
+	// sign extend roz parameters
+	if (X & 0x08000000) X |= 0xf0000000;
+	if (Y & 0x08000000) Y |= 0xf0000000;
+	if (PB & 0x8000) PB |= 0xffff0000;
+	if (PD & 0x8000) PD |= 0xffff0000;
+
+	if(y == 0)
+		changed = 3;
+
+	if(changed & 1)
+		*currentx = X;
+	else
+		*currentx += PB;
+
+	if(changed & 2)
+		*currenty = Y;
+	else
+		*currenty += PD;
+}
+
+static void gba_latch_roz(gba_state *state, int y)
+{
+	int mode = state->m_DISPCNT & 7;
+
+	if (mode == 0 || mode > 5)
+		return;
+
+	// the tiled modes only step an enabled layer, the bitmap modes always do
+	if (mode > 2 || (state->m_DISPCNT & DISPCNT_BG2_EN))
+		gba_latch_roz_line(y, state->m_BG2X, state->m_BG2Y, state->m_BG2PB, state->m_BG2PD, &state->m_gfxBG2X, &state->m_gfxBG2Y, state->m_gfxBG2Changed);
+	state->m_gfxBG2Changed = 0;
+
+	if (mode == 2)
+	{
+		if (state->m_DISPCNT & DISPCNT_BG3_EN)
+			gba_latch_roz_line(y, state->m_BG3X, state->m_BG3Y, state->m_BG3PB, state->m_BG3PD, &state->m_gfxBG3X, &state->m_gfxBG3Y, state->m_gfxBG3Changed);
+		state->m_gfxBG3Changed = 0;
+	}
+}
+
+/*
+ * Deferred rendering
+ *
+ * With -deferred_scanlines, reaching a line only latches the affine
+ * parameters and records the video registers; the recorded lines are drawn
+ * in bands on worker threads at the end of the visible area.  Palette and OAM
+ * writes snapshot the old contents for the lines already recorded.  A VRAM
+ * write draws what is pending and makes the rest of the frame immediate.
+ */
+
+#define GBA_DEFERRED_BANDS		8
+#define GBA_DEFERRED_LINES		160
+#define GBA_SNAPSHOT_WORDS		(0x400/4 * 2)		// PRAM followed by OAM
+
+struct GBA_LINE_RECORD
+{
+	int y;
+	gba_video_regs regs;
+};
+
+struct GBA_RENDER_BAND
+{
+	UINT32 xferscan[7][240+2048];
+};
+
+static deferred_manager *gba_deferred;
+
+static void gba_render_band(deferred_manager *deferred, void *param, void *bandptr, int first, int count)
+{
+	running_machine &machine = *(running_machine *)param;
+	gba_state *state = machine.driver_data<gba_state>();
+	struct GBA_RENDER_BAND *band = (struct GBA_RENDER_BAND *)bandptr;
+	int i;
+
+	for (i = first; i < first + count; i++)
+	{
+		const struct GBA_LINE_RECORD *line = (const struct GBA_LINE_RECORD *)deferred_get_line(deferred, i);
+		UINT32 *snapshot = (UINT32 *)deferred_get_line_snapshot(deferred, i);
+		gba_video_regs regs = line->regs;
+
+		if (snapshot != NULL)
+		{
+			regs.m_video_pram = snapshot;
+			regs.m_video_oam = snapshot + 0x400/4;
+		}
+		gba_render_scanline(machine, &regs, state->m_bitmap, line->y, band->xferscan);
+	}
+}
+
+/* draw the pending lines and finish the frame immediately; called before VRAM changes */
+void gba_video_sync(running_machine &machine)
+{
+	deferred_sync(gba_deferred);
+}
+
+/* keep the current palette and OAM for the pending lines; called before either changes */
+void gba_video_snapshot(running_machine &machine)
+{
+	gba_state *state = machine.driver_data<gba_state>();
+	UINT32 *snapshot = (UINT32 *)deferred_snapshot(gba_deferred);
+
+	if (snapshot == NULL)
+		return;
+
+	memcpy(snapshot, state->m_gba_pram.target(), 0x400);
+	memcpy(snapshot + 0x400/4, state->m_gba_oam.target(), 0x400);
+}
+
+void gba_draw_scanline(running_machine &machine, int y)
+{
+	gba_state *state = machine.driver_data<gba_state>();
+	struct GBA_LINE_RECORD *line;
+
+	if (!(state->m_DISPCNT & DISPCNT_BLANK))
+		gba_latch_roz(state, y);
+
+	line = (struct GBA_LINE_RECORD *)deferred_capture(gba_deferred, y, FALSE);
+	if (line == NULL)
+	{
+		gba_render_scanline(machine, state, state->m_bitmap, y, state->m_xferscan);
+		return;
+	}
+
+	line->y = y;
+	line->regs = *state;
+	if (y == GBA_DEFERRED_LINES - 1)
+		deferred_render(gba_deferred);
+}
+
 void gba_state::video_start()
 {
 	machine().primary_screen->register_screen_bitmap(m_bitmap);
+
+	m_video_pram = m_gba_pram;
+	m_video_vram = m_gba_vram;
+	m_video_oam = m_gba_oam;
+
+	gba_deferred = deferred_alloc(machine(), GBA_DEFERRED_LINES, sizeof(struct GBA_LINE_RECORD), GBA_SNAPSHOT_WORDS * 4,
+			auto_alloc_array(machine(), struct GBA_RENDER_BAND, GBA_DEFERRED_BANDS), sizeof(struct GBA_RENDER_BAND), GBA_DEFERRED_BANDS,
+			gba_render_band, NULL, &machine());
 }
 
 UINT32 gba_state::screen_update(screen_device &screen, bitmap_ind16 &bitmap, const rectangle &cliprect)
 {
+	deferred_render(gba_deferred);
 	copybitmap(bitmap, m_bitmap, 0, 0, 0, 0, cliprect);
 	return 0;
 }
-
@@ -8,14 +8,14 @@
 
 ***************************************************************************/
 
-static void draw_mode1_scanline(running_machine &machine, gba_state *state, int y, UINT32* line0, UINT32* line1, UINT32* line2, UINT32* line3, UINT32* lineOBJ, UINT32* lineOBJWin, UINT32* lineMix, int bpp)
+static void draw_mode1_scanline(running_machine &machine, gba_video_regs *state, int y, UINT32* line0, UINT32* line1, UINT32* line2, UINT32* line3, UINT32* lineOBJ, UINT32* lineOBJWin, UINT32* lineMix, int bpp)
 {
 	int x = 0;
-	UINT32 backdrop = ((UINT16*)state->m_gba_pram.target())[0] | 0x30000000;
+	UINT32 backdrop = ((UINT16*)state->m_video_pram)[0] | 0x30000000;
 
 	draw_bg_scanline(state, line0, y, DISPCNT_BG0_EN, state->m_BG0CNT, state->m_BG0HOFS, state->m_BG0VOFS);
 	draw_bg_scanline(state, line1, y, DISPCNT_BG1_EN, state->m_BG1CNT, state->m_BG1HOFS, state->m_BG1VOFS);
-	draw_roz_scanline(state, line2, y, DISPCNT_BG2_EN, state->m_BG2CNT, state->m_BG2X, state->m_BG2Y, state->m_BG2PA, state->m_BG2PB, state->m_BG2PC, state->m_BG2PD, &state->m_gfxBG2X, &state->m_gfxBG2Y, state->m_gfxBG2Changed);
+	draw_roz_scanline(state, line2, y, DISPCNT_BG2_EN, state->m_BG2CNT, state->m_BG2X, state->m_BG2Y, state->m_BG2PA, state->m_BG2PB, state->m_BG2PC, state->m_BG2PD, state->m_gfxBG2X, state->m_gfxBG2Y);
 	draw_gba_oam(state, machine, lineOBJ, y);
 
 	for(x = 0; x < 240; x++)
@@ -96,18 +96,17 @@ static void draw_mode1_scanline(running_machine &machine, gba_state *state, int
 
 		lineMix[x] = color;
 	}
-	state->m_gfxBG2Changed = 0;
 }
 
-static void draw_mode1_scanline_nowindow(running_machine &machine, gba_state *state, int y, UINT32* line0, UINT32* line1, UINT32* line2, UINT32* line3, UINT32* lineOBJ, UINT32* lineOBJWin, UINT32* lineMix, int bpp)
+static void draw_mode1_scanline_nowindow(running_machine &machine, gba_video_regs *state, int y, UINT32* line0, UINT32* line1, UINT32* line2, UINT32* line3, UINT32* lineOBJ, UINT32* lineOBJWin, UINT32* lineMix, int bpp)
 {
 	int x = 0;
-	UINT32 backdrop = ((UINT16*)state->m_gba_pram.target())[0] | 0x30000000;
+	UINT32 backdrop = ((UINT16*)state->m_video_pram)[0] | 0x30000000;
 	int effect = state->m_BLDCNT & BLDCNT_SFX;
 
 	draw_bg_scanline(state, line0, y, DISPCNT_BG0_EN, state->m_BG0CNT, state->m_BG0HOFS, state->m_BG0VOFS);
 	draw_bg_scanline(state, line1, y, DISPCNT_BG1_EN, state->m_BG1CNT, state->m_BG1HOFS, state->m_BG1VOFS);
-	draw_roz_scanline(state, line2, y, DISPCNT_BG2_EN, state->m_BG2CNT, state->m_BG2X, state->m_BG2Y, state->m_BG2PA, state->m_BG2PB, state->m_BG2PC, state->m_BG2PD, &state->m_gfxBG2X, &state->m_gfxBG2Y, state->m_gfxBG2Changed);
+	draw_roz_scanline(state, line2, y, DISPCNT_BG2_EN, state->m_BG2CNT, state->m_BG2X, state->m_BG2Y, state->m_BG2PA, state->m_BG2PB, state->m_BG2PC, state->m_BG2PD, state->m_gfxBG2X, state->m_gfxBG2Y);
 	draw_gba_oam(state, machine, lineOBJ, y);
 
 	for(x = 0; x < 240; x++)
@@ -255,13 +254,12 @@ static void draw_mode1_scanline_nowindow(running_machine &machine, gba_state *st
 		}
 		lineMix[x] = color;
 	}
-	state->m_gfxBG2Changed = 0;
 }
 
-static void draw_mode1_scanline_all(running_machine &machine, gba_state *state, int y, UINT32* line0, UINT32* line1, UINT32* line2, UINT32* line3, UINT32* lineOBJ, UINT32* lineOBJWin, UINT32* lineMix, int bpp)
+static void draw_mode1_scanline_all(running_machine &machine, gba_video_regs *state, int y, UINT32* line0, UINT32* line1, UINT32* line2, UINT32* line3, UINT32* lineOBJ, UINT32* lineOBJWin, UINT32* lineMix, int bpp)
 {
 	int x = 0;
-	UINT32 backdrop = ((UINT16*)state->m_gba_pram.target())[0] | 0x30000000;
+	UINT32 backdrop = ((UINT16*)state->m_video_pram)[0] | 0x30000000;
 	int inWindow0 = 0;
 	int inWindow1 = 0;
 	UINT8 inWin0Mask = state->m_WININ & 0x00ff;
@@ -300,7 +298,7 @@ static void draw_mode1_scanline_all(running_machine &machine, gba_state *state,
 
 	draw_bg_scanline(state, line0, y, DISPCNT_BG0_EN, state->m_BG0CNT, state->m_BG0HOFS, state->m_BG0VOFS);
 	draw_bg_scanline(state, line1, y, DISPCNT_BG1_EN, state->m_BG1CNT, state->m_BG1HOFS, state->m_BG1VOFS);
-	draw_roz_scanline(state, line2, y, DISPCNT_BG2_EN, state->m_BG2CNT, state->m_BG2X, state->m_BG2Y, state->m_BG2PA, state->m_BG2PB, state->m_BG2PC, state->m_BG2PD, &state->m_gfxBG2X, &state->m_gfxBG2Y, state->m_gfxBG2Changed);
+	draw_roz_scanline(state, line2, y, DISPCNT_BG2_EN, state->m_BG2CNT, state->m_BG2X, state->m_BG2Y, state->m_BG2PA, state->m_BG2PB, state->m_BG2PC, state->m_BG2PD, state->m_gfxBG2X, state->m_gfxBG2Y);
 	draw_gba_oam(state, machine, lineOBJ, y);
 	draw_gba_oam_window(state, machine, lineOBJWin, y);
 
@@ -521,5 +519,4 @@ static void draw_mode1_scanline_all(running_machine &machine, gba_state *state,
 		}
 		lineMix[x] = color;
 	}
-	state->m_gfxBG2Changed = 0;
 }
@@ -196,6 +196,58 @@ file_error osd_read(osd_file *file, void *buffer, UINT64 offset, UINT32 length,
 file_error osd_write(osd_file *file, const void *buffer, UINT64 offset, UINT32 length, UINT32 *actual);
 
 
+/*-----------------------------------------------------------------------------
+    osd_map: map a range of an open file into memory
+
+    Parameters:
+
+        file - handle to a file previously opened via osd_open
+
+        offset - offset within the file where the mapping should start;
+            this need not be aligned to any particular boundary
+
+        length - number of bytes to map; must be non-zero and must not
+            extend past the end of the file
+
+        mapping - pointer to an osd_mapping * to receive the handle to the
+            new mapping; this is only valid if the function returns
+            FILERR_NONE
+
+        base - pointer to a void * to receive the address of the first
+            mapped byte; this is only valid if the function returns
+            FILERR_NONE
+
+    Return value:
+
+        a file_error describing any error that occurred while mapping
+        the file, or FILERR_NONE if no error occurred
+
+    Notes:
+
+        The mapping is private: the caller may write to the mapped memory,
+        but such writes are never carried back to the file. The mapping
+        remains valid after the file is closed, until it is released via
+        osd_unmap.
+
+        Implementations that cannot map files (or cannot map this kind of
+        file, such as sockets or ptys) should return FILERR_FAILURE; the
+        core always falls back to osd_read in that case.
+-----------------------------------------------------------------------------*/
+typedef struct _osd_mapping osd_mapping;
+
+file_error osd_map(osd_file *file, UINT64 offset, UINT64 length, osd_mapping **mapping, void **base);
+
+
+/*-----------------------------------------------------------------------------
+    osd_unmap: release a mapping previously created via osd_map
+
+    Parameters:
+
+        mapping - handle to the mapping to release
+-----------------------------------------------------------------------------*/
+void osd_unmap(osd_mapping *mapping);
+
+
 /*-----------------------------------------------------------------------------
     osd_rmfile: deletes a file
 
@@ -211,6 +263,28 @@ file_error osd_write(osd_file *file, const void *buffer, UINT64 offset, UINT32 l
 file_error osd_rmfile(const char *filename);
 
 
+/*-----------------------------------------------------------------------------
+    osd_rename: renames a file, replacing any existing file of the new name
+
+    Parameters:
+
+        oldname - path to the file to rename
+
+        newname - path to give it; this is in the same directory
+
+    Return value:
+
+        a file_error describing any error that occurred while renaming
+        the file, or FILERR_NONE if no error occurred
+
+    Notes:
+
+        Where the host allows, the replacement should be atomic, so that
+        other processes see either the old file or the new one.
+-----------------------------------------------------------------------------*/
+file_error osd_rename(const char *oldname, const char *newname);
+
+
 /*-----------------------------------------------------------------------------
     osd_get_physical_drive_geometry: if the given path points to a physical
         drive, return the geometry of that drive
@@ -833,6 +907,87 @@ void osd_free_executable(void *ptr, size_t size);
 void osd_break_into_debugger(const char *message);
 
 
+
+/***************************************************************************
+    PROCESS INTERFACES
+***************************************************************************/
+
+/* osd_process is an opaque type which represents a child process */
+typedef struct _osd_process osd_process;
+
+/* possible states returned by osd_process_wait */
+enum
+{
+	OSD_PROCESS_RUNNING = 0,		/* still running after the timeout */
+	OSD_PROCESS_EXITED,				/* exited normally; *result is the exit code */
+	OSD_PROCESS_CRASHED				/* killed by a signal or exception; *result is its number */
+};
+
+
+/*-----------------------------------------------------------------------------
+    osd_process_create: start a child process
+
+    Parameters:
+
+        argv - NULL-terminated array of arguments; argv[0] is the program
+            to run, looked up the same way the system shell would
+
+        logpath - path of a file that receives the child's standard output
+            and standard error, or NULL to share the caller's
+
+    Return value:
+
+        a handle to the new process, or NULL if it could not be started
+
+    Notes:
+
+        Implementations that cannot start processes should simply return
+        NULL.
+-----------------------------------------------------------------------------*/
+osd_process *osd_process_create(const char *const *argv, const char *logpath);
+
+
+/*-----------------------------------------------------------------------------
+    osd_process_wait: wait for a child process to finish
+
+    Parameters:
+
+        process - handle to a process created via osd_process_create
+
+        timeout - maximum time to wait, in osd_ticks; 0 just polls
+
+        result - pointer to an int that receives the exit code or the
+            signal/exception number when the process has finished
+
+    Return value:
+
+        one of the OSD_PROCESS_* states above; once a process has finished,
+        further calls keep returning the same state and result
+-----------------------------------------------------------------------------*/
+int osd_process_wait(osd_process *process, osd_ticks_t timeout, int *result);
+
+
+/*-----------------------------------------------------------------------------
+    osd_process_kill: forcibly terminate a running child process
+
+    Parameters:
+
+        process - handle to a process created via osd_process_create
+-----------------------------------------------------------------------------*/
+void osd_process_kill(osd_process *process);
+
+
+/*-----------------------------------------------------------------------------
+    osd_process_free: release a process handle, killing the process first
+        if it is still running
+
+    Parameters:
+
+        process - handle to a process created via osd_process_create
+-----------------------------------------------------------------------------*/
+void osd_process_free(osd_process *process);
+
+
 /*-----------------------------------------------------------------------------
   MESS specific code below
 -----------------------------------------------------------------------------*/
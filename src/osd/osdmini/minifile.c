@@ -42,6 +42,25 @@
 #include "osdcore.h"
 #include <stdlib.h>
 
+// POSIX hosts can map files even through stdio
+#if defined(__unix__) || defined(__APPLE__)
+#define MINIFILE_MMAP
+#include <stdio.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
+
+
+//============================================================
+//  TYPE DEFINITIONS
+//============================================================
+
+struct _osd_mapping
+{
+	void *		base;		// page-aligned base of the mapping
+	size_t		length;		// length of the mapping in bytes
+};
+
 
 //============================================================
 //  osd_open
@@ -134,6 +153,59 @@ file_error osd_write(osd_file *file, const void *buffer, UINT64 offset, UINT32 l
 }
 
 
+//============================================================
+//  osd_map
+//============================================================
+
+file_error osd_map(osd_file *file, UINT64 offset, UINT64 length, osd_mapping **mapping, void **base)
+{
+#ifdef MINIFILE_MMAP
+	UINT64 delta = offset % sysconf(_SC_PAGESIZE);
+	size_t maplength = (size_t)(length + delta);
+	void *ptr;
+
+	// make sure the range fits in our address space
+	if (length == 0 || maplength != length + delta)
+		return FILERR_FAILURE;
+
+	// flush anything stdio is holding, then map privately
+	fflush((FILE *)file);
+	ptr = mmap(NULL, maplength, PROT_READ | PROT_WRITE, MAP_PRIVATE, fileno((FILE *)file), offset - delta);
+	if (ptr == MAP_FAILED)
+		return FILERR_FAILURE;
+
+	// allocate the mapping object
+	*mapping = (osd_mapping *)malloc(sizeof(**mapping));
+	if (*mapping == NULL)
+	{
+		munmap(ptr, maplength);
+		return FILERR_OUT_OF_MEMORY;
+	}
+	(*mapping)->base = ptr;
+	(*mapping)->length = maplength;
+
+	*base = (UINT8 *)ptr + delta;
+	return FILERR_NONE;
+#else
+	// stdio alone gives us no way to do this
+	return FILERR_FAILURE;
+#endif
+}
+
+
+//============================================================
+//  osd_unmap
+//============================================================
+
+void osd_unmap(osd_mapping *mapping)
+{
+#ifdef MINIFILE_MMAP
+	munmap(mapping->base, mapping->length);
+#endif
+	free(mapping);
+}
+
+
 //============================================================
 //  osd_rmfile
 //============================================================
@@ -144,6 +216,16 @@ file_error osd_rmfile(const char *filename)
 }
 
 
+//============================================================
+//  osd_rename
+//============================================================
+
+file_error osd_rename(const char *oldname, const char *newname)
+{
+	return rename(oldname, newname) ? FILERR_FAILURE : FILERR_NONE;
+}
+
+
 //============================================================
 //  osd_get_physical_drive_geometry
 //============================================================
@@ -42,6 +42,50 @@
 #include "osdcore.h"
 #include <stdlib.h>
 
+// POSIX hosts can start child processes
+#if defined(__unix__) || defined(__APPLE__)
+#define MINIMISC_PROCESS
+#include <stdio.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#endif
+
+
+//============================================================
+//  CONSTANTS
+//============================================================
+
+#ifdef MINIMISC_PROCESS
+// highest descriptor a child closes itself where there is no closefrom()
+#define PROCESS_CLOSE_LIMIT		1024
+
+// other threads may be starting children too, so keep each one's log out of the rest
+#ifdef O_CLOEXEC
+#define PROCESS_O_CLOEXEC		O_CLOEXEC
+#else
+#define PROCESS_O_CLOEXEC		0
+#endif
+#endif
+
+
+//============================================================
+//  TYPE DEFINITIONS
+//============================================================
+
+struct _osd_process
+{
+#ifdef MINIMISC_PROCESS
+	pid_t		pid;		// process ID of the child
+#endif
+	int			state;		// OSD_PROCESS_* state
+	int			result;		// exit code or signal number once finished
+};
+
+
 
 //============================================================
 //  osd_malloc
@@ -125,3 +169,165 @@ const void *osd_get_slider_list()
 	// nothing to slide in mini OSD
 	return NULL;
 }
+
+
+#ifdef MINIMISC_PROCESS
+//============================================================
+//  close_inherited_files
+//
+//  closes every descriptor above stderr in a new child; the
+//  fallback loop stops at a modest limit
+//============================================================
+
+static void close_inherited_files(void)
+{
+#if defined(__FreeBSD__) || defined(__OpenBSD__) || defined(__NetBSD__) || (defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 34)))
+	closefrom(STDERR_FILENO + 1);
+#else
+	long maxfd = sysconf(_SC_OPEN_MAX);
+	if (maxfd < 0 || maxfd > PROCESS_CLOSE_LIMIT)
+		maxfd = PROCESS_CLOSE_LIMIT;
+	for (int fd = STDERR_FILENO + 1; fd < maxfd; fd++)
+		close(fd);
+#endif
+}
+#endif
+
+
+//============================================================
+//  osd_process_create
+//============================================================
+
+osd_process *osd_process_create(const char *const *argv, const char *logpath)
+{
+#ifdef MINIMISC_PROCESS
+	osd_process *process;
+	int logfd = -1;
+
+	// open the log first so that failures are reported to the caller
+	if (logpath != NULL)
+	{
+		logfd = open(logpath, O_WRONLY | O_CREAT | O_TRUNC | PROCESS_O_CLOEXEC, 0666);
+		if (logfd < 0)
+			return NULL;
+	}
+
+	process = (osd_process *)osd_malloc(sizeof(*process));
+	if (process == NULL)
+	{
+		if (logfd >= 0)
+			close(logfd);
+		return NULL;
+	}
+
+	// don't let the child inherit anything still sitting in our buffers
+	fflush(NULL);
+	process->pid = fork();
+	if (process->pid == 0)
+	{
+		// in the child: redirect output and run the program
+		if (logfd >= 0)
+		{
+			dup2(logfd, STDOUT_FILENO);
+			dup2(logfd, STDERR_FILENO);
+			close(logfd);
+		}
+
+		// close everything else we inherited (the report, ROMs, other
+		// children's logs) so it doesn't stay open for the child's lifetime
+		close_inherited_files();
+		execvp(argv[0], (char *const *)argv);
+		_exit(127);
+	}
+
+	if (logfd >= 0)
+		close(logfd);
+	if (process->pid < 0)
+	{
+		osd_free(process);
+		return NULL;
+	}
+	process->state = OSD_PROCESS_RUNNING;
+	process->result = 0;
+	return process;
+#else
+	// no portable way to do this
+	return NULL;
+#endif
+}
+
+
+//============================================================
+//  osd_process_wait
+//============================================================
+
+int osd_process_wait(osd_process *process, osd_ticks_t timeout, int *result)
+{
+#ifdef MINIMISC_PROCESS
+	osd_ticks_t endtime = osd_ticks() + timeout;
+
+	while (process->state == OSD_PROCESS_RUNNING)
+	{
+		int status;
+		pid_t pid = waitpid(process->pid, &status, WNOHANG);
+
+		if (pid == process->pid && WIFEXITED(status))
+		{
+			process->state = OSD_PROCESS_EXITED;
+			process->result = WEXITSTATUS(status);
+		}
+		else if (pid == process->pid && WIFSIGNALED(status))
+		{
+			process->state = OSD_PROCESS_CRASHED;
+			process->result = WTERMSIG(status);
+		}
+		else if (pid < 0 && errno != EINTR)
+		{
+			// someone else reaped it; all we know is that it is gone
+			process->state = OSD_PROCESS_EXITED;
+			process->result = -1;
+		}
+		else if (pid == 0 && osd_ticks() >= endtime)
+			break;
+		else if (pid == 0)
+			usleep(1000);
+	}
+
+	*result = process->result;
+	return process->state;
+#else
+	// we never create any processes
+	*result = 0;
+	return OSD_PROCESS_EXITED;
+#endif
+}
+
+
+//============================================================
+//  osd_process_kill
+//============================================================
+
+void osd_process_kill(osd_process *process)
+{
+#ifdef MINIMISC_PROCESS
+	if (process->state == OSD_PROCESS_RUNNING)
+		kill(process->pid, SIGKILL);
+#endif
+}
+
+
+//============================================================
+//  osd_process_free
+//============================================================
+
+void osd_process_free(osd_process *process)
+{
+#ifdef MINIMISC_PROCESS
+	if (process->state == OSD_PROCESS_RUNNING)
+	{
+		kill(process->pid, SIGKILL);
+		waitpid(process->pid, NULL, 0);
+	}
+#endif
+	osd_free(process);
+}
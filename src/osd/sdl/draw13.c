@@ -165,6 +165,7 @@ static void draw13_destroy_texture(sdl_info *sdl, texture_info *texture);
 //============================================================
 
 static void texture_set_data(sdl_info *sdl, texture_info *texture, const render_texinfo *texsource, UINT32 flags);
+static void texture_set_data_rows(texture_info *texture, const render_texinfo *texsource, int miny, int maxy);
 static texture_info *texture_create(sdl_window_info *window, const render_texinfo *texsource, quad_setup_data *setup, UINT32 flags);
 static texture_info *texture_find(sdl_info *sdl, const render_primitive *prim, quad_setup_data *setup);
 static texture_info * texture_update(sdl_window_info *window, const render_primitive *prim);
@@ -573,6 +574,9 @@ static int draw13_window_create(sdl_window_info *window, int width, int height)
 
 	window->dxdata = sdl;
 
+	// we refresh textures a band of changed rows at a time, so ask the core to find them
+	window->target->set_wants_dirty_rows(true);
+
 	sdl->extra_flags = (window->fullscreen ?
 			SDL_WINDOW_BORDERLESS | SDL_WINDOW_INPUT_FOCUS | SDL_WINDOW_FULLSCREEN : SDL_WINDOW_RESIZABLE);
 
@@ -1018,6 +1022,50 @@ static void texture_set_data(sdl_info *sdl, texture_info *texture, const render_
 	texture->copyinfo->time += osd_ticks();
 }
 
+//============================================================
+//  texture_set_data_rows
+//  refresh only rows miny..maxy of a streaming, unrotated
+//  texture
+//============================================================
+
+static void texture_set_data_rows(texture_info *texture, const render_texinfo *texsource, int miny, int maxy)
+{
+	int srcpixelsize = (PRIMFLAG_GET_TEXFORMAT(texture->flags) == TEXFORMAT_RGB32 || PRIMFLAG_GET_TEXFORMAT(texture->flags) == TEXFORMAT_ARGB32) ? 4 : 2;
+	render_texinfo band = *texsource;
+	SDL_Rect rect;
+
+	assert(texture->sdl_access == SDL_TEXTUREACCESS_STREAMING && !texture->is_rotated);
+
+	// describe just the changed rows as a texture of their own
+	band.base = (UINT8 *)texsource->base + miny * texsource->rowpixels * srcpixelsize;
+	band.height = maxy - miny + 1;
+
+	rect.x = 0;
+	rect.y = miny;
+	rect.w = texture->rawwidth;
+	rect.h = band.height;
+
+	texture->copyinfo->time -= osd_ticks();
+	SDL_LockTexture(texture->texture_id, &rect, (void **) &texture->pixels, &texture->pitch);
+	if ( texture->copyinfo->func )
+		texture->copyinfo->func(texture, &band);
+	else
+	{
+		UINT8 *src = (UINT8 *) band.base;
+		UINT8 *dst = (UINT8 *) texture->pixels;
+		int spitch = band.rowpixels * texture->copyinfo->dst_bpp;
+		int num = band.width * texture->copyinfo->dst_bpp;
+		int h = band.height;
+		while (h--) {
+			memcpy(dst, src, num);
+			src += spitch;
+			dst += texture->pitch;
+		}
+	}
+	SDL_UnlockTexture(texture->texture_id);
+	texture->copyinfo->time += osd_ticks();
+}
+
 //============================================================
 //  compute rotation setup
 //============================================================
@@ -1141,9 +1189,20 @@ static texture_info * texture_update(sdl_window_info *window, const render_primi
 	{
 		if (prim->texture.base != NULL && texture->texinfo.seqid != prim->texture.seqid)
 		{
+			UINT32 lastseqid = texture->texinfo.seqid;
+			INT32 miny, maxy;
+
 			texture->texinfo.seqid = prim->texture.seqid;
-			// if we found it, but with a different seqid, copy the data
-			texture_set_data(sdl, texture, &prim->texture, prim->flags);
+			// if we found it, but with a different seqid, copy the data; streaming
+			// textures that aren't rotated can be refreshed a band of rows at a time
+			if (texture->sdl_access == SDL_TEXTUREACCESS_STREAMING && !texture->is_rotated &&
+					prim->texture.dirty_rows(lastseqid, miny, maxy))
+			{
+				if (miny <= maxy)
+					texture_set_data_rows(texture, &prim->texture, miny, maxy);
+			}
+			else
+				texture_set_data(sdl, texture, &prim->texture, prim->flags);
 		}
 
 	}
@@ -412,6 +412,7 @@ static void texcopy_rgb15_paletted_argb1555(texture_info *texture, const render_
 //============================================================
 
 static void texture_set_data(texture_info *texture, const render_texinfo *texsource);
+static void texture_set_data_rows(texture_info *texture, const render_texinfo *texsource, int miny, int maxy);
 static texture_info *texture_create(sdl_window_info *window, const render_texinfo *texsource, UINT32 flags);
 static texture_info *texture_find(sdl_info *sdl, const render_primitive *prim);
 static texture_info * texture_update(sdl_window_info *window, const render_primitive *prim, int shaderIdx);
@@ -545,6 +546,9 @@ static int drawogl_window_create(sdl_window_info *window, int width, int height)
 
 	window->dxdata = sdl;
 
+	// we refresh textures a band of changed rows at a time, so ask the core to find them
+	window->target->set_wants_dirty_rows(true);
+
 #if (SDLMAME_SDL2)
 	sdl->extra_flags = (window->fullscreen ?
 			SDL_WINDOW_BORDERLESS | SDL_WINDOW_INPUT_FOCUS | SDL_WINDOW_FULLSCREEN : SDL_WINDOW_RESIZABLE);
@@ -2706,6 +2710,89 @@ static void texture_set_data(texture_info *texture, const render_texinfo *texsou
 	}
 }
 
+//============================================================
+//  texture_set_data_rows
+//  refresh only rows miny..maxy of the source; the rest of
+//  the texture, including any border, is left untouched
+//============================================================
+
+static void texture_set_data_rows(texture_info *texture, const render_texinfo *texsource, int miny, int maxy)
+{
+	int srcpixelsize = (PRIMFLAG_GET_TEXFORMAT(texture->flags) == TEXFORMAT_RGB32 || PRIMFLAG_GET_TEXFORMAT(texture->flags) == TEXFORMAT_ARGB32) ? 4 : 2;
+	int rows = maxy - miny + 1;
+	int yoffset = miny * texture->yprescale + texture->borderpix;
+	void *data;
+
+	assert(texture->type != TEXTURE_TYPE_DYNAMIC);
+	assert(miny >= 0 && maxy < texsource->height && miny <= maxy);
+
+	if (texture->nocopy)
+	{
+		// upload straight from the source rows
+		texture->data = (UINT32 *) texsource->base;
+		data = (UINT8 *)texsource->base + miny * texsource->rowpixels * srcpixelsize;
+	}
+	else
+	{
+		// copy (and convert) just the band of changed rows; the copy functions
+		// address rows relative to texture->data, so move it for the duration
+		render_texinfo band = *texsource;
+		UINT32 *fulldata = texture->data;
+
+		band.base = (UINT8 *)texsource->base + miny * texsource->rowpixels * srcpixelsize;
+		band.height = rows;
+		texture->data = (UINT32 *)((UINT8 *)fulldata + miny * texture->yprescale * texture->rawwidth * texture->texProperties[SDL_TEXFORMAT_PIXEL_SIZE]);
+		assert(texture->texCopyFn);
+		texture->texCopyFn(texture, &band);
+		texture->data = fulldata;
+
+		data = (UINT8 *)texture->data + yoffset * texture->rawwidth * texture->texProperties[SDL_TEXFORMAT_PIXEL_SIZE];
+	}
+
+	if ( texture->type == TEXTURE_TYPE_SHADER )
+	{
+		if ( texture->lut_texture )
+		{
+			pfn_glActiveTexture(GL_TEXTURE1);
+			glBindTexture(texture->texTarget, texture->lut_texture);
+
+			glPixelStorei(GL_UNPACK_ROW_LENGTH, texture->lut_table_width);
+
+			glTexSubImage2D(texture->texTarget, 0, 0, 0, texture->lut_table_width, texture->lut_table_height,
+				     GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, texsource->palette );
+		}
+		pfn_glActiveTexture(GL_TEXTURE0);
+		glBindTexture(texture->texTarget, texture->texture);
+
+		glPixelStorei(GL_UNPACK_ROW_LENGTH, texture->texinfo.rowpixels);
+
+		if(texture->format!=SDL_TEXFORMAT_PALETTE16)
+		{
+			glTexSubImage2D(texture->texTarget, 0, 0, yoffset, texture->rawwidth, rows * texture->yprescale,
+					texture->texProperties[SDL_TEXFORMAT_FORMAT],
+					texture->texProperties[SDL_TEXFORMAT_TYPE], data);
+		}
+		else
+		{
+			glTexSubImage2D(texture->texTarget, 0, 0, yoffset, texture->rawwidth, rows * texture->yprescale,
+					GL_ALPHA, GL_UNSIGNED_SHORT, data);
+		}
+	}
+	else
+	{
+		glBindTexture(texture->texTarget, texture->texture);
+
+		if (texture->nocopy)
+			glPixelStorei(GL_UNPACK_ROW_LENGTH, texture->texinfo.rowpixels);
+		else
+			glPixelStorei(GL_UNPACK_ROW_LENGTH, texture->rawwidth);
+
+		glTexSubImage2D(texture->texTarget, 0, 0, yoffset, texture->rawwidth, rows * texture->yprescale,
+		        texture->texProperties[SDL_TEXFORMAT_FORMAT],
+		texture->texProperties[SDL_TEXFORMAT_TYPE], data);
+	}
+}
+
 //============================================================
 //  texture_find
 //============================================================
@@ -3033,11 +3120,27 @@ static texture_info * texture_update(sdl_window_info *window, const render_primi
 		{
 			if (prim->texture.base != NULL && texture->texinfo.seqid != prim->texture.seqid)
 			{
+				UINT32 lastseqid = texture->texinfo.seqid;
+				INT32 miny, maxy;
+
 				texture->texinfo.seqid = prim->texture.seqid;
 
-				// if we found it, but with a different seqid, copy the data
-				texture_set_data(texture, &prim->texture);
-				texBound=1;
+				// if we found it, but with a different seqid, copy the data; when the core
+				// can tell which rows changed since our copy, refresh only those (PBOs are
+				// always refilled completely)
+				if (texture->type != TEXTURE_TYPE_DYNAMIC && prim->texture.dirty_rows(lastseqid, miny, maxy))
+				{
+					if (miny <= maxy)
+					{
+						texture_set_data_rows(texture, &prim->texture, miny, maxy);
+						texBound=1;
+					}
+				}
+				else
+				{
+					texture_set_data(texture, &prim->texture);
+					texBound=1;
+				}
 			}
 		}
 
@@ -24,6 +24,9 @@
 #endif
 
 #include <sys/stat.h>
+#if !defined(SDLMAME_WIN32) && !defined(SDLMAME_OS2)
+#include <sys/mman.h>
+#endif
 #include <fcntl.h>
 #include <unistd.h>
 #include <stdio.h>
@@ -160,6 +163,11 @@ file_error osd_open(const char *path, UINT32 openflags, osd_file **file, UINT64
 		goto error;
 	}
 
+#ifdef O_CLOEXEC
+	// keep our files out of any child processes we start
+	access |= O_CLOEXEC;
+#endif
+
 	tmpstr = (char *) osd_malloc_array(strlen((*file)->filename)+1);
 	strcpy(tmpstr, (*file)->filename);
 
@@ -387,6 +395,58 @@ file_error osd_close(osd_file *file)
     }
 }
 
+//============================================================
+//  osd_map
+//============================================================
+
+file_error osd_map(osd_file *file, UINT64 offset, UINT64 length, osd_mapping **mapping, void **base)
+{
+#if defined(SDLMAME_WIN32) || defined(SDLMAME_OS2)
+	return FILERR_FAILURE;
+#else
+	UINT64 delta = offset % sysconf(_SC_PAGESIZE);
+	size_t maplength = (size_t)(length + delta);
+	void *ptr;
+
+	// only plain files can be mapped, and only if they fit our address space
+	if (file->type != SDLFILE_FILE || length == 0 || maplength != length + delta)
+		return FILERR_FAILURE;
+
+	#if defined(SDLMAME_DARWIN) || defined(SDLMAME_NO64BITIO) || defined(SDLMAME_BSD) || defined(SDLMAME_HAIKU)
+	ptr = mmap(NULL, maplength, PROT_READ | PROT_WRITE, MAP_PRIVATE, file->handle, offset - delta);
+	#else
+	ptr = mmap64(NULL, maplength, PROT_READ | PROT_WRITE, MAP_PRIVATE, file->handle, offset - delta);
+	#endif
+	if (ptr == MAP_FAILED)
+		return error_to_file_error(errno);
+
+	*mapping = (osd_mapping *) osd_malloc(sizeof(**mapping));
+	if (*mapping == NULL)
+	{
+		munmap(ptr, maplength);
+		return FILERR_OUT_OF_MEMORY;
+	}
+	(*mapping)->base = ptr;
+	(*mapping)->length = maplength;
+
+	*base = (UINT8 *)ptr + delta;
+	return FILERR_NONE;
+#endif
+}
+
+
+//============================================================
+//  osd_unmap
+//============================================================
+
+void osd_unmap(osd_mapping *mapping)
+{
+#if !defined(SDLMAME_WIN32) && !defined(SDLMAME_OS2)
+	munmap(mapping->base, mapping->length);
+#endif
+	osd_free(mapping);
+}
+
 //============================================================
 //  osd_rmfile
 //============================================================
@@ -401,6 +461,25 @@ file_error osd_rmfile(const char *filename)
 	return FILERR_NONE;
 }
 
+//============================================================
+//  osd_rename
+//============================================================
+
+file_error osd_rename(const char *oldname, const char *newname)
+{
+	#if defined(SDLMAME_WIN32) || defined(SDLMAME_OS2)
+	// rename() won't replace an existing file here
+	unlink(newname);
+	#endif
+
+	if (rename(oldname, newname) == -1)
+	{
+		return error_to_file_error(errno);
+	}
+
+	return FILERR_NONE;
+}
+
 //============================================================
 //  create_path_recursive
 //============================================================
@@ -33,6 +33,12 @@ struct _osd_file
 	char	filename[1];
 };
 
+struct _osd_mapping
+{
+	void *	base;		// page-aligned base of the mapping
+	size_t	length;		// length of the mapping in bytes
+};
+
 //============================================================
 //  PROTOTYPES
 //============================================================
@@ -58,3 +58,53 @@ void osd_break_into_debugger(const char *message)
 	printf("Ignoring MAME exception: %s\n", message);
 }
 
+
+//============================================================
+//  TYPE DEFINITIONS
+//============================================================
+
+struct _osd_process
+{
+	int			state;		// OSD_PROCESS_* state
+};
+
+
+//============================================================
+//  osd_process_create
+//============================================================
+
+osd_process *osd_process_create(const char *const *argv, const char *logpath)
+{
+	// not supported on this platform
+	return NULL;
+}
+
+
+//============================================================
+//  osd_process_wait
+//============================================================
+
+int osd_process_wait(osd_process *process, osd_ticks_t timeout, int *result)
+{
+	*result = 0;
+	return OSD_PROCESS_EXITED;
+}
+
+
+//============================================================
+//  osd_process_kill
+//============================================================
+
+void osd_process_kill(osd_process *process)
+{
+}
+
+
+//============================================================
+//  osd_process_free
+//============================================================
+
+void osd_process_free(osd_process *process)
+{
+	osd_free(process);
+}
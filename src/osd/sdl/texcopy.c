@@ -250,11 +250,17 @@ static void FUNC_NAME(texcopy)(texture_info *texture, const render_texinfo *texs
 		switch(texture->xprescale)
 		{
 		case 1:
+#ifdef TEXSRC_ROW_TO_DEST
+			TEXSRC_ROW_TO_DEST(dst, src, texsource->width);
+			dst += texsource->width;
+			src += texsource->width;
+#else
 			for (x = 0; x < texsource->width; x++)
 			{
 				*dst++ = TEXSRC_TO_DEST(*src);
 				src++;
 			}
+#endif
 			break;
 		case 2:
 			for (x = 0; x < texsource->width; x++)
@@ -19,6 +19,10 @@
 #undef SRC_EQUALS_DEST
 #endif
 
+#ifdef TEXSRC_ROW_TO_DEST
+#undef TEXSRC_ROW_TO_DEST
+#endif
+
 #ifdef FUNC_NAME
 #undef FUNC_NAME
 #endif
@@ -51,6 +55,8 @@
 	#define TEXSRC_TYPE UINT16
 	#define TEXSRC_TO_DEST(src) \
 		(0xff000000 | texsource->palette[src])
+	#define TEXSRC_ROW_TO_DEST(dst, src, count) \
+		palette_lookup_row(dst, src, count, texsource->palette, 0xff000000)
 	#define FUNC_NAME(name) name ## _palette16
 #elif SDL_TEXFORMAT == SDL_TEXFORMAT_PALETTE16A
 	#define DEST_TYPE UINT32
@@ -58,6 +64,8 @@
 	#define TEXSRC_TYPE UINT16
 	#define TEXSRC_TO_DEST(src) \
 		(texsource->palette[src])
+	#define TEXSRC_ROW_TO_DEST(dst, src, count) \
+		palette_lookup_row(dst, src, count, texsource->palette, 0)
 	#define FUNC_NAME(name) name ## _palette16a
 #elif SDL_TEXFORMAT == SDL_TEXFORMAT_RGB15
 	#define DEST_TYPE UINT32
@@ -1974,15 +1974,12 @@ static void texture_compute_size(d3d_info *d3d, int texwidth, int texheight, d3d
 
 INLINE void copyline_palette16(UINT32 *dst, const UINT16 *src, int width, const rgb_t *palette, int xborderpix)
 {
-	int x;
-
 	assert(xborderpix == 0 || xborderpix == 1);
 	if (xborderpix)
 		*dst++ = 0xff000000 | palette[*src];
-	for (x = 0; x < width; x++)
-		*dst++ = 0xff000000 | palette[*src++];
+	palette_lookup_row(dst, src, width, palette, 0xff000000);
 	if (xborderpix)
-		*dst++ = 0xff000000 | palette[*--src];
+		dst[width] = 0xff000000 | palette[src[width - 1]];
 }
 
 
@@ -1993,15 +1990,12 @@ INLINE void copyline_palette16(UINT32 *dst, const UINT16 *src, int width, const
 
 INLINE void copyline_palettea16(UINT32 *dst, const UINT16 *src, int width, const rgb_t *palette, int xborderpix)
 {
-	int x;
-
 	assert(xborderpix == 0 || xborderpix == 1);
 	if (xborderpix)
 		*dst++ = palette[*src];
-	for (x = 0; x < width; x++)
-		*dst++ = palette[*src++];
+	palette_lookup_row(dst, src, width, palette, 0);
 	if (xborderpix)
-		*dst++ = palette[*--src];
+		dst[width] = palette[src[width - 1]];
 }
 
 
@@ -293,6 +293,70 @@ file_error osd_close(osd_file *file)
 }
 
 
+//============================================================
+//  osd_map
+//============================================================
+
+file_error osd_map(osd_file *file, UINT64 offset, UINT64 length, osd_mapping **mapping, void **base)
+{
+	SYSTEM_INFO sysinfo;
+	UINT64 delta, start;
+	SIZE_T maplength;
+	HANDLE handle;
+	void *view;
+
+	// only plain files can be mapped
+	if (file->type != WINFILE_FILE || length == 0)
+		return FILERR_FAILURE;
+
+	// views must start on an allocation granularity boundary
+	GetSystemInfo(&sysinfo);
+	delta = offset % sysinfo.dwAllocationGranularity;
+	start = offset - delta;
+	maplength = (SIZE_T)(length + delta);
+	if (maplength != length + delta)
+		return FILERR_FAILURE;
+
+	// create a copy-on-write mapping and a view of the requested range
+	handle = CreateFileMapping(file->handle, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+	if (handle == NULL)
+		return win_error_to_mame_file_error(GetLastError());
+	view = MapViewOfFile(handle, FILE_MAP_COPY, (DWORD)(start >> 32), (DWORD)start, maplength);
+	if (view == NULL)
+	{
+		DWORD error = GetLastError();
+		CloseHandle(handle);
+		return win_error_to_mame_file_error(error);
+	}
+
+	// allocate the mapping object
+	*mapping = (osd_mapping *)malloc(sizeof(**mapping));
+	if (*mapping == NULL)
+	{
+		UnmapViewOfFile(view);
+		CloseHandle(handle);
+		return FILERR_OUT_OF_MEMORY;
+	}
+	(*mapping)->handle = handle;
+	(*mapping)->view = view;
+
+	*base = (UINT8 *)view + delta;
+	return FILERR_NONE;
+}
+
+
+//============================================================
+//  osd_unmap
+//============================================================
+
+void osd_unmap(osd_mapping *mapping)
+{
+	UnmapViewOfFile(mapping->view);
+	CloseHandle(mapping->handle);
+	free(mapping);
+}
+
+
 //============================================================
 //  osd_rmfile
 //============================================================
@@ -321,6 +385,37 @@ done:
 }
 
 
+//============================================================
+//  osd_rename
+//============================================================
+
+file_error osd_rename(const char *oldname, const char *newname)
+{
+	file_error filerr = FILERR_NONE;
+
+	TCHAR *tempold = tstring_from_utf8(oldname);
+	TCHAR *tempnew = tstring_from_utf8(newname);
+	if (!tempold || !tempnew)
+	{
+		filerr = FILERR_OUT_OF_MEMORY;
+		goto done;
+	}
+
+	if (!MoveFileEx(tempold, tempnew, MOVEFILE_REPLACE_EXISTING))
+	{
+		filerr = win_error_to_file_error(GetLastError());
+		goto done;
+	}
+
+done:
+	if (tempold)
+		osd_free(tempold);
+	if (tempnew)
+		osd_free(tempnew);
+	return filerr;
+}
+
+
 //============================================================
 //  osd_get_physical_drive_geometry
 //============================================================
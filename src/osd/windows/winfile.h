@@ -31,6 +31,12 @@ struct _osd_file
 	TCHAR		filename[1];
 };
 
+struct _osd_mapping
+{
+	HANDLE		handle;		// file mapping object
+	void *		view;		// base of the mapped view
+};
+
 //============================================================
 //  PROTOTYPES
 //============================================================
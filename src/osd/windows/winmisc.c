@@ -189,3 +189,177 @@ void osd_break_into_debugger(const char *message)
 	else if (s_debugger_stack_crawler != NULL)
 		(*s_debugger_stack_crawler)();
 }
+
+
+//============================================================
+//  TYPE DEFINITIONS
+//============================================================
+
+struct _osd_process
+{
+	HANDLE		handle;		// handle to the child process
+	int			state;		// OSD_PROCESS_* state
+	int			result;		// exit code or exception number once finished
+};
+
+
+//============================================================
+//  append_quoted_arg
+//============================================================
+
+static char *append_quoted_arg(char *dst, const char *arg)
+{
+	int backslashes = 0;
+
+	// quote every argument the way the C runtime splits them again
+	*dst++ = '"';
+	for ( ; *arg != 0; arg++)
+	{
+		if (*arg == '\\')
+			backslashes++;
+		else
+		{
+			if (*arg == '"')
+			{
+				for (backslashes = backslashes * 2 + 1; backslashes > 0; backslashes--)
+					*dst++ = '\\';
+			}
+			backslashes = 0;
+		}
+		*dst++ = *arg;
+	}
+	while (backslashes-- > 0)
+		*dst++ = '\\';
+	*dst++ = '"';
+	return dst;
+}
+
+
+//============================================================
+//  osd_process_create
+//============================================================
+
+osd_process *osd_process_create(const char *const *argv, const char *logpath)
+{
+	SECURITY_ATTRIBUTES sa = { sizeof(sa), NULL, TRUE };
+	STARTUPINFO si = { sizeof(si) };
+	PROCESS_INFORMATION pi;
+	HANDLE log = INVALID_HANDLE_VALUE;
+	osd_process *process;
+	size_t length = 1;
+	char *command, *dst;
+	BOOL result;
+	int argnum;
+
+	// build a command line; each character may need escaping plus quotes
+	for (argnum = 0; argv[argnum] != NULL; argnum++)
+		length += 2 * strlen(argv[argnum]) + 3;
+	command = (char *)osd_malloc(length);
+	if (command == NULL)
+		return NULL;
+	dst = command;
+	for (argnum = 0; argv[argnum] != NULL; argnum++)
+	{
+		if (argnum != 0)
+			*dst++ = ' ';
+		dst = append_quoted_arg(dst, argv[argnum]);
+	}
+	*dst = 0;
+
+	// the log is opened inheritable and handed over as stdout/stderr
+	if (logpath != NULL)
+	{
+		TCHAR *t_logpath = tstring_from_utf8(logpath);
+		if (t_logpath != NULL)
+		{
+			log = CreateFile(t_logpath, GENERIC_WRITE, FILE_SHARE_READ, &sa, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+			osd_free(t_logpath);
+		}
+		if (log == INVALID_HANDLE_VALUE)
+		{
+			osd_free(command);
+			return NULL;
+		}
+		si.dwFlags = STARTF_USESTDHANDLES;
+		si.hStdInput = GetStdHandle(STD_INPUT_HANDLE);
+		si.hStdOutput = log;
+		si.hStdError = log;
+	}
+
+	TCHAR *t_command = tstring_from_utf8(command);
+	result = FALSE;
+	if (t_command != NULL)
+	{
+		result = CreateProcess(NULL, t_command, NULL, NULL, TRUE, 0, NULL, NULL, &si, &pi);
+		osd_free(t_command);
+	}
+	osd_free(command);
+	if (log != INVALID_HANDLE_VALUE)
+		CloseHandle(log);
+	if (!result)
+		return NULL;
+
+	CloseHandle(pi.hThread);
+	process = (osd_process *)osd_malloc(sizeof(*process));
+	if (process == NULL)
+	{
+		TerminateProcess(pi.hProcess, 1);
+		CloseHandle(pi.hProcess);
+		return NULL;
+	}
+	process->handle = pi.hProcess;
+	process->state = OSD_PROCESS_RUNNING;
+	process->result = 0;
+	return process;
+}
+
+
+//============================================================
+//  osd_process_wait
+//============================================================
+
+int osd_process_wait(osd_process *process, osd_ticks_t timeout, int *result)
+{
+	if (process->state == OSD_PROCESS_RUNNING)
+	{
+		DWORD ms = (DWORD)(timeout * 1000 / osd_ticks_per_second());
+		DWORD code;
+
+		if (WaitForSingleObject(process->handle, ms) == WAIT_OBJECT_0 && GetExitCodeProcess(process->handle, &code))
+		{
+			// NTSTATUS error codes (access violations and the like) mean a crash
+			process->state = ((code & 0xc0000000) == 0xc0000000) ? OSD_PROCESS_CRASHED : OSD_PROCESS_EXITED;
+			process->result = (int)code;
+		}
+	}
+
+	*result = process->result;
+	return process->state;
+}
+
+
+//============================================================
+//  osd_process_kill
+//============================================================
+
+void osd_process_kill(osd_process *process)
+{
+	if (process->state == OSD_PROCESS_RUNNING)
+		TerminateProcess(process->handle, 1);
+}
+
+
+//============================================================
+//  osd_process_free
+//============================================================
+
+void osd_process_free(osd_process *process)
+{
+	if (process->state == OSD_PROCESS_RUNNING)
+	{
+		TerminateProcess(process->handle, 1);
+		WaitForSingleObject(process->handle, INFINITE);
+	}
+	CloseHandle(process->handle);
+	osd_free(process);
+}
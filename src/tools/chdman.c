@@ -103,6 +103,7 @@ const int MODE_GDI = 2;
 #define OPTION_HUNK_SIZE "hunksize"
 #define OPTION_UNIT_SIZE "unitsize"
 #define OPTION_COMPRESSION "compression"
+#define OPTION_DECODE_WEIGHT "decodeweight"
 #define OPTION_INPUT_PARENT "inputparent"
 #define OPTION_OUTPUT_PARENT "outputparent"
 #define OPTION_IDENT "ident"
@@ -512,6 +513,7 @@ static const option_description s_options[] =
 	{ OPTION_HUNK_SIZE,				"hs",	true, " <bytes>: size of each hunk, in bytes" },
 	{ OPTION_UNIT_SIZE,				"us",	true, " <bytes>: size of each unit, in bytes" },
 	{ OPTION_COMPRESSION,			"c",	true, " <none|type1[,type2[,...]]>: which compression codecs to use (up to 4)" },
+	{ OPTION_DECODE_WEIGHT,			"dw",	true, " <bytes>: favor faster-decoding codecs; each microsecond a hunk typically takes to decode costs this many bytes" },
 	{ OPTION_IDENT,					"id",	true, " <filename>: name of ident file to provide CHS information" },
 	{ OPTION_CHS,					"chs",	true, " <cylinders,heads,sectors>: specifies CHS values directly" },
 	{ OPTION_SECTOR_SIZE,			"ss",	true, " <bytes>: size of each hard disk sector" },
@@ -556,6 +558,7 @@ static const command_description s_commands[] =
 			REQUIRED OPTION_HUNK_SIZE,
 			REQUIRED OPTION_UNIT_SIZE,
 			OPTION_COMPRESSION,
+			OPTION_DECODE_WEIGHT,
 			OPTION_NUMPROCESSORS
 		}
 	},
@@ -572,6 +575,7 @@ static const command_description s_commands[] =
 			OPTION_INPUT_LENGTH_HUNKS,
 			OPTION_HUNK_SIZE,
 			OPTION_COMPRESSION,
+			OPTION_DECODE_WEIGHT,
 			OPTION_IDENT,
 			OPTION_CHS,
 			OPTION_SECTOR_SIZE,
@@ -587,6 +591,7 @@ static const command_description s_commands[] =
 			REQUIRED OPTION_INPUT,
 			OPTION_HUNK_SIZE,
 			OPTION_COMPRESSION,
+			OPTION_DECODE_WEIGHT,
 			OPTION_NUMPROCESSORS
 		}
 	},
@@ -665,6 +670,7 @@ static const command_description s_commands[] =
 			OPTION_INPUT_LENGTH_HUNKS,
 			OPTION_HUNK_SIZE,
 			OPTION_COMPRESSION,
+			OPTION_DECODE_WEIGHT,
 			OPTION_NUMPROCESSORS
 		}
 	},
@@ -1140,8 +1146,18 @@ static const char *compression_string(astring &string, chd_codec_type compressio
 //  compress_common - standard compression loop
 //-------------------------------------------------
 
-static void compress_common(chd_file_compressor &chd)
+static void compress_common(chd_file_compressor &chd, const parameters_t &params)
 {
+	// trade size for decode speed if requested
+	astring *decode_weight_str = params.find(OPTION_DECODE_WEIGHT);
+	if (decode_weight_str != NULL)
+	{
+		double weight = atof(*decode_weight_str);
+		if (weight < 0)
+			report_error(1, "Invalid decode weight '%s' specified", decode_weight_str->cstr());
+		chd.set_decode_weight(weight);
+	}
+
 	// begin compressing
 	chd.compress_begin();
 
@@ -1160,6 +1176,18 @@ static void compress_common(chd_file_compressor &chd)
 
 	// final progress update
 	progress(true, "Compression complete ... final ratio = %.1f%%            \n", 100.0 * ratio);
+
+	// report what the decode timing found
+	if (chd.decode_weight() > 0)
+		for (int codecnum = 0; codecnum < 4 && chd.compression(codecnum) != CHD_CODEC_NONE; codecnum++)
+		{
+			UINT64 decoded, chosen;
+			osd_ticks_t ticks;
+			chd.decode_stats(codecnum, decoded, chosen, ticks);
+			double seconds = double(ticks) / double(osd_ticks_per_second());
+			printf("%-12s decode: %8.1f MB/s, chosen for %" I64FMT "u hunks\n", chd_codec_list::codec_name(chd.compression(codecnum)),
+					(seconds > 0) ? double(decoded) * double(chd.hunk_bytes()) / (seconds * 1000000.0) : 0.0, chosen);
+		}
 }
 
 
@@ -1472,8 +1500,8 @@ static void do_verify(parameters_t &params)
 	// create an array to read into
 	dynamic_buffer buffer((TEMP_BUFFER_SIZE / input_chd.hunk_bytes()) * input_chd.hunk_bytes());
 
-	// read all the data and build up an SHA-1
-	sha1_creator rawsha1;
+	// read all the data and build up an SHA-1; the reader decompresses and hashes on other threads
+	chd_parallel_reader reader(input_chd, true);
 	for (UINT64 offset = 0; offset < input_chd.logical_bytes(); )
 	{
 		progress(false, "Verifying, %.1f%% complete... \r", 100.0 * double(offset) / double(input_chd.logical_bytes()));
@@ -1484,11 +1512,9 @@ static void do_verify(parameters_t &params)
 		if (err != CHDERR_NONE)
 			report_error(1, "Error reading CHD file (%s): %s", params.find(OPTION_INPUT)->cstr(), chd_file::error_string(err));
 
-		// add to the checksum
-		rawsha1.append(buffer, bytes_to_read);
 		offset += bytes_to_read;
 	}
-	sha1_t computed_sha1 = rawsha1.finish();
+	sha1_t computed_sha1 = reader.raw_sha1();
 
 	// finish up
 	if (raw_sha1 != computed_sha1)
@@ -1614,7 +1640,7 @@ static void do_create_raw(parameters_t &params)
 			chd->clone_all_metadata(output_parent);
 
 		// compress it generically
-		compress_common(*chd);
+		compress_common(*chd, params);
 		delete chd;
 	}
 	catch (...)
@@ -1787,7 +1813,7 @@ static void do_create_hd(parameters_t &params)
 
 		// compress it generically
 		if (input_file != NULL)
-			compress_common(*chd);
+			compress_common(*chd, params);
 		delete chd;
 	}
 	catch (...)
@@ -1879,7 +1905,7 @@ static void do_create_cd(parameters_t &params)
 			report_error(1, "Error adding CD metadata: %s", chd_file::error_string(err));
 
 		// compress it generically
-		compress_common(*chd);
+		compress_common(*chd, params);
 		delete chd;
 	}
 	catch (...)
@@ -1996,7 +2022,7 @@ static void do_create_ld(parameters_t &params)
 			report_error(1, "Error adding AV metadata: %s\n", chd_file::error_string(err));
 
 		// create the compressor and then run it generically
-		compress_common(*chd);
+		compress_common(*chd, params);
 
 		// write the final LD metadata
 		if (info.height == 524/2 || info.height == 624/2)
@@ -2128,8 +2154,9 @@ static void do_copy(parameters_t &params)
 				report_error(1, "Error writing upgraded CD metadata: %s", chd_file::error_string(err));
 		}
 
-		// compress it generically
-		compress_common(*chd);
+		// compress it generically, decompressing the input on other threads
+		chd_parallel_reader reader(input_chd);
+		compress_common(*chd, params);
 		delete chd;
 	}
 	catch (...)
@@ -2185,7 +2212,8 @@ static void do_extract_raw(parameters_t &params)
 		if (filerr != FILERR_NONE)
 			report_error(1, "Unable to open file (%s)", output_file_str->cstr());
 
-		// copy all data
+		// copy all data, decompressing on other threads
+		chd_parallel_reader reader(input_chd);
 		dynamic_buffer buffer((TEMP_BUFFER_SIZE / input_chd.hunk_bytes()) * input_chd.hunk_bytes());
 		for (UINT64 offset = input_start; offset < input_end; )
 		{
@@ -2305,7 +2333,8 @@ static void do_extract_cd(parameters_t &params)
 			core_fprintf(output_toc_file, "%d\n", toc->numtrks);
 		}
 
-		// iterate over tracks and copy all data
+		// iterate over tracks and copy all data, decompressing on other threads
+		chd_parallel_reader reader(input_chd);
 		UINT64 outputoffs = 0;
 		UINT32 discoffs = 0;
 		dynamic_buffer buffer;
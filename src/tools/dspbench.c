@@ -0,0 +1,413 @@
+/***************************************************************************
+
+    dspbench.c
+
+    SCSP/AICA DSP benchmark and comparison tool.
+
+****************************************************************************
+
+    Copyright Aaron Giles
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are
+    met:
+
+        * Redistributions of source code must retain the above copyright
+          notice, this list of conditions and the following disclaimer.
+        * Redistributions in binary form must reproduce the above copyright
+          notice, this list of conditions and the following disclaimer in
+          the documentation and/or other materials provided with the
+          distribution.
+        * Neither the name 'MAME' nor the names of its contributors may be
+          used to endorse or promote products derived from this software
+          without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY AARON GILES ''AS IS'' AND ANY EXPRESS OR
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL AARON GILES BE LIABLE FOR ANY DIRECT,
+    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+    HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+    STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+    IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+    POSSIBILITY OF SUCH DAMAGE.
+
+****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "emu.h"
+#include "dspbench.h"
+
+#define DEFAULT_PROGRAMS		1000
+#define DEFAULT_SAMPLES			1024
+
+
+
+/***************************************************************************
+    GLOBAL VARIABLES
+***************************************************************************/
+
+static const dspbench_dsp *const dsp_list[] =
+{
+	&dspbench_scsp,
+	&dspbench_aica
+};
+
+static UINT32 random_state;
+
+
+
+/***************************************************************************
+    TEST PROGRAMS
+***************************************************************************/
+
+/*-------------------------------------------------
+    random_next - deterministic pseudo-random
+    numbers, so a seed always gives the same
+    programs
+-------------------------------------------------*/
+
+static UINT32 random_next(void)
+{
+	random_state = random_state * 1103515245 + 12345;
+	return random_state >> 8;
+}
+
+
+/*-------------------------------------------------
+    random_bit - a flag that is set one time in
+    'odds'
+-------------------------------------------------*/
+
+static UINT8 random_bit(int odds)
+{
+	return (random_next() % odds) == 0;
+}
+
+
+/*-------------------------------------------------
+    random_24bit - a sign-extended 24-bit value
+-------------------------------------------------*/
+
+static INT32 random_24bit(void)
+{
+	return (INT32)(random_next() << 8) >> 8;
+}
+
+
+/*-------------------------------------------------
+    random_step - pick a step; every register
+    write is set on a fraction of the steps so
+    programs mix live steps with steps the
+    compiler can drop, and some steps are NOPs
+-------------------------------------------------*/
+
+static void random_step(const dspbench_dsp *dsp, dspbench_step *step)
+{
+	memset(step, 0, sizeof(*step));
+	if (random_bit(8))
+		return;
+
+	step->TRA = random_next() & 0x7f;
+	step->TWT = random_bit(4);
+	step->TWA = random_next() & 0x7f;
+
+	step->XSEL = random_next() & 1;
+	step->YSEL = random_next() & 3;
+	if ((dsp->flags & DSPBENCH_FLAG_BAD_IRA) && random_bit(256))
+		step->IRA = 0x32 + random_next() % 14;
+	else
+		step->IRA = random_next() % 0x32;
+	step->IWT = random_bit(4);
+	step->IWA = random_next() & 0x1f;
+
+	step->TABLE = random_next() & 1;
+	step->MWT = random_bit(4);
+	step->MRD = random_bit(3);
+	step->EWT = random_bit(4);
+	step->EWA = random_next() & 0x0f;
+	step->ADRL = random_bit(4);
+	step->FRCL = random_bit(4);
+	step->SHIFT = random_next() & 3;
+	step->YRL = random_bit(4);
+	step->NEGB = random_next() & 1;
+	step->ZERO = random_bit(4);
+	step->BSEL = random_next() & 1;
+
+	step->NOFL = random_bit(4);
+	step->COEF = random_next() & 0x3f;
+	step->MASA = random_next() & 0x1f;
+	step->ADREB = random_next() & 1;
+	step->NXADR = random_next() & 1;
+}
+
+
+/*-------------------------------------------------
+    random_program - pick a program of 1 to 128
+    steps and the registers it starts from
+-------------------------------------------------*/
+
+static void random_program(const dspbench_dsp *dsp, dspbench_program *program)
+{
+	int length = 1 + random_next() % 128;
+	int i;
+
+	memset(program, 0, sizeof(*program));
+	for (i = 0; i < length; i++)
+		random_step(dsp, &program->step[i]);
+	for (i = 0; i < ARRAY_LENGTH(program->coef); i++)
+		program->coef[i] = random_next();
+	for (i = 0; i < ARRAY_LENGTH(program->madrs); i++)
+		program->madrs[i] = random_next();
+	for (i = 0; i < ARRAY_LENGTH(program->temp); i++)
+		program->temp[i] = random_24bit();
+	for (i = 0; i < ARRAY_LENGTH(program->mems); i++)
+		program->mems[i] = random_24bit();
+
+	// RBP stays small enough for every address to land in DSPBENCH_RAM_WORDS
+	program->rbp = random_next() & 0x3f;
+	program->rbl = 0x2000 << (random_next() & 3);
+	program->dec = random_next();
+}
+
+
+/*-------------------------------------------------
+    random_inputs - add a few 20-bit samples to
+    the MIXS inputs of one or two DSPs
+-------------------------------------------------*/
+
+static void random_inputs(const dspbench_dsp *dsp, void *dspa, void *dspb)
+{
+	int inputs = random_next() % 4;
+
+	while (inputs-- != 0)
+	{
+		int sel = random_next() & 0x0f;
+		INT32 sample = (INT32)(random_next() << 12) >> 12;
+
+		(*dsp->input)(dspa, sel, sample);
+		if (dspb != NULL)
+			(*dsp->input)(dspb, sel, sample);
+	}
+}
+
+
+/*-------------------------------------------------
+    random_ram - allocate sound RAM filled with
+    random words
+-------------------------------------------------*/
+
+static UINT16 *random_ram(void)
+{
+	UINT16 *ram = (UINT16 *)osd_malloc(DSPBENCH_RAM_WORDS * sizeof(UINT16));
+
+	for (int i = 0; i < DSPBENCH_RAM_WORDS; i++)
+		ram[i] = random_next();
+	return ram;
+}
+
+
+
+/***************************************************************************
+    CORE IMPLEMENTATION
+***************************************************************************/
+
+/*-------------------------------------------------
+    compare_dsp - run the same random programs
+    through the compiled step list and the old
+    interpreter, rewriting steps now and then as
+    a running game would, and compare the DSP
+    state after every sample
+-------------------------------------------------*/
+
+static bool compare_dsp(const dspbench_dsp *dsp, int programs, int samples, UINT32 seed)
+{
+	static dspbench_program program;
+	void *newdsp = (*dsp->create)();
+	void *refdsp = (*dsp->create)();
+	UINT16 *ram;
+	UINT32 patches = 0;
+	bool result = true;
+
+	random_state = seed;
+	ram = random_ram();
+	(*dsp->load_ram)(newdsp, ram);
+	(*dsp->load_ram)(refdsp, ram);
+	osd_free(ram);
+
+	for (int prognum = 0; prognum < programs && result; prognum++)
+	{
+		random_program(dsp, &program);
+		(*dsp->load)(newdsp, &program);
+		(*dsp->load)(refdsp, &program);
+
+		for (int sample = 0; sample < samples; sample++)
+		{
+			const char *differs;
+
+			random_inputs(dsp, newdsp, refdsp);
+			if (random_bit(64))
+			{
+				dspbench_step step;
+				int index = random_next() % 128;
+
+				random_step(dsp, &step);
+				(*dsp->patch)(newdsp, index, &step);
+				(*dsp->patch)(refdsp, index, &step);
+				patches++;
+			}
+
+			(*dsp->step)(newdsp);
+			(*dsp->reference)(refdsp);
+
+			// sound RAM is only compared once per program
+			differs = (*dsp->compare)(newdsp, refdsp, sample == samples - 1);
+			if (differs != NULL)
+			{
+				printf("%-5s MISMATCH program %d sample %d: %s differs between compiled and interpreted\n", dsp->name, prognum, sample, differs);
+				result = false;
+				break;
+			}
+		}
+	}
+
+	if (result)
+		printf("%-5s %d programs x %d samples identical (%u steps rewritten while running)\n", dsp->name, programs, samples, patches);
+
+	(*dsp->destroy)(newdsp);
+	(*dsp->destroy)(refdsp);
+	return result;
+}
+
+
+/*-------------------------------------------------
+    time_path - run random programs through one
+    of the paths and return the ticks spent
+    stepping the DSP
+-------------------------------------------------*/
+
+static osd_ticks_t time_path(const dspbench_dsp *dsp, bool reference, int programs, int samples, UINT32 seed)
+{
+	static dspbench_program program;
+	void *param = (*dsp->create)();
+	void (*step)(void *) = reference ? dsp->reference : dsp->step;
+	osd_ticks_t elapsed = 0;
+	UINT16 *ram;
+
+	random_state = seed;
+	ram = random_ram();
+	(*dsp->load_ram)(param, ram);
+	osd_free(ram);
+
+	for (int prognum = 0; prognum < programs; prognum++)
+	{
+		osd_ticks_t start;
+
+		random_program(dsp, &program);
+		(*dsp->load)(param, &program);
+
+		start = osd_ticks();
+		for (int sample = 0; sample < samples; sample++)
+		{
+			random_inputs(dsp, param, NULL);
+			(*step)(param);
+		}
+		elapsed += osd_ticks() - start;
+	}
+
+	(*dsp->destroy)(param);
+	return elapsed;
+}
+
+
+/*-------------------------------------------------
+    bench_dsp - time both paths
+-------------------------------------------------*/
+
+static void bench_dsp(const dspbench_dsp *dsp, int programs, int samples, UINT32 seed)
+{
+	double tps = (double)osd_ticks_per_second();
+	osd_ticks_t newticks = time_path(dsp, false, programs, samples, seed);
+	osd_ticks_t refticks = time_path(dsp, true, programs, samples, seed);
+
+	printf("%-5s %d programs x %d samples: compiled %8.3f ms, interpreter %8.3f ms, speedup %.2fx\n",
+			dsp->name, programs, samples,
+			(double)newticks * 1000.0 / tps, (double)refticks * 1000.0 / tps,
+			(newticks != 0) ? (double)refticks / (double)newticks : 0.0);
+}
+
+
+/*-------------------------------------------------
+    main - main entry point
+-------------------------------------------------*/
+
+int main(int argc, char *argv[])
+{
+	int programs = DEFAULT_PROGRAMS;
+	int samples = DEFAULT_SAMPLES;
+	UINT32 seed = 1;
+	int firstdsp = argc;
+	int result = 0;
+	int matched = 0;
+
+	// parse options
+	for (int argnum = 1; argnum < argc; argnum++)
+	{
+		if (strcmp(argv[argnum], "-programs") == 0 && argnum + 1 < argc)
+			programs = atoi(argv[++argnum]);
+		else if (strcmp(argv[argnum], "-samples") == 0 && argnum + 1 < argc)
+			samples = atoi(argv[++argnum]);
+		else if (strcmp(argv[argnum], "-seed") == 0 && argnum + 1 < argc)
+			seed = strtoul(argv[++argnum], NULL, 0);
+		else if (argv[argnum][0] == '-')
+		{
+			fprintf(stderr, "Usage:\n  dspbench [-programs <n>] [-samples <n>] [-seed <n>] [dsp ...]\n\n");
+			fprintf(stderr, "Runs random MPRO programs through the compiled step list and the old\n");
+			fprintf(stderr, "interpreter of each sound DSP, checks that the DSP state matches after every\n");
+			fprintf(stderr, "sample, and times both. DSPs:");
+			for (int dspnum = 0; dspnum < ARRAY_LENGTH(dsp_list); dspnum++)
+				fprintf(stderr, " %s", dsp_list[dspnum]->name);
+			fprintf(stderr, "\n");
+			return 1;
+		}
+		else if (firstdsp == argc)
+			firstdsp = argnum;
+	}
+	if (programs <= 0)
+		programs = DEFAULT_PROGRAMS;
+	if (samples <= 0)
+		samples = DEFAULT_SAMPLES;
+
+	for (int dspnum = 0; dspnum < ARRAY_LENGTH(dsp_list); dspnum++)
+	{
+		const dspbench_dsp *dsp = dsp_list[dspnum];
+
+		// only the DSPs named on the command line, if any
+		if (firstdsp < argc)
+		{
+			int argnum;
+			for (argnum = firstdsp; argnum < argc; argnum++)
+				if (core_stricmp(argv[argnum], dsp->name) == 0)
+					break;
+			if (argnum == argc)
+				continue;
+		}
+		matched++;
+
+		if (!compare_dsp(dsp, programs, samples, seed))
+			result = 1;
+		bench_dsp(dsp, programs, samples, seed);
+	}
+
+	if (matched == 0)
+	{
+		fprintf(stderr, "No matching DSPs\n");
+		return 1;
+	}
+	return result;
+}
@@ -0,0 +1,132 @@
+/***************************************************************************
+
+    dspbench.h
+
+    SCSP/AICA DSP benchmark and comparison tool.
+
+****************************************************************************
+
+    Copyright Aaron Giles
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are
+    met:
+
+        * Redistributions of source code must retain the above copyright
+          notice, this list of conditions and the following disclaimer.
+        * Redistributions in binary form must reproduce the above copyright
+          notice, this list of conditions and the following disclaimer in
+          the documentation and/or other materials provided with the
+          distribution.
+        * Neither the name 'MAME' nor the names of its contributors may be
+          used to endorse or promote products derived from this software
+          without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY AARON GILES ''AS IS'' AND ANY EXPRESS OR
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL AARON GILES BE LIABLE FOR ANY DIRECT,
+    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+    HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+    STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+    IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+    POSSIBILITY OF SUCH DAMAGE.
+
+****************************************************************************
+
+    Each DSP core is compiled into its own translation unit together with
+    a copy of the per-step interpreter it used before MPRO programs were
+    compiled into step lists. The tool loads the same random programs into
+    both and compares the DSP state after every sample.
+
+***************************************************************************/
+
+#pragma once
+
+#ifndef __DSPBENCH_H__
+#define __DSPBENCH_H__
+
+#include "osdcore.h"
+
+
+/***************************************************************************
+    CONSTANTS
+***************************************************************************/
+
+/* words of sound RAM given to each DSP; enough for any RBP the tool picks */
+#define DSPBENCH_RAM_WORDS		0x80000
+
+/* DSP features */
+#define DSPBENCH_FLAG_BAD_IRA	0x01	/* an IRA past 0x31 is defined behaviour */
+
+
+
+/***************************************************************************
+    TYPE DEFINITIONS
+***************************************************************************/
+
+/* one MPRO step, as separate fields; each core encodes them its own way */
+struct dspbench_step
+{
+	UINT8			TRA, TWT, TWA;
+	UINT8			XSEL, YSEL, IRA, IWT, IWA;
+	UINT8			TABLE, MWT, MRD, EWT, EWA, ADRL, FRCL, SHIFT, YRL, NEGB, ZERO, BSEL;
+	UINT8			NOFL, COEF, MASA, ADREB, NXADR;
+};
+
+/* a program together with the registers it starts from */
+struct dspbench_program
+{
+	dspbench_step	step[128];				/* steps past the last one are zero */
+	INT16			coef[128];				/* COEF registers */
+	UINT16			madrs[32];				/* MADRS registers */
+	INT32			temp[128];				/* TEMP registers, 24 bit */
+	INT32			mems[32];				/* MEMS registers, 24 bit */
+	UINT32			rbp;					/* ring buffer pointer */
+	UINT32			rbl;					/* ring buffer length in words */
+	UINT32			dec;					/* DEC counter */
+};
+
+/* one DSP type as seen by the tool */
+struct dspbench_dsp
+{
+	const char *	name;					/* DSP name */
+	UINT32			flags;					/* DSPBENCH_FLAG_* */
+
+	/* create a stopped DSP with its own zeroed sound RAM; destroy it again */
+	void *			(*create)(void);
+	void			(*destroy)(void *dsp);
+
+	/* copy in sound RAM; load a program and start it; rewrite one step
+       of the running program the way an MPRO register write does */
+	void			(*load_ram)(void *dsp, const UINT16 *ram);
+	void			(*load)(void *dsp, const dspbench_program *program);
+	void			(*patch)(void *dsp, int index, const dspbench_step *step);
+
+	/* add a sample to a MIXS input */
+	void			(*input)(void *dsp, int sel, INT32 sample);
+
+	/* run one sample through the compiled program and through the old interpreter */
+	void			(*step)(void *dsp);
+	void			(*reference)(void *dsp);
+
+	/* name the first piece of state that differs, or NULL; sound RAM is
+       only compared when asked, since it is large */
+	const char *	(*compare)(const void *dsp, const void *ref, bool ram);
+};
+
+
+
+/***************************************************************************
+    GLOBAL VARIABLES
+***************************************************************************/
+
+/* DSP descriptions */
+extern const dspbench_dsp dspbench_scsp;		/* dspbench_scsp.c */
+extern const dspbench_dsp dspbench_aica;		/* dspbench_aica.c */
+
+
+#endif	/* __DSPBENCH_H__ */
@@ -0,0 +1,425 @@
+/***************************************************************************
+
+    dspbench_aica.c
+
+    AICA DSP benchmark.
+
+****************************************************************************
+
+    Copyright Aaron Giles
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are
+    met:
+
+        * Redistributions of source code must retain the above copyright
+          notice, this list of conditions and the following disclaimer.
+        * Redistributions in binary form must reproduce the above copyright
+          notice, this list of conditions and the following disclaimer in
+          the documentation and/or other materials provided with the
+          distribution.
+        * Neither the name 'MAME' nor the names of its contributors may be
+          used to endorse or promote products derived from this software
+          without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY AARON GILES ''AS IS'' AND ANY EXPRESS OR
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL AARON GILES BE LIABLE FOR ANY DIRECT,
+    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+    HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+    STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+    IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+    POSSIBILITY OF SUCH DAMAGE.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "dspbench.h"
+
+/* the core is built into this file so the tool can reach its internals */
+#include "sound/aicadsp.c"
+
+
+
+/***************************************************************************
+    TYPE DEFINITIONS
+***************************************************************************/
+
+/* a DSP and the sound RAM it works in */
+struct aica_bench
+{
+	struct _AICADSP	DSP;
+	UINT16			RAM[DSPBENCH_RAM_WORDS];
+};
+
+
+
+/***************************************************************************
+    REFERENCE INTERPRETER
+***************************************************************************/
+
+/*-------------------------------------------------
+    aica_reference_step - aica_dsp_step before
+    programs were compiled, decoding every step
+    of MPRO on every sample
+-------------------------------------------------*/
+
+static void aica_reference_step(struct _AICADSP *DSP)
+{
+	INT32 ACC=0;	//26 bit
+	INT32 SHIFTED=0;	//24 bit
+	INT32 X=0;	//24 bit
+	INT32 Y=0;	//13 bit
+	INT32 B=0;	//26 bit
+	INT32 INPUTS=0;	//24 bit
+	INT32 MEMVAL=0;
+	INT32 FRC_REG=0;	//13 bit
+	INT32 Y_REG=0;		//24 bit
+	UINT32 ADDR=0;
+	UINT32 ADRS_REG=0;	//13 bit
+	int step;
+
+	if(DSP->Stopped)
+		return;
+
+	memset(DSP->EFREG,0,2*16);
+	for(step=0;step</*128*/DSP->LastStep;++step)
+	{
+		UINT16 *IPtr=DSP->MPRO+step*8;
+
+//      if(IPtr[0]==0 && IPtr[1]==0 && IPtr[2]==0 && IPtr[3]==0)
+//          break;
+
+		UINT32 TRA=(IPtr[0]>>9)&0x7F;
+		UINT32 TWT=(IPtr[0]>>8)&0x01;
+		UINT32 TWA=(IPtr[0]>>1)&0x7F;
+
+		UINT32 XSEL=(IPtr[2]>>15)&0x01;
+		UINT32 YSEL=(IPtr[2]>>13)&0x03;
+		UINT32 IRA=(IPtr[2]>>7)&0x3F;
+		UINT32 IWT=(IPtr[2]>>6)&0x01;
+		UINT32 IWA=(IPtr[2]>>1)&0x1F;
+
+		UINT32 TABLE=(IPtr[4]>>15)&0x01;
+		UINT32 MWT=(IPtr[4]>>14)&0x01;
+		UINT32 MRD=(IPtr[4]>>13)&0x01;
+		UINT32 EWT=(IPtr[4]>>12)&0x01;
+		UINT32 EWA=(IPtr[4]>>8)&0x0F;
+		UINT32 ADRL=(IPtr[4]>>7)&0x01;
+		UINT32 FRCL=(IPtr[4]>>6)&0x01;
+		UINT32 SHIFT=(IPtr[4]>>4)&0x03;
+		UINT32 YRL=(IPtr[4]>>3)&0x01;
+		UINT32 NEGB=(IPtr[4]>>2)&0x01;
+		UINT32 ZERO=(IPtr[4]>>1)&0x01;
+		UINT32 BSEL=(IPtr[4]>>0)&0x01;
+
+		UINT32 NOFL=(IPtr[6]>>15)&1;		//????
+		UINT32 COEF=step;
+
+		UINT32 MASA=(IPtr[6]>>9)&0x1f;	//???
+		UINT32 ADREB=(IPtr[6]>>8)&0x1;
+		UINT32 NXADR=(IPtr[6]>>7)&0x1;
+
+		INT64 v;
+
+		//operations are done at 24 bit precision
+		//INPUTS RW
+		assert(IRA<0x32);
+		if(IRA<=0x1f)
+			INPUTS=DSP->MEMS[IRA];
+		else if(IRA<=0x2F)
+			INPUTS=DSP->MIXS[IRA-0x20]<<4;	//MIXS is 20 bit
+		else if(IRA<=0x31)
+			INPUTS=0;
+
+		INPUTS<<=8;
+		INPUTS>>=8;
+		//if(INPUTS&0x00800000)
+		//  INPUTS|=0xFF000000;
+
+		if(IWT)
+		{
+			DSP->MEMS[IWA]=MEMVAL;	//MEMVAL was selected in previous MRD
+			if(IRA==IWA)
+				INPUTS=MEMVAL;
+		}
+
+		//Operand sel
+		//B
+		if(!ZERO)
+		{
+			if(BSEL)
+				B=ACC;
+			else
+			{
+				B=DSP->TEMP[(TRA+DSP->DEC)&0x7F];
+				B<<=8;
+				B>>=8;
+				//if(B&0x00800000)
+				//  B|=0xFF000000;  //Sign extend
+			}
+			if(NEGB)
+				B=0-B;
+		}
+		else
+			B=0;
+
+		//X
+		if(XSEL)
+			X=INPUTS;
+		else
+		{
+			X=DSP->TEMP[(TRA+DSP->DEC)&0x7F];
+			X<<=8;
+			X>>=8;
+			//if(X&0x00800000)
+			//  X|=0xFF000000;
+		}
+
+		//Y
+		if(YSEL==0)
+			Y=FRC_REG;
+		else if(YSEL==1)
+			Y=DSP->COEF[COEF<<1]>>3;	//COEF is 16 bits
+		else if(YSEL==2)
+			Y=(Y_REG>>11)&0x1FFF;
+		else if(YSEL==3)
+			Y=(Y_REG>>4)&0x0FFF;
+
+		if(YRL)
+			Y_REG=INPUTS;
+
+		//Shifter
+		if(SHIFT==0)
+		{
+			SHIFTED=ACC;
+			if(SHIFTED>0x007FFFFF)
+				SHIFTED=0x007FFFFF;
+			if(SHIFTED<(-0x00800000))
+				SHIFTED=-0x00800000;
+		}
+		else if(SHIFT==1)
+		{
+			SHIFTED=ACC*2;
+			if(SHIFTED>0x007FFFFF)
+				SHIFTED=0x007FFFFF;
+			if(SHIFTED<(-0x00800000))
+				SHIFTED=-0x00800000;
+		}
+		else if(SHIFT==2)
+		{
+			SHIFTED=ACC*2;
+			SHIFTED<<=8;
+			SHIFTED>>=8;
+			//SHIFTED&=0x00FFFFFF;
+			//if(SHIFTED&0x00800000)
+			//  SHIFTED|=0xFF000000;
+		}
+		else if(SHIFT==3)
+		{
+			SHIFTED=ACC;
+			SHIFTED<<=8;
+			SHIFTED>>=8;
+			//SHIFTED&=0x00FFFFFF;
+			//if(SHIFTED&0x00800000)
+			//  SHIFTED|=0xFF000000;
+		}
+
+		//ACCUM
+		Y<<=19;
+		Y>>=19;
+		//if(Y&0x1000)
+		//  Y|=0xFFFFF000;
+
+		v=(((INT64) X*(INT64) Y)>>12);
+		ACC=(int) v+B;
+
+		if(TWT)
+			DSP->TEMP[(TWA+DSP->DEC)&0x7F]=SHIFTED;
+
+		if(FRCL)
+		{
+			if(SHIFT==3)
+				FRC_REG=SHIFTED&0x0FFF;
+			else
+				FRC_REG=(SHIFTED>>11)&0x1FFF;
+		}
+
+		if(MRD || MWT)
+		//if(0)
+		{
+			ADDR=DSP->MADRS[MASA<<1];
+			if(!TABLE)
+				ADDR+=DSP->DEC;
+			if(ADREB)
+				ADDR+=ADRS_REG&0x0FFF;
+			if(NXADR)
+				ADDR++;
+			if(!TABLE)
+				ADDR&=DSP->RBL-1;
+			else
+				ADDR&=0xFFFF;
+			//ADDR<<=1;
+			//ADDR+=DSP->RBP<<13;
+			//MEMVAL=DSP->AICARAM[ADDR>>1];
+			ADDR+=DSP->RBP<<10;
+			if(MRD && (step&1))	//memory only allowed on odd? DoA inserts NOPs on even
+			{
+				if(NOFL)
+					MEMVAL=DSP->AICARAM[ADDR]<<8;
+				else
+					MEMVAL=UNPACK(DSP->AICARAM[ADDR]);
+			}
+			if(MWT && (step&1))
+			{
+				if(NOFL)
+					DSP->AICARAM[ADDR]=SHIFTED>>8;
+				else
+					DSP->AICARAM[ADDR]=PACK(SHIFTED);
+			}
+		}
+
+		if(ADRL)
+		{
+			if(SHIFT==3)
+				ADRS_REG=(SHIFTED>>12)&0xFFF;
+			else
+				ADRS_REG=(INPUTS>>16);
+		}
+
+		if(EWT)
+			DSP->EFREG[EWA]+=SHIFTED>>8;
+
+	}
+	--DSP->DEC;
+	memset(DSP->MIXS,0,4*16);
+}
+
+
+
+/***************************************************************************
+    CORE IMPLEMENTATION
+***************************************************************************/
+
+/*-------------------------------------------------
+    aica_bench_encode - pack a step into the even
+    words of its eight MPRO words; the AICA has
+    no COEF field, each step uses its own COEF
+-------------------------------------------------*/
+
+static void aica_bench_encode(UINT16 *IPtr, const dspbench_step *S)
+{
+	memset(IPtr, 0, 8*sizeof(IPtr[0]));
+	IPtr[0]=(S->TRA<<9)|(S->TWT<<8)|(S->TWA<<1);
+	IPtr[2]=(S->XSEL<<15)|(S->YSEL<<13)|(S->IRA<<7)|(S->IWT<<6)|(S->IWA<<1);
+	IPtr[4]=(S->TABLE<<15)|(S->MWT<<14)|(S->MRD<<13)|(S->EWT<<12)|(S->EWA<<8)|(S->ADRL<<7)|(S->FRCL<<6)|
+			(S->SHIFT<<4)|(S->YRL<<3)|(S->NEGB<<2)|(S->ZERO<<1)|(S->BSEL<<0);
+	IPtr[6]=(S->NOFL<<15)|(S->MASA<<9)|(S->ADREB<<8)|(S->NXADR<<7);
+}
+
+static void *aica_bench_create(void)
+{
+	aica_bench *bench = (aica_bench *)osd_malloc(sizeof(*bench));
+
+	aica_dsp_init(&bench->DSP);
+	memset(bench->RAM, 0, sizeof(bench->RAM));
+	bench->DSP.AICARAM = bench->RAM;
+	bench->DSP.AICARAM_LENGTH = DSPBENCH_RAM_WORDS;
+	return bench;
+}
+
+static void aica_bench_destroy(void *dsp)
+{
+	osd_free(dsp);
+}
+
+static void aica_bench_load_ram(void *dsp, const UINT16 *ram)
+{
+	memcpy(((aica_bench *)dsp)->RAM, ram, sizeof(((aica_bench *)dsp)->RAM));
+}
+
+static void aica_bench_load(void *dsp, const dspbench_program *program)
+{
+	struct _AICADSP *DSP = &((aica_bench *)dsp)->DSP;
+	int i;
+
+	for (i = 0; i < 128; i++)
+		aica_bench_encode(DSP->MPRO + i*8, &program->step[i]);
+	memset(DSP->COEF, 0, sizeof(DSP->COEF));
+	memset(DSP->MADRS, 0, sizeof(DSP->MADRS));
+	for (i = 0; i < 128; i++)
+		DSP->COEF[i*2] = program->coef[i];
+	for (i = 0; i < 32; i++)
+		DSP->MADRS[i*2] = program->madrs[i];
+	memcpy(DSP->TEMP, program->temp, sizeof(DSP->TEMP));
+	memcpy(DSP->MEMS, program->mems, sizeof(DSP->MEMS));
+	memset(DSP->MIXS, 0, sizeof(DSP->MIXS));
+	DSP->RBP = program->rbp;
+	DSP->RBL = program->rbl;
+	DSP->DEC = program->dec;
+	aica_dsp_start(DSP);
+}
+
+static void aica_bench_patch(void *dsp, int index, const dspbench_step *step)
+{
+	struct _AICADSP *DSP = &((aica_bench *)dsp)->DSP;
+
+	/* what an MPRO write in AICA_w16 does, short of the last word */
+	aica_bench_encode(DSP->MPRO + index*8, step);
+	DSP->Dirty = 1;
+}
+
+static void aica_bench_input(void *dsp, int sel, INT32 sample)
+{
+	aica_dsp_setsample(&((aica_bench *)dsp)->DSP, sample, sel, 0);
+}
+
+static void aica_bench_step(void *dsp)
+{
+	aica_dsp_step(&((aica_bench *)dsp)->DSP);
+}
+
+static void aica_bench_reference(void *dsp)
+{
+	aica_reference_step(&((aica_bench *)dsp)->DSP);
+}
+
+static const char *aica_bench_compare(const void *dsp, const void *ref, bool ram)
+{
+	const aica_bench *a = (const aica_bench *)dsp;
+	const aica_bench *b = (const aica_bench *)ref;
+
+	if (memcmp(a->DSP.EFREG, b->DSP.EFREG, sizeof(a->DSP.EFREG)) != 0)
+		return "EFREG";
+	if (memcmp(a->DSP.TEMP, b->DSP.TEMP, sizeof(a->DSP.TEMP)) != 0)
+		return "TEMP";
+	if (memcmp(a->DSP.MEMS, b->DSP.MEMS, sizeof(a->DSP.MEMS)) != 0)
+		return "MEMS";
+	if (memcmp(a->DSP.MIXS, b->DSP.MIXS, sizeof(a->DSP.MIXS)) != 0)
+		return "MIXS";
+	if (a->DSP.DEC != b->DSP.DEC)
+		return "DEC";
+	if (ram && memcmp(a->RAM, b->RAM, sizeof(a->RAM)) != 0)
+		return "sound RAM";
+	return NULL;
+}
+
+
+
+/***************************************************************************
+    DSP DESCRIPTION
+***************************************************************************/
+
+/* an IRA past 0x31 trips an assert in the old interpreter, so it is not generated */
+const dspbench_dsp dspbench_aica =
+{
+	"aica", 0,
+	aica_bench_create, aica_bench_destroy,
+	aica_bench_load_ram, aica_bench_load, aica_bench_patch,
+	aica_bench_input, aica_bench_step, aica_bench_reference,
+	aica_bench_compare
+};
@@ -0,0 +1,423 @@
+/***************************************************************************
+
+    dspbench_scsp.c
+
+    SCSP DSP benchmark.
+
+****************************************************************************
+
+    Copyright Aaron Giles
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are
+    met:
+
+        * Redistributions of source code must retain the above copyright
+          notice, this list of conditions and the following disclaimer.
+        * Redistributions in binary form must reproduce the above copyright
+          notice, this list of conditions and the following disclaimer in
+          the documentation and/or other materials provided with the
+          distribution.
+        * Neither the name 'MAME' nor the names of its contributors may be
+          used to endorse or promote products derived from this software
+          without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY AARON GILES ''AS IS'' AND ANY EXPRESS OR
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL AARON GILES BE LIABLE FOR ANY DIRECT,
+    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+    HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+    STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+    IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+    POSSIBILITY OF SUCH DAMAGE.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "dspbench.h"
+
+/* the core is built into this file so the tool can reach its internals */
+#include "sound/scspdsp.c"
+
+
+
+/***************************************************************************
+    TYPE DEFINITIONS
+***************************************************************************/
+
+/* a DSP and the sound RAM it works in */
+struct scsp_bench
+{
+	struct _SCSPDSP	DSP;
+	UINT16			RAM[DSPBENCH_RAM_WORDS];
+};
+
+
+
+/***************************************************************************
+    REFERENCE INTERPRETER
+***************************************************************************/
+
+/*-------------------------------------------------
+    scsp_reference_step - SCSPDSP_Step before
+    programs were compiled, decoding every step
+    of MPRO on every sample
+-------------------------------------------------*/
+
+static void scsp_reference_step(struct _SCSPDSP *DSP)
+{
+	INT32 ACC=0;	//26 bit
+	INT32 SHIFTED=0;	//24 bit
+	INT32 X=0;	//24 bit
+	INT32 Y=0;	//13 bit
+	INT32 B=0;	//26 bit
+	INT32 INPUTS=0;	//24 bit
+	INT32 MEMVAL=0;
+	INT32 FRC_REG=0;	//13 bit
+	INT32 Y_REG=0;		//24 bit
+	UINT32 ADDR=0;
+	UINT32 ADRS_REG=0;	//13 bit
+	int step;
+
+	if(DSP->Stopped)
+		return;
+
+	memset(DSP->EFREG,0,2*16);
+	for(step=0;step</*128*/DSP->LastStep;++step)
+	{
+		UINT16 *IPtr=DSP->MPRO+step*4;
+
+//      if(IPtr[0]==0 && IPtr[1]==0 && IPtr[2]==0 && IPtr[3]==0)
+//          break;
+
+		UINT32 TRA=(IPtr[0]>>8)&0x7F;
+		UINT32 TWT=(IPtr[0]>>7)&0x01;
+		UINT32 TWA=(IPtr[0]>>0)&0x7F;
+
+		UINT32 XSEL=(IPtr[1]>>15)&0x01;
+		UINT32 YSEL=(IPtr[1]>>13)&0x03;
+		UINT32 IRA=(IPtr[1]>>6)&0x3F;
+		UINT32 IWT=(IPtr[1]>>5)&0x01;
+		UINT32 IWA=(IPtr[1]>>0)&0x1F;
+
+		UINT32 TABLE=(IPtr[2]>>15)&0x01;
+		UINT32 MWT=(IPtr[2]>>14)&0x01;
+		UINT32 MRD=(IPtr[2]>>13)&0x01;
+		UINT32 EWT=(IPtr[2]>>12)&0x01;
+		UINT32 EWA=(IPtr[2]>>8)&0x0F;
+		UINT32 ADRL=(IPtr[2]>>7)&0x01;
+		UINT32 FRCL=(IPtr[2]>>6)&0x01;
+		UINT32 SHIFT=(IPtr[2]>>4)&0x03;
+		UINT32 YRL=(IPtr[2]>>3)&0x01;
+		UINT32 NEGB=(IPtr[2]>>2)&0x01;
+		UINT32 ZERO=(IPtr[2]>>1)&0x01;
+		UINT32 BSEL=(IPtr[2]>>0)&0x01;
+
+		UINT32 NOFL=(IPtr[3]>>15)&1;		//????
+		UINT32 COEF=(IPtr[3]>>9)&0x3f;
+
+		UINT32 MASA=(IPtr[3]>>2)&0x1f;	//???
+		UINT32 ADREB=(IPtr[3]>>1)&0x1;
+		UINT32 NXADR=(IPtr[3]>>0)&0x1;
+
+		INT64 v;
+
+		//operations are done at 24 bit precision
+		//INPUTS RW
+// colmns97 hits this
+//      assert(IRA<0x32);
+		if(IRA<=0x1f)
+			INPUTS=DSP->MEMS[IRA];
+		else if(IRA<=0x2F)
+			INPUTS=DSP->MIXS[IRA-0x20]<<4;	//MIXS is 20 bit
+		else if(IRA<=0x31)
+			INPUTS=0;
+		else
+			return;
+
+		INPUTS<<=8;
+		INPUTS>>=8;
+		//if(INPUTS&0x00800000)
+		//  INPUTS|=0xFF000000;
+
+		if(IWT)
+		{
+			DSP->MEMS[IWA]=MEMVAL;	//MEMVAL was selected in previous MRD
+			if(IRA==IWA)
+				INPUTS=MEMVAL;
+		}
+
+		//Operand sel
+		//B
+		if(!ZERO)
+		{
+			if(BSEL)
+				B=ACC;
+			else
+			{
+				B=DSP->TEMP[(TRA+DSP->DEC)&0x7F];
+				B<<=8;
+				B>>=8;
+				//if(B&0x00800000)
+				//  B|=0xFF000000;  //Sign extend
+			}
+			if(NEGB)
+				B=0-B;
+		}
+		else
+			B=0;
+
+		//X
+		if(XSEL)
+			X=INPUTS;
+		else
+		{
+			X=DSP->TEMP[(TRA+DSP->DEC)&0x7F];
+			X<<=8;
+			X>>=8;
+			//if(X&0x00800000)
+			//  X|=0xFF000000;
+		}
+
+		//Y
+		if(YSEL==0)
+			Y=FRC_REG;
+		else if(YSEL==1)
+			Y=DSP->COEF[COEF]>>3;	//COEF is 16 bits
+		else if(YSEL==2)
+			Y=(Y_REG>>11)&0x1FFF;
+		else if(YSEL==3)
+			Y=(Y_REG>>4)&0x0FFF;
+
+		if(YRL)
+			Y_REG=INPUTS;
+
+		//Shifter
+		if(SHIFT==0)
+		{
+			SHIFTED=ACC;
+			if(SHIFTED>0x007FFFFF)
+				SHIFTED=0x007FFFFF;
+			if(SHIFTED<(-0x00800000))
+				SHIFTED=-0x00800000;
+		}
+		else if(SHIFT==1)
+		{
+			SHIFTED=ACC*2;
+			if(SHIFTED>0x007FFFFF)
+				SHIFTED=0x007FFFFF;
+			if(SHIFTED<(-0x00800000))
+				SHIFTED=-0x00800000;
+		}
+		else if(SHIFT==2)
+		{
+			SHIFTED=ACC*2;
+			SHIFTED<<=8;
+			SHIFTED>>=8;
+			//SHIFTED&=0x00FFFFFF;
+			//if(SHIFTED&0x00800000)
+			//  SHIFTED|=0xFF000000;
+		}
+		else if(SHIFT==3)
+		{
+			SHIFTED=ACC;
+			SHIFTED<<=8;
+			SHIFTED>>=8;
+			//SHIFTED&=0x00FFFFFF;
+			//if(SHIFTED&0x00800000)
+			//  SHIFTED|=0xFF000000;
+		}
+
+		//ACCUM
+		Y<<=19;
+		Y>>=19;
+		//if(Y&0x1000)
+		//  Y|=0xFFFFF000;
+
+		v=(((INT64) X*(INT64) Y)>>12);
+		ACC=(int) v+B;
+
+		if(TWT)
+			DSP->TEMP[(TWA+DSP->DEC)&0x7F]=SHIFTED;
+
+		if(FRCL)
+		{
+			if(SHIFT==3)
+				FRC_REG=SHIFTED&0x0FFF;
+			else
+				FRC_REG=(SHIFTED>>11)&0x1FFF;
+		}
+
+		if(MRD || MWT)
+		//if(0)
+		{
+			ADDR=DSP->MADRS[MASA];
+			if(!TABLE)
+				ADDR+=DSP->DEC;
+			if(ADREB)
+				ADDR+=ADRS_REG&0x0FFF;
+			if(NXADR)
+				ADDR++;
+			if(!TABLE)
+				ADDR&=DSP->RBL-1;
+			else
+				ADDR&=0xFFFF;
+			//ADDR<<=1;
+			//ADDR+=DSP->RBP<<13;
+			//MEMVAL=DSP->SCSPRAM[ADDR>>1];
+			ADDR+=DSP->RBP<<12;
+			if (ADDR > 0x7ffff) ADDR = 0;
+			if(MRD && (step&1))	//memory only allowed on odd? DoA inserts NOPs on even
+			{
+				if(NOFL)
+					MEMVAL=DSP->SCSPRAM[ADDR]<<8;
+				else
+					MEMVAL=UNPACK(DSP->SCSPRAM[ADDR]);
+			}
+			if(MWT && (step&1))
+			{
+				if(NOFL)
+			    		DSP->SCSPRAM[ADDR]=SHIFTED>>8;
+				else
+					DSP->SCSPRAM[ADDR]=PACK(SHIFTED);
+			}
+		}
+
+		if(ADRL)
+		{
+			if(SHIFT==3)
+				ADRS_REG=(SHIFTED>>12)&0xFFF;
+			else
+				ADRS_REG=(INPUTS>>16);
+		}
+
+		if(EWT)
+			DSP->EFREG[EWA]+=SHIFTED>>8;
+
+	}
+	--DSP->DEC;
+	memset(DSP->MIXS,0,4*16);
+}
+
+
+
+/***************************************************************************
+    CORE IMPLEMENTATION
+***************************************************************************/
+
+/*-------------------------------------------------
+    scsp_bench_encode - pack a step into the four
+    MPRO words
+-------------------------------------------------*/
+
+static void scsp_bench_encode(UINT16 *IPtr, const dspbench_step *S)
+{
+	IPtr[0]=(S->TRA<<8)|(S->TWT<<7)|(S->TWA<<0);
+	IPtr[1]=(S->XSEL<<15)|(S->YSEL<<13)|(S->IRA<<6)|(S->IWT<<5)|(S->IWA<<0);
+	IPtr[2]=(S->TABLE<<15)|(S->MWT<<14)|(S->MRD<<13)|(S->EWT<<12)|(S->EWA<<8)|(S->ADRL<<7)|(S->FRCL<<6)|
+			(S->SHIFT<<4)|(S->YRL<<3)|(S->NEGB<<2)|(S->ZERO<<1)|(S->BSEL<<0);
+	IPtr[3]=(S->NOFL<<15)|(S->COEF<<9)|(S->MASA<<2)|(S->ADREB<<1)|(S->NXADR<<0);
+}
+
+static void *scsp_bench_create(void)
+{
+	scsp_bench *bench = (scsp_bench *)osd_malloc(sizeof(*bench));
+
+	SCSPDSP_Init(&bench->DSP);
+	memset(bench->RAM, 0, sizeof(bench->RAM));
+	bench->DSP.SCSPRAM = bench->RAM;
+	bench->DSP.SCSPRAM_LENGTH = DSPBENCH_RAM_WORDS;
+	return bench;
+}
+
+static void scsp_bench_destroy(void *dsp)
+{
+	osd_free(dsp);
+}
+
+static void scsp_bench_load_ram(void *dsp, const UINT16 *ram)
+{
+	memcpy(((scsp_bench *)dsp)->RAM, ram, sizeof(((scsp_bench *)dsp)->RAM));
+}
+
+static void scsp_bench_load(void *dsp, const dspbench_program *program)
+{
+	struct _SCSPDSP *DSP = &((scsp_bench *)dsp)->DSP;
+	int i;
+
+	for (i = 0; i < 128; i++)
+		scsp_bench_encode(DSP->MPRO + i*4, &program->step[i]);
+	for (i = 0; i < 64; i++)
+		DSP->COEF[i] = program->coef[i];
+	memcpy(DSP->MADRS, program->madrs, sizeof(DSP->MADRS));
+	memcpy(DSP->TEMP, program->temp, sizeof(DSP->TEMP));
+	memcpy(DSP->MEMS, program->mems, sizeof(DSP->MEMS));
+	memset(DSP->MIXS, 0, sizeof(DSP->MIXS));
+	DSP->RBP = program->rbp;
+	DSP->RBL = program->rbl;
+	DSP->DEC = program->dec;
+	SCSPDSP_Start(DSP);
+}
+
+static void scsp_bench_patch(void *dsp, int index, const dspbench_step *step)
+{
+	struct _SCSPDSP *DSP = &((scsp_bench *)dsp)->DSP;
+
+	/* what an MPRO write in SCSP_w16 does, short of the last word */
+	scsp_bench_encode(DSP->MPRO + index*4, step);
+	DSP->Dirty = 1;
+}
+
+static void scsp_bench_input(void *dsp, int sel, INT32 sample)
+{
+	SCSPDSP_SetSample(&((scsp_bench *)dsp)->DSP, sample, sel, 0);
+}
+
+static void scsp_bench_step(void *dsp)
+{
+	SCSPDSP_Step(&((scsp_bench *)dsp)->DSP);
+}
+
+static void scsp_bench_reference(void *dsp)
+{
+	scsp_reference_step(&((scsp_bench *)dsp)->DSP);
+}
+
+static const char *scsp_bench_compare(const void *dsp, const void *ref, bool ram)
+{
+	const scsp_bench *a = (const scsp_bench *)dsp;
+	const scsp_bench *b = (const scsp_bench *)ref;
+
+	if (memcmp(a->DSP.EFREG, b->DSP.EFREG, sizeof(a->DSP.EFREG)) != 0)
+		return "EFREG";
+	if (memcmp(a->DSP.TEMP, b->DSP.TEMP, sizeof(a->DSP.TEMP)) != 0)
+		return "TEMP";
+	if (memcmp(a->DSP.MEMS, b->DSP.MEMS, sizeof(a->DSP.MEMS)) != 0)
+		return "MEMS";
+	if (memcmp(a->DSP.MIXS, b->DSP.MIXS, sizeof(a->DSP.MIXS)) != 0)
+		return "MIXS";
+	if (a->DSP.DEC != b->DSP.DEC)
+		return "DEC";
+	if (ram && memcmp(a->RAM, b->RAM, sizeof(a->RAM)) != 0)
+		return "sound RAM";
+	return NULL;
+}
+
+
+
+/***************************************************************************
+    DSP DESCRIPTION
+***************************************************************************/
+
+const dspbench_dsp dspbench_scsp =
+{
+	"scsp", DSPBENCH_FLAG_BAD_IRA,
+	scsp_bench_create, scsp_bench_destroy,
+	scsp_bench_load_ram, scsp_bench_load, scsp_bench_patch,
+	scsp_bench_input, scsp_bench_step, scsp_bench_reference,
+	scsp_bench_compare
+};
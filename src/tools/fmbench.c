@@ -0,0 +1,560 @@
+/***************************************************************************
+
+    fmbench.c
+
+    FM sound core benchmark and comparison tool.
+
+****************************************************************************
+
+    Copyright Aaron Giles
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are
+    met:
+
+        * Redistributions of source code must retain the above copyright
+          notice, this list of conditions and the following disclaimer.
+        * Redistributions in binary form must reproduce the above copyright
+          notice, this list of conditions and the following disclaimer in
+          the documentation and/or other materials provided with the
+          distribution.
+        * Neither the name 'MAME' nor the names of its contributors may be
+          used to endorse or promote products derived from this software
+          without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY AARON GILES ''AS IS'' AND ANY EXPRESS OR
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL AARON GILES BE LIABLE FOR ANY DIRECT,
+    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+    HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+    STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+    IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+    POSSIBILITY OF SUCH DAMAGE.
+
+****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "emu.h"
+#include "sound/fm.h"
+#include "fmbench.h"
+
+#define MAX_CHUNK				4096
+#define DEFAULT_SECONDS			20
+
+
+
+/***************************************************************************
+    TYPE DEFINITIONS
+***************************************************************************/
+
+struct chip_buffers
+{
+	void *			ptr[2];				// one buffer per output
+	UINT8			data[2][MAX_CHUNK * sizeof(INT32)];
+};
+
+
+
+/***************************************************************************
+    GLOBAL VARIABLES
+***************************************************************************/
+
+static const fmbench_chip *const chip_lists[] =
+{
+	fmbench_opn_chips,
+	fmbench_opn2_chips,
+	fmbench_opm_chips
+};
+
+static UINT32 random_state;
+
+
+
+/***************************************************************************
+    TEST STREAMS
+***************************************************************************/
+
+/*-------------------------------------------------
+    random_next - deterministic pseudo-random
+    numbers, so a seed always gives the same
+    register stream
+-------------------------------------------------*/
+
+static UINT32 random_next(void)
+{
+	random_state = random_state * 1103515245 + 12345;
+	return random_state >> 8;
+}
+
+
+/*-------------------------------------------------
+    random_channel - pick one of the FM channels
+    a chip has
+-------------------------------------------------*/
+
+static int random_channel(const fmbench_chip *chip)
+{
+	int chan;
+
+	do
+		chan = random_next() % 8;
+	while (!(chip->chanmask & (1 << chan)));
+	return chan;
+}
+
+
+/*-------------------------------------------------
+    opn_keycode - OPN register 0x28 channel code
+-------------------------------------------------*/
+
+static int opn_keycode(int chan)
+{
+	return (chan < 3) ? chan : chan + 1;
+}
+
+
+/*-------------------------------------------------
+    opn_random_write - pick an OPN register write;
+    timers and CSM are left alone since nothing
+    here emulates the external timers
+-------------------------------------------------*/
+
+static void opn_random_write(const fmbench_chip *chip, int *reg, int *data)
+{
+	int chan = random_channel(chip);
+	int port = (chan >= 3) ? 0x100 : 0x000;
+	int ch = chan % 3;
+	int sel = random_next() % 32;
+
+	*data = random_next() & 0xff;
+
+	if (sel < 4)
+	{
+		// key on/off for any combination of slots
+		*reg = 0x28;
+		*data = (*data & 0xf0) | opn_keycode(chan);
+	}
+	else if (sel == 4 && (chip->flags & FMBENCH_FLAG_LFO))
+	{
+		*reg = 0x22;
+		*data &= 0x0f;
+	}
+	else if (sel == 5)
+	{
+		// three slot mode on or off
+		*reg = 0x27;
+		*data &= 0x40;
+	}
+	else if (sel == 6 && (chip->flags & FMBENCH_FLAG_DAC))
+		*reg = 0x2a + (random_next() & 1);
+	else if (sel < 22)
+	{
+		// operator registers 0x30-0x90
+		*reg = port | (0x30 + 0x10 * (random_next() % 7)) | ((random_next() & 3) << 2) | ch;
+	}
+	else if (sel < 26)
+		*reg = port | ((random_next() & 1) ? 0xa4 : 0xa0) | ch;
+	else if (sel < 28 && (chip->chanmask & 0x04))
+	{
+		// channel 3 slot frequencies for three slot mode
+		*reg = ((random_next() & 1) ? 0xac : 0xa8) | (random_next() % 3);
+	}
+	else if (chip->flags & FMBENCH_FLAG_LFO)
+		*reg = port | ((random_next() & 1) ? 0xb4 : 0xb0) | ch;
+	else
+		*reg = port | 0xb0 | ch;
+}
+
+
+/*-------------------------------------------------
+    opm_random_write - pick an OPM register write,
+    leaving out the timer registers
+-------------------------------------------------*/
+
+static void opm_random_write(const fmbench_chip *chip, int *reg, int *data)
+{
+	int sel = random_next() % 32;
+
+	*data = random_next() & 0xff;
+
+	if (sel < 4)
+	{
+		*reg = 0x08;
+		*data &= 0x7f;
+	}
+	else if (sel == 4)
+	{
+		// LFO reset
+		*reg = 0x01;
+		*data &= 0x02;
+	}
+	else if (sel == 5)
+		*reg = 0x0f;
+	else if (sel == 6)
+		*reg = 0x18;
+	else if (sel == 7)
+		*reg = 0x19;
+	else if (sel == 8)
+	{
+		// LFO waveform; leave the CT output pins alone
+		*reg = 0x1b;
+		*data &= 0x03;
+	}
+	else if (sel < 14)
+		*reg = 0x20 + random_next() % 0x20;
+	else
+		*reg = 0x40 + random_next() % 0xc0;
+}
+
+
+/*-------------------------------------------------
+    release_all - key off every channel
+-------------------------------------------------*/
+
+static void release_all(const fmbench_chip *chip, void *chipa, void *chipb)
+{
+	int chan;
+
+	for (chan = 0; chan < 8; chan++)
+		if (chip->chanmask & (1 << chan))
+		{
+			int reg = (chip->family == FMBENCH_OPN) ? 0x28 : 0x08;
+			int data = (chip->family == FMBENCH_OPN) ? opn_keycode(chan) : chan;
+
+			(*chip->write)(chipa, reg, data);
+			if (chipb != NULL)
+				(*chip->write)(chipb, reg, data);
+		}
+}
+
+
+/*-------------------------------------------------
+    program_tone - set every channel up with a
+    sustained tone and key it on
+-------------------------------------------------*/
+
+static void program_tone(const fmbench_chip *chip, void *param)
+{
+	int chan, slot;
+
+	if (chip->family == FMBENCH_OPN)
+	{
+		static const UINT8 op_regs[6] = { 0x71, 0x1c, 0x1f, 0x08, 0x04, 0x2f };
+
+		if (chip->flags & FMBENCH_FLAG_LFO)
+			(*chip->write)(param, 0x22, 0x0b);
+		for (chan = 0; chan < 6; chan++)
+		{
+			int base = (chan < 3) ? chan : (0x100 | (chan - 3));
+			if (!(chip->chanmask & (1 << chan)))
+				continue;
+			for (slot = 0; slot < 4; slot++)
+			{
+				int r = base + slot * 4;
+				// carriers (slot 4 in algorithm 2) are louder and slower to decay
+				(*chip->write)(param, 0x30 + r, (slot == 3) ? 0x01 : op_regs[0]);
+				(*chip->write)(param, 0x40 + r, (slot == 3) ? 0x08 : op_regs[1]);
+				(*chip->write)(param, 0x50 + r, op_regs[2]);
+				(*chip->write)(param, 0x60 + r, op_regs[3]);
+				(*chip->write)(param, 0x70 + r, op_regs[4]);
+				(*chip->write)(param, 0x80 + r, op_regs[5]);
+			}
+			(*chip->write)(param, 0xb0 + base, 0x32);
+			if (chip->flags & FMBENCH_FLAG_LFO)
+				(*chip->write)(param, 0xb4 + base, 0xc0 | 0x12);
+			(*chip->write)(param, 0xa4 + base, ((3 + (chan & 1)) << 3) | 0x02);
+			(*chip->write)(param, 0xa0 + base, 0x6a + chan * 0x10);
+			(*chip->write)(param, 0x28, 0xf0 | opn_keycode(chan));
+		}
+	}
+	else
+	{
+		(*chip->write)(param, 0x18, 0xc0);			// LFO frequency
+		(*chip->write)(param, 0x19, 0x90);			// PMD
+		(*chip->write)(param, 0x19, 0x10);			// AMD
+		for (chan = 0; chan < 8; chan++)
+		{
+			for (slot = 0; slot < 4; slot++)
+			{
+				int r = chan + slot * 8;
+				// the carrier (C2 in connection 2) is louder and slower to decay
+				(*chip->write)(param, 0x40 + r, (slot == 3) ? 0x01 : 0x71);
+				(*chip->write)(param, 0x60 + r, (slot == 3) ? 0x08 : 0x1c);
+				(*chip->write)(param, 0x80 + r, 0x1f);
+				(*chip->write)(param, 0xa0 + r, 0x88);
+				(*chip->write)(param, 0xc0 + r, 0x04);
+				(*chip->write)(param, 0xe0 + r, 0x2f);
+			}
+			(*chip->write)(param, 0x20 + chan, 0xc0 | (6 << 3) | 2);
+			(*chip->write)(param, 0x28 + chan, ((3 + (chan & 1)) << 4) | (chan & 0x0e));
+			(*chip->write)(param, 0x38 + chan, 0x21);
+			(*chip->write)(param, 0x08, 0x78 | chan);
+		}
+	}
+}
+
+
+
+/***************************************************************************
+    CORE IMPLEMENTATION
+***************************************************************************/
+
+/*-------------------------------------------------
+    buffers_init - point the output buffers at
+    their storage
+-------------------------------------------------*/
+
+static void buffers_init(chip_buffers &buffers)
+{
+	buffers.ptr[0] = buffers.data[0];
+	buffers.ptr[1] = buffers.data[1];
+}
+
+
+/*-------------------------------------------------
+    get_sample - fetch one output sample
+-------------------------------------------------*/
+
+static INT32 get_sample(const fmbench_chip *chip, const chip_buffers &buffers, int output, int index)
+{
+	if (chip->sample_bytes == sizeof(INT16))
+		return ((const INT16 *)buffers.data[output])[index];
+	return ((const INT32 *)buffers.data[output])[index];
+}
+
+
+/*-------------------------------------------------
+    compare_chip - drive the block update and the
+    per-sample reference with the same random
+    register stream and compare every sample
+-------------------------------------------------*/
+
+static bool compare_chip(const fmbench_chip *chip, int seconds, UINT32 seed)
+{
+	static chip_buffers newbuf, refbuf;
+	void *newchip = (*chip->create)(chip->clock, chip->rate);
+	void *refchip = (*chip->create)(chip->clock, chip->rate);
+	UINT64 total = (UINT64)chip->rate * seconds;
+	UINT64 done, audible = 0;
+	bool result = true;
+
+	buffers_init(newbuf);
+	buffers_init(refbuf);
+	random_state = seed;
+
+	for (done = 0; done < total && result; )
+	{
+		int writes = random_next() % 8;
+		int length, output, index;
+
+		// a few register writes, applied to both chips
+		while (writes-- != 0)
+		{
+			int reg, data;
+			if (chip->family == FMBENCH_OPN)
+				opn_random_write(chip, &reg, &data);
+			else
+				opm_random_write(chip, &reg, &data);
+			(*chip->write)(newchip, reg, data);
+			(*chip->write)(refchip, reg, data);
+		}
+
+		// chunks from a single sample up to MAX_CHUNK; now and then
+		// release everything and let the channels run out to silence
+		if (random_next() % 32 == 0)
+		{
+			release_all(chip, newchip, refchip);
+			length = MAX_CHUNK;
+		}
+		else
+			length = 1 + random_next() % (1 << (random_next() % 13));
+		if (length > MAX_CHUNK)
+			length = MAX_CHUNK;
+		if (length > total - done)
+			length = total - done;
+
+		(*chip->update)(newchip, newbuf.ptr, length);
+		(*chip->reference)(refchip, refbuf.ptr, length);
+
+		for (output = 0; output < chip->outputs; output++)
+		{
+			if (memcmp(newbuf.data[output], refbuf.data[output], length * chip->sample_bytes) != 0)
+			{
+				for (index = 0; index < length; index++)
+					if (get_sample(chip, newbuf, output, index) != get_sample(chip, refbuf, output, index))
+						break;
+				printf("%-8s MISMATCH output %d sample %u: block %d, reference %d\n", chip->name, output,
+						(UINT32)(done + index), get_sample(chip, newbuf, output, index), get_sample(chip, refbuf, output, index));
+				result = false;
+				break;
+			}
+			for (index = 0; index < length; index++)
+				if (get_sample(chip, refbuf, output, index) != 0)
+					audible++;
+		}
+		done += length;
+	}
+
+	if (result)
+		printf("%-8s %u samples identical (%.1f%% non-silent)\n", chip->name, (UINT32)total,
+				100.0 * (double)audible / (double)(total * chip->outputs));
+
+	(*chip->destroy)(newchip);
+	(*chip->destroy)(refchip);
+	return result;
+}
+
+
+/*-------------------------------------------------
+    time_path - render a test tone through one of
+    the update paths, releasing it halfway, and
+    return the ticks spent
+-------------------------------------------------*/
+
+static osd_ticks_t time_path(const fmbench_chip *chip, bool reference, int seconds)
+{
+	static chip_buffers buffers;
+	void *param = (*chip->create)(chip->clock, chip->rate);
+	int total = chip->rate * seconds;
+	osd_ticks_t start, elapsed;
+	int done;
+
+	buffers_init(buffers);
+	program_tone(chip, param);
+
+	start = osd_ticks();
+	for (done = 0; done < total; done += 1024)
+	{
+		int length = MIN(1024, total - done);
+
+		// release every note halfway through
+		if (done < total / 2 && done + 1024 >= total / 2)
+			release_all(chip, param, NULL);
+		(*(reference ? chip->reference : chip->update))(param, buffers.ptr, length);
+	}
+	elapsed = osd_ticks() - start;
+
+	(*chip->destroy)(param);
+	return elapsed;
+}
+
+
+/*-------------------------------------------------
+    bench_chip - time both update paths
+-------------------------------------------------*/
+
+static void bench_chip(const fmbench_chip *chip, int seconds)
+{
+	double tps = (double)osd_ticks_per_second();
+	osd_ticks_t newticks = time_path(chip, false, seconds);
+	osd_ticks_t refticks = time_path(chip, true, seconds);
+
+	printf("%-8s %d seconds of tone: block %8.3f ms (%6.1fx realtime), per-sample %8.3f ms (%6.1fx realtime), speedup %.2fx\n",
+			chip->name, seconds,
+			(double)newticks * 1000.0 / tps, (newticks != 0) ? (double)seconds * tps / (double)newticks : 0.0,
+			(double)refticks * 1000.0 / tps, (refticks != 0) ? (double)seconds * tps / (double)refticks : 0.0,
+			(newticks != 0) ? (double)refticks / (double)newticks : 0.0);
+}
+
+
+/*-------------------------------------------------
+    main - main entry point
+-------------------------------------------------*/
+
+int main(int argc, char *argv[])
+{
+	int seconds = DEFAULT_SECONDS;
+	UINT32 seed = 1;
+	int firstchip = argc;
+	int result = 0;
+	int matched = 0;
+
+	// parse options
+	for (int argnum = 1; argnum < argc; argnum++)
+	{
+		if (strcmp(argv[argnum], "-seconds") == 0 && argnum + 1 < argc)
+			seconds = atoi(argv[++argnum]);
+		else if (strcmp(argv[argnum], "-seed") == 0 && argnum + 1 < argc)
+			seed = strtoul(argv[++argnum], NULL, 0);
+		else if (argv[argnum][0] == '-')
+		{
+			fprintf(stderr, "Usage:\n  fmbench [-seconds <n>] [-seed <n>] [chip ...]\n\n");
+			fprintf(stderr, "Renders each FM chip through the block update and the old per-sample loop,\n");
+			fprintf(stderr, "checks that a random register stream gives identical output on both, and\n");
+			fprintf(stderr, "times a test tone on each. Chips:");
+			for (int listnum = 0; listnum < ARRAY_LENGTH(chip_lists); listnum++)
+				for (const fmbench_chip *chip = chip_lists[listnum]; chip->name != NULL; chip++)
+					fprintf(stderr, " %s", chip->name);
+			fprintf(stderr, "\n");
+			return 1;
+		}
+		else if (firstchip == argc)
+			firstchip = argnum;
+	}
+	if (seconds <= 0)
+		seconds = DEFAULT_SECONDS;
+
+	for (int listnum = 0; listnum < ARRAY_LENGTH(chip_lists); listnum++)
+		for (const fmbench_chip *chip = chip_lists[listnum]; chip->name != NULL; chip++)
+		{
+			// only the chips named on the command line, if any
+			if (firstchip < argc)
+			{
+				int argnum;
+				for (argnum = firstchip; argnum < argc; argnum++)
+					if (core_stricmp(argv[argnum], chip->name) == 0)
+						break;
+				if (argnum == argc)
+					continue;
+			}
+			matched++;
+
+			if (!compare_chip(chip, seconds, seed))
+				result = 1;
+			bench_chip(chip, seconds);
+		}
+
+	if (matched == 0)
+	{
+		fprintf(stderr, "No matching chips\n");
+		return 1;
+	}
+	return result;
+}
+
+
+
+/***************************************************************************
+    LINKAGE
+****************************************************************************
+
+    The cores are built outside of a running machine: chips are created
+    without a device and never touch the scheduler, the save state system
+    or memory regions. These satisfy the linker for the code paths that
+    do (device setup, timers, busy flag) and are never reached.
+
+***************************************************************************/
+
+void CLIB_DECL logerror(const char *format, ...) { }
+
+void ym2203_update_request(void *param) { }
+void ym2608_update_request(void *param) { }
+void ym2610_update_request(void *param) { }
+void ym2612_update_request(void *param) { }
+
+void save_manager::save_memory(const char *module, const char *tag, UINT32 index, const char *name, void *val, UINT32 valsize, UINT32 valcount) { }
+void save_manager::register_postload(save_prepost_delegate func) { }
+
+attotime device_scheduler::time() const { return attotime::zero; }
+emu_timer *device_scheduler::timer_alloc(timer_expired_delegate callback, void *ptr) { return NULL; }
+void device_scheduler::timer_set(attotime duration, timer_expired_delegate callback, int param, void *ptr) { }
+bool emu_timer::enable(bool enable) { return false; }
+void emu_timer::adjust(attotime duration, INT32 param, attotime periodicity) { }
+
+memory_region *device_t::memregion(const char *tag) const { return NULL; }
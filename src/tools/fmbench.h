@@ -0,0 +1,112 @@
+/***************************************************************************
+
+    fmbench.h
+
+    FM sound core benchmark and comparison tool.
+
+****************************************************************************
+
+    Copyright Aaron Giles
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are
+    met:
+
+        * Redistributions of source code must retain the above copyright
+          notice, this list of conditions and the following disclaimer.
+        * Redistributions in binary form must reproduce the above copyright
+          notice, this list of conditions and the following disclaimer in
+          the documentation and/or other materials provided with the
+          distribution.
+        * Neither the name 'MAME' nor the names of its contributors may be
+          used to endorse or promote products derived from this software
+          without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY AARON GILES ''AS IS'' AND ANY EXPRESS OR
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL AARON GILES BE LIABLE FOR ANY DIRECT,
+    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+    HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+    STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+    IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+    POSSIBILITY OF SUCH DAMAGE.
+
+****************************************************************************
+
+    Each FM core is compiled into its own translation unit together with
+    a copy of the per-sample update loop it used before the cores were
+    switched to block rendering. The tool drives both paths with the same
+    register stream and compares the output.
+
+***************************************************************************/
+
+#pragma once
+
+#ifndef __FMBENCH_H__
+#define __FMBENCH_H__
+
+#include "osdcore.h"
+
+
+/***************************************************************************
+    CONSTANTS
+***************************************************************************/
+
+/* register interface of a chip, which decides how test streams are built */
+enum
+{
+	FMBENCH_OPN = 0,		/* YM2203/YM2608/YM2610/YM2610B/YM2612 */
+	FMBENCH_OPM				/* YM2151 */
+};
+
+/* chip features */
+#define FMBENCH_FLAG_LFO		0x01	/* OPN with LFO and panning */
+#define FMBENCH_FLAG_DAC		0x02	/* YM2612 DAC on channel 6 */
+
+
+
+/***************************************************************************
+    TYPE DEFINITIONS
+***************************************************************************/
+
+/* one chip type as seen by the tool */
+struct fmbench_chip
+{
+	const char *	name;					/* chip name */
+	int				family;					/* FMBENCH_OPN or FMBENCH_OPM */
+	UINT32			chanmask;				/* FM channels present, bit n = channel n */
+	UINT32			flags;					/* FMBENCH_FLAG_* */
+	int				clock;					/* typical input clock */
+	int				rate;					/* native sample rate at that clock */
+	int				outputs;				/* number of output streams */
+	int				sample_bytes;			/* size of an output sample (INT16 or INT32) */
+
+	/* create a reset chip without a device; destroy it again */
+	void *			(*create)(int clock, int rate);
+	void			(*destroy)(void *chip);
+
+	/* write a register; bit 8 selects the second OPN port */
+	void			(*write)(void *chip, int reg, int data);
+
+	/* render through the block update and through the old per-sample loop */
+	void			(*update)(void *chip, void **buffers, int length);
+	void			(*reference)(void *chip, void **buffers, int length);
+};
+
+
+
+/***************************************************************************
+    GLOBAL VARIABLES
+***************************************************************************/
+
+/* chip lists, each terminated by an entry with a NULL name */
+extern const fmbench_chip fmbench_opn_chips[];		/* fmbench_opn.c */
+extern const fmbench_chip fmbench_opn2_chips[];		/* fmbench_opn2.c */
+extern const fmbench_chip fmbench_opm_chips[];		/* fmbench_opm.c */
+
+
+#endif	/* __FMBENCH_H__ */
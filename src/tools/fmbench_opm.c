@@ -0,0 +1,237 @@
+/***************************************************************************
+
+    fmbench_opm.c
+
+    FM sound core benchmark: YM2151.
+
+****************************************************************************
+
+    Copyright Aaron Giles
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are
+    met:
+
+        * Redistributions of source code must retain the above copyright
+          notice, this list of conditions and the following disclaimer.
+        * Redistributions in binary form must reproduce the above copyright
+          notice, this list of conditions and the following disclaimer in
+          the documentation and/or other materials provided with the
+          distribution.
+        * Neither the name 'MAME' nor the names of its contributors may be
+          used to endorse or promote products derived from this software
+          without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY AARON GILES ''AS IS'' AND ANY EXPRESS OR
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL AARON GILES BE LIABLE FOR ANY DIRECT,
+    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+    HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+    STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+    IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+    POSSIBILITY OF SUCH DAMAGE.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "fmbench.h"
+
+/* the core is built into this file so the tool can reach its internals */
+#include "sound/ym2151.c"
+
+
+
+/***************************************************************************
+    YM2151
+***************************************************************************/
+
+/*-------------------------------------------------
+    ym2151_bench_reset - ym2151_reset_chip, minus
+    the MAME timers the tool has no scheduler for
+-------------------------------------------------*/
+
+static void ym2151_bench_reset(YM2151 *chip)
+{
+	int i;
+
+	/* initialize hardware registers */
+	for (i=0; i<32; i++)
+	{
+		memset(&chip->oper[i],'\0',sizeof(YM2151Operator));
+		chip->oper[i].volume = MAX_ATT_INDEX;
+		chip->oper[i].kc_i = 768; /* min kc_i value */
+	}
+
+	chip->eg_timer = 0;
+	chip->eg_cnt   = 0;
+
+	chip->lfo_timer  = 0;
+	chip->lfo_counter= 0;
+	chip->lfo_phase  = 0;
+	chip->lfo_wsel   = 0;
+	chip->pmd = 0;
+	chip->amd = 0;
+	chip->lfa = 0;
+	chip->lfp = 0;
+
+	chip->test= 0;
+
+	chip->irq_enable = 0;
+	chip->timer_A_index = 0;
+	chip->timer_B_index = 0;
+	chip->timer_A_index_old = 0;
+	chip->timer_B_index_old = 0;
+
+	chip->noise     = 0;
+	chip->noise_rng = 0;
+	chip->noise_p   = 0;
+	chip->noise_f   = chip->noise_tab[0];
+
+	chip->csm_req	= 0;
+	chip->status    = 0;
+
+	ym2151_write_reg(chip, 0x1b, 0);	/* only because of CT1, CT2 output pins */
+	ym2151_write_reg(chip, 0x18, 0);	/* set LFO frequency */
+	for (i=0x20; i<0x100; i++)		/* set the operators */
+	{
+		ym2151_write_reg(chip, i, 0);
+	}
+}
+
+static void *ym2151_bench_create(int clock, int rate)
+{
+	YM2151 *PSG = (YM2151 *)osd_malloc(sizeof(*PSG));
+
+	/* what ym2151_init sets up, minus the device */
+	memset(PSG, 0, sizeof(YM2151));
+	init_tables();
+
+	PSG->clock = clock;
+	PSG->sampfreq = rate;
+	init_chip_tables( PSG );
+
+	PSG->lfo_timer_add = (1<<LFO_SH) * (clock/64.0) / PSG->sampfreq;
+
+	PSG->eg_timer_add  = (1<<EG_SH)  * (clock/64.0) / PSG->sampfreq;
+	PSG->eg_timer_overflow = ( 3 ) * (1<<EG_SH);
+
+	ym2151_bench_reset(PSG);
+	return PSG;
+}
+
+static void ym2151_bench_destroy(void *chip)
+{
+	osd_free(chip);
+}
+
+static void ym2151_bench_write(void *chip, int reg, int data)
+{
+	ym2151_write_reg(chip, reg, data);
+}
+
+static void ym2151_bench_update(void *chip, void **buffers, int length)
+{
+	ym2151_update_one(chip, (SAMP **)buffers, length);
+}
+
+
+/*-------------------------------------------------
+    ym2151_bench_reference - the YM2151 update
+    loop before block rendering, with the MAME
+    timers
+-------------------------------------------------*/
+
+static void ym2151_bench_reference(void *chip, void **buffers, int length)
+{
+	YM2151 *PSG = (YM2151 *)chip;
+	signed int *chanout = PSG->chanout;
+	int i, c;
+	signed int outl,outr;
+	SAMP *bufL, *bufR;
+
+	bufL = (SAMP *)buffers[0];
+	bufR = (SAMP *)buffers[1];
+
+	for (i=0; i<length; i++)
+	{
+		/* advance_eg */
+		PSG->eg_timer += PSG->eg_timer_add;
+
+		while (PSG->eg_timer >= PSG->eg_timer_overflow)
+		{
+			PSG->eg_timer -= PSG->eg_timer_overflow;
+
+			PSG->eg_cnt++;
+
+			for (c = 0; c < 8; c++)
+				advance_eg_channel(&PSG->oper[c*4], PSG->eg_cnt);
+		}
+
+		chanout[0] = 0;
+		chanout[1] = 0;
+		chanout[2] = 0;
+		chanout[3] = 0;
+		chanout[4] = 0;
+		chanout[5] = 0;
+		chanout[6] = 0;
+		chanout[7] = 0;
+
+		chan_calc(PSG, 0);
+		chan_calc(PSG, 1);
+		chan_calc(PSG, 2);
+		chan_calc(PSG, 3);
+		chan_calc(PSG, 4);
+		chan_calc(PSG, 5);
+		chan_calc(PSG, 6);
+		chan7_calc(PSG);
+
+		outl = chanout[0] & PSG->pan[0];
+		outr = chanout[0] & PSG->pan[1];
+		outl += (chanout[1] & PSG->pan[2]);
+		outr += (chanout[1] & PSG->pan[3]);
+		outl += (chanout[2] & PSG->pan[4]);
+		outr += (chanout[2] & PSG->pan[5]);
+		outl += (chanout[3] & PSG->pan[6]);
+		outr += (chanout[3] & PSG->pan[7]);
+		outl += (chanout[4] & PSG->pan[8]);
+		outr += (chanout[4] & PSG->pan[9]);
+		outl += (chanout[5] & PSG->pan[10]);
+		outr += (chanout[5] & PSG->pan[11]);
+		outl += (chanout[6] & PSG->pan[12]);
+		outr += (chanout[6] & PSG->pan[13]);
+		outl += (chanout[7] & PSG->pan[14]);
+		outr += (chanout[7] & PSG->pan[15]);
+
+		outl >>= FINAL_SH;
+		outr >>= FINAL_SH;
+		if (outl > MAXOUT) outl = MAXOUT;
+			else if (outl < MINOUT) outl = MINOUT;
+		if (outr > MAXOUT) outr = MAXOUT;
+			else if (outr < MINOUT) outr = MINOUT;
+		((SAMP*)bufL)[i] = (SAMP)outl;
+		((SAMP*)bufR)[i] = (SAMP)outr;
+
+		/* advance: LFO, noise, phase generator, then CSM */
+		advance_lfo(PSG);
+		advance_noise(PSG);
+		for (c = 0; c < 8; c++)
+			advance_phase_channel(PSG, &PSG->oper[c*4], PSG->lfp);
+		advance_csm(PSG);
+	}
+}
+
+
+
+/***************************************************************************
+    CHIP LIST
+***************************************************************************/
+
+const fmbench_chip fmbench_opm_chips[] =
+{
+	{ "ym2151", FMBENCH_OPM, 0xff, 0, 3579545, 3579545 / 64, 2, sizeof(SAMP), ym2151_bench_create, ym2151_bench_destroy, ym2151_bench_write, ym2151_bench_update, ym2151_bench_reference },
+	{ NULL }
+};
@@ -0,0 +1,745 @@
+/***************************************************************************
+
+    fmbench_opn.c
+
+    FM sound core benchmark: YM2203, YM2608, YM2610 and YM2610B.
+
+****************************************************************************
+
+    Copyright Aaron Giles
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are
+    met:
+
+        * Redistributions of source code must retain the above copyright
+          notice, this list of conditions and the following disclaimer.
+        * Redistributions in binary form must reproduce the above copyright
+          notice, this list of conditions and the following disclaimer in
+          the documentation and/or other materials provided with the
+          distribution.
+        * Neither the name 'MAME' nor the names of its contributors may be
+          used to endorse or promote products derived from this software
+          without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY AARON GILES ''AS IS'' AND ANY EXPRESS OR
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL AARON GILES BE LIABLE FOR ANY DIRECT,
+    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+    HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+    STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+    IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+    POSSIBILITY OF SUCH DAMAGE.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "fmbench.h"
+
+/* the core is built into this file so the tool can reach its internals */
+#include "sound/fm.c"
+#include "sound/ymdeltat.c"
+
+
+
+/***************************************************************************
+    CHIP SETUP
+***************************************************************************/
+
+/*-------------------------------------------------
+    SSG stubs - the benchmark only drives the FM
+    section
+-------------------------------------------------*/
+
+static void bench_ssg_set_clock(void *param, int clock) { }
+static void bench_ssg_write(void *param, int address, int data) { }
+static int bench_ssg_read(void *param) { return 0; }
+static void bench_ssg_reset(void *param) { }
+
+static const ssg_callbacks bench_ssg =
+{
+	bench_ssg_set_clock,
+	bench_ssg_write,
+	bench_ssg_read,
+	bench_ssg_reset
+};
+
+
+/*-------------------------------------------------
+    opn_bench_setup - fill in what the *_init
+    functions set up, minus the device
+-------------------------------------------------*/
+
+static void opn_bench_setup(FM_OPN *OPN, FM_CH *CH, UINT8 type, int clock, int rate)
+{
+	init_tables();
+
+	OPN->type = type;
+	OPN->P_CH = CH;
+	OPN->ST.param = NULL;
+	OPN->ST.clock = clock;
+	OPN->ST.rate = rate;
+	OPN->ST.SSG = &bench_ssg;
+}
+
+
+/*-------------------------------------------------
+    opn_bench_write - write an FM register
+    directly, bypassing the busy flag and the
+    stream update
+-------------------------------------------------*/
+
+static void opn_bench_write(FM_OPN *OPN, int reg, int data)
+{
+	if (reg < 0x30)
+		OPNWriteMode(OPN, reg, data);
+	else
+		OPNWriteReg(OPN, reg, data);
+}
+
+
+
+/***************************************************************************
+    YM2203
+***************************************************************************/
+
+static void *ym2203_bench_create(int clock, int rate)
+{
+	YM2203 *F2203 = (YM2203 *)osd_malloc(sizeof(*F2203));
+
+	memset(F2203, 0, sizeof(*F2203));
+	opn_bench_setup(&F2203->OPN, F2203->CH, TYPE_YM2203, clock, rate);
+	ym2203_reset_chip(F2203);
+	return F2203;
+}
+
+static void ym2203_bench_write(void *chip, int reg, int data)
+{
+	opn_bench_write(&((YM2203 *)chip)->OPN, reg, data);
+}
+
+static void ym2203_bench_update(void *chip, void **buffers, int length)
+{
+	ym2203_update_one(chip, (FMSAMPLE *)buffers[0], length);
+}
+
+
+/*-------------------------------------------------
+    ym2203_bench_reference - the YM2203 update
+    loop before block rendering
+-------------------------------------------------*/
+
+static void ym2203_bench_reference(void *chip, void **buffers, int length)
+{
+	YM2203 *F2203 = (YM2203 *)chip;
+	FM_OPN *OPN =   &F2203->OPN;
+	int i;
+	FMSAMPLE *buf = (FMSAMPLE *)buffers[0];
+	FM_CH	*cch[3];
+
+	cch[0]   = &F2203->CH[0];
+	cch[1]   = &F2203->CH[1];
+	cch[2]   = &F2203->CH[2];
+
+
+	/* refresh PG and EG */
+	refresh_fc_eg_chan( OPN, cch[0] );
+	refresh_fc_eg_chan( OPN, cch[1] );
+	if( (F2203->OPN.ST.mode & 0xc0) )
+	{
+		/* 3SLOT MODE */
+		if( cch[2]->SLOT[SLOT1].Incr==-1)
+		{
+			refresh_fc_eg_slot(OPN, &cch[2]->SLOT[SLOT1] , OPN->SL3.fc[1] , OPN->SL3.kcode[1] );
+			refresh_fc_eg_slot(OPN, &cch[2]->SLOT[SLOT2] , OPN->SL3.fc[2] , OPN->SL3.kcode[2] );
+			refresh_fc_eg_slot(OPN, &cch[2]->SLOT[SLOT3] , OPN->SL3.fc[0] , OPN->SL3.kcode[0] );
+			refresh_fc_eg_slot(OPN, &cch[2]->SLOT[SLOT4] , cch[2]->fc , cch[2]->kcode );
+		}
+	}
+	else
+		refresh_fc_eg_chan( OPN, cch[2] );
+
+
+	/* YM2203 doesn't have LFO so we must keep these globals at 0 level */
+	OPN->LFO_AM = 0;
+	OPN->LFO_PM = 0;
+
+	/* buffering */
+	for (i=0; i < length ; i++)
+	{
+		/* clear outputs */
+		OPN->out_fm[0] = 0;
+		OPN->out_fm[1] = 0;
+		OPN->out_fm[2] = 0;
+
+		/* advance envelope generator */
+		OPN->eg_timer += OPN->eg_timer_add;
+		while (OPN->eg_timer >= OPN->eg_timer_overflow)
+		{
+			OPN->eg_timer -= OPN->eg_timer_overflow;
+			OPN->eg_cnt++;
+
+			advance_eg_channel(OPN->eg_cnt, &cch[0]->SLOT[SLOT1]);
+			advance_eg_channel(OPN->eg_cnt, &cch[1]->SLOT[SLOT1]);
+			advance_eg_channel(OPN->eg_cnt, &cch[2]->SLOT[SLOT1]);
+		}
+
+		/* calculate FM */
+		chan_calc(OPN, cch[0], 0 );
+		chan_calc(OPN, cch[1], 1 );
+		chan_calc(OPN, cch[2], 2 );
+
+		/* buffering */
+		{
+			int lt;
+
+			lt = OPN->out_fm[0] + OPN->out_fm[1] + OPN->out_fm[2];
+
+			lt >>= FINAL_SH;
+
+			Limit( lt , MAXOUT, MINOUT );
+
+			/* buffering */
+			buf[i] = lt;
+		}
+
+		/* timer A control */
+		INTERNAL_TIMER_A( &F2203->OPN.ST , cch[2] )
+	}
+	INTERNAL_TIMER_B(&F2203->OPN.ST,length)
+}
+
+
+
+/***************************************************************************
+    YM2608
+***************************************************************************/
+
+static void *ym2608_bench_create(int clock, int rate)
+{
+	YM2608 *F2608 = (YM2608 *)osd_malloc(sizeof(*F2608));
+
+	memset(F2608, 0, sizeof(*F2608));
+	opn_bench_setup(&F2608->OPN, F2608->CH, TYPE_YM2608, clock, rate);
+	F2608->deltaT.status_set_handler = YM2608_deltat_status_set;
+	F2608->deltaT.status_reset_handler = YM2608_deltat_status_reset;
+	F2608->deltaT.status_change_which_chip = F2608;
+	F2608->pcmbuf = YM2608_ADPCM_ROM;
+	F2608->pcm_size = 0x2000;
+	Init_ADPCMATable();
+
+	ym2608_reset_chip(F2608);
+	return F2608;
+}
+
+static void ym2608_bench_write(void *chip, int reg, int data)
+{
+	opn_bench_write(&((YM2608 *)chip)->OPN, reg, data);
+}
+
+static void ym2608_bench_update(void *chip, void **buffers, int length)
+{
+	ym2608_update_one(chip, (FMSAMPLE **)buffers, length);
+}
+
+
+/*-------------------------------------------------
+    ym2608_bench_reference - the YM2608 update
+    loop before block rendering
+-------------------------------------------------*/
+
+static void ym2608_bench_reference(void *chip, void **buffer, int length)
+{
+	YM2608 *F2608 = (YM2608 *)chip;
+	FM_OPN *OPN   = &F2608->OPN;
+	YM_DELTAT *DELTAT = &F2608->deltaT;
+	int i,j;
+	FMSAMPLE  *bufL,*bufR;
+	FM_CH	*cch[6];
+	INT32 *out_fm = OPN->out_fm;
+
+	/* set bufer */
+	bufL = (FMSAMPLE *)buffer[0];
+	bufR = (FMSAMPLE *)buffer[1];
+
+	cch[0]   = &F2608->CH[0];
+	cch[1]   = &F2608->CH[1];
+	cch[2]   = &F2608->CH[2];
+	cch[3]   = &F2608->CH[3];
+	cch[4]   = &F2608->CH[4];
+	cch[5]   = &F2608->CH[5];
+
+	/* refresh PG and EG */
+	refresh_fc_eg_chan( OPN, cch[0] );
+	refresh_fc_eg_chan( OPN, cch[1] );
+	if( (OPN->ST.mode & 0xc0) )
+	{
+		/* 3SLOT MODE */
+		if( cch[2]->SLOT[SLOT1].Incr==-1)
+		{
+			refresh_fc_eg_slot(OPN, &cch[2]->SLOT[SLOT1] , OPN->SL3.fc[1] , OPN->SL3.kcode[1] );
+			refresh_fc_eg_slot(OPN, &cch[2]->SLOT[SLOT2] , OPN->SL3.fc[2] , OPN->SL3.kcode[2] );
+			refresh_fc_eg_slot(OPN, &cch[2]->SLOT[SLOT3] , OPN->SL3.fc[0] , OPN->SL3.kcode[0] );
+			refresh_fc_eg_slot(OPN, &cch[2]->SLOT[SLOT4] , cch[2]->fc , cch[2]->kcode );
+		}
+	}
+	else
+		refresh_fc_eg_chan( OPN, cch[2] );
+	refresh_fc_eg_chan( OPN, cch[3] );
+	refresh_fc_eg_chan( OPN, cch[4] );
+	refresh_fc_eg_chan( OPN, cch[5] );
+
+
+	/* buffering */
+	for(i=0; i < length ; i++)
+	{
+
+		advance_lfo(OPN);
+
+		/* clear output acc. */
+		OPN->out_adpcm[OUTD_LEFT] = OPN->out_adpcm[OUTD_RIGHT] = OPN->out_adpcm[OUTD_CENTER] = 0;
+		OPN->out_delta[OUTD_LEFT] = OPN->out_delta[OUTD_RIGHT] = OPN->out_delta[OUTD_CENTER] = 0;
+		/* clear outputs */
+		out_fm[0] = 0;
+		out_fm[1] = 0;
+		out_fm[2] = 0;
+		out_fm[3] = 0;
+		out_fm[4] = 0;
+		out_fm[5] = 0;
+
+		/* calculate FM */
+		chan_calc(OPN, cch[0], 0 );
+		chan_calc(OPN, cch[1], 1 );
+		chan_calc(OPN, cch[2], 2 );
+		chan_calc(OPN, cch[3], 3 );
+		chan_calc(OPN, cch[4], 4 );
+		chan_calc(OPN, cch[5], 5 );
+
+		/* deltaT ADPCM */
+		if( DELTAT->portstate&0x80 )
+			YM_DELTAT_ADPCM_CALC(DELTAT);
+
+		/* ADPCMA */
+		for( j = 0; j < 6; j++ )
+		{
+			if( F2608->adpcm[j].flag )
+				ADPCMA_calc_chan( F2608, &F2608->adpcm[j]);
+		}
+
+		/* advance envelope generator */
+		OPN->eg_timer += OPN->eg_timer_add;
+		while (OPN->eg_timer >= OPN->eg_timer_overflow)
+		{
+			OPN->eg_timer -= OPN->eg_timer_overflow;
+			OPN->eg_cnt++;
+
+			advance_eg_channel(OPN->eg_cnt, &cch[0]->SLOT[SLOT1]);
+			advance_eg_channel(OPN->eg_cnt, &cch[1]->SLOT[SLOT1]);
+			advance_eg_channel(OPN->eg_cnt, &cch[2]->SLOT[SLOT1]);
+			advance_eg_channel(OPN->eg_cnt, &cch[3]->SLOT[SLOT1]);
+			advance_eg_channel(OPN->eg_cnt, &cch[4]->SLOT[SLOT1]);
+			advance_eg_channel(OPN->eg_cnt, &cch[5]->SLOT[SLOT1]);
+		}
+
+		/* buffering */
+		{
+			int lt,rt;
+
+			lt =  OPN->out_adpcm[OUTD_LEFT]  + OPN->out_adpcm[OUTD_CENTER];
+			rt =  OPN->out_adpcm[OUTD_RIGHT] + OPN->out_adpcm[OUTD_CENTER];
+			lt += (OPN->out_delta[OUTD_LEFT]  + OPN->out_delta[OUTD_CENTER])>>9;
+			rt += (OPN->out_delta[OUTD_RIGHT] + OPN->out_delta[OUTD_CENTER])>>9;
+			lt += ((out_fm[0]>>1) & OPN->pan[0]);	/* shift right verified on real YM2608 */
+			rt += ((out_fm[0]>>1) & OPN->pan[1]);
+			lt += ((out_fm[1]>>1) & OPN->pan[2]);
+			rt += ((out_fm[1]>>1) & OPN->pan[3]);
+			lt += ((out_fm[2]>>1) & OPN->pan[4]);
+			rt += ((out_fm[2]>>1) & OPN->pan[5]);
+			lt += ((out_fm[3]>>1) & OPN->pan[6]);
+			rt += ((out_fm[3]>>1) & OPN->pan[7]);
+			lt += ((out_fm[4]>>1) & OPN->pan[8]);
+			rt += ((out_fm[4]>>1) & OPN->pan[9]);
+			lt += ((out_fm[5]>>1) & OPN->pan[10]);
+			rt += ((out_fm[5]>>1) & OPN->pan[11]);
+
+			lt >>= FINAL_SH;
+			rt >>= FINAL_SH;
+
+			Limit( lt, MAXOUT, MINOUT );
+			Limit( rt, MAXOUT, MINOUT );
+			/* buffering */
+			bufL[i] = lt;
+			bufR[i] = rt;
+		}
+
+		/* timer A control */
+		INTERNAL_TIMER_A( &OPN->ST , cch[2] )
+	}
+	INTERNAL_TIMER_B(&OPN->ST,length)
+
+
+	/* check IRQ for DELTA-T EOS */
+	FM_STATUS_SET(&OPN->ST, 0);
+
+}
+
+
+
+/***************************************************************************
+    YM2610 / YM2610B
+***************************************************************************/
+
+/*-------------------------------------------------
+    ym2610_bench_reset - the FM half of
+    ym2610_reset_chip, which also looks up the
+    ADPCM regions through the device
+-------------------------------------------------*/
+
+static void ym2610_bench_reset(YM2610 *F2610)
+{
+	FM_OPN *OPN = &F2610->OPN;
+	int i;
+
+	/* Reset Prescaler */
+	OPNSetPres( OPN, 6*24, 6*24, 4*2); /* OPN 1/6 , SSG 1/4 */
+	/* status clear */
+	FM_IRQMASK_SET(&OPN->ST,0x03);
+	FM_BUSY_CLEAR(&OPN->ST);
+	OPNWriteMode(OPN,0x27,0x30); /* mode 0 , timer reset */
+
+	OPN->eg_timer = 0;
+	OPN->eg_cnt   = 0;
+
+	FM_STATUS_RESET(&OPN->ST, 0xff);
+
+	reset_channels( &OPN->ST , F2610->CH , 6 );
+	/* reset OPerator paramater */
+	for(i = 0xb6 ; i >= 0xb4 ; i-- )
+	{
+		OPNWriteReg(OPN,i      ,0xc0);
+		OPNWriteReg(OPN,i|0x100,0xc0);
+	}
+	for(i = 0xb2 ; i >= 0x30 ; i-- )
+	{
+		OPNWriteReg(OPN,i      ,0);
+		OPNWriteReg(OPN,i|0x100,0);
+	}
+	for(i = 0x26 ; i >= 0x20 ; i-- ) OPNWriteReg(OPN,i,0);
+}
+
+static void *ym2610_bench_create(int clock, int rate)
+{
+	YM2610 *F2610 = (YM2610 *)osd_malloc(sizeof(*F2610));
+
+	memset(F2610, 0, sizeof(*F2610));
+	opn_bench_setup(&F2610->OPN, F2610->CH, TYPE_YM2610, clock, rate);
+	Init_ADPCMATable();
+
+	ym2610_bench_reset(F2610);
+	return F2610;
+}
+
+static void ym2610_bench_write(void *chip, int reg, int data)
+{
+	opn_bench_write(&((YM2610 *)chip)->OPN, reg, data);
+}
+
+static void ym2610_bench_update(void *chip, void **buffers, int length)
+{
+	ym2610_update_one(chip, (FMSAMPLE **)buffers, length);
+}
+
+static void ym2610b_bench_update(void *chip, void **buffers, int length)
+{
+	ym2610b_update_one(chip, (FMSAMPLE **)buffers, length);
+}
+
+
+/*-------------------------------------------------
+    ym2610_bench_reference - the YM2610 update
+    loop before block rendering
+-------------------------------------------------*/
+
+static void ym2610_bench_reference(void *chip, void **buffer, int length)
+{
+	YM2610 *F2610 = (YM2610 *)chip;
+	FM_OPN *OPN   = &F2610->OPN;
+	YM_DELTAT *DELTAT = &F2610->deltaT;
+	int i,j;
+	FMSAMPLE  *bufL,*bufR;
+	FM_CH	*cch[4];
+	INT32 *out_fm = OPN->out_fm;
+
+	/* buffer setup */
+	bufL = (FMSAMPLE *)buffer[0];
+	bufR = (FMSAMPLE *)buffer[1];
+
+	cch[0] = &F2610->CH[1];
+	cch[1] = &F2610->CH[2];
+	cch[2] = &F2610->CH[4];
+	cch[3] = &F2610->CH[5];
+
+	/* refresh PG and EG */
+	refresh_fc_eg_chan( OPN, cch[0] );
+	if( (OPN->ST.mode & 0xc0) )
+	{
+		/* 3SLOT MODE */
+		if( cch[1]->SLOT[SLOT1].Incr==-1)
+		{
+			refresh_fc_eg_slot(OPN, &cch[1]->SLOT[SLOT1] , OPN->SL3.fc[1] , OPN->SL3.kcode[1] );
+			refresh_fc_eg_slot(OPN, &cch[1]->SLOT[SLOT2] , OPN->SL3.fc[2] , OPN->SL3.kcode[2] );
+			refresh_fc_eg_slot(OPN, &cch[1]->SLOT[SLOT3] , OPN->SL3.fc[0] , OPN->SL3.kcode[0] );
+			refresh_fc_eg_slot(OPN, &cch[1]->SLOT[SLOT4] , cch[1]->fc , cch[1]->kcode );
+		}
+	}
+	else
+		refresh_fc_eg_chan( OPN, cch[1] );
+	refresh_fc_eg_chan( OPN, cch[2] );
+	refresh_fc_eg_chan( OPN, cch[3] );
+
+	/* buffering */
+	for(i=0; i < length ; i++)
+	{
+
+		advance_lfo(OPN);
+
+		/* clear output acc. */
+		OPN->out_adpcm[OUTD_LEFT] = OPN->out_adpcm[OUTD_RIGHT] = OPN->out_adpcm[OUTD_CENTER] = 0;
+		OPN->out_delta[OUTD_LEFT] = OPN->out_delta[OUTD_RIGHT] = OPN->out_delta[OUTD_CENTER] = 0;
+		/* clear outputs */
+		out_fm[1] = 0;
+		out_fm[2] = 0;
+		out_fm[4] = 0;
+		out_fm[5] = 0;
+
+		/* advance envelope generator */
+		OPN->eg_timer += OPN->eg_timer_add;
+		while (OPN->eg_timer >= OPN->eg_timer_overflow)
+		{
+			OPN->eg_timer -= OPN->eg_timer_overflow;
+			OPN->eg_cnt++;
+
+			advance_eg_channel(OPN->eg_cnt, &cch[0]->SLOT[SLOT1]);
+			advance_eg_channel(OPN->eg_cnt, &cch[1]->SLOT[SLOT1]);
+			advance_eg_channel(OPN->eg_cnt, &cch[2]->SLOT[SLOT1]);
+			advance_eg_channel(OPN->eg_cnt, &cch[3]->SLOT[SLOT1]);
+		}
+
+		/* calculate FM */
+		chan_calc(OPN, cch[0], 1 );	/*remapped to 1*/
+		chan_calc(OPN, cch[1], 2 );	/*remapped to 2*/
+		chan_calc(OPN, cch[2], 4 );	/*remapped to 4*/
+		chan_calc(OPN, cch[3], 5 );	/*remapped to 5*/
+
+		/* deltaT ADPCM */
+		if( DELTAT->portstate&0x80 )
+			YM_DELTAT_ADPCM_CALC(DELTAT);
+
+		/* ADPCMA */
+		for( j = 0; j < 6; j++ )
+		{
+			if( F2610->adpcm[j].flag )
+				ADPCMA_calc_chan( F2610, &F2610->adpcm[j]);
+		}
+
+		/* buffering */
+		{
+			int lt,rt;
+
+			lt =  OPN->out_adpcm[OUTD_LEFT]  + OPN->out_adpcm[OUTD_CENTER];
+			rt =  OPN->out_adpcm[OUTD_RIGHT] + OPN->out_adpcm[OUTD_CENTER];
+			lt += (OPN->out_delta[OUTD_LEFT]  + OPN->out_delta[OUTD_CENTER])>>9;
+			rt += (OPN->out_delta[OUTD_RIGHT] + OPN->out_delta[OUTD_CENTER])>>9;
+
+
+			lt += ((out_fm[1]>>1) & OPN->pan[2]);	/* the shift right was verified on real chip */
+			rt += ((out_fm[1]>>1) & OPN->pan[3]);
+			lt += ((out_fm[2]>>1) & OPN->pan[4]);
+			rt += ((out_fm[2]>>1) & OPN->pan[5]);
+
+			lt += ((out_fm[4]>>1) & OPN->pan[8]);
+			rt += ((out_fm[4]>>1) & OPN->pan[9]);
+			lt += ((out_fm[5]>>1) & OPN->pan[10]);
+			rt += ((out_fm[5]>>1) & OPN->pan[11]);
+
+
+			lt >>= FINAL_SH;
+			rt >>= FINAL_SH;
+
+			Limit( lt, MAXOUT, MINOUT );
+			Limit( rt, MAXOUT, MINOUT );
+
+			/* buffering */
+			bufL[i] = lt;
+			bufR[i] = rt;
+		}
+
+		/* timer A control */
+		INTERNAL_TIMER_A( &OPN->ST , cch[1] )
+	}
+	INTERNAL_TIMER_B(&OPN->ST,length)
+
+}
+
+
+/*-------------------------------------------------
+    ym2610b_bench_reference - the YM2610B update
+    loop before block rendering
+-------------------------------------------------*/
+
+static void ym2610b_bench_reference(void *chip, void **buffer, int length)
+{
+	YM2610 *F2610 = (YM2610 *)chip;
+	FM_OPN *OPN   = &F2610->OPN;
+	YM_DELTAT *DELTAT = &F2610->deltaT;
+	int i,j;
+	FMSAMPLE  *bufL,*bufR;
+	FM_CH	*cch[6];
+	INT32 *out_fm = OPN->out_fm;
+
+	/* buffer setup */
+	bufL = (FMSAMPLE *)buffer[0];
+	bufR = (FMSAMPLE *)buffer[1];
+
+	cch[0] = &F2610->CH[0];
+	cch[1] = &F2610->CH[1];
+	cch[2] = &F2610->CH[2];
+	cch[3] = &F2610->CH[3];
+	cch[4] = &F2610->CH[4];
+	cch[5] = &F2610->CH[5];
+
+	/* refresh PG and EG */
+	refresh_fc_eg_chan( OPN, cch[0] );
+	refresh_fc_eg_chan( OPN, cch[1] );
+	if( (OPN->ST.mode & 0xc0) )
+	{
+		/* 3SLOT MODE */
+		if( cch[2]->SLOT[SLOT1].Incr==-1)
+		{
+			refresh_fc_eg_slot(OPN, &cch[2]->SLOT[SLOT1] , OPN->SL3.fc[1] , OPN->SL3.kcode[1] );
+			refresh_fc_eg_slot(OPN, &cch[2]->SLOT[SLOT2] , OPN->SL3.fc[2] , OPN->SL3.kcode[2] );
+			refresh_fc_eg_slot(OPN, &cch[2]->SLOT[SLOT3] , OPN->SL3.fc[0] , OPN->SL3.kcode[0] );
+			refresh_fc_eg_slot(OPN, &cch[2]->SLOT[SLOT4] , cch[2]->fc , cch[2]->kcode );
+		}
+	}
+	else
+		refresh_fc_eg_chan( OPN, cch[2] );
+	refresh_fc_eg_chan( OPN, cch[3] );
+	refresh_fc_eg_chan( OPN, cch[4] );
+	refresh_fc_eg_chan( OPN, cch[5] );
+
+	/* buffering */
+	for(i=0; i < length ; i++)
+	{
+
+		advance_lfo(OPN);
+
+		/* clear output acc. */
+		OPN->out_adpcm[OUTD_LEFT] = OPN->out_adpcm[OUTD_RIGHT] = OPN->out_adpcm[OUTD_CENTER] = 0;
+		OPN->out_delta[OUTD_LEFT] = OPN->out_delta[OUTD_RIGHT] = OPN->out_delta[OUTD_CENTER] = 0;
+		/* clear outputs */
+		out_fm[0] = 0;
+		out_fm[1] = 0;
+		out_fm[2] = 0;
+		out_fm[3] = 0;
+		out_fm[4] = 0;
+		out_fm[5] = 0;
+
+		/* advance envelope generator */
+		OPN->eg_timer += OPN->eg_timer_add;
+		while (OPN->eg_timer >= OPN->eg_timer_overflow)
+		{
+			OPN->eg_timer -= OPN->eg_timer_overflow;
+			OPN->eg_cnt++;
+
+			advance_eg_channel(OPN->eg_cnt, &cch[0]->SLOT[SLOT1]);
+			advance_eg_channel(OPN->eg_cnt, &cch[1]->SLOT[SLOT1]);
+			advance_eg_channel(OPN->eg_cnt, &cch[2]->SLOT[SLOT1]);
+			advance_eg_channel(OPN->eg_cnt, &cch[3]->SLOT[SLOT1]);
+			advance_eg_channel(OPN->eg_cnt, &cch[4]->SLOT[SLOT1]);
+			advance_eg_channel(OPN->eg_cnt, &cch[5]->SLOT[SLOT1]);
+		}
+
+		/* calculate FM */
+		chan_calc(OPN, cch[0], 0 );
+		chan_calc(OPN, cch[1], 1 );
+		chan_calc(OPN, cch[2], 2 );
+		chan_calc(OPN, cch[3], 3 );
+		chan_calc(OPN, cch[4], 4 );
+		chan_calc(OPN, cch[5], 5 );
+
+		/* deltaT ADPCM */
+		if( DELTAT->portstate&0x80 )
+			YM_DELTAT_ADPCM_CALC(DELTAT);
+
+		/* ADPCMA */
+		for( j = 0; j < 6; j++ )
+		{
+			if( F2610->adpcm[j].flag )
+				ADPCMA_calc_chan( F2610, &F2610->adpcm[j]);
+		}
+
+		/* buffering */
+		{
+			int lt,rt;
+
+			lt =  OPN->out_adpcm[OUTD_LEFT]  + OPN->out_adpcm[OUTD_CENTER];
+			rt =  OPN->out_adpcm[OUTD_RIGHT] + OPN->out_adpcm[OUTD_CENTER];
+			lt += (OPN->out_delta[OUTD_LEFT]  + OPN->out_delta[OUTD_CENTER])>>9;
+			rt += (OPN->out_delta[OUTD_RIGHT] + OPN->out_delta[OUTD_CENTER])>>9;
+
+			lt += ((out_fm[0]>>1) & OPN->pan[0]);	/* the shift right is verified on YM2610 */
+			rt += ((out_fm[0]>>1) & OPN->pan[1]);
+			lt += ((out_fm[1]>>1) & OPN->pan[2]);
+			rt += ((out_fm[1]>>1) & OPN->pan[3]);
+			lt += ((out_fm[2]>>1) & OPN->pan[4]);
+			rt += ((out_fm[2]>>1) & OPN->pan[5]);
+			lt += ((out_fm[3]>>1) & OPN->pan[6]);
+			rt += ((out_fm[3]>>1) & OPN->pan[7]);
+			lt += ((out_fm[4]>>1) & OPN->pan[8]);
+			rt += ((out_fm[4]>>1) & OPN->pan[9]);
+			lt += ((out_fm[5]>>1) & OPN->pan[10]);
+			rt += ((out_fm[5]>>1) & OPN->pan[11]);
+
+
+			lt >>= FINAL_SH;
+			rt >>= FINAL_SH;
+
+			Limit( lt, MAXOUT, MINOUT );
+			Limit( rt, MAXOUT, MINOUT );
+
+			/* buffering */
+			bufL[i] = lt;
+			bufR[i] = rt;
+		}
+
+		/* timer A control */
+		INTERNAL_TIMER_A( &OPN->ST , cch[2] )
+	}
+	INTERNAL_TIMER_B(&OPN->ST,length)
+
+}
+
+
+
+/***************************************************************************
+    CHIP LIST
+***************************************************************************/
+
+static void opn_bench_destroy(void *chip)
+{
+	osd_free(chip);
+}
+
+const fmbench_chip fmbench_opn_chips[] =
+{
+	{ "ym2203",  FMBENCH_OPN, 0x07, 0,                3579545, 3579545 / 72, 1, sizeof(FMSAMPLE), ym2203_bench_create, opn_bench_destroy, ym2203_bench_write, ym2203_bench_update,  ym2203_bench_reference },
+	{ "ym2608",  FMBENCH_OPN, 0x3f, FMBENCH_FLAG_LFO, 8000000, 8000000 / 144, 2, sizeof(FMSAMPLE), ym2608_bench_create, opn_bench_destroy, ym2608_bench_write, ym2608_bench_update,  ym2608_bench_reference },
+	{ "ym2610",  FMBENCH_OPN, 0x36, FMBENCH_FLAG_LFO, 8000000, 8000000 / 144, 2, sizeof(FMSAMPLE), ym2610_bench_create, opn_bench_destroy, ym2610_bench_write, ym2610_bench_update,  ym2610_bench_reference },
+	{ "ym2610b", FMBENCH_OPN, 0x3f, FMBENCH_FLAG_LFO, 8000000, 8000000 / 144, 2, sizeof(FMSAMPLE), ym2610_bench_create, opn_bench_destroy, ym2610_bench_write, ym2610b_bench_update, ym2610b_bench_reference },
+	{ NULL }
+};
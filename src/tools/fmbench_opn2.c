@@ -0,0 +1,254 @@
+/***************************************************************************
+
+    fmbench_opn2.c
+
+    FM sound core benchmark: YM2612.
+
+****************************************************************************
+
+    Copyright Aaron Giles
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are
+    met:
+
+        * Redistributions of source code must retain the above copyright
+          notice, this list of conditions and the following disclaimer.
+        * Redistributions in binary form must reproduce the above copyright
+          notice, this list of conditions and the following disclaimer in
+          the documentation and/or other materials provided with the
+          distribution.
+        * Neither the name 'MAME' nor the names of its contributors may be
+          used to endorse or promote products derived from this software
+          without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY AARON GILES ''AS IS'' AND ANY EXPRESS OR
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL AARON GILES BE LIABLE FOR ANY DIRECT,
+    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+    HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+    STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+    IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+    POSSIBILITY OF SUCH DAMAGE.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "fmbench.h"
+
+/* the core is built into this file so the tool can reach its internals */
+#include "sound/fm2612.c"
+
+
+
+/***************************************************************************
+    YM2612
+***************************************************************************/
+
+static void *ym2612_bench_create(int clock, int rate)
+{
+	YM2612 *F2612 = (YM2612 *)osd_malloc(sizeof(*F2612));
+
+	/* what ym2612_init sets up, minus the device */
+	memset(F2612, 0, sizeof(*F2612));
+	init_tables();
+	F2612->OPN.type = TYPE_YM2612;
+	F2612->OPN.P_CH = F2612->CH;
+	F2612->OPN.ST.clock = clock;
+	F2612->OPN.ST.rate = rate;
+
+	ym2612_reset_chip(F2612);
+	return F2612;
+}
+
+static void ym2612_bench_destroy(void *chip)
+{
+	osd_free(chip);
+}
+
+
+/*-------------------------------------------------
+    ym2612_bench_write - write a register the way
+    ym2612_write does, bypassing the busy flag and
+    the stream update
+-------------------------------------------------*/
+
+static void ym2612_bench_write(void *chip, int reg, int data)
+{
+	YM2612 *F2612 = (YM2612 *)chip;
+
+	if (reg == 0x2a)
+		F2612->dacout = ((int)data - 0x80) << 6;
+	else if (reg == 0x2b)
+		F2612->dacen = data & 0x80;
+	else if (reg < 0x30)
+		OPNWriteMode(&F2612->OPN, reg, data);
+	else
+		OPNWriteReg(&F2612->OPN, reg, data);
+}
+
+
+static void ym2612_bench_update(void *chip, void **buffers, int length)
+{
+	ym2612_update_one(chip, (FMSAMPLE **)buffers, length);
+}
+
+
+/*-------------------------------------------------
+    ym2612_bench_reference - the YM2612 update
+    loop before block rendering
+-------------------------------------------------*/
+
+static void ym2612_bench_reference(void *chip, void **buffer, int length)
+{
+	YM2612 *F2612 = (YM2612 *)chip;
+	FM_OPN *OPN   = &F2612->OPN;
+	INT32 *out_fm = OPN->out_fm;
+	int i;
+	FMSAMPLE  *bufL,*bufR;
+	FM_CH	*cch[6];
+	int lt,rt;
+
+	/* set bufer */
+	bufL = (FMSAMPLE *)buffer[0];
+	bufR = (FMSAMPLE *)buffer[1];
+
+	cch[0]   = &F2612->CH[0];
+	cch[1]   = &F2612->CH[1];
+	cch[2]   = &F2612->CH[2];
+	cch[3]   = &F2612->CH[3];
+	cch[4]   = &F2612->CH[4];
+	cch[5]   = &F2612->CH[5];
+
+	/* refresh PG and EG */
+	refresh_fc_eg_chan( OPN, cch[0] );
+	refresh_fc_eg_chan( OPN, cch[1] );
+	if( (OPN->ST.mode & 0xc0) )
+	{
+		/* 3SLOT MODE */
+		if( cch[2]->SLOT[SLOT1].Incr==-1)
+		{
+			refresh_fc_eg_slot(OPN, &cch[2]->SLOT[SLOT1] , OPN->SL3.fc[1] , OPN->SL3.kcode[1] );
+			refresh_fc_eg_slot(OPN, &cch[2]->SLOT[SLOT2] , OPN->SL3.fc[2] , OPN->SL3.kcode[2] );
+			refresh_fc_eg_slot(OPN, &cch[2]->SLOT[SLOT3] , OPN->SL3.fc[0] , OPN->SL3.kcode[0] );
+			refresh_fc_eg_slot(OPN, &cch[2]->SLOT[SLOT4] , cch[2]->fc , cch[2]->kcode );
+		}
+	}else refresh_fc_eg_chan( OPN, cch[2] );
+	refresh_fc_eg_chan( OPN, cch[3] );
+	refresh_fc_eg_chan( OPN, cch[4] );
+	refresh_fc_eg_chan( OPN, cch[5] );
+
+	/* buffering */
+	for(i=0; i < length ; i++)
+	{
+		/* clear outputs */
+		out_fm[0] = 0;
+		out_fm[1] = 0;
+		out_fm[2] = 0;
+		out_fm[3] = 0;
+		out_fm[4] = 0;
+		out_fm[5] = 0;
+
+		/* update SSG-EG output */
+		update_ssg_eg_channel(&cch[0]->SLOT[SLOT1]);
+		update_ssg_eg_channel(&cch[1]->SLOT[SLOT1]);
+		update_ssg_eg_channel(&cch[2]->SLOT[SLOT1]);
+		update_ssg_eg_channel(&cch[3]->SLOT[SLOT1]);
+		update_ssg_eg_channel(&cch[4]->SLOT[SLOT1]);
+		update_ssg_eg_channel(&cch[5]->SLOT[SLOT1]);
+
+		/* calculate FM */
+		chan_calc(F2612, OPN, cch[0]);
+		chan_calc(F2612, OPN, cch[1]);
+		chan_calc(F2612, OPN, cch[2]);
+		chan_calc(F2612, OPN, cch[3]);
+		chan_calc(F2612, OPN, cch[4]);
+		if( F2612->dacen )
+			*cch[5]->connect4 += F2612->dacout;
+		else
+			chan_calc(F2612, OPN, cch[5]);
+
+		/* advance LFO */
+		advance_lfo(OPN);
+
+		/* advance envelope generator */
+		OPN->eg_timer += OPN->eg_timer_add;
+		while (OPN->eg_timer >= OPN->eg_timer_overflow)
+		{
+			OPN->eg_timer -= OPN->eg_timer_overflow;
+			OPN->eg_cnt++;
+
+			advance_eg_channel(OPN->eg_cnt, &cch[0]->SLOT[SLOT1]);
+			advance_eg_channel(OPN->eg_cnt, &cch[1]->SLOT[SLOT1]);
+			advance_eg_channel(OPN->eg_cnt, &cch[2]->SLOT[SLOT1]);
+			advance_eg_channel(OPN->eg_cnt, &cch[3]->SLOT[SLOT1]);
+			advance_eg_channel(OPN->eg_cnt, &cch[4]->SLOT[SLOT1]);
+			advance_eg_channel(OPN->eg_cnt, &cch[5]->SLOT[SLOT1]);
+		}
+
+		if (out_fm[0] > 8191) out_fm[0] = 8191;
+		else if (out_fm[0] < -8192) out_fm[0] = -8192;
+		if (out_fm[1] > 8191) out_fm[1] = 8191;
+		else if (out_fm[1] < -8192) out_fm[1] = -8192;
+		if (out_fm[2] > 8191) out_fm[2] = 8191;
+		else if (out_fm[2] < -8192) out_fm[2] = -8192;
+		if (out_fm[3] > 8191) out_fm[3] = 8191;
+		else if (out_fm[3] < -8192) out_fm[3] = -8192;
+		if (out_fm[4] > 8191) out_fm[4] = 8191;
+		else if (out_fm[4] < -8192) out_fm[4] = -8192;
+		if (out_fm[5] > 8191) out_fm[5] = 8191;
+		else if (out_fm[5] < -8192) out_fm[5] = -8192;
+
+		/* 6-channels mixing  */
+		lt  = ((out_fm[0]>>0) & OPN->pan[0]);
+		rt  = ((out_fm[0]>>0) & OPN->pan[1]);
+		lt += ((out_fm[1]>>0) & OPN->pan[2]);
+		rt += ((out_fm[1]>>0) & OPN->pan[3]);
+		lt += ((out_fm[2]>>0) & OPN->pan[4]);
+		rt += ((out_fm[2]>>0) & OPN->pan[5]);
+		lt += ((out_fm[3]>>0) & OPN->pan[6]);
+		rt += ((out_fm[3]>>0) & OPN->pan[7]);
+		lt += ((out_fm[4]>>0) & OPN->pan[8]);
+		rt += ((out_fm[4]>>0) & OPN->pan[9]);
+		lt += ((out_fm[5]>>0) & OPN->pan[10]);
+		rt += ((out_fm[5]>>0) & OPN->pan[11]);
+
+		/* buffering */
+		bufL[i] = lt;
+		bufR[i] = rt;
+
+		/* CSM mode: if CSM Key ON has occurred, CSM Key OFF need to be sent       */
+		/* only if Timer A does not overflow again (i.e CSM Key ON not set again) */
+		OPN->SL3.key_csm <<= 1;
+
+		/* timer A control */
+		INTERNAL_TIMER_A( &OPN->ST , cch[2] )
+
+		/* CSM Mode Key ON still disabled */
+		/* CSM Mode Key OFF (verified by Nemesis on real hardware) */
+		FM_KEYOFF_CSM(cch[2],SLOT1);
+		FM_KEYOFF_CSM(cch[2],SLOT2);
+		FM_KEYOFF_CSM(cch[2],SLOT3);
+		FM_KEYOFF_CSM(cch[2],SLOT4);
+		OPN->SL3.key_csm = 0;
+	}
+
+	/* timer B control */
+	INTERNAL_TIMER_B(&OPN->ST,length)
+}
+
+
+
+/***************************************************************************
+    CHIP LIST
+***************************************************************************/
+
+const fmbench_chip fmbench_opn2_chips[] =
+{
+	{ "ym2612", FMBENCH_OPN, 0x3f, FMBENCH_FLAG_LFO | FMBENCH_FLAG_DAC, 7670453, 7670453 / 144, 2, sizeof(FMSAMPLE), ym2612_bench_create, ym2612_bench_destroy, ym2612_bench_write, ym2612_bench_update, ym2612_bench_reference },
+	{ NULL }
+};
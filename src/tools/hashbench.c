@@ -0,0 +1,197 @@
+/***************************************************************************
+
+    hashbench.c
+
+    CRC-32 and SHA-1 throughput benchmark.
+
+****************************************************************************
+
+    Copyright Aaron Giles
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are
+    met:
+
+        * Redistributions of source code must retain the above copyright
+          notice, this list of conditions and the following disclaimer.
+        * Redistributions in binary form must reproduce the above copyright
+          notice, this list of conditions and the following disclaimer in
+          the documentation and/or other materials provided with the
+          distribution.
+        * Neither the name 'MAME' nor the names of its contributors may be
+          used to endorse or promote products derived from this software
+          without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY AARON GILES ''AS IS'' AND ANY EXPRESS OR
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL AARON GILES BE LIABLE FOR ANY DIRECT,
+    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+    HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+    STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+    IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+    POSSIBILITY OF SUCH DAMAGE.
+
+****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "osdcore.h"
+#include "corefile.h"
+#include "hashing.h"
+#include "chd.h"
+
+#define CHUNK_SIZE				(1024 * 1024)
+
+
+
+/***************************************************************************
+    TYPE DEFINITIONS
+***************************************************************************/
+
+struct bench_results
+{
+	UINT64			bytes;				// total bytes hashed
+	osd_ticks_t		crc_ticks;			// ticks spent computing CRC-32
+	osd_ticks_t		sha1_ticks;			// ticks spent computing SHA-1
+};
+
+
+
+/***************************************************************************
+    CORE IMPLEMENTATION
+***************************************************************************/
+
+/*-------------------------------------------------
+    hash_chunk - hash a single chunk of data,
+    timing CRC-32 and SHA-1 separately
+-------------------------------------------------*/
+
+static void hash_chunk(bench_results &results, crc32_creator &crc, sha1_creator &sha1, const UINT8 *data, UINT32 length)
+{
+	osd_ticks_t start = osd_ticks();
+	crc.append(data, length);
+	osd_ticks_t mid = osd_ticks();
+	sha1.append(data, length);
+	osd_ticks_t end = osd_ticks();
+
+	results.crc_ticks += mid - start;
+	results.sha1_ticks += end - mid;
+	results.bytes += length;
+}
+
+
+/*-------------------------------------------------
+    bench_chd - hash the decompressed contents
+    of a CHD, one hunk at a time
+-------------------------------------------------*/
+
+static bool bench_chd(const char *filename, bench_results &results, crc32_creator &crc, sha1_creator &sha1)
+{
+	chd_file chd;
+	if (chd.open(filename) != CHDERR_NONE)
+		return false;
+
+	dynamic_buffer buffer(chd.hunk_bytes());
+	UINT64 remaining = chd.logical_bytes();
+	for (UINT32 hunknum = 0; hunknum < chd.hunk_count() && remaining > 0; hunknum++)
+	{
+		chd_error err = chd.read_hunk(hunknum, buffer);
+		if (err != CHDERR_NONE)
+		{
+			fprintf(stderr, "%s: error reading hunk %d: %s\n", filename, hunknum, chd_file::error_string(err));
+			break;
+		}
+		UINT32 length = (remaining < chd.hunk_bytes()) ? remaining : chd.hunk_bytes();
+		hash_chunk(results, crc, sha1, buffer, length);
+		remaining -= length;
+	}
+	return true;
+}
+
+
+/*-------------------------------------------------
+    bench_raw - hash the raw contents of a file
+-------------------------------------------------*/
+
+static bool bench_raw(const char *filename, bench_results &results, crc32_creator &crc, sha1_creator &sha1)
+{
+	core_file *file;
+	if (core_fopen(filename, OPEN_FLAG_READ, &file) != FILERR_NONE)
+		return false;
+
+	dynamic_buffer buffer(CHUNK_SIZE);
+	UINT32 length;
+	while ((length = core_fread(file, buffer, CHUNK_SIZE)) != 0)
+		hash_chunk(results, crc, sha1, buffer, length);
+
+	core_fclose(file);
+	return true;
+}
+
+
+/*-------------------------------------------------
+    report - print throughput for a set of results
+-------------------------------------------------*/
+
+static void report(const char *name, const bench_results &results)
+{
+	double mb = (double)results.bytes / (1024.0 * 1024.0);
+	double tps = (double)osd_ticks_per_second();
+
+	printf("%-40s %10.1f MB  CRC-32 %8.1f MB/s  SHA-1 %8.1f MB/s\n", name, mb,
+			(results.crc_ticks != 0) ? mb * tps / (double)results.crc_ticks : 0.0,
+			(results.sha1_ticks != 0) ? mb * tps / (double)results.sha1_ticks : 0.0);
+}
+
+
+/*-------------------------------------------------
+    main - main entry point
+-------------------------------------------------*/
+
+int main(int argc, char *argv[])
+{
+	bench_results total = { 0 };
+	int result = 0;
+
+	// needs at least one file
+	if (argc < 2)
+	{
+		fprintf(stderr, "Usage:\n  hashbench <file.chd|file> [...]\n\n");
+		fprintf(stderr, "Hashes each file (CHDs are hashed as decompressed data) and reports CRC-32 and SHA-1 throughput\n");
+		return 1;
+	}
+
+	printf("SHA-1 implementation: %s\n", sha1_accelerated() ? "SHA extensions" : "portable C");
+
+	for (int argnum = 1; argnum < argc; argnum++)
+	{
+		bench_results results = { 0 };
+		crc32_creator crc;
+		sha1_creator sha1;
+
+		// try as a CHD first, then fall back to raw data
+		if (!bench_chd(argv[argnum], results, crc, sha1) && !bench_raw(argv[argnum], results, crc, sha1))
+		{
+			fprintf(stderr, "%s: unable to open file\n", argv[argnum]);
+			result = 1;
+			continue;
+		}
+
+		astring crcstr, sha1str;
+		printf("%s: crc=%s sha1=%s\n", argv[argnum], crc.finish().as_string(crcstr), sha1.finish().as_string(sha1str));
+		report(argv[argnum], results);
+
+		total.bytes += results.bytes;
+		total.crc_ticks += results.crc_ticks;
+		total.sha1_ticks += results.sha1_ticks;
+	}
+
+	if (argc > 2)
+		report("total", total);
+	return result;
+}
@@ -61,6 +61,9 @@ TOOLS += \
 	srcclean$(EXE) \
 	src2html$(EXE) \
 	split$(EXE) \
+	hashbench$(EXE) \
+	fmbench$(EXE) \
+	dspbench$(EXE) \
 
 
 
@@ -192,3 +195,55 @@ SPLITOBJS = \
 split$(EXE): $(SPLITOBJS) $(LIBUTIL) $(LIBOCORE) $(ZLIB) $(EXPAT)
 	@echo Linking $@...
 	$(LD) $(LDFLAGS) $^ $(LIBS) -o $@
+
+
+
+#-------------------------------------------------
+# hashbench
+#-------------------------------------------------
+
+HASHBENCHOBJS = \
+	$(TOOLSOBJ)/hashbench.o \
+
+hashbench$(EXE): $(HASHBENCHOBJS) $(LIBUTIL) $(ZLIB) $(EXPAT) $(FLAC_LIB) $(7Z_LIB) $(LIBOCORE)
+	@echo Linking $@...
+	$(LD) $(LDFLAGS) $^ $(LIBS) $(FLAC_LIB) -o $@
+
+
+
+#-------------------------------------------------
+# fmbench
+#-------------------------------------------------
+
+FMBENCHOBJS = \
+	$(TOOLSOBJ)/fmbench.o \
+	$(TOOLSOBJ)/fmbench_opn.o \
+	$(TOOLSOBJ)/fmbench_opn2.o \
+	$(TOOLSOBJ)/fmbench_opm.o \
+	$(EMUOBJ)/emualloc.o \
+	$(EMUOBJ)/attotime.o \
+
+fmbench$(EXE): $(FMBENCHOBJS) $(LIBUTIL) $(ZLIB) $(EXPAT) $(LIBOCORE)
+	@echo Linking $@...
+	$(LD) $(LDFLAGS) $^ $(LIBS) -o $@
+
+
+
+#-------------------------------------------------
+# dspbench
+#-------------------------------------------------
+
+DSPBENCHOBJS = \
+	$(TOOLSOBJ)/dspbench.o \
+	$(TOOLSOBJ)/dspbench_scsp.o \
+	$(TOOLSOBJ)/dspbench_aica.o \
+	$(EMUOBJ)/emualloc.o \
+	$(EMUOBJ)/attotime.o \
+
+# the DSP cores are built into the tool, so rebuild it when they change
+$(TOOLSOBJ)/dspbench_scsp.o: $(SRC)/emu/sound/scspdsp.c $(SRC)/emu/sound/scspdsp.h
+$(TOOLSOBJ)/dspbench_aica.o: $(SRC)/emu/sound/aicadsp.c $(SRC)/emu/sound/aicadsp.h
+
+dspbench$(EXE): $(DSPBENCHOBJS) $(LIBUTIL) $(ZLIB) $(EXPAT) $(LIBOCORE)
+	@echo Linking $@...
+	$(LD) $(LDFLAGS) $^ $(LIBS) -o $@
@@ -39,3 +39,5 @@
 
 extern const char build_version[];
 const char build_version[] = "0.146u5 ("__DATE__")";
+extern const char build_id[];
+const char build_id[] = __DATE__ " " __TIME__;